@@ -0,0 +1,106 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utility>
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/num/bounded.h"
+#include "sus/prelude.h"
+
+namespace {
+
+using sus::num::Bounded;
+using Byte = Bounded<u8, 0, 255>;
+
+constexpr size_t kRecordLen = 16u;
+constexpr size_t kRecords = 1024u;
+constexpr size_t kLen = kRecordLen * kRecords;
+
+sus::Vec<u8> random_bytes() {
+  auto v = sus::Vec<u8>::with_capacity(kLen);
+  uint64_t state = 0x853c49e6748fea9bu;
+  for (size_t i = 0u; i < kLen; ++i) {
+    state = state * 6364136223846793005u + 1442695040888963407u;
+    v.push(u8(static_cast<uint8_t>(state >> 56u)));
+  }
+  return v;
+}
+
+// Sums the bytes of a record. Each `+` widens the range of the result, which
+// stays within `u16` so there are no overflow checks.
+template <size_t... Is>
+u16 sum_record(const Byte* p, std::index_sequence<Is...>) noexcept {
+  return (p[Is] + ...);
+}
+
+// A 16-bit checksum of each fixed-size record in a buffer, such as of packets.
+TEST(BenchBounded, Checksum) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+
+  const sus::Vec<u8> bytes = random_bytes();
+  auto bounded = sus::Vec<Byte>::with_capacity(kLen);
+  for (u8 v : bytes) bounded.push(Byte(v));
+  auto out = sus::Vec<u16>::with_capacity(kRecords);
+  for (size_t i = 0u; i < kRecords; ++i) out.push(0_u16);
+
+  const u8* in = bytes.as_ptr();
+  const Byte* bin = bounded.as_ptr();
+  u16* o = out.as_mut_ptr();
+
+  b.run("u16 checksum", [&]() {
+    for (size_t r = 0u; r < kRecords; ++r) {
+      auto sum = 0_u16;
+      for (size_t i = 0u; i < kRecordLen; ++i) sum += in[r * kRecordLen + i];
+      o[r] = sum;
+    }
+    ankerl::nanobench::doNotOptimizeAway(o[kRecords / 2u]);
+  });
+  b.run("Bounded checksum", [&]() {
+    for (size_t r = 0u; r < kRecords; ++r) {
+      o[r] = sum_record(bin + r * kRecordLen,
+                        std::make_index_sequence<kRecordLen>());
+    }
+    ankerl::nanobench::doNotOptimizeAway(o[kRecords / 2u]);
+  });
+}
+
+// Counts the occurrences of each value, where the values were stored to
+// memory so the optimizer can't see their range.
+TEST(BenchBounded, Histogram) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+
+  const sus::Vec<u8> bytes = random_bytes();
+  auto values = sus::Vec<u32>::with_capacity(kLen);
+  auto bounded = sus::Vec<Bounded<u32, 0, 255>>::with_capacity(kLen);
+  for (u8 v : bytes) {
+    values.push(u32::from(v));
+    bounded.push(Bounded<u32, 0, 255>(u32::from(v)));
+  }
+  auto counts = sus::Array<u32, 256>();
+
+  const u32* in = values.as_ptr();
+  const Bounded<u32, 0, 255>* bin = bounded.as_ptr();
+
+  b.run("u32 index histogram", [&]() {
+    for (size_t i = 0u; i < kLen; ++i) counts[in[i]] += 1u;
+    ankerl::nanobench::doNotOptimizeAway(counts[128u]);
+  });
+  b.run("Bounded index histogram", [&]() {
+    for (size_t i = 0u; i < kLen; ++i) counts[bin[i]] += 1u;
+    ankerl::nanobench::doNotOptimizeAway(counts[128u]);
+  });
+}
+
+}  // namespace
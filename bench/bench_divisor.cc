@@ -0,0 +1,86 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/num/divisor.h"
+#include "sus/prelude.h"
+
+namespace {
+
+constexpr size_t kLen = 4096u;
+
+// Divides a buffer of pseudo-random integers by a divisor that is only known
+// at runtime, as when choosing a hash table bucket.
+template <class T>
+void divide(ankerl::nanobench::Bench& b, std::string_view name, T divisor) {
+  using P = decltype(T::primitive_value);
+  auto values = sus::Vec<T>::with_capacity(kLen);
+  uint64_t state = 0x853c49e6748fea9bu;
+  for (size_t i = 0u; i < kLen; ++i) {
+    state = state * 6364136223846793005u + 1442695040888963407u;
+    values.push(T(static_cast<P>(state >> 7u)));
+  }
+  auto out = sus::Vec<T>::with_capacity(kLen);
+  for (size_t i = 0u; i < kLen; ++i) out.push(T());
+
+  const T* in = values.as_ptr();
+  T* o = out.as_mut_ptr();
+
+  // Hide the divisor from the optimizer so it can't precompute it either.
+  ankerl::nanobench::doNotOptimizeAway(divisor);
+  const auto d = sus::num::Divisor<T>(divisor);
+
+  b.run(fmt::format("{} native /", name), [&]() {
+    for (size_t i = 0u; i < kLen; ++i) o[i] = in[i] / divisor;
+    ankerl::nanobench::doNotOptimizeAway(o[kLen / 2u]);
+  });
+  b.run(fmt::format("{} Divisor /", name), [&]() {
+    for (size_t i = 0u; i < kLen; ++i) o[i] = in[i] / d;
+    ankerl::nanobench::doNotOptimizeAway(o[kLen / 2u]);
+  });
+  b.run(fmt::format("{} native %", name), [&]() {
+    for (size_t i = 0u; i < kLen; ++i) o[i] = in[i] % divisor;
+    ankerl::nanobench::doNotOptimizeAway(o[kLen / 2u]);
+  });
+  b.run(fmt::format("{} Divisor %", name), [&]() {
+    for (size_t i = 0u; i < kLen; ++i) o[i] = in[i] % d;
+    ankerl::nanobench::doNotOptimizeAway(o[kLen / 2u]);
+  });
+  b.run(fmt::format("{} Divisor div_slice", name), [&]() {
+    for (size_t i = 0u; i < kLen; ++i) o[i] = in[i];
+    d.div_slice(out);
+    ankerl::nanobench::doNotOptimizeAway(o[kLen / 2u]);
+  });
+}
+
+}  // namespace
+
+TEST(BenchDivisor, u32) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  divide<u32>(b, "u32 by 7", 7u);
+  divide<u32>(b, "u32 by 1000", 1000u);
+}
+
+TEST(BenchDivisor, u64) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  divide<u64>(b, "u64 by 7", 7u);
+  divide<u64>(b, "u64 by 1000", 1000u);
+}
+
+TEST(BenchDivisor, i64) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  divide<i64>(b, "i64 by 7", 7);
+  divide<i64>(b, "i64 by -1000", -1000);
+}
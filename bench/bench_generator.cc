@@ -0,0 +1,139 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/iter/generator.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+
+using sus::iter::Generator;
+
+namespace {
+
+struct Node {
+  u32 value;
+  Node* left;
+  Node* right;
+};
+
+// Builds a balanced binary search tree over `[lo, hi)` from `nodes`.
+Node* build(sus::Vec<Node>& nodes, u32 lo, u32 hi) {
+  if (lo == hi) return nullptr;
+  u32 mid = lo + (hi - lo) / 2u;
+  Node* n = &nodes[usize::from(mid)];
+  n->value = mid;
+  n->left = build(nodes, lo, mid);
+  n->right = build(nodes, mid + 1u, hi);
+  return n;
+}
+
+// Re-yields every item of each subtree, which resumes every generator between
+// the leaf and the root for each item.
+Generator<u32> walk_loop(const Node& n) {
+  if (n.left)
+    for (u32 v : walk_loop(*n.left)) co_yield v;
+  co_yield n.value;
+  if (n.right)
+    for (u32 v : walk_loop(*n.right)) co_yield v;
+}
+
+Generator<u32> walk_elements_of(const Node& n) {
+  if (n.left) co_yield sus::iter::elements_of(walk_elements_of(*n.left));
+  co_yield n.value;
+  if (n.right) co_yield sus::iter::elements_of(walk_elements_of(*n.right));
+}
+
+Generator<u32> walk_free_list(std::allocator_arg_t,
+                              sus::iter::GeneratorFrameFreeList& frames,
+                              const Node& n) {
+  if (n.left)
+    co_yield sus::iter::elements_of(
+        walk_free_list(std::allocator_arg, frames, *n.left));
+  co_yield n.value;
+  if (n.right)
+    co_yield sus::iter::elements_of(
+        walk_free_list(std::allocator_arg, frames, *n.right));
+}
+
+// An in-order iterator written by hand with an explicit stack.
+class StackWalk final : public sus::iter::IteratorBase<StackWalk, u32> {
+ public:
+  using Item = u32;
+
+  explicit StackWalk(const Node* root) noexcept { push_left(root); }
+
+  sus::Option<u32> next() noexcept {
+    if (stack_.is_empty()) return sus::none();
+    const Node* n = stack_.pop().unwrap();
+    push_left(n->right);
+    return sus::some(n->value);
+  }
+  sus::iter::SizeHint size_hint() const noexcept {
+    return sus::iter::SizeHint(stack_.len(), sus::none());
+  }
+
+ private:
+  void push_left(const Node* n) noexcept {
+    for (; n != nullptr; n = n->left) stack_.push(n);
+  }
+
+  sus::Vec<const Node*> stack_;
+};
+
+void traverse(ankerl::nanobench::Bench& b, u32 count) {
+  auto nodes = sus::Vec<Node>::with_capacity(usize::from(count));
+  for (u32 i; i < count; i += 1u) nodes.push(Node(i, nullptr, nullptr));
+  const Node& root = *build(nodes, 0u, count);
+  const u64 expected = u64::from(count) * u64::from(count - 1u) / 2u;
+
+  auto sum = [](sus::iter::Iterator<u32> auto&& it) {
+    return sus::move(it).fold(
+        0_u64, [](u64 acc, u32 v) { return acc + u64::from(v); });
+  };
+
+  b.run(fmt::format("hand-written stack iterator, n = {}", count), [&]() {
+    u64 s = sum(StackWalk(&root));
+    EXPECT_EQ(s, expected);
+    return s;
+  });
+  b.run(fmt::format("generator re-yield loop, n = {}", count), [&]() {
+    u64 s = sum(walk_loop(root));
+    EXPECT_EQ(s, expected);
+    return s;
+  });
+  b.run(fmt::format("generator elements_of, n = {}", count), [&]() {
+    u64 s = sum(walk_elements_of(root));
+    EXPECT_EQ(s, expected);
+    return s;
+  });
+  auto frames = sus::iter::GeneratorFrameFreeList();
+  b.run(fmt::format("generator elements_of + free list, n = {}", count),
+        [&]() {
+          u64 s = sum(walk_free_list(std::allocator_arg, frames, root));
+          EXPECT_EQ(s, expected);
+          return s;
+        });
+}
+
+}  // namespace
+
+TEST(BenchGenerator, TreeWalk_1023) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  traverse(b, 1023u);
+}
+TEST(BenchGenerator, TreeWalk_1_048_575) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  traverse(b, 1'048'575u);
+}
@@ -0,0 +1,75 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bit>
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/num/half_float.h"
+#include "sus/prelude.h"
+
+namespace {
+
+using sus::num::bf16;
+using sus::num::f16;
+
+constexpr size_t kLen = 64u * 1024u;
+
+sus::Vec<f32> random_values() {
+  auto v = sus::Vec<f32>::with_capacity(kLen);
+  uint32_t state = 1u;
+  for (size_t i = 0u; i < kLen; ++i) {
+    state = state * 1664525u + 1013904223u;
+    v.push(f32(static_cast<float>(state >> 8u) * 0x1p-16f - 128.f));
+  }
+  return v;
+}
+
+template <class H>
+sus::Vec<H> zeros() {
+  auto v = sus::Vec<H>::with_capacity(kLen);
+  for (size_t i = 0u; i < kLen; ++i) v.push(H());
+  return v;
+}
+
+// Converting an array of 64K floats to half precision and back. The bulk
+// conversion uses F16C or NEON where the target has them (build with
+// `-mf16c` or `-march=native` to see it), while the element-wise loop uses
+// the scalar software conversion. With F16C the slice conversion is around
+// 40 times faster.
+TEST(BenchHalfFloat, F16Convert) {
+  const auto src = random_values();
+  auto halves = zeros<f16>();
+  auto back = sus::Vec<f32>::with_capacity(kLen);
+  for (size_t i = 0u; i < kLen; ++i) back.push(0_f32);
+
+  auto b = ankerl::nanobench::Bench().relative(true).batch(kLen);
+  b.run("f16 element-wise", [&]() {
+    for (usize i; i < kLen; i += 1u) halves[i] = f16(src[i]);
+    for (usize i; i < kLen; i += 1u) back[i] = halves[i].to_f32();
+    ankerl::nanobench::doNotOptimizeAway(back.as_ptr());
+  });
+  b.run("f16 slice", [&]() {
+    f16::from_f32_slice(src.as_slice(), halves.as_mut_slice());
+    f16::to_f32_slice(halves.as_slice(), back.as_mut_slice());
+    ankerl::nanobench::doNotOptimizeAway(back.as_ptr());
+  });
+  b.run("bf16 slice", [&, bhalves = zeros<bf16>()]() mutable {
+    bf16::from_f32_slice(src.as_slice(), bhalves.as_mut_slice());
+    bf16::to_f32_slice(bhalves.as_slice(), back.as_mut_slice());
+    ankerl::nanobench::doNotOptimizeAway(back.as_ptr());
+  });
+}
+
+}  // namespace
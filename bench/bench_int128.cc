@@ -0,0 +1,126 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/prelude.h"
+#include "sus/tuple/tuple.h"
+
+#if defined(__SIZEOF_INT128__)
+
+namespace {
+
+constexpr size_t kLen = 16u * 1024u;
+
+sus::Vec<u64> random_values(uint64_t seed) {
+  auto v = sus::Vec<u64>::with_capacity(kLen);
+  uint64_t state = seed;
+  for (size_t i = 0u; i < kLen; ++i) {
+    state = state * 6364136223846793005u + 1442695040888963407u;
+    v.push(state);
+  }
+  return v;
+}
+
+/// A 128-bit value held as two 64-bit halves, as code without a 128-bit type
+/// has to do.
+struct Emulated {
+  u64 lo;
+  u64 hi;
+
+  void add(u64 plo, u64 phi) {
+    const auto [sum, carry] = lo.overflowing_add(plo);
+    lo = sum;
+    hi = hi.wrapping_add(phi).wrapping_add(u64::from(carry));
+  }
+};
+
+/// The high half of a 64x64 multiply without any compiler support, by
+/// multiplying 32-bit halves.
+u64 mul_high_portable(u64 x, u64 y) {
+  const u64 xlo = x & 0xffffffffu, xhi = x >> 32u;
+  const u64 ylo = y & 0xffffffffu, yhi = y >> 32u;
+  const u64 lolo = xlo * ylo;
+  const u64 hilo = xhi * ylo;
+  const u64 lohi = xlo * yhi;
+  const u64 mid = (lolo >> 32u) + (hilo & 0xffffffffu) + lohi;
+  return xhi * yhi + (hilo >> 32u) + (mid >> 32u);
+}
+
+// A dot product of 64-bit values into a 128-bit accumulator, as used for
+// fixed-point sums. The u128 type should match the raw `__uint128_t` loop,
+// which is a `mul` and an `add`/`adc` pair per element.
+TEST(BenchInt128, MultiplyAccumulate) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+
+  const sus::Vec<u64> xs = random_values(0x853c49e6748fea9bu);
+  const sus::Vec<u64> ys = random_values(0xda3e39cb94b95bdbu);
+
+  b.run("u128", [&]() {
+    auto acc = 0_u128;
+    for (usize i; i < kLen; i += 1u)
+      acc = acc.wrapping_add(u128::from(xs[i]) * u128::from(ys[i]));
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run("__uint128_t", [&]() {
+    __uint128_t acc = 0u;
+    for (usize i; i < kLen; i += 1u)
+      acc += __uint128_t{xs[i].primitive_value} * ys[i].primitive_value;
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run("u64::widening_mul + carry", [&]() {
+    auto acc = Emulated(0u, 0u);
+    for (usize i; i < kLen; i += 1u) {
+      const auto [lo, hi] = xs[i].widening_mul(ys[i]);
+      acc.add(lo, hi);
+    }
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run("32-bit halves + carry", [&]() {
+    auto acc = Emulated(0u, 0u);
+    for (usize i; i < kLen; i += 1u) {
+      acc.add(xs[i].wrapping_mul(ys[i]), mul_high_portable(xs[i], ys[i]));
+    }
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+}
+
+// Overflow-checked 128-bit addition, which uses the carry flag through the
+// compiler builtins, against checking the halves by hand.
+TEST(BenchInt128, CheckedAdd) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+
+  const sus::Vec<u64> xs = random_values(0x853c49e6748fea9bu);
+
+  b.run("u128::checked_add", [&]() {
+    auto acc = 0_u128;
+    for (u64 x : xs) acc = acc.checked_add(u128::from(x) << 32u).unwrap();
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run("emulated checked add", [&]() {
+    auto lo = 0_u64, hi = 0_u64;
+    for (u64 x : xs) {
+      const auto [sum, carry] = lo.overflowing_add(x << 32u);
+      lo = sum;
+      hi = hi.checked_add(x >> 32u).unwrap().checked_add(u64::from(carry))
+               .unwrap();
+    }
+    ankerl::nanobench::doNotOptimizeAway(lo);
+    ankerl::nanobench::doNotOptimizeAway(hi);
+  });
+}
+
+}  // namespace
+
+#endif
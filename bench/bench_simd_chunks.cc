@@ -17,6 +17,7 @@
 #include "sus/iter/iterator.h"
 #include "sus/iter/zip.h"
 #include "sus/prelude.h"
+#include "sus/simd/simd.h"
 
 using sus::iter::zip;
 
@@ -146,6 +147,26 @@ auto common_prefix_take_while(sus::Slice<u8> xs,
                    .count();
 }
 
+// This compares a whole chunk with explicit SIMD instructions, and finds the
+// first mismatch in the chunk from the comparison mask without a second loop.
+auto common_prefix_simd(sus::Slice<u8> xs, sus::Slice<u8> ys) -> usize {
+  using u8x16 = sus::simd::u8x16;
+  auto result = 0_usize;
+  for (auto [xs_chunk, ys_chunk] :
+       zip(xs.chunks_exact(u8x16::LANES), ys.chunks_exact(u8x16::LANES))) {
+    auto ne = u8x16::from_slice(xs_chunk).simd_ne(u8x16::from_slice(ys_chunk));
+    if (sus::Option<usize> i = ne.first_set(); i.is_some())
+      return result + sus::move(i).unwrap();
+    result += u8x16::LANES;
+  }
+  for (auto [x, y] : zip(xs[sus::ops::range_from(result)],
+                         ys[sus::ops::range_from(result)])) {
+    if (x != y) break;
+    result += 1u;
+  }
+  return result;
+}
+
 TEST(BenchSimdChunks, common_prefix) {
   auto b = ankerl::nanobench::Bench().minEpochIterations(48498);
 
@@ -195,4 +216,11 @@ TEST(BenchSimdChunks, common_prefix) {
     result = r;
   });
   EXPECT_EQ(result, first_result);
+
+  b.run("common_prefix_simd", [&]() {
+    auto r = common_prefix_simd(v1, v2);
+    ankerl::nanobench::doNotOptimizeAway(r);
+    result = r;
+  });
+  EXPECT_EQ(result, first_result);
 }
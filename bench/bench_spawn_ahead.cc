@@ -0,0 +1,109 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdio.h>
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/iter/iterator.h"
+#include "sus/iter/spawn_ahead.h"
+#include "sus/prelude.h"
+
+namespace {
+
+struct Record {
+  u64 key;
+  u64 value;
+};
+
+// Builds `n` lines of text in the form "<key>,<value>\n".
+sus::Vec<char> generate_input(usize n) {
+  auto out = sus::Vec<char>();
+  u64 state = 0x9e3779b97f4a7c15u;
+  char buf[64];
+  for (usize i; i < n; i += 1u) {
+    // xorshift64.
+    state ^= state << 13u;
+    state ^= state >> 7u;
+    state ^= state << 17u;
+    int len = snprintf(buf, sizeof(buf), "%llu,%llu\n",
+                       static_cast<unsigned long long>(uint64_t{state} >> 32u),
+                       static_cast<unsigned long long>(uint64_t{state}));
+    for (int j = 0; j < len; ++j) out.push(buf[j]);
+  }
+  return out;
+}
+
+// The CPU-bound stage: parses the text into records, and hashes each value a
+// number of times to stand in for more expensive validation.
+auto parse(const sus::Vec<char>& input) {
+  return input.split([](const char& c) { return c == '\n'; })
+      .filter([](const sus::Slice<char>& line) { return !line.is_empty(); })
+      .map([](sus::Slice<char> line) {
+        Record r;
+        u64* field = &r.key;
+        for (char c : line) {
+          if (c == ',')
+            field = &r.value;
+          else
+            *field = field->wrapping_mul(10u).wrapping_add(
+                static_cast<uint64_t>(c - '0'));
+        }
+        for (i32 i; i < 64; i += 1) {
+          r.value ^= r.value >> 33u;
+          r.value = r.value.wrapping_mul(0xff51afd7ed558ccdu);
+        }
+        return r;
+      });
+}
+
+// The I/O-bound stage: writes each record out and flushes it.
+u64 write_all(sus::iter::Iterator<Record> auto&& records, FILE* out) {
+  u64 count;
+  for (Record r : records) {
+    fprintf(out, "%llu=%llu\n", static_cast<unsigned long long>(uint64_t{r.key}),
+            static_cast<unsigned long long>(uint64_t{r.value}));
+    fflush(out);
+    count += 1u;
+  }
+  return count;
+}
+
+void pipeline(ankerl::nanobench::Bench& b, usize n) {
+  auto input = generate_input(n);
+  FILE* out = fopen("/dev/null", "w");
+  ASSERT_NE(out, nullptr);
+
+  b.run(fmt::format("single thread, n = {}", n), [&]() {
+    u64 count = write_all(parse(input), out);
+    EXPECT_EQ(count, u64::try_from(n).unwrap());
+    return count;
+  });
+  for (usize buffer_len : sus::Vec<usize>(16u, 256u)) {
+    b.run(fmt::format("spawn_ahead({}), n = {}", buffer_len, n), [&]() {
+      u64 count = write_all(parse(input).spawn_ahead(buffer_len), out);
+      EXPECT_EQ(count, u64::try_from(n).unwrap());
+      return count;
+    });
+  }
+
+  fclose(out);
+}
+
+}  // namespace
+
+TEST(BenchSpawnAhead, ParseAndWrite_100_000) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+  pipeline(b, 100'000u);
+}
@@ -0,0 +1,90 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <tuple>
+
+#include "fmt/core.h"
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/prelude.h"
+
+namespace {
+
+// 8M records, each with a mix of small and large fields.
+constexpr usize kRecords = 8'000'000u;
+
+// The fields in the order they are declared, with padding between them.
+struct Record {
+  u8 kind;
+  u64 id;
+  u8 flags;
+  u32 count;
+};
+
+template <class T, class Make>
+sus::Vec<T> build(Make make) {
+  auto v = sus::Vec<T>::with_capacity(kRecords);
+  for (usize i; i < kRecords; i += 1u) {
+    v.push(make(u8::try_from(i & 0x7fu).unwrap(), u64::from(i),
+                u32::try_from(i).unwrap()));
+  }
+  return v;
+}
+
+template <class T>
+std::string name(const char* type, const sus::Vec<T>& v) {
+  return fmt::format("{} ({} MB)", type,
+                     v.len() * sizeof(T) / (1024u * 1024u));
+}
+
+// Summing a field of each record is limited by memory bandwidth. A
+// `Tuple<u8, u64, u8, u32>` lays out its elements by alignment in 16 bytes,
+// where the struct and `std::tuple` take 24 bytes, so the sum is around 1.6
+// times faster over the Tuples.
+TEST(BenchTuple, Footprint) {
+  auto b = ankerl::nanobench::Bench().relative(true).epochs(3u);
+
+  u64 sum;
+  {
+    const auto records = build<Record>([](u8 kind, u64 id, u32 count) {
+      return Record(kind, id, 1_u8, count);
+    });
+    b.run(name("struct", records), [&]() {
+      for (const Record& r : records) sum += u64::from(r.count);
+      ankerl::nanobench::doNotOptimizeAway(sum);
+    });
+  }
+  {
+    using T = std::tuple<u8, u64, u8, u32>;
+    const auto records = build<T>([](u8 kind, u64 id, u32 count) {
+      return T(kind, id, 1_u8, count);
+    });
+    b.run(name("std::tuple", records), [&]() {
+      for (const T& r : records) sum += u64::from(std::get<3>(r));
+      ankerl::nanobench::doNotOptimizeAway(sum);
+    });
+  }
+  {
+    using T = sus::Tuple<u8, u64, u8, u32>;
+    const auto records = build<T>([](u8 kind, u64 id, u32 count) {
+      return T(kind, id, 1_u8, count);
+    });
+    b.run(name("sus::Tuple", records), [&]() {
+      for (const T& r : records) sum += u64::from(r.at<3>());
+      ankerl::nanobench::doNotOptimizeAway(sum);
+    });
+  }
+}
+
+}  // namespace
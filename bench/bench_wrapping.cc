@@ -0,0 +1,91 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "googletest/include/gtest/gtest.h"
+#include "nanobench.h"
+#include "sus/num/saturating.h"
+#include "sus/num/wrapping.h"
+#include "sus/prelude.h"
+
+namespace {
+
+using sus::num::Saturating;
+using sus::num::Wrapping;
+
+constexpr size_t kLen = 16u * 1024u;
+
+sus::Vec<u32> random_values(u32 max) {
+  auto v = sus::Vec<u32>::with_capacity(kLen);
+  uint64_t state = 0x853c49e6748fea9bu;
+  for (size_t i = 0u; i < kLen; ++i) {
+    state = state * 6364136223846793005u + 1442695040888963407u;
+    v.push(u32(static_cast<uint32_t>(state >> 32u)) % max);
+  }
+  return v;
+}
+
+// Sums a slice of values which are small enough to not overflow. A checked
+// sum must branch on each add, while the wrapping and saturating sums use
+// Simd vectors.
+TEST(BenchWrapping, Sum) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+
+  const sus::Vec<u32> values = random_values(1024u);
+  const sus::Slice<u32> s = values.as_slice();
+  const sus::Slice<Wrapping<u32>> ws = Wrapping<u32>::from_slice(s);
+  const sus::Slice<Saturating<u32>> ss = Saturating<u32>::from_slice(s);
+
+  b.run("checked sum", [&]() {
+    auto sum = 0_u32;
+    for (u32 v : s) sum += v;
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run("wrapping_add loop", [&]() {
+    auto sum = 0_u32;
+    for (u32 v : s) sum = sum.wrapping_add(v);
+    ankerl::nanobench::doNotOptimizeAway(sum);
+  });
+  b.run("Wrapping sum", [&]() {
+    ankerl::nanobench::doNotOptimizeAway(ws.iter().sum<Wrapping<u32>>());
+  });
+  b.run("Saturating sum", [&]() {
+    ankerl::nanobench::doNotOptimizeAway(ss.iter().sum<Saturating<u32>>());
+  });
+}
+
+// FNV-1a over a buffer, where the multiply is expected to overflow.
+TEST(BenchWrapping, Hash) {
+  auto b = ankerl::nanobench::Bench().relative(true);
+
+  const sus::Vec<u32> values = random_values(256u);
+
+  b.run("wrapping_mul by name", [&]() {
+    auto hash = 0xcbf29ce484222325_u64;
+    for (u32 v : values) {
+      hash ^= u64::from(v);
+      hash = hash.wrapping_mul(0x100000001b3_u64);
+    }
+    ankerl::nanobench::doNotOptimizeAway(hash);
+  });
+  b.run("Wrapping operators", [&]() {
+    auto hash = Wrapping<u64>(0xcbf29ce484222325_u64);
+    for (u32 v : values) {
+      hash ^= u64::from(v);
+      hash *= 0x100000001b3_u64;
+    }
+    ankerl::nanobench::doNotOptimizeAway(hash);
+  });
+}
+
+}  // namespace
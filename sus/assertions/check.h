@@ -16,6 +16,25 @@
 
 #include "sus/assertions/panic.h"
 
+#if SUS_PANIC_OUTLINE && !defined(SUS_PANIC_ELIDE_MESSAGE)
+// A pointer to a record of the current location with static storage. The
+// record is placed in a lambda so that it can appear in constexpr functions.
+// The panic itself is in one out-of-line function shared by every check.
+#define _sus__static_panic_location()                                     \
+  []() noexcept -> const ::sus::assertions::PanicLocation* {              \
+    static constexpr auto loc = ::sus::assertions::PanicLocation::current(); \
+    return &loc;                                                          \
+  }()
+#define _sus__check_panic() \
+  ::sus::assertions::__private::panic_at(_sus__static_panic_location())
+#define _sus__check_panic_with_message(msg)                              \
+  ::sus::assertions::__private::panic_at_with_message(                   \
+      msg, _sus__static_panic_location())
+#else
+#define _sus__check_panic() ::sus::panic()
+#define _sus__check_panic_with_message(msg) ::sus::panic(msg)
+#endif
+
 /// Verifies that the input, evaluated to a `bool`, is true. Otherwise, it will
 /// [`panic`]($sus::panic), printing a message and terminating the program.
 ///
@@ -26,7 +45,7 @@
 /// [`sus::panic`]($sus::panic) as described there.
 #define sus_check(...)               \
   if (![](bool x) { return x; }(__VA_ARGS__)) [[unlikely]] { \
-    ::sus::panic();                     \
+    _sus__check_panic();                \
   }                                  \
   static_assert(true)
 
@@ -43,6 +62,6 @@
 /// this macro will avoid instantiating it at all.
 #define sus_check_with_message(cond, msg) \
   if (!(cond)) [[unlikely]] {             \
-    ::sus::panic(msg);          \
+    _sus__check_panic_with_message(msg);  \
   }                                       \
   static_assert(true)
@@ -38,4 +38,13 @@ void print_panic_message(std::string_view msg,
   }
 }
 
+void panic_at(const PanicLocation* location) noexcept {
+  ::sus::panic("", *location);
+}
+
+void panic_at_with_message(std::string_view msg,
+                           const PanicLocation* location) noexcept {
+  ::sus::panic(msg, *location);
+}
+
 }  // namespace sus::assertions::__private
@@ -31,6 +31,13 @@ namespace sus {
 namespace assertions {}
 }  // namespace sus
 
+// SUS_PANIC_OUTLINE can be defined to false to inline the panic at each
+// `sus_check` instead of calling an out-of-line cold function.
+#if !defined(SUS_PANIC_OUTLINE)
+#define SUS_PANIC_OUTLINE true
+#endif
+static_assert(SUS_PANIC_OUTLINE == false || SUS_PANIC_OUTLINE == true);
+
 namespace sus::assertions {
 
 /// Records the location where a panic occured.
@@ -59,6 +66,20 @@ struct PanicLocation {
 namespace __private {
 void print_panic_message(std::string_view msg,
                          const PanicLocation& location) noexcept;
+
+/// Panics at `location`. This is the out-of-line cold path of
+/// [`sus_check`]($sus_check), which passes a pointer to a location record
+/// with static storage, so that a call site only has to load one address.
+///
+/// Defined in `sus/assertions/panic.cc`.
+[[noreturn]] _sus_cold _sus_no_inline void panic_at(
+    const PanicLocation* location) noexcept;
+/// Panics at `location` with the message `msg`. This is the out-of-line cold
+/// path of [`sus_check_with_message`]($sus_check_with_message).
+///
+/// Defined in `sus/assertions/panic.cc`.
+[[noreturn]] _sus_cold _sus_no_inline void panic_at_with_message(
+    std::string_view msg, const PanicLocation* location) noexcept;
 }  // namespace __private
 
 /// Terminate the program, after printing a message.
@@ -81,6 +102,14 @@ void print_panic_message(std::string_view msg,
 /// library, the compilation of calling code must match how the Subspace library
 /// was built.
 ///
+/// Unless messages are elided, a failed [`sus_check`]($sus_check) or
+/// [`sus_check_with_message`]($sus_check_with_message) calls a cold function
+/// in the Subspace library with a pointer to a static record of its location,
+/// instead of inlining the panic at each check. This keeps the code for checks
+/// in hot loops small. Defining `SUS_PANIC_OUTLINE` to `false` inlines the
+/// panic at each check instead. It must be defined consistently, in the same
+/// way as the macros above.
+///
 /// The `SUS_PROVIDE_PRINT_PANIC_MESSAGE_HANDLER()` macro receives two arguments:
 /// * A message, which is a `const char*`, a `std::string_view` or a
 ///   `std::string`. Overloads should be used to handle each case.
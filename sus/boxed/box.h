@@ -665,15 +665,17 @@ class [[_sus_trivial_abi]] Box final : public __private::BoxBase<Box<T>, T> {
 
   T* t_;
 
-  static T* never_value() {
-    return reinterpret_cast<T*>(alignof(T));
+  // The niches are addresses of the first `T` objects in the zero page, which
+  // are never allocated.
+  static T* never_value_niche(size_t niche) {
+    return reinterpret_cast<T*>(alignof(T) * (niche + 1u));
   }
 
   sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(t_));
-  sus_class_never_value_field(::sus::marker::unsafe_fn, Box, t_, never_value(),
-                              nullptr);
+  sus_class_never_value_field_niches(::sus::marker::unsafe_fn, Box, t_, 2u,
+                                     never_value_niche, nullptr);
   explicit Box(::sus::mem::NeverValueConstructor) noexcept
-      : t_(never_value()) {}
+      : t_(never_value_niche(0u)) {}
 };
 
 }  // namespace sus::boxed
@@ -52,6 +52,8 @@ static_assert(sus::mem::CloneFrom<Box<i32>>);
 
 // For any T.
 static_assert(sus::mem::NeverValueField<Box<i32>>);
+static_assert(sus::mem::never_value_niche_count<Box<i32>>() == 2u);
+static_assert(sizeof(sus::Option<sus::Option<Box<i32>>>) == sizeof(Box<i32>));
 // For any T.
 static_assert(sus::mem::TriviallyRelocatable<Box<i32>>);
 
@@ -0,0 +1,281 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <new>
+#include <type_traits>
+
+#include "sus/boxed/dyn.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/adaptors/map.h"
+#include "sus/macros/lifetimebound.h"
+#include "sus/mem/move.h"
+#include "sus/mem/replace.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/option/option.h"
+
+namespace sus::boxed {
+
+namespace __private {
+
+/// The operations on one type of element in a `DynVec<DynC>`.
+template <class DynC>
+struct DynVecOps {
+  /// Moves the element to the same offset in a new buffer.
+  void (*relocate)(DynC* dync, char* old_data, char* new_data);
+  void (*destroy)(DynC* dync);
+};
+
+/// The layout of an element holding a `T` in a `DynVec<DynC>`.
+///
+/// The element begins with a pointer to its `DynVecOps`, followed by the
+/// type-erasure of `DynC`, which refers to the `T` that follows it. The `DynC`
+/// is at the element's offset in the buffer, so the ops pointer is found just
+/// before it.
+template <class DynC, class T>
+struct DynVecElement {
+  using View = typename DynC::template DynTyped<T, T&>;
+  using Ops = DynVecOps<DynC>;
+
+  static_assert(alignof(View) >= alignof(const Ops*));
+  static constexpr size_t kAlign =
+      alignof(View) > alignof(T) ? alignof(View) : alignof(T);
+  static constexpr size_t kValueOffset =
+      (sizeof(View) + alignof(T) - 1u) / alignof(T) * alignof(T);
+  /// The number of bytes after the offset of the `DynC`.
+  static constexpr size_t kSize = kValueOffset + sizeof(T);
+
+  static DynC* construct(char* at, T&& value) noexcept {
+    new (at - sizeof(const Ops*)) const Ops*(&kOps);
+    T* t = new (at + kValueOffset) T(::sus::move(value));
+    return new (at) View(*t);
+  }
+  static char* address_of(DynC* dync) noexcept {
+    return reinterpret_cast<char*>(static_cast<View*>(dync));
+  }
+  static T& value_of(DynC* dync) noexcept {
+    return *std::launder(
+        reinterpret_cast<T*>(address_of(dync) + kValueOffset));
+  }
+
+  static void destroy(DynC* dync) noexcept {
+    T& t = value_of(dync);
+    static_cast<View*>(dync)->~View();
+    t.~T();
+  }
+  static void relocate(DynC* dync, char* old_data, char* new_data) noexcept {
+    T& t = value_of(dync);
+    construct(new_data + (address_of(dync) - old_data), ::sus::move(t));
+    static_cast<View*>(dync)->~View();
+    t.~T();
+  }
+
+  static constexpr DynVecOps<DynC> kOps = {&relocate, &destroy};
+};
+
+}  // namespace __private
+
+/// A list of type-erased objects which satisfy a concept `C`, stored together
+/// in a single buffer.
+///
+/// Where a `Vec<Box<DynC>>` makes a heap allocation for each element, and
+/// iterating it reads a pointer from the `Vec` and then the object from
+/// wherever it was allocated, a `DynVec<DynC>` places each object after the
+/// previous one in a single growable buffer. Objects of different types, and
+/// sizes, can be pushed into the same `DynVec` as long as they satisfy the
+/// concept `C`. Each object is stored next to its type-erasure, so calls
+/// through the `DynC` interface read from the same region of memory, and
+/// iterating over the elements walks forward through the buffer.
+///
+/// Elements are moved into the `DynVec` with
+/// [`push`]($sus::boxed::DynVec::push) and are accessed as `DynC` references.
+/// When the buffer grows, the elements are moved into the new buffer, so
+/// references to them are invalidated. The alignment of the elements must not
+/// be larger than `__STDCPP_DEFAULT_NEW_ALIGNMENT__`.
+///
+/// See [`DynConcept`]($sus::boxed::DynConcept) for more on type erasure of
+/// concept-satisfying types.
+///
+/// # Examples
+/// ```
+/// auto v = sus::DynVec<sus::fn::DynFn<i32(i32)>>();
+/// v.push([](i32 i) { return i + 1; });
+/// v.push([y = 3_i32](i32 i) { return i * y; });
+/// i32 sum;
+/// for (const sus::fn::DynFn<i32(i32)>& f : v.iter()) sum += f(2);
+/// sus_check(sum == 3 + 6);
+/// ```
+template <class DynC>
+class DynVec final {
+  static_assert(std::same_as<DynC, std::remove_cvref_t<DynC>>,
+                "DynC can not be qualified or a reference");
+
+ public:
+  /// Constructs an empty `DynVec`, which does not allocate.
+  DynVec() noexcept = default;
+
+  /// Constructs an empty `DynVec` with space for at least `bytes` bytes of
+  /// elements before it needs to grow.
+  static DynVec with_byte_capacity(usize bytes) noexcept {
+    auto v = DynVec();
+    if (bytes > 0u) v.grow_to(bytes);
+    return v;
+  }
+
+  DynVec(DynVec&& o) noexcept
+      : offsets_(::sus::mem::replace(o.offsets_, Offsets())),
+        data_(::sus::mem::replace(o.data_, nullptr)),
+        byte_len_(::sus::mem::replace(o.byte_len_, 0u)),
+        byte_capacity_(::sus::mem::replace(o.byte_capacity_, 0u)) {}
+  DynVec& operator=(DynVec&& o) noexcept {
+    if (this != &o) {
+      free_storage();
+      offsets_ = ::sus::mem::replace(o.offsets_, Offsets());
+      data_ = ::sus::mem::replace(o.data_, nullptr);
+      byte_len_ = ::sus::mem::replace(o.byte_len_, 0u);
+      byte_capacity_ = ::sus::mem::replace(o.byte_capacity_, 0u);
+    }
+    return *this;
+  }
+
+  ~DynVec() noexcept { free_storage(); }
+
+  /// Returns the number of elements in the `DynVec`.
+  usize len() const noexcept { return offsets_.len(); }
+  /// Returns whether the `DynVec` has no elements.
+  bool is_empty() const noexcept { return offsets_.is_empty(); }
+  /// Returns the number of bytes used by the elements in the buffer.
+  usize byte_len() const noexcept { return byte_len_; }
+  /// Returns the number of bytes the buffer can hold before it needs to grow.
+  usize byte_capacity() const noexcept { return byte_capacity_; }
+
+  /// Moves `value` into the end of the buffer.
+  ///
+  /// The buffer grows if there is not enough space, which moves all the
+  /// existing elements.
+  template <class T>
+    requires(DynC::template SatisfiesConcept<T> &&
+             std::is_move_constructible_v<T> && !std::is_reference_v<T>)
+  void push(T value) noexcept {
+    using Element = __private::DynVecElement<DynC, T>;
+    static_assert(Element::kAlign <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                  "DynVec elements can not be over-aligned");
+    // The `DynC` is aligned after space for the ops pointer.
+    const usize offset =
+        (byte_len_ + sizeof(const Ops*) + (Element::kAlign - 1u)) &
+        ~usize(Element::kAlign - 1u);
+    const usize end = offset + Element::kSize;
+    if (end > byte_capacity_) {
+      grow_to(end > byte_capacity_ * 2u ? end : byte_capacity_ * 2u);
+    }
+    Element::construct(data_ + size_t{offset}, ::sus::move(value));
+    offsets_.push(offset);
+    byte_len_ = end;
+  }
+
+  /// Destroys all elements, keeping the buffer for reuse.
+  void clear() noexcept {
+    for (usize offset : offsets_) ops_at(offset).destroy(at(offset));
+    offsets_.clear();
+    byte_len_ = 0u;
+  }
+
+  /// Returns a reference to the element at position `i`.
+  ///
+  /// # Panics
+  /// Panics if the index is out of bounds.
+  const DynC& operator[](usize i) const& noexcept sus_lifetimebound {
+    return *at(offsets_[i]);
+  }
+  DynC& operator[](usize i) & noexcept sus_lifetimebound {
+    return *at(offsets_[i]);
+  }
+
+  /// Returns a const reference to the element at position `i`, or `None` if
+  /// the index is out of bounds.
+  ::sus::Option<const DynC&> get(usize i) const& noexcept sus_lifetimebound {
+    if (i >= len()) return ::sus::Option<const DynC&>();
+    return ::sus::Option<const DynC&>(*at(offsets_[i]));
+  }
+  /// Returns a mutable reference to the element at position `i`, or `None` if
+  /// the index is out of bounds.
+  ::sus::Option<DynC&> get_mut(usize i) & noexcept sus_lifetimebound {
+    if (i >= len()) return ::sus::Option<DynC&>();
+    return ::sus::Option<DynC&>(*at(offsets_[i]));
+  }
+
+  /// Returns an iterator over const references to the elements, in the order
+  /// they were pushed.
+  auto iter() const& noexcept sus_lifetimebound {
+    const char* data = data_;
+    return offsets_.iter().map([data](const usize& offset) -> const DynC& {
+      return *std::launder(
+          reinterpret_cast<const DynC*>(data + size_t{offset}));
+    });
+  }
+  /// Returns an iterator over mutable references to the elements, in the order
+  /// they were pushed.
+  auto iter_mut() & noexcept sus_lifetimebound {
+    char* data = data_;
+    return offsets_.iter().map([data](const usize& offset) -> DynC& {
+      return *std::launder(reinterpret_cast<DynC*>(data + size_t{offset}));
+    });
+  }
+
+ private:
+  using Ops = __private::DynVecOps<DynC>;
+  using Offsets = ::sus::collections::Vec<usize>;
+
+  DynC* at(usize offset) const noexcept {
+    return std::launder(reinterpret_cast<DynC*>(data_ + size_t{offset}));
+  }
+  const Ops& ops_at(usize offset) const noexcept {
+    return **std::launder(reinterpret_cast<const Ops**>(
+        data_ + size_t{offset} - sizeof(const Ops*)));
+  }
+
+  void grow_to(usize bytes) noexcept {
+    auto* new_data = static_cast<char*>(::operator new(size_t{bytes}));
+    // Elements stay at the same offsets in the new buffer, which keeps them
+    // aligned since both buffers have the default new alignment.
+    for (usize offset : offsets_)
+      ops_at(offset).relocate(at(offset), data_, new_data);
+    if (data_ != nullptr) ::operator delete(data_);
+    data_ = new_data;
+    byte_capacity_ = bytes;
+  }
+
+  void free_storage() noexcept {
+    if (data_ == nullptr) return;
+    for (usize offset : offsets_) ops_at(offset).destroy(at(offset));
+    ::operator delete(data_);
+    data_ = nullptr;
+  }
+
+  /// The offset of each element's `DynC` in the buffer.
+  Offsets offsets_;
+  char* data_ = nullptr;
+  usize byte_len_;
+  usize byte_capacity_;
+};
+
+}  // namespace sus::boxed
+
+// Promote `DynVec` to the top `sus` namespace.
+namespace sus {
+using ::sus::boxed::DynVec;
+}
@@ -0,0 +1,174 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/boxed/dyn_vec.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/fn/fn.h"
+#include "sus/prelude.h"
+
+namespace {
+using sus::boxed::DynVec;
+using sus::fn::DynFn;
+using sus::fn::DynFnMut;
+
+TEST(DynVec, Empty) {
+  auto v = DynVec<DynFn<i32(i32)>>();
+  EXPECT_EQ(v.len(), 0u);
+  EXPECT_TRUE(v.is_empty());
+  EXPECT_EQ(v.byte_len(), 0u);
+  EXPECT_EQ(v.byte_capacity(), 0u);
+  EXPECT_TRUE(v.get(0u).is_none());
+  EXPECT_EQ(v.iter().count(), 0u);
+}
+
+TEST(DynVec, PushDifferentTypes) {
+  auto v = DynVec<DynFn<i32(i32)>>();
+  v.push([](i32 i) { return i + 1; });
+  v.push([y = 3_i32](i32 i) { return i * y; });
+  v.push([a = 1_i64, b = 2_i64, c = 3_i64](i32 i) {
+    return i + i32::try_from(a + b + c).unwrap();
+  });
+  EXPECT_EQ(v.len(), 3u);
+  EXPECT_EQ(v[0u](2), 3);
+  EXPECT_EQ(v[1u](2), 6);
+  EXPECT_EQ(v[2u](2), 8);
+  EXPECT_EQ(v.get(1u).unwrap()(3), 9);
+  EXPECT_TRUE(v.get(3u).is_none());
+
+  // The elements are stored back to back in a single buffer.
+  EXPECT_LE(v.byte_len(), v.byte_capacity());
+  const auto* first = reinterpret_cast<const char*>(&v[0u]);
+  const auto* last = reinterpret_cast<const char*>(&v[2u]);
+  EXPECT_LT(first, last);
+  EXPECT_LT(last, first + size_t{v.byte_len()});
+}
+
+TEST(DynVec, Iter) {
+  auto v = DynVec<DynFn<i32(i32)>>();
+  for (i32 i = 0; i < 10; i += 1) v.push([i](i32 x) { return x * 10 + i; });
+
+  i32 expected = 0;
+  for (const DynFn<i32(i32)>& f : v.iter()) {
+    EXPECT_EQ(f(1), 10 + expected);
+    expected += 1;
+  }
+  EXPECT_EQ(expected, 10);
+}
+
+TEST(DynVec, IterMut) {
+  auto v = DynVec<DynFnMut<i32()>>();
+  v.push([n = 0_i32]() mutable {
+    n += 1;
+    return n;
+  });
+  v.push([n = 10_i64]() mutable {
+    n += 1;
+    return i32::try_from(n).unwrap();
+  });
+
+  for (DynFnMut<i32()>& f : v.iter_mut()) f();
+  EXPECT_EQ(v[0u](), 2);
+  EXPECT_EQ(v[1u](), 12);
+  EXPECT_EQ(v.get_mut(0u).unwrap()(), 3);
+}
+
+struct Counts {
+  i32 constructed;
+  i32 destroyed;
+};
+
+// A callable which counts how many of its copies are alive.
+struct Counted {
+  Counted(Counts& c, i32 v) : counts(&c), value(v) { counts->constructed += 1; }
+  Counted(Counted&& o) : counts(o.counts), value(o.value) {
+    counts->constructed += 1;
+  }
+  ~Counted() { counts->destroyed += 1; }
+
+  i32 operator()(i32 x) const { return x + value; }
+
+  Counts* counts;
+  i32 value;
+};
+
+TEST(DynVec, GrowRelocates) {
+  auto counts = Counts();
+  {
+    auto v = DynVec<DynFn<i32(i32)>>();
+    for (i32 i = 0; i < 100; i += 1) v.push(Counted(counts, i));
+    EXPECT_EQ(v.len(), 100u);
+    // Every element was moved and destroyed at least once while growing.
+    EXPECT_GT(counts.destroyed, 100);
+    EXPECT_EQ(counts.constructed - counts.destroyed, 100);
+    for (usize i; i < 100u; i += 1u) {
+      EXPECT_EQ(v[i](1), 1 + i32::try_from(i).unwrap());
+    }
+  }
+  EXPECT_EQ(counts.constructed, counts.destroyed);
+}
+
+TEST(DynVec, WithByteCapacity) {
+  auto counts = Counts();
+  auto v = DynVec<DynFn<i32(i32)>>::with_byte_capacity(4096u);
+  EXPECT_EQ(v.byte_capacity(), 4096u);
+  for (i32 i = 0; i < 10; i += 1) v.push(Counted(counts, i));
+  // Nothing was relocated: each push constructs a temporary and moves it into
+  // the buffer.
+  EXPECT_EQ(counts.constructed, 20);
+  EXPECT_EQ(counts.destroyed, 10);
+  EXPECT_EQ(v.byte_capacity(), 4096u);
+}
+
+TEST(DynVec, Clear) {
+  auto counts = Counts();
+  auto v = DynVec<DynFn<i32(i32)>>();
+  for (i32 i = 0; i < 5; i += 1) v.push(Counted(counts, i));
+  const usize cap = v.byte_capacity();
+  v.clear();
+  EXPECT_EQ(counts.constructed, counts.destroyed);
+  EXPECT_TRUE(v.is_empty());
+  EXPECT_EQ(v.byte_len(), 0u);
+  EXPECT_EQ(v.byte_capacity(), cap);
+
+  v.push([](i32 i) { return i; });
+  EXPECT_EQ(v[0u](4), 4);
+}
+
+TEST(DynVec, Move) {
+  auto counts = Counts();
+  {
+    auto v = DynVec<DynFn<i32(i32)>>();
+    v.push(Counted(counts, 1));
+    v.push(Counted(counts, 2));
+    const i32 live = counts.constructed - counts.destroyed;
+
+    auto w = sus::move(v);
+    // Moving the `DynVec` does not move the elements.
+    EXPECT_EQ(counts.constructed - counts.destroyed, live);
+    EXPECT_EQ(w.len(), 2u);
+    EXPECT_EQ(w[1u](1), 3);
+    // The moved-from `DynVec` is empty.
+    EXPECT_TRUE(v.is_empty());
+
+    auto x = DynVec<DynFn<i32(i32)>>();
+    x.push(Counted(counts, 3));
+    x = sus::move(w);
+    EXPECT_EQ(counts.constructed - counts.destroyed, live);
+    EXPECT_EQ(x[0u](1), 2);
+  }
+  EXPECT_EQ(counts.constructed, counts.destroyed);
+}
+
+}  // namespace
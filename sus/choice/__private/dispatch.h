@@ -0,0 +1,89 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+
+#include <type_traits>
+#include <utility>
+
+#include "sus/assertions/unreachable.h"
+#include "sus/macros/inline.h"
+
+namespace sus::choice_type::__private {
+
+template <size_t I, class R, class F>
+constexpr R dispatch_thunk(F& f) {
+  return static_cast<F&&>(f)(std::integral_constant<size_t, I>());
+}
+
+template <class R, class F, size_t... Is>
+constexpr R (*const dispatch_table[sizeof...(Is)])(F&) = {
+    &dispatch_thunk<Is, R, F>...};
+
+#define _sus__dispatch_case(I)                                      \
+  case I:                                                           \
+    if constexpr (I < N) {                                          \
+      return static_cast<F&&>(f)(std::integral_constant<size_t, I>()); \
+    }                                                               \
+    break;
+#define _sus__dispatch_cases_16(I)                                   \
+  _sus__dispatch_case(I + 0) _sus__dispatch_case(I + 1)              \
+  _sus__dispatch_case(I + 2) _sus__dispatch_case(I + 3)              \
+  _sus__dispatch_case(I + 4) _sus__dispatch_case(I + 5)              \
+  _sus__dispatch_case(I + 6) _sus__dispatch_case(I + 7)              \
+  _sus__dispatch_case(I + 8) _sus__dispatch_case(I + 9)              \
+  _sus__dispatch_case(I + 10) _sus__dispatch_case(I + 11)            \
+  _sus__dispatch_case(I + 12) _sus__dispatch_case(I + 13)            \
+  _sus__dispatch_case(I + 14) _sus__dispatch_case(I + 15)
+
+/// Calls `f(std::integral_constant<size_t, I>())` where `I` is equal to
+/// `index`, which must be less than `N`, and returns its result. Every `I`
+/// must produce the same return type.
+///
+/// This is the dispatch from the runtime index of a `Choice` to the
+/// compile-time index of its storage. It compiles to a single `switch` over
+/// the index, which the compiler turns into a jump table, and for more than 64
+/// members to a call through a table of function pointers. Either way the
+/// cost does not grow with the number of members, as it does for a chain of
+/// comparisons.
+template <size_t N, class F>
+_sus_always_inline constexpr decltype(auto) dispatch_index(size_t index,
+                                                           F&& f) {
+  static_assert(N > 0u);
+  if constexpr (N <= 16u) {
+    switch (index) { _sus__dispatch_cases_16(0) }
+  } else if constexpr (N <= 64u) {
+    switch (index) {
+      _sus__dispatch_cases_16(0) _sus__dispatch_cases_16(16)
+      _sus__dispatch_cases_16(32) _sus__dispatch_cases_16(48)
+    }
+  } else {
+    using R =
+        decltype(static_cast<F&&>(f)(std::integral_constant<size_t, 0>()));
+    return [&]<size_t... Is>(std::index_sequence<Is...>) -> R {
+      if (index < N) return dispatch_table<R, F, Is...>[index](f);
+      ::sus::unreachable();
+    }(std::make_index_sequence<N>());
+  }
+  ::sus::unreachable();
+}
+
+#undef _sus__dispatch_cases_16
+#undef _sus__dispatch_case
+
+}  // namespace sus::choice_type::__private
@@ -20,9 +20,12 @@
 #include <memory>
 #include <type_traits>
 
+#include "sus/choice/__private/dispatch.h"
 #include "sus/choice/__private/nothing.h"
 #include "sus/choice/__private/pack_index.h"
 #include "sus/macros/no_unique_address.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/tuple/tuple.h"
 
@@ -178,93 +181,10 @@ union Storage<I, ::sus::Tuple<Ts...>, Elements...> {
 
   using Type = ::sus::Tuple<Ts...>;
 
-  inline constexpr void activate_for_construct(size_t index) {
-    if (index != I) {
-      std::construct_at(&more_);  // Make the more_ member active.
-      more_.activate_for_construct(index);
-    }
-  }
   inline constexpr void construct(Type&& tuple) {
     std::construct_at(&tuple_, ::sus::move(tuple));
   }
   inline constexpr void assign(Type&& tuple) { tuple_ = ::sus::move(tuple); }
-  inline void move_construct(size_t index, Storage&& from) {
-    if (index == I) {
-      std::construct_at(&tuple_, ::sus::move(from.tuple_));
-    } else {
-      std::construct_at(&more_);  // Make the more_ member active.
-      more_.move_construct(index, ::sus::move(from.more_));
-    }
-  }
-  inline constexpr void move_assign(size_t index, Storage&& from) {
-    if (index == I) {
-      tuple_ = ::sus::move(from.tuple_);
-    } else {
-      more_.move_assign(index, ::sus::move(from.more_));
-    }
-  }
-  inline constexpr void copy_construct(size_t index, const Storage& from) {
-    if (index == I) {
-      std::construct_at(&tuple_, from.tuple_);
-    } else {
-      std::construct_at(&more_);  // Make the more_ member active.
-      more_.copy_construct(index, from.more_);
-    }
-  }
-  inline constexpr void copy_assign(size_t index, const Storage& from) {
-    if (index == I) {
-      tuple_ = from.tuple_;
-    } else {
-      more_.copy_assign(index, from.more_);
-    }
-  }
-  inline constexpr void clone_construct(size_t index, const Storage& from) {
-    if (index == I) {
-      std::construct_at(&tuple_, ::sus::clone(from.tuple_));
-    } else {
-      std::construct_at(&more_);  // Make the more_ member active.
-      more_.clone_construct(index, from.more_);
-    }
-  }
-  inline constexpr void destroy(size_t index) {
-    if (index == I) {
-      tuple_.~Type();
-    } else {
-      more_.destroy(index);
-      more_.~Storage<I + 1, Elements...>();
-    }
-  }
-  inline constexpr bool eq(size_t index, const Storage& other) const& {
-    if (index == I) {
-      return tuple_ == other.tuple_;
-    } else {
-      return more_.eq(index, other.more_);
-    }
-  }
-  inline constexpr std::strong_ordering strong_ord(
-      size_t index, const Storage& other) const& {
-    if (index == I) {
-      return std::strong_order(tuple_, other.tuple_);
-    } else {
-      return more_.ord(index, other.more_);
-    }
-  }
-  inline constexpr std::weak_ordering weak_ord(size_t index,
-                                               const Storage& other) const& {
-    if (index == I) {
-      return std::weak_order(tuple_, other.tuple_);
-    } else {
-      return more_.weak_ord(index, other.more_);
-    }
-  }
-  inline constexpr std::partial_ordering partial_ord(
-      size_t index, const Storage& other) const& {
-    if (index == I) {
-      return std::partial_order(tuple_, other.tuple_);
-    } else {
-      return more_.partial_ord(index, other.more_);
-    }
-  }
 
   constexpr auto as() const& {
     return [this]<size_t... Is>(std::index_sequence<Is...>) {
@@ -307,74 +227,6 @@ union Storage<I, Nothing, Elements...> {
     requires(... && std::is_trivially_move_assignable_v<Elements>)
   = default;
 
-  inline constexpr void activate_for_construct(size_t index) {
-    if (index != I) {
-      std::construct_at(&more_);  // Make the more_ member active.
-      more_.activate_for_construct(index);
-    }
-  }
-  inline constexpr void move_construct(size_t index, Storage&& from) {
-    if (index != I) {
-      std::construct_at(&more_);  // Make the more_ member active.
-      more_.move_construct(index, ::sus::move(from.more_));
-    }
-  }
-  inline constexpr void move_assign(size_t index, Storage&& from) {
-    if (index != I) {
-      more_.move_assign(index, ::sus::move(from.more_));
-    }
-  }
-  inline constexpr void copy_construct(size_t index, const Storage& from) {
-    if (index != I) {
-      std::construct_at(&more_);  // Make the more_ member active.
-      more_.copy_construct(index, from.more_);
-    }
-  }
-  inline constexpr void copy_assign(size_t index, const Storage& from) {
-    if (index != I) {
-      more_.copy_assign(index, from.more_);
-    }
-  }
-  inline constexpr void clone_construct(size_t index, const Storage& from) {
-    if (index != I) {
-      more_.clone_construct(index, from.more_);
-    }
-  }
-  inline constexpr void destroy(size_t index) {
-    if (index != I) {
-      more_.destroy(index);
-      more_.~Storage<I + 1, Elements...>();
-    }
-  }
-  inline constexpr bool eq(size_t index, const Storage& other) const& {
-    if (index == I) {
-      return true;
-    } else {
-      return more_.eq(index, other.more_);
-    }
-  }
-  inline constexpr auto strong_ord(size_t index, const Storage& other) const& {
-    if (index == I) {
-      return std::strong_ordering::equivalent;
-    } else {
-      return more_.strong_ord(index, other.more_);
-    }
-  }
-  inline constexpr auto weak_ord(size_t index, const Storage& other) const& {
-    if (index == I) {
-      return std::weak_ordering::equivalent;
-    } else {
-      return more_.weak_ord(index, other.more_);
-    }
-  }
-  inline constexpr auto partial_ord(size_t index, const Storage& other) const& {
-    if (index == I) {
-      return std::partial_ordering::equivalent;
-    } else {
-      return more_.partial_ord(index, other.more_);
-    }
-  }
-
   [[_sus_no_unique_address]] Storage<I + 1, Elements...> more_;
 };
 
@@ -410,12 +262,6 @@ union Storage<I, ::sus::Tuple<T>, Elements...> {
 
   using Type = ::sus::Tuple<T>;
 
-  inline constexpr void activate_for_construct(size_t index) {
-    if (index != I) {
-      std::construct_at(&more_);  // Make the more_ member active.
-      more_.activate_for_construct(index);
-    }
-  }
   template <class U>
   inline constexpr void construct(U&& value) {
     std::construct_at(&tuple_, ::sus::Tuple<T>(::sus::forward<U>(value)));
@@ -423,81 +269,6 @@ union Storage<I, ::sus::Tuple<T>, Elements...> {
   inline constexpr void assign(T&& value) {
     tuple_ = Type(::sus::forward<T>(value));
   }
-  inline constexpr void move_construct(size_t index, Storage&& from) {
-    if (index == I) {
-      std::construct_at(&tuple_, ::sus::move(from.tuple_));
-    } else {
-      std::construct_at(&more_);  // Make the more_ member active.
-      more_.move_construct(index, ::sus::move(from.more_));
-    }
-  }
-  inline constexpr void move_assign(size_t index, Storage&& from) {
-    if (index == I) {
-      tuple_ = ::sus::move(from.tuple_);
-    } else {
-      more_.move_assign(index, ::sus::move(from.more_));
-    }
-  }
-  inline constexpr void copy_construct(size_t index, const Storage& from) {
-    if (index == I) {
-      std::construct_at(&tuple_, from.tuple_);
-    } else {
-      std::construct_at(&more_);  // Make the more_ member active.
-      more_.copy_construct(index, from.more_);
-    }
-  }
-  inline constexpr void copy_assign(size_t index, const Storage& from) {
-    if (index == I) {
-      tuple_ = from.tuple_;
-    } else {
-      more_.copy_assign(index, from.more_);
-    }
-  }
-  inline constexpr void clone_construct(size_t index, const Storage& from) {
-    if (index == I) {
-      auto x = ::sus::clone(from.tuple_);
-      std::construct_at(&tuple_, sus::move(x));
-    } else {
-      std::construct_at(&more_);  // Make the more_ member active.
-      more_.clone_construct(index, from.more_);
-    }
-  }
-  inline constexpr void destroy(size_t index) {
-    if (index == I) {
-      tuple_.~Type();
-    } else {
-      more_.destroy(index);
-      more_.~Storage<I + 1, Elements...>();
-    }
-  }
-  inline constexpr bool eq(size_t index, const Storage& other) const& {
-    if (index == I) {
-      return tuple_ == other.tuple_;
-    } else {
-      return more_.eq(index, other.more_);
-    }
-  }
-  inline constexpr auto strong_ord(size_t index, const Storage& other) const& {
-    if (index == I) {
-      return std::strong_order(tuple_, other.tuple_);
-    } else {
-      return more_.strong_ord(index, other.more_);
-    }
-  }
-  inline constexpr auto weak_ord(size_t index, const Storage& other) const& {
-    if (index == I) {
-      return std::weak_order(tuple_, other.tuple_);
-    } else {
-      return more_.weak_ord(index, other.more_);
-    }
-  }
-  inline constexpr auto partial_ord(size_t index, const Storage& other) const& {
-    if (index == I) {
-      return std::partial_order(tuple_, other.tuple_);
-    } else {
-      return more_.partial_ord(index, other.more_);
-    }
-  }
 
   inline constexpr decltype(auto) as() const& {
     return tuple_.template at<0>();
@@ -539,56 +310,10 @@ union Storage<I, ::sus::Tuple<Ts...>> {
 
   using Type = ::sus::Tuple<Ts...>;
 
-  inline constexpr void activate_for_construct(size_t index) {
-    sus_check(index == I);
-  }
   inline constexpr void construct(Type&& tuple) {
     std::construct_at(&tuple_, ::sus::move(tuple));
   }
   inline constexpr void assign(Type&& tuple) { tuple_ = ::sus::move(tuple); }
-  inline constexpr void move_construct(size_t index, Storage&& from) {
-    sus_check(index == I);
-    std::construct_at(&tuple_, ::sus::move(from.tuple_));
-  }
-  inline constexpr void move_assign(size_t index, Storage&& from) {
-    sus_check(index == I);
-    tuple_ = ::sus::move(from.tuple_);
-  }
-  inline constexpr void copy_construct(size_t index, const Storage& from) {
-    sus_check(index == I);
-    std::construct_at(&tuple_, from.tuple_);
-  }
-  inline constexpr void copy_assign(size_t index, const Storage& from) {
-    sus_check(index == I);
-    tuple_ = from.tuple_;
-  }
-  inline constexpr void clone_construct(size_t index, const Storage& from) {
-    sus_check(index == I);
-    std::construct_at(&tuple_, ::sus::clone(from.tuple_));
-  }
-  inline constexpr void destroy(size_t index) {
-    sus_check(index == I);
-    tuple_.~Type();
-  }
-  inline constexpr bool eq(size_t index, const Storage& other) const& noexcept {
-    sus_check(index == I);
-    return tuple_ == other.tuple_;
-  }
-  inline constexpr auto strong_ord(size_t index,
-                                   const Storage& other) const& noexcept {
-    sus_check(index == I);
-    return std::strong_order(tuple_, other.tuple_);
-  }
-  inline constexpr auto weak_ord(size_t index,
-                                 const Storage& other) const& noexcept {
-    sus_check(index == I);
-    return std::weak_order(tuple_, other.tuple_);
-  }
-  inline constexpr auto partial_ord(size_t index,
-                                    const Storage& other) const& noexcept {
-    sus_check(index == I);
-    return std::partial_order(tuple_, other.tuple_);
-  }
 
   constexpr auto as() const& {
     return [this]<size_t... Is>(std::index_sequence<Is...>) {
@@ -609,42 +334,6 @@ union Storage<I, ::sus::Tuple<Ts...>> {
 template <size_t I>
 union Storage<I, Nothing> {
   constexpr Storage() {}
-
-  inline constexpr void activate_for_construct(size_t index) {
-    sus_check(index == I);
-  }
-  inline constexpr void move_construct(size_t index, Storage&&) {
-    sus_check(index == I);
-  }
-  inline constexpr void move_assign(size_t index, Storage&&) {
-    sus_check(index == I);
-  }
-  inline constexpr void copy_construct(size_t index, const Storage&) {
-    sus_check(index == I);
-  }
-  inline constexpr void copy_assign(size_t index, const Storage&) {
-    sus_check(index == I);
-  }
-  inline constexpr void clone_construct(size_t index, const Storage&) {
-    sus_check(index == I);
-  }
-  inline constexpr void destroy(size_t index) { sus_check(index == I); }
-  inline constexpr bool eq(size_t index, const Storage&) const& {
-    sus_check(index == I);
-    return true;
-  }
-  inline constexpr auto strong_ord(size_t index, const Storage&) const& {
-    sus_check(index == I);
-    return std::strong_ordering::equivalent;
-  }
-  inline constexpr auto weak_ord(size_t index, const Storage&) const& {
-    sus_check(index == I);
-    return std::weak_ordering::equivalent;
-  }
-  inline constexpr auto partial_ord(size_t index, const Storage&) const& {
-    sus_check(index == I);
-    return std::partial_ordering::equivalent;
-  }
 };
 
 template <size_t I, class T>
@@ -672,9 +361,6 @@ union Storage<I, ::sus::Tuple<T>> {
 
   using Type = ::sus::Tuple<T>;
 
-  inline constexpr void activate_for_construct(size_t index) {
-    sus_check(index == I);
-  }
   template <class U>
   inline constexpr void construct(U&& value) {
     std::construct_at(&tuple_, ::sus::Tuple<T>(::sus::forward<U>(value)));
@@ -682,46 +368,6 @@ union Storage<I, ::sus::Tuple<T>> {
   inline constexpr void assign(T&& value) {
     tuple_ = Type(::sus::forward<T>(value));
   }
-  inline constexpr void move_construct(size_t index, Storage&& from) {
-    sus_check(index == I);
-    std::construct_at(&tuple_, ::sus::move(from.tuple_));
-  }
-  inline constexpr void move_assign(size_t index, Storage&& from) {
-    sus_check(index == I);
-    tuple_ = ::sus::move(from.tuple_);
-  }
-  inline constexpr void copy_construct(size_t index, const Storage& from) {
-    sus_check(index == I);
-    std::construct_at(&tuple_, from.tuple_);
-  }
-  inline constexpr void copy_assign(size_t index, const Storage& from) {
-    sus_check(index == I);
-    tuple_ = from.tuple_;
-  }
-  inline constexpr void clone_construct(size_t index, const Storage& from) {
-    sus_check(index == I);
-    std::construct_at(&tuple_, ::sus::clone(from.tuple_));
-  }
-  inline constexpr void destroy(size_t index) {
-    sus_check(index == I);
-    tuple_.~Type();
-  }
-  inline constexpr bool eq(size_t index, const Storage& other) const& {
-    sus_check(index == I);
-    return tuple_ == other.tuple_;
-  }
-  inline constexpr auto strong_ord(size_t index, const Storage& other) const& {
-    sus_check(index == I);
-    return std::strong_order(tuple_, other.tuple_);
-  }
-  inline constexpr auto weak_ord(size_t index, const Storage& other) const& {
-    sus_check(index == I);
-    return std::weak_order(tuple_, other.tuple_);
-  }
-  inline constexpr auto partial_ord(size_t index, const Storage& other) const& {
-    sus_check(index == I);
-    return std::partial_order(tuple_, other.tuple_);
-  }
 
   inline constexpr decltype(auto) as() const& {
     return tuple_.template at<0>();
@@ -791,4 +437,178 @@ static constexpr auto& find_choice_storage_mut(
   return storage;
 }
 
+/// Whether a level of the Storage holds values, or is for a tag with a `void`
+/// type.
+template <class S>
+concept StorageHoldsValues = requires(S& s) { s.tuple_; };
+
+template <size_t I, class S>
+static constexpr void destroy_choice_storage(
+    S& storage, std::integral_constant<size_t, I>) {
+  destroy_choice_storage(storage.more_,
+                         std::integral_constant<size_t, I - 1u>());
+  std::destroy_at(&storage.more_);
+}
+
+template <class S>
+static constexpr void destroy_choice_storage(
+    S& storage, std::integral_constant<size_t, 0>) {
+  if constexpr (StorageHoldsValues<S>) std::destroy_at(&storage.tuple_);
+}
+
+// The operations on a whole Storage below receive the index of its active
+// member and dispatch to the operation on that member's level with
+// `dispatch_index()`, in constant time.
+
+template <class... Ts>
+static constexpr void storage_destroy(size_t index,
+                                      Storage<0, Ts...>& storage) {
+  dispatch_index<sizeof...(Ts)>(
+      index, [&]<size_t I>(std::integral_constant<size_t, I> i) {
+        destroy_choice_storage(storage, i);
+      });
+}
+
+template <class... Ts>
+static constexpr void storage_move_construct(size_t index,
+                                             Storage<0, Ts...>& to,
+                                             Storage<0, Ts...>&& from) {
+  dispatch_index<sizeof...(Ts)>(
+      index, [&]<size_t I>(std::integral_constant<size_t, I>) {
+        auto& t = construct_choice_storage<I>(to);
+        if constexpr (StorageHoldsValues<decltype(t)>) {
+          auto& f = find_choice_storage_mut<I>(from);
+          std::construct_at(&t.tuple_, ::sus::move(f.tuple_));
+        }
+      });
+}
+
+template <class... Ts>
+static constexpr void storage_move_assign(size_t index, Storage<0, Ts...>& to,
+                                          Storage<0, Ts...>&& from) {
+  dispatch_index<sizeof...(Ts)>(
+      index, [&]<size_t I>(std::integral_constant<size_t, I>) {
+        auto& t = find_choice_storage_mut<I>(to);
+        if constexpr (StorageHoldsValues<decltype(t)>)
+          t.tuple_ = ::sus::move(find_choice_storage_mut<I>(from).tuple_);
+      });
+}
+
+template <class... Ts>
+static constexpr void storage_copy_construct(size_t index,
+                                             Storage<0, Ts...>& to,
+                                             const Storage<0, Ts...>& from) {
+  dispatch_index<sizeof...(Ts)>(
+      index, [&]<size_t I>(std::integral_constant<size_t, I>) {
+        auto& t = construct_choice_storage<I>(to);
+        if constexpr (StorageHoldsValues<decltype(t)>)
+          std::construct_at(&t.tuple_, find_choice_storage<I>(from).tuple_);
+      });
+}
+
+template <class... Ts>
+static constexpr void storage_copy_assign(size_t index, Storage<0, Ts...>& to,
+                                          const Storage<0, Ts...>& from) {
+  dispatch_index<sizeof...(Ts)>(
+      index, [&]<size_t I>(std::integral_constant<size_t, I>) {
+        auto& t = find_choice_storage_mut<I>(to);
+        if constexpr (StorageHoldsValues<decltype(t)>)
+          t.tuple_ = find_choice_storage<I>(from).tuple_;
+      });
+}
+
+template <class... Ts>
+static constexpr void storage_clone_construct(size_t index,
+                                              Storage<0, Ts...>& to,
+                                              const Storage<0, Ts...>& from) {
+  dispatch_index<sizeof...(Ts)>(
+      index, [&]<size_t I>(std::integral_constant<size_t, I>) {
+        auto& t = construct_choice_storage<I>(to);
+        if constexpr (StorageHoldsValues<decltype(t)>) {
+          std::construct_at(&t.tuple_,
+                            ::sus::clone(find_choice_storage<I>(from).tuple_));
+        }
+      });
+}
+
+template <class... Ts, class... Us>
+static constexpr bool storage_eq(size_t index, const Storage<0, Ts...>& l,
+                                 const Storage<0, Us...>& r) {
+  return dispatch_index<sizeof...(Ts)>(
+      index, [&]<size_t I>(std::integral_constant<size_t, I>) -> bool {
+        const auto& ls = find_choice_storage<I>(l);
+        if constexpr (StorageHoldsValues<decltype(ls)>)
+          return ls.tuple_ == find_choice_storage<I>(r).tuple_;
+        else
+          return true;
+      });
+}
+
+template <class... Ts, class... Us>
+static constexpr std::strong_ordering storage_strong_ord(
+    size_t index, const Storage<0, Ts...>& l, const Storage<0, Us...>& r) {
+  return dispatch_index<sizeof...(Ts)>(
+      index,
+      [&]<size_t I>(std::integral_constant<size_t, I>) -> std::strong_ordering {
+        const auto& ls = find_choice_storage<I>(l);
+        if constexpr (StorageHoldsValues<decltype(ls)>)
+          return std::strong_order(ls.tuple_, find_choice_storage<I>(r).tuple_);
+        else
+          return std::strong_ordering::equivalent;
+      });
+}
+
+template <class... Ts, class... Us>
+static constexpr std::weak_ordering storage_weak_ord(
+    size_t index, const Storage<0, Ts...>& l, const Storage<0, Us...>& r) {
+  return dispatch_index<sizeof...(Ts)>(
+      index,
+      [&]<size_t I>(std::integral_constant<size_t, I>) -> std::weak_ordering {
+        const auto& ls = find_choice_storage<I>(l);
+        if constexpr (StorageHoldsValues<decltype(ls)>)
+          return std::weak_order(ls.tuple_, find_choice_storage<I>(r).tuple_);
+        else
+          return std::weak_ordering::equivalent;
+      });
+}
+
+template <class... Ts, class... Us>
+static constexpr std::partial_ordering storage_partial_ord(
+    size_t index, const Storage<0, Ts...>& l, const Storage<0, Us...>& r) {
+  return dispatch_index<sizeof...(Ts)>(
+      index,
+      [&]<size_t I>(
+          std::integral_constant<size_t, I>) -> std::partial_ordering {
+        const auto& ls = find_choice_storage<I>(l);
+        if constexpr (StorageHoldsValues<decltype(ls)>) {
+          return std::partial_order(ls.tuple_,
+                                    find_choice_storage<I>(r).tuple_);
+        } else {
+          return std::partial_ordering::equivalent;
+        }
+      });
+}
+
+/// Calls `f` with `args` followed by a reference to each value stored at the
+/// level `S` of the Storage.
+template <class S, class F, class... Args>
+static constexpr decltype(auto) call_with_choice_values(S& storage, F&& f,
+                                                        Args&&... args) {
+  if constexpr (StorageHoldsValues<S>) {
+    constexpr size_t count =
+        StorageCount<typename std::remove_const_t<S>::Type>;
+    return [&]<size_t... Is>(std::index_sequence<Is...>) -> decltype(auto) {
+      if constexpr (std::is_const_v<S>) {
+        return ::sus::forward<F>(f)(::sus::forward<Args>(args)...,
+                                    storage.tuple_.template at<Is>()...);
+      } else {
+        return ::sus::forward<F>(f)(::sus::forward<Args>(args)...,
+                                    storage.tuple_.template at_mut<Is>()...);
+      }
+    }(std::make_index_sequence<count>());
+  } else {
+    return ::sus::forward<F>(f)(::sus::forward<Args>(args)...);
+  }
+}
+
 }  // namespace sus::choice_type::__private
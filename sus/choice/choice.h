@@ -25,6 +25,7 @@
 #include "sus/choice/__private/index_of_value.h"
 #include "sus/choice/__private/index_type.h"
 #include "sus/choice/__private/ops_concepts.h"
+#include "sus/choice/__private/overloaded.h"
 #include "sus/choice/__private/pack_index.h"
 #include "sus/choice/__private/storage.h"
 #include "sus/choice/__private/type_list.h"
@@ -127,6 +128,13 @@ struct CanConvertToStorage<I, ::sus::tuple_type::Tuple<Ts...>, U> {
 ///   reference to the values attached to the tag if its currently active, and
 ///   returns `None` if the tag is not active.
 ///
+/// The values of whichever tag is active can be accessed without naming the
+/// tag:
+/// * [`visit(f)`]($sus::choice_type::Choice::visit) calls `f` with the active
+///   tag and references to its values.
+/// * [`match(fs...)`]($sus::choice_type::Choice::match) calls the function in
+///   `fs` that accepts the active member's values.
+///
 /// # Examples
 /// This `Choice` holds either a [`u64`]($sus::num::u64) with
 /// the `First` tag or a [`u32`]($sus::num::u32) with the `Second` tag.
@@ -316,8 +324,7 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
         "`const i16&, u32` parameters but it can be constructed from "
         " `i32, u16`.");
     auto u = Choice(index<V>);
-    u.storage_.activate_for_construct(index<V>);
-    find_choice_storage_mut<index<V>>(u.storage_)
+    __private::construct_choice_storage<index<V>>(u.storage_)
         .construct(StorageType(::sus::forward<U>(value)));
     return u;
   }
@@ -342,8 +349,7 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
         "`const i16&, u32` parameters but it can be constructed from "
         " `i32, u16`.");
     auto u = Choice(index<V>);
-    u.storage_.activate_for_construct(index<V>);
-    find_choice_storage_mut<index<V>>(u.storage_)
+    __private::construct_choice_storage<index<V>>(u.storage_)
         .construct(StorageType(::sus::forward<Us>(values)...));
     return u;
   }
@@ -357,7 +363,7 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
                std::is_trivially_destructible_v<Ts>))
   {
     if (index_ != kUseAfterMove && index_ != kNeverValue)
-      storage_.destroy(index_);
+      __private::storage_destroy(index_, storage_);
   }
 
   /// Move constructor.
@@ -380,7 +386,8 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
                                    // the tag to an unused value.
                                    kUseAfterMove)) {
     sus_check(index_ != kUseAfterMove);
-    storage_.move_construct(index_, ::sus::move(o.storage_));
+    __private::storage_move_construct(index_, storage_,
+                                      ::sus::move(o.storage_));
   }
   /// #[doc.overloads=move]
   Choice(Choice&& o)
@@ -405,11 +412,13 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
   {
     sus_check(o.index_ != kUseAfterMove);
     if (index_ == o.index_) {
-      storage_.move_assign(index_, ::sus::move(o.storage_));
+      __private::storage_move_assign(index_, storage_,
+                                     ::sus::move(o.storage_));
     } else {
-      if (index_ != kUseAfterMove) storage_.destroy(index_);
+      if (index_ != kUseAfterMove) __private::storage_destroy(index_, storage_);
       index_ = ::sus::move(o.index_);
-      storage_.move_construct(index_, ::sus::move(o.storage_));
+      __private::storage_move_construct(index_, storage_,
+                                      ::sus::move(o.storage_));
     }
     o.index_ = kUseAfterMove;
     return *this;
@@ -436,7 +445,7 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
                std::is_trivially_copy_constructible_v<Ts>))
       : index_(o.index_) {
     sus_check(o.index_ != kUseAfterMove);
-    storage_.copy_construct(index_, o.storage_);
+    __private::storage_copy_construct(index_, storage_, o.storage_);
   }
   /// #[doc.overloads=copy]
   Choice(const Choice& o)
@@ -461,11 +470,11 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
   {
     sus_check(o.index_ != kUseAfterMove);
     if (index_ == o.index_) {
-      storage_.copy_assign(index_, o.storage_);
+      __private::storage_copy_assign(index_, storage_, o.storage_);
     } else {
-      if (index_ != kUseAfterMove) storage_.destroy(index_);
+      if (index_ != kUseAfterMove) __private::storage_destroy(index_, storage_);
       index_ = o.index_;
-      storage_.copy_construct(index_, o.storage_);
+      __private::storage_copy_construct(index_, storage_, o.storage_);
     }
     return *this;
   }
@@ -482,7 +491,7 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
   {
     sus_check(index_ != kUseAfterMove);
     auto u = Choice(::sus::clone(index_));
-    u.storage_.clone_construct(index_, storage_);
+    __private::storage_clone_construct(index_, u.storage_, storage_);
     return u;
   }
 
@@ -665,7 +674,7 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
     requires(__private::StorageCount<StorageTypeOfTag<V>> == 0u)
   constexpr void set() & noexcept {
     if (index_ != index<V>) {
-      if (index_ != kUseAfterMove) storage_.destroy(index_);
+      if (index_ != kUseAfterMove) __private::storage_destroy(index_, storage_);
       index_ = index<V>;
     }
   }
@@ -690,10 +699,9 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
       __private::find_choice_storage_mut<index<V>>(storage_).assign(
           ::sus::forward<U>(value));
     } else {
-      if (index_ != kUseAfterMove) storage_.destroy(index_);
+      if (index_ != kUseAfterMove) __private::storage_destroy(index_, storage_);
       index_ = index<V>;
-      storage_.activate_for_construct(index<V>);
-      __private::find_choice_storage_mut<index<V>>(storage_).construct(
+      __private::construct_choice_storage<index<V>>(storage_).construct(
           ::sus::forward<U>(value));
     }
   }
@@ -721,10 +729,9 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
       __private::find_choice_storage_mut<index<V>>(storage_).assign(
           StorageType(::sus::forward<Us>(values)...));
     } else {
-      if (index_ != kUseAfterMove) storage_.destroy(index_);
+      if (index_ != kUseAfterMove) __private::storage_destroy(index_, storage_);
       index_ = index<V>;
-      storage_.activate_for_construct(index<V>);
-      __private::find_choice_storage_mut<index<V>>(storage_).construct(
+      __private::construct_choice_storage<index<V>>(storage_).construct(
           StorageType(::sus::forward<Us>(values)...));
     }
   }
@@ -777,6 +784,128 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
     return __private::find_choice_storage_mut<index<V>>(storage_).as_mut();
   }
 
+  /// Calls `f` with the tag of the active member followed by a const reference
+  /// to each of its values, and returns the result of `f`.
+  ///
+  /// The tag is passed as a `std::integral_constant`, so a generic lambda can
+  /// compare it in an `if constexpr` to handle each tag. A tag whose type is
+  /// `void` passes only the tag. The function must return the same type for
+  /// every tag.
+  ///
+  /// Like a `switch` on the tag, this jumps to the active member in constant
+  /// time, however many members the `Choice` has.
+  ///
+  /// # Panics
+  /// The function will panic if the `Choice` has been moved from.
+  ///
+  /// # Examples
+  /// ```
+  /// enum class Order { First, Second };
+  /// using EitherOr = Choice<sus_choice_types(
+  ///     (Order::First, u64),
+  ///     (Order::Second, std::string, i32)
+  /// )>;
+  /// auto e = EitherOr::with<Order::Second>("text", 4);
+  /// e.visit([](auto tag, const auto&... values) {
+  ///   if constexpr (tag == Order::First) {
+  ///     fmt::println("First has u64 {}", values...);
+  ///   } else {
+  ///     // Prints "Second has text and 4".
+  ///     fmt::println("Second has {} and {}", values...);
+  ///   }
+  /// });
+  /// ```
+  template <class F>
+  constexpr decltype(auto) visit(F&& f) const& noexcept {
+    sus_check(index_ != kUseAfterMove);
+    return __private::dispatch_index<sizeof...(Ts)>(
+        size_t{index_},
+        [&]<size_t I>(std::integral_constant<size_t, I>) -> decltype(auto) {
+          constexpr TagsType tags[] = {Tags...};
+          return __private::call_with_choice_values(
+              __private::find_choice_storage<I>(storage_),
+              ::sus::forward<F>(f),
+              std::integral_constant<TagsType, tags[I]>());
+        });
+  }
+  /// Calls `f` with the tag of the active member followed by a mutable
+  /// reference to each of its values, and returns the result of `f`.
+  ///
+  /// See the const overload of `visit()` for details.
+  template <class F>
+  constexpr decltype(auto) visit(F&& f) & noexcept {
+    sus_check(index_ != kUseAfterMove);
+    return __private::dispatch_index<sizeof...(Ts)>(
+        size_t{index_},
+        [&]<size_t I>(std::integral_constant<size_t, I>) -> decltype(auto) {
+          constexpr TagsType tags[] = {Tags...};
+          return __private::call_with_choice_values(
+              __private::find_choice_storage_mut<I>(storage_),
+              ::sus::forward<F>(f),
+              std::integral_constant<TagsType, tags[I]>());
+        });
+  }
+
+  /// Calls the function from `fs` that overload resolution picks for the
+  /// values of the active member, passing a const reference to each of them,
+  /// and returns its result.
+  ///
+  /// A tag whose type is `void` calls the function that takes no arguments.
+  /// Each function must return the same type. Tags whose values have the same
+  /// types can not be told apart by `match()`, use
+  /// [`visit`]($sus::choice_type::Choice::visit) to receive the tag as well.
+  ///
+  /// Like a `switch` on the tag, this jumps to the active member in constant
+  /// time, however many members the `Choice` has.
+  ///
+  /// # Panics
+  /// The function will panic if the `Choice` has been moved from.
+  ///
+  /// # Examples
+  /// ```
+  /// enum class Kind { Text, Number, Quit };
+  /// using Message = Choice<sus_choice_types(
+  ///     (Kind::Text, std::string),
+  ///     (Kind::Number, i32),
+  ///     (Kind::Quit, void)
+  /// )>;
+  /// auto m = Message::with<Kind::Number>(7);
+  /// std::string s = m.match(
+  ///     [](const std::string& text) { return text; },
+  ///     [](i32 n) { return fmt::to_string(n); },
+  ///     []() { return std::string("quit"); });
+  /// sus_check(s == "7");
+  /// ```
+  template <class... Fs>
+  constexpr decltype(auto) match(Fs&&... fs) const& noexcept {
+    sus_check(index_ != kUseAfterMove);
+    auto f = __private::Overloaded<std::remove_cvref_t<Fs>...>{
+        ::sus::forward<Fs>(fs)...};
+    return __private::dispatch_index<sizeof...(Ts)>(
+        size_t{index_},
+        [&]<size_t I>(std::integral_constant<size_t, I>) -> decltype(auto) {
+          return __private::call_with_choice_values(
+              __private::find_choice_storage<I>(storage_), f);
+        });
+  }
+  /// Calls the function from `fs` that overload resolution picks for the
+  /// values of the active member, passing a mutable reference to each of
+  /// them, and returns its result.
+  ///
+  /// See the const overload of `match()` for details.
+  template <class... Fs>
+  constexpr decltype(auto) match(Fs&&... fs) & noexcept {
+    sus_check(index_ != kUseAfterMove);
+    auto f = __private::Overloaded<std::remove_cvref_t<Fs>...>{
+        ::sus::forward<Fs>(fs)...};
+    return __private::dispatch_index<sizeof...(Ts)>(
+        size_t{index_},
+        [&]<size_t I>(std::integral_constant<size_t, I>) -> decltype(auto) {
+          return __private::call_with_choice_values(
+              __private::find_choice_storage_mut<I>(storage_), f);
+        });
+  }
+
   /// Compares two `Choice`s for equality if the
   /// types inside satisfy [`Eq`]($sus::cmp::Eq).
   ///
@@ -786,7 +915,8 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
                                    TagsType, __private::TypeList<Ts...>>)
   {
     sus_check(l.index_ != kUseAfterMove && r.index_ != kUseAfterMove);
-    return l.index_ == r.index_ && l.storage_.eq(l.index_, r.storage_);
+    return l.index_ == r.index_ &&
+           __private::storage_eq(l.index_, l.storage_, r.storage_);
   }
 
   template <class... Us, auto V, auto... Vs>
@@ -796,7 +926,8 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
       const Choice& l,
       const Choice<__private::TypeList<Us...>, V, Vs...>& r) noexcept {
     sus_check(l.index_ != kUseAfterMove && r.index_ != kUseAfterMove);
-    return l.index_ == r.index_ && l.storage_.eq(l.index_, r.storage_);
+    return l.index_ == r.index_ &&
+           __private::storage_eq(l.index_, l.storage_, r.storage_);
   }
 
   template <class... Us, auto V, auto... Vs>
@@ -822,7 +953,8 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
     if (value_order != std::strong_ordering::equivalent) {
       return value_order;
     } else {
-      return l.storage_.strong_ord(l.index_, r.storage_);
+      return __private::storage_strong_ord(l.index_, l.storage_,
+                                           r.storage_);
     }
   }
 
@@ -838,7 +970,8 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
     if (value_order != std::strong_ordering::equivalent) {
       return value_order;
     } else {
-      return l.storage_.strong_ord(l.index_, r.storage_);
+      return __private::storage_strong_ord(l.index_, l.storage_,
+                                           r.storage_);
     }
   }
 
@@ -852,7 +985,7 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
     if (value_order != std::weak_ordering::equivalent) {
       return value_order;
     } else {
-      return l.storage_.weak_ord(l.index_, r.storage_);
+      return __private::storage_weak_ord(l.index_, l.storage_, r.storage_);
     }
   }
 
@@ -867,7 +1000,7 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
     if (value_order != std::weak_ordering::equivalent) {
       return value_order;
     } else {
-      return l.storage_.weak_ord(l.index_, r.storage_);
+      return __private::storage_weak_ord(l.index_, l.storage_, r.storage_);
     }
   }
 
@@ -882,7 +1015,8 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
     if (value_order != std::partial_ordering::equivalent) {
       return value_order;
     } else {
-      return l.storage_.partial_ord(l.index_, r.storage_);
+      return __private::storage_partial_ord(l.index_, l.storage_,
+                                            r.storage_);
     }
   }
 
@@ -898,7 +1032,8 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
     if (value_order != std::partial_ordering::equivalent) {
       return value_order;
     } else {
-      return l.storage_.partial_ord(l.index_, r.storage_);
+      return __private::storage_partial_ord(l.index_, l.storage_,
+                                            r.storage_);
     }
   }
 
@@ -929,8 +1064,18 @@ class Choice<__private::TypeList<Ts...>, Tags...> final {
   sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn, IndexType,
                                            Ts...);
 
-  sus_class_never_value_field(::sus::marker::unsafe_fn, Choice, index_,
-                              kNeverValue, kNeverValue);
+  // The ~0 index is the never-value, and the indices between the last member
+  // and the moved-from index are further niches, counting down from
+  // `kUseAfterMove`.
+  static constexpr size_t kNicheCount =
+      1u + size_t{kUseAfterMove} - sizeof...(Tags);
+  static constexpr IndexType never_value_niche(size_t niche) noexcept {
+    if (niche == 0u) return kNeverValue;
+    return static_cast<IndexType>(kUseAfterMove - niche);
+  }
+  sus_class_never_value_field_niches(::sus::marker::unsafe_fn, Choice, index_,
+                                     kNicheCount, never_value_niche,
+                                     kNeverValue);
   // For the NeverValueField.
   constexpr Choice(sus::mem::NeverValueConstructor) noexcept
       : index_(kNeverValue) {}
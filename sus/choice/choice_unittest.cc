@@ -98,6 +98,17 @@ TEST(Choice, NeverValue) {
   static_assert(!std::is_standard_layout_v<Two>);
   static_assert(sus::mem::NeverValueField<Two>);
   static_assert(sizeof(sus::Option<Two>) == sizeof(Two));
+
+  // The unused index values are further niches, which nested `Option`s use.
+  static_assert(sus::mem::never_value_niche_count<One>() > 2u);
+  static_assert(sizeof(sus::Option<sus::Option<One>>) == sizeof(One));
+  auto o = sus::Option<sus::Option<One>>(sus::Option<One>());
+  EXPECT_EQ(o.is_some(), true);
+  EXPECT_EQ(o->is_none(), true);
+  o = sus::none();
+  EXPECT_EQ(o.is_none(), true);
+  o = sus::some(sus::some(One::with<Order::Second>(3u)));
+  EXPECT_EQ(o->as_value().which(), Order::Second);
 }
 
 TEST(Choice, ConstructorFunctionNoValue) {
@@ -950,6 +961,125 @@ TEST(Choice, VoidValues) {
   EXPECT_LT(u4, u6);
 }
 
+TEST(Choice, Visit) {
+  using U = Choice<sus_choice_types((Order::First, u32),
+                                    (Order::Second, void),
+                                    (Order::Third, std::string, i32))>;
+  auto count_values = [](auto tag, const auto&... values) {
+    return sus::Tuple<Order, usize>(tag(), sizeof...(values));
+  };
+  EXPECT_EQ(U::with<Order::First>(2u).visit(count_values),
+            sus::tuple(Order::First, 1_usize));
+  EXPECT_EQ(U::with<Order::Second>().visit(count_values),
+            sus::tuple(Order::Second, 0_usize));
+  EXPECT_EQ(U::with<Order::Third>("text", 4).visit(count_values),
+            sus::tuple(Order::Third, 2_usize));
+
+  // Mutable access to the values.
+  auto u = U::with<Order::Third>("text", 4);
+  u.visit([](auto tag, auto&... values) {
+    if constexpr (tag == Order::Third) {
+      auto add = [](std::string& s, i32& i) {
+        s += "s";
+        i += 1;
+      };
+      add(values...);
+    }
+  });
+  const auto& [s, i] = u.as<Order::Third>();
+  EXPECT_EQ(s, "texts");
+  EXPECT_EQ(i, 5_i32);
+}
+
+TEST(Choice, Match) {
+  using U = Choice<sus_choice_types((Order::First, u32),
+                                    (Order::Second, void),
+                                    (Order::Third, std::string, i32))>;
+  auto describe = [](const U& u) {
+    return u.match(
+        [](const u32& i) { return fmt::format("u32 {}", i); },
+        []() { return std::string("void"); },
+        [](const std::string& s, const i32& i) {
+          return fmt::format("{} {}", s, i);
+        });
+  };
+  EXPECT_EQ(describe(U::with<Order::First>(2u)), "u32 2");
+  EXPECT_EQ(describe(U::with<Order::Second>()), "void");
+  EXPECT_EQ(describe(U::with<Order::Third>("text", 4)), "text 4");
+
+  // Mutable access to the values.
+  auto u = U::with<Order::First>(2u);
+  u.match([](u32& i) { i += 1u; }, []() {}, [](std::string&, i32&) {});
+  EXPECT_EQ(u.as<Order::First>(), 3u);
+}
+
+template <size_t>
+using StringStorage = sus::Tuple<std::string>;
+
+template <size_t... Is>
+auto many_strings(std::index_sequence<Is...>)
+    -> Choice<sus::choice_type::__private::TypeList<StringStorage<Is>...>,
+              Is...>;
+
+// A Choice with `N` members, which each hold a string.
+template <size_t N>
+using ManyStrings = decltype(many_strings(std::make_index_sequence<N>()));
+
+template <size_t N>
+void check_many_members() {
+  constexpr size_t kLast = N - 1u;
+  auto a = ManyStrings<N>::template with<kLast>(std::string("last"));
+  auto b = ManyStrings<N>::template with<1u>(std::string("one"));
+
+  auto c = a;
+  EXPECT_EQ(c, a);
+  EXPECT_NE(c, b);
+  EXPECT_LT(b, a);
+  EXPECT_GT(ManyStrings<N>::template with<1u>(std::string("x")), b);
+  c = b;
+  EXPECT_EQ(c.template as<1u>(), "one");
+  auto d = sus::move(c);
+  c = sus::move(a);
+  EXPECT_EQ(c.template as<kLast>(), "last");
+
+  auto visit_size = [](auto tag, const std::string& s) {
+    return tag() * 100u + s.size();
+  };
+  EXPECT_EQ(d.visit(visit_size), 103u);
+  d.template set<kLast>(std::string("at the end"));
+  EXPECT_EQ(d.visit(visit_size), kLast * 100u + 10u);
+  EXPECT_EQ(d.match([](const std::string& s) { return s; }), "at the end");
+}
+
+TEST(Choice, ManyMembers) {
+  // Each size is dispatched differently: with a small switch, a large switch
+  // and a table of function pointers.
+  check_many_members<4u>();
+  check_many_members<20u>();
+  check_many_members<70u>();
+}
+
+TEST(ChoiceDeathTest, VisitAfterMove) {
+  using U = Choice<sus_choice_types((Order::First, std::string),
+                                    (Order::Second, void))>;
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto u = U::with<Order::First>("text");
+        auto v = sus::move(u);
+        u.visit([](auto, const auto&...) {});
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto u = U::with<Order::First>("text");
+        auto v = sus::move(u);
+        u.match([](const std::string&) {}, []() {});
+      },
+      "");
+#endif
+}
+
 TEST(Choice, fmt) {
   auto u = Choice<sus_choice_types(
       (Order::First, u32), (Order::Second, void))>::with<Order::First>(4u);
@@ -0,0 +1,189 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "sus/assertions/check.h"
+#include "sus/macros/inline.h"
+#include "sus/num/__private/check_integer_overflow.h"
+#include "sus/num/__private/intrinsics.h"
+#include "sus/num/float_concepts.h"
+#include "sus/num/integer_concepts.h"
+
+namespace sus::collections::__private {
+
+/// The numeric types which slices provide arithmetic kernels for.
+template <class T>
+concept SliceNumeric = ::sus::num::IntegerNumeric<T> || ::sus::num::Float<T>;
+
+template <class T>
+using NumericPrimitive = std::remove_cvref_t<decltype(T::primitive_value)>;
+
+/// The number of elements summed between overflow checks in a scan. Overflow
+/// is recorded without branching inside a block, and checked at its end.
+constexpr size_t kScanBlock = 256u;
+
+/// Computes `a * b + c` with a fused multiply-add where the target has an
+/// instruction for it, as [`f32::mul_add`]($sus::num::f32::mul_add) does.
+/// Elsewhere the fused operation is a slow library call, so the multiply and
+/// add are done separately, which can round differently in the last bit.
+template <class P>
+__sus_pure_const _sus_always_inline constexpr P mul_add(P a, P b,
+                                                       P c) noexcept {
+#if defined(__FMA__) || defined(__ARM_FEATURE_FMA)
+  if (!std::is_constant_evaluated()) return ::fma(a, b, c);
+#endif
+  return a * b + c;
+}
+template <>
+__sus_pure_const _sus_always_inline constexpr float mul_add(float a, float b,
+                                                           float c) noexcept {
+#if defined(__FMA__) || defined(__ARM_FEATURE_FMA)
+  if (!std::is_constant_evaluated()) return ::fmaf(a, b, c);
+#endif
+  return a * b + c;
+}
+
+/// Writes the running sums of `src`, starting from `carry`, to `dst` and
+/// returns the sum of everything.
+///
+/// An inclusive scan writes the sum up to and including each element, and an
+/// exclusive scan writes the sum of the elements before it. The `src` and
+/// `dst` pointers may be equal, but the ranges must not otherwise overlap.
+///
+/// Integer sums panic on overflow, which is checked once per block of
+/// elements. Float sums are added in order, so give the same results as a
+/// loop.
+template <bool Exclusive, class T>
+constexpr T scan(const T* src, T* dst, size_t len, T carry) noexcept {
+  using P = NumericPrimitive<T>;
+  P sum = carry.primitive_value;
+  if constexpr (::sus::num::Float<T>) {
+    for (size_t i = 0u; i < len; ++i) {
+      const P x = src[i].primitive_value;
+      if constexpr (Exclusive) dst[i].primitive_value = sum;
+      sum += x;
+      if constexpr (!Exclusive) dst[i].primitive_value = sum;
+    }
+  } else if constexpr (std::is_unsigned_v<P> && sizeof(P) <= 4u) {
+    // Small unsigned sums are accumulated in 64 bits, where a block can not
+    // overflow. The sums never decrease, so a block overflowed if and only if
+    // its last sum does not fit in `P`. This avoids recording a carry flag at
+    // each addition.
+    uint64_t wide = sum;
+    size_t i = 0u;
+    while (i < len) {
+      const size_t end = i + (len - i < kScanBlock ? len - i : kScanBlock);
+      for (; i < end; ++i) {
+        const uint64_t x = src[i].primitive_value;
+        if constexpr (Exclusive) dst[i].primitive_value = static_cast<P>(wide);
+        wide += x;
+        if constexpr (!Exclusive) dst[i].primitive_value = static_cast<P>(wide);
+      }
+      if constexpr (SUS_CHECK_INTEGER_OVERFLOW) {
+        sus_check_with_message(wide <= ::sus::num::__private::max_value<P>(),
+                               "attempt to add with overflow");
+      }
+    }
+    sum = static_cast<P>(wide);
+  } else {
+    size_t i = 0u;
+    while (i < len) {
+      const size_t end = i + (len - i < kScanBlock ? len - i : kScanBlock);
+      bool overflow = false;
+      for (; i < end; ++i) {
+        const P x = src[i].primitive_value;
+        if constexpr (Exclusive) dst[i].primitive_value = sum;
+        const auto out = ::sus::num::__private::add_with_overflow(sum, x);
+        overflow |= out.overflow;
+        sum = out.value;
+        if constexpr (!Exclusive) dst[i].primitive_value = sum;
+      }
+      if constexpr (SUS_CHECK_INTEGER_OVERFLOW)
+        sus_check_with_message(!overflow, "attempt to add with overflow");
+    }
+  }
+  return T(sum);
+}
+
+/// Returns the sum of `src`, wrapping around on integer overflow. This is the
+/// first pass of a parallel scan, which checks for overflow in its second
+/// pass.
+template <class T>
+constexpr T wrapping_sum(const T* src, size_t len) noexcept {
+  using P = NumericPrimitive<T>;
+  P sum = P{0};
+  for (size_t i = 0u; i < len; ++i) {
+    if constexpr (::sus::num::Float<T>)
+      sum += src[i].primitive_value;
+    else
+      sum = ::sus::num::__private::wrapping_add(sum, src[i].primitive_value);
+  }
+  return T(sum);
+}
+
+/// Returns the sum of products of `a` and `b`.
+///
+/// Products are added into many independent accumulators, which the compiler
+/// keeps in vector registers, so the sum is not rounded in the order of a
+/// loop.
+template <class T>
+T dot(const T* a, const T* b, size_t len) noexcept {
+  using P = NumericPrimitive<T>;
+  // Enough accumulators to cover the latency of a fused multiply-add on
+  // several 32 byte vectors at once.
+  constexpr size_t kAcc = 128u / sizeof(P);
+  P acc[kAcc] = {};
+  size_t i = 0u;
+  for (; len - i >= kAcc; i += kAcc) {
+    for (size_t k = 0u; k < kAcc; ++k) {
+      acc[k] = mul_add(a[i + k].primitive_value, b[i + k].primitive_value,
+                       acc[k]);
+    }
+  }
+  for (size_t k = 0u; i < len; ++i, ++k) {
+    acc[k] = mul_add(a[i].primitive_value, b[i].primitive_value, acc[k]);
+  }
+  // Add the accumulators pairwise.
+  for (size_t width = kAcc / 2u; width > 0u; width /= 2u) {
+    for (size_t k = 0u; k < width; ++k) acc[k] += acc[k + width];
+  }
+  return T(acc[0u]);
+}
+
+/// Computes `y = a * x + y`.
+template <class T>
+void axpy(T a, const T* x, T* y, size_t len) noexcept {
+  using P = NumericPrimitive<T>;
+  const P ap = a.primitive_value;
+  for (size_t i = 0u; i < len; ++i) {
+    y[i].primitive_value =
+        mul_add(ap, x[i].primitive_value, y[i].primitive_value);
+  }
+}
+
+/// Runs a scan on multiple threads. Defined in
+/// `sus/collections/parallel_scan.h`, which must be included to use it.
+template <class T>
+struct ParallelScan;
+
+}  // namespace sus::collections::__private
@@ -32,6 +32,7 @@
 #include "sus/construct/default.h"
 #include "sus/fn/fn_concepts.h"
 #include "sus/iter/iterator_loop.h"
+#include "sus/lib/__private/forward_decl.h"
 #include "sus/macros/__private/compiler_bugs.h"
 #include "sus/macros/lifetimebound.h"
 #include "sus/macros/no_unique_address.h"
@@ -41,6 +42,7 @@
 #include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/num/cast.h"
 #include "sus/num/num_concepts.h"
 #include "sus/num/signed_integer.h"
 #include "sus/num/unsigned_integer.h"
@@ -267,6 +269,32 @@ class Array final {
     return *(storage_.data_ + i);
   }
 
+  /// Returns a reference to the element at index `i`, where the range of the
+  /// [`Bounded`]($sus::num::Bounded) index is known to be inside the array, so
+  /// there is no bounds check.
+  ///
+  /// #[doc.overloads=array.index.bounded]
+  template <::sus::num::IntegerNumeric U, decltype(U::primitive_value) Lo,
+            decltype(U::primitive_value) Hi>
+    requires(std::cmp_greater_equal(Lo, 0) && std::cmp_less(Hi, N))
+  constexpr inline const T& operator[](
+      ::sus::num::Bounded<U, Lo, Hi> i) const& noexcept sus_lifetimebound {
+    return *(storage_.data_ + ::sus::cast<usize>(i.get()));
+  }
+  template <::sus::num::IntegerNumeric U, decltype(U::primitive_value) Lo,
+            decltype(U::primitive_value) Hi>
+    requires(std::cmp_greater_equal(Lo, 0) && std::cmp_less(Hi, N))
+  constexpr inline const T& operator[](::sus::num::Bounded<U, Lo, Hi> i) && =
+      delete;
+  /// #[doc.overloads=array.index.bounded]
+  template <::sus::num::IntegerNumeric U, decltype(U::primitive_value) Lo,
+            decltype(U::primitive_value) Hi>
+    requires(std::cmp_greater_equal(Lo, 0) && std::cmp_less(Hi, N))
+  constexpr inline T& operator[](::sus::num::Bounded<U, Lo, Hi> i) & noexcept
+      sus_lifetimebound {
+    return *(storage_.data_ + ::sus::cast<usize>(i.get()));
+  }
+
   /// Returns a const pointer to the first element in the array.
   constexpr inline const T* as_ptr() const& noexcept sus_lifetimebound
     requires(N > 0)
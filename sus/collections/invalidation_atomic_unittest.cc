@@ -0,0 +1,67 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This test is built with SUS_ITERATOR_INVALIDATION defined to 2.
+
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/vec.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+static_assert(SUS_ITERATOR_INVALIDATION == 2);
+
+namespace {
+
+using sus::test::ensure_use;
+
+TEST(InvalidationAtomic, IterFromThreads) {
+  auto v = sus::Vec<i32>(1, 2, 3, 4);
+  const auto& cv = v;
+
+  auto threads = sus::Vec<std::thread>();
+  for (usize t; t < 8u; t += 1u) {
+    threads.push(std::thread([&cv]() {
+      for (usize i; i < 10'000u; i += 1u) {
+        i32 sum;
+        for (const i32& x : cv.iter()) sum += x;
+        EXPECT_EQ(sum, 10);
+        sus::Slice<i32> s = cv.as_slice();
+        EXPECT_EQ(s.iter().count(), 4u);
+      }
+    }));
+  }
+  for (std::thread& t : threads.iter_mut()) t.join();
+
+  // Every iterator and slice was dropped, so the `Vec` can be mutated.
+  v.push(5);
+  EXPECT_EQ(v.len(), 5u);
+}
+
+TEST(InvalidationAtomicDeathTest, IteratorInvalidation) {
+#if GTEST_HAS_DEATH_TEST
+  auto v = sus::Vec<i32>(1, 2);
+  auto it = v.iter();
+  it.next();
+  EXPECT_DEATH(
+      {
+        v.push(3);
+        ensure_use(&v);
+      },
+      "");
+#endif
+}
+
+}  // namespace
@@ -20,10 +20,12 @@
 
 #include <type_traits>
 
+#include "sus/iter/adaptors/moved.h"
 #include "sus/iter/iterator_defn.h"
 #include "sus/iter/iterator_ref.h"
 #include "sus/lib/__private/forward_decl.h"
 #include "sus/macros/no_unique_address.h"
+#include "sus/marker/unsafe.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/replace.h"
@@ -59,9 +61,14 @@ struct [[nodiscard]] [[_sus_trivial_abi]] SliceIter final
   }
 
   /// Returns a slice of the items left to be iterated.
-  constexpr Slice<Item> as_slice() const& {
-    return Slice<Item>::from_raw_collection(::sus::marker::unsafe_fn, ptr_,
-                                            end_ - ptr_);
+  constexpr Slice<RawItem> as_slice() const& {
+    return Slice<RawItem>::from_raw_collection(
+        ::sus::marker::unsafe_fn, ref_.to_view(), ptr_,
+        // SAFETY: `end_ > ptr_` at all times, and the distance between two
+        // pointers in a single allocation is at most isize::MAX which fits in
+        // usize.
+        usize::try_from(end_ - ptr_)
+            .unwrap_unchecked(::sus::marker::unsafe_fn));
   }
 
   constexpr Option<Item> next() noexcept {
@@ -106,6 +113,10 @@ struct [[nodiscard]] [[_sus_trivial_abi]] SliceIter final
   }
 
  private:
+  // IteratorRange exposes the pointers as a contiguous range.
+  template <class Iter>
+  friend class ::sus::iter::IteratorRange;
+
   [[_sus_no_unique_address]] ::sus::iter::IterRef ref_;
   const RawItem* ptr_;
   const RawItem* end_;
@@ -196,7 +207,31 @@ struct [[_sus_trivial_abi]] SliceIterMut final
     return {};
   }
 
+  /// Creates an iterator which moves all of its elements. The elements are
+  /// left in a moved-from state, and using them afterward, other than to
+  /// destroy them or assign to them, can cause Undefined Behaviour.
+  ///
+  /// This converts the iterator from being over `T&` to being over values of
+  /// type `T`. It is used for moving out of contiguous std ranges, as with
+  /// [`from_range`]($sus::iter::from_range). Subspace collections can be
+  /// consumed with `into_iter()` instead.
+  ///
+  /// # Safety
+  /// The elements being iterated over will be moved from, and must not be used
+  /// afterward in a way that the types do not support.
+  constexpr ::sus::iter::Iterator<RawItem> auto moved(
+      ::sus::marker::UnsafeFnMarker) && noexcept
+    requires(::sus::mem::Move<RawItem>)
+  {
+    using Moved = ::sus::iter::Moved<SliceIterMut>;
+    return Moved(::sus::move(*this));
+  }
+
  private:
+  // IteratorRange exposes the pointers as a contiguous range.
+  template <class Iter>
+  friend class ::sus::iter::IteratorRange;
+
   [[_sus_no_unique_address]] ::sus::iter::IterRef ref_;
   RawItem* ptr_;
   RawItem* end_;
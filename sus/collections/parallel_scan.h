@@ -0,0 +1,96 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <barrier>
+#include <thread>
+
+#include "sus/collections/__private/slice_numeric.h"
+#include "sus/collections/vec.h"
+#include "sus/num/__private/intrinsics.h"
+
+namespace sus::collections::__private {
+
+/// Implements
+/// [`SliceMut::par_prefix_sum_in_place`](
+/// $sus::collections::SliceMut::par_prefix_sum_in_place).
+///
+/// The slice is split into one part per thread. In the first pass each thread
+/// sums its part, wrapping on overflow. At the barrier between the passes the
+/// sums are turned into the starting value for each part, and in the second
+/// pass each thread scans its part from that value. The second pass checks
+/// for overflow in every running sum, which are exactly the sums a single
+/// thread would compute, so an overflow hidden by wrapping in the first pass
+/// is caught there.
+template <class T>
+struct ParallelScan {
+  /// Parts shorter than this are not worth starting a thread for.
+  static constexpr size_t kMinPart = 64u * 1024u;
+
+  static void prefix_sum_in_place(T* p, size_t len,
+                                  size_t num_threads) noexcept {
+    size_t parts = len / kMinPart;
+    if (parts > num_threads) parts = num_threads;
+    if (parts <= 1u) {
+      scan<false>(p, p, len, T());
+      return;
+    }
+    const size_t part_len = (len + parts - 1u) / parts;
+
+    // Each part's sum, which the barrier replaces by the sum of the parts
+    // before it.
+    auto carries = ::sus::Vec<T>::with_capacity(parts);
+    for (size_t i = 0u; i < parts; ++i) carries.push(T());
+    T* const carry = carries.as_mut_ptr();
+
+    auto combine = [carry, parts]() noexcept {
+      T sum = T();
+      for (size_t i = 0u; i < parts; ++i) {
+        const T part = carry[i];
+        carry[i] = sum;
+        sum = add(sum, part);
+      }
+    };
+    std::barrier sync(static_cast<ptrdiff_t>(parts), combine);
+
+    auto run = [&](size_t i) noexcept {
+      T* const begin = p + i * part_len;
+      const size_t n = i + 1u < parts ? part_len : len - i * part_len;
+      // The last part's sum is not needed by any other part.
+      if (i + 1u < parts) carry[i] = wrapping_sum(begin, n);
+      sync.arrive_and_wait();
+      scan<false>(begin, begin, n, carry[i]);
+    };
+
+    auto workers = ::sus::Vec<std::thread>::with_capacity(parts - 1u);
+    for (size_t i = 1u; i < parts; ++i) workers.push(std::thread(run, i));
+    run(0u);
+    for (std::thread& t : workers.iter_mut()) t.join();
+  }
+
+ private:
+  static constexpr T add(T a, T b) noexcept {
+    if constexpr (::sus::num::Float<T>) {
+      return a + b;
+    } else {
+      return T(::sus::num::__private::wrapping_add(a.primitive_value,
+                                                   b.primitive_value));
+    }
+  }
+};
+
+}  // namespace sus::collections::__private
@@ -21,6 +21,7 @@
 #include "sus/assertions/debug_check.h"
 #include "sus/cmp/eq.h"
 #include "sus/cmp/ord.h"
+#include "sus/collections/__private/slice_numeric.h"
 #include "sus/collections/__private/sort.h"
 #include "sus/collections/concat.h"
 #include "sus/collections/iterators/chunks.h"
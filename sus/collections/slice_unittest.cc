@@ -18,6 +18,7 @@
 
 #include "googletest/include/gtest/gtest.h"
 #include "sus/collections/array.h"
+#include "sus/collections/parallel_scan.h"
 #include "sus/collections/vec.h"
 #include "sus/construct/into.h"
 #include "sus/iter/iterator.h"
@@ -2644,6 +2645,153 @@ TEST(SliceMut, LastMut) {
   static_assert(std::same_as<sus::Option<NoCopyMove&>, decltype(s.last_mut())>);
 }
 
+TEST(SliceMut, PrefixSumInPlace) {
+  auto v = sus::Vec<u32>(3u, 1u, 4u);
+  v.prefix_sum_in_place();
+  EXPECT_EQ(v, sus::Vec<u32>(3u, 4u, 8u));
+
+  // Lengths around the size of the overflow check block, compared to a loop.
+  for (usize len : sus::Vec<usize>(0u, 1u, 3u, 4u, 5u, 255u, 256u, 257u,
+                                   1000u)) {
+    auto u = sus::Vec<u64>();
+    auto i = sus::Vec<i32>();
+    auto f = sus::Vec<f32>();
+    for (usize k; k < len; k += 1u) {
+      u.push(u64::try_from(k * 7u % 13u).unwrap());
+      i.push(i32::try_from(k % 11u).unwrap() - 5);
+      f.push(f32(static_cast<float>(size_t{k % 5u})) * 0.5_f32);
+    }
+    auto u_sums = u.clone();
+    auto i_sums = i.clone();
+    auto f_sums = f.clone();
+    u_sums.prefix_sum_in_place();
+    i_sums.prefix_sum_in_place();
+    f_sums.prefix_sum_in_place();
+    u64 u_sum;
+    i32 i_sum;
+    f32 f_sum;
+    for (usize k; k < len; k += 1u) {
+      u_sum += u[k];
+      i_sum += i[k];
+      f_sum += f[k];
+      EXPECT_EQ(u_sums[k], u_sum);
+      EXPECT_EQ(i_sums[k], i_sum);
+      EXPECT_EQ(f_sums[k], f_sum);
+    }
+  }
+
+  // Up to the maximum without overflowing.
+  auto m = sus::Vec<u32>(u32::MAX - 2u, 1u, 1u, 0u, 0u);
+  m.prefix_sum_in_place();
+  EXPECT_EQ(m[4u], u32::MAX);
+}
+
+TEST(SliceMutDeathTest, PrefixSumInPlaceOverflow) {
+#if GTEST_HAS_DEATH_TEST
+  // Overflow at the start and at the end of a block.
+  auto v = sus::Vec<u32>();
+  for (usize k; k < 300u; k += 1u) v.push(1u);
+  v[1u] = u32::MAX;
+  EXPECT_DEATH(v.prefix_sum_in_place(), "");
+  v[1u] = 1u;
+  v[299u] = u32::MAX - 298u;
+  EXPECT_DEATH(v.prefix_sum_in_place(), "");
+  // A sum that wraps more than once in a block is still caught.
+  auto w = sus::Vec<u64>(u64::MAX, u64::MAX, 2u, 0u);
+  EXPECT_DEATH(w.prefix_sum_in_place(), "");
+  auto i = sus::Vec<i32>(i32::MIN, -1);
+  EXPECT_DEATH(i.prefix_sum_in_place(), "");
+#endif
+}
+
+TEST(Slice, ExclusivePrefixSumInto) {
+  auto lens = sus::Vec<u32>(3u, 1u, 4u, 1u, 5u);
+  auto offsets = sus::Vec<u32>(0u, 0u, 0u, 0u, 0u);
+  EXPECT_EQ(lens.exclusive_prefix_sum_into(offsets), 14u);
+  EXPECT_EQ(offsets, sus::Vec<u32>(0u, 3u, 4u, 8u, 9u));
+
+  // In place.
+  EXPECT_EQ(lens.exclusive_prefix_sum_into(lens), 14u);
+  EXPECT_EQ(lens, sus::Vec<u32>(0u, 3u, 4u, 8u, 9u));
+
+  auto f = sus::Vec<f64>(1.5, 2.0);
+  auto g = sus::Vec<f64>(0.0, 0.0);
+  EXPECT_EQ(f.exclusive_prefix_sum_into(g), 3.5_f64);
+  EXPECT_EQ(g, sus::Vec<f64>(0.0, 1.5));
+}
+
+TEST(SliceDeathTest, ExclusivePrefixSumIntoChecks) {
+#if GTEST_HAS_DEATH_TEST
+  auto v = sus::Vec<u32>(1u, 2u, 3u);
+  auto short_dst = sus::Vec<u32>(0u, 0u);
+  EXPECT_DEATH(v.exclusive_prefix_sum_into(short_dst), "");
+  EXPECT_DEATH(v[".."_r].exclusive_prefix_sum_into(v["1.."_r]), "");
+#endif
+}
+
+TEST(SliceMut, ParPrefixSumInPlace) {
+  auto v = sus::Vec<u64>();
+  for (usize k; k < 1'000'003u; k += 1u) v.push(u64::from(k % 17u));
+  auto expected = v.clone();
+  expected.prefix_sum_in_place();
+  for (usize threads : sus::Vec<usize>(1u, 2u, 3u, 8u)) {
+    auto w = v.clone();
+    w.par_prefix_sum_in_place(threads);
+    EXPECT_EQ(w, expected);
+  }
+
+  // Short slices run on one thread.
+  auto s = sus::Vec<i64>(1, -2, 3);
+  s.par_prefix_sum_in_place(4u);
+  EXPECT_EQ(s, sus::Vec<i64>(1, -1, 2));
+}
+
+TEST(SliceMutDeathTest, ParPrefixSumInPlaceOverflow) {
+#if GTEST_HAS_DEATH_TEST
+  // Every part's own sum fits, but the running sum overflows in a later part.
+  auto v = sus::Vec<u32>();
+  for (usize k; k < 400'000u; k += 1u) v.push(20'000u);
+  EXPECT_DEATH(v.par_prefix_sum_in_place(4u), "");
+#endif
+}
+
+TEST(Slice, Dot) {
+  auto a = sus::Vec<f32>();
+  auto b = sus::Vec<f32>();
+  f32 expected;
+  for (usize k; k < 100u; k += 1u) {
+    a.push(f32(static_cast<float>(size_t{k})));
+    b.push(0.5_f32);
+    expected += f32(static_cast<float>(size_t{k})) * 0.5_f32;
+  }
+  EXPECT_EQ(a.dot(b), expected);
+  const auto c = sus::Vec<f64>(1.0, 2.0, 3.0);
+  const auto d = sus::Vec<f64>(4.0, 5.0, 6.0);
+  EXPECT_EQ(c.dot(d), 32_f64);
+  EXPECT_EQ(c["0..0"_r].dot(d[".."_r]["0..0"_r]), 0_f64);
+}
+
+TEST(SliceMut, Axpy) {
+  auto y = sus::Vec<f32>(1_f32, 2_f32, 3_f32);
+  const auto x = sus::Vec<f32>(10_f32, 20_f32, 30_f32);
+  y.axpy(2_f32, x);
+  EXPECT_EQ(y, sus::Vec<f32>(21_f32, 42_f32, 63_f32));
+}
+
+TEST(SliceDeathTest, DotAxpyLengths) {
+#if GTEST_HAS_DEATH_TEST
+  auto a = sus::Vec<f32>(1_f32, 2_f32);
+  auto b = sus::Vec<f32>(1_f32);
+  EXPECT_DEATH(
+      {
+        auto d = a.dot(b);
+        ensure_use(&d);
+      },
+      "");
+  EXPECT_DEATH(a.axpy(1_f32, b), "");
+#endif
+}
+
 TEST(Slice, Repeat) {
   {
     auto v1 = Vec<i32>(1, 2);
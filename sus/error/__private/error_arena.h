@@ -0,0 +1,44 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+
+namespace sus::error::__private {
+
+/// The largest allocation, in bytes, which is served from the error arena.
+/// Larger allocations go directly to the global `operator new`.
+constexpr size_t kErrorArenaMaxBlock = 256u;
+
+/// Allocates `size` bytes for a [`DynError`]($sus::error::DynError) object.
+///
+/// Allocations are rounded up to one of a few block sizes, and blocks are
+/// reused from a cache owned by the current thread, so errors that are
+/// created and dropped repeatedly do not go to the global heap once the cache
+/// has warmed up. The cache is bounded, and is freed when the thread exits.
+///
+/// Defined in `sus/error/error_arena.cc`.
+void* error_alloc(size_t size);
+
+/// Returns memory from [`error_alloc`]($sus::error::__private::error_alloc)
+/// with the same `size`. The block is cached by the current thread, which
+/// need not be the thread that allocated it.
+///
+/// Defined in `sus/error/error_arena.cc`.
+void error_free(void* ptr, size_t size) noexcept;
+
+}  // namespace sus::error::__private
@@ -14,8 +14,13 @@
 
 #pragma once
 
+#include <stddef.h>
+
+#include <new>
+
 #include "fmt/core.h"
 #include "sus/boxed/dyn.h"
+#include "sus/error/__private/error_arena.h"
 #include "sus/macros/lifetimebound.h"
 #include "sus/option/option.h"
 
@@ -440,6 +445,14 @@ struct DynErrorTyped;
 /// [`Pin<T>`](https://doc.rust-lang.org/std/pin/struct.Pin.html) types in
 /// Rust.
 ///
+/// `DynError` objects created with `new`, such as by
+/// [`Box<DynError>`]($sus::boxed::Box), are allocated from a cache owned by
+/// the current thread rather than from the global heap, once the cache has
+/// warmed up. Paired with an error type that does not allocate, such as
+/// [`StaticError`]($sus::error::StaticError) or
+/// [`InlineError`]($sus::error::InlineError), this makes returning a
+/// `Box<DynError>` free of heap allocations.
+///
 /// See [`DynConcept`]($sus::boxed::DynConcept) for more on type erasure of
 /// concept-satisfying types.
 struct DynError {
@@ -457,6 +470,31 @@ struct DynError {
   DynError(DynError&&) = delete;
   /// #[doc.hidden]
   DynError&& operator=(DynError&&) = delete;
+
+  // Allocation from the thread's error arena.
+
+  /// #[doc.hidden]
+  static void* operator new(size_t size) {
+    return __private::error_alloc(size);
+  }
+  /// #[doc.hidden]
+  static void operator delete(void* ptr, size_t size) noexcept {
+    __private::error_free(ptr, size);
+  }
+  /// #[doc.hidden]
+  static void* operator new(size_t size, std::align_val_t align) {
+    return ::operator new(size, align);
+  }
+  /// #[doc.hidden]
+  static void operator delete(void* ptr, size_t size,
+                              std::align_val_t align) noexcept {
+    ::operator delete(ptr, size, align);
+  }
+  /// #[doc.hidden]
+  static void* operator new(size_t, void* ptr) noexcept { return ptr; }
+  /// #[doc.hidden]
+  static void operator delete(void*, void*) noexcept {}
+
   /// #[doc.hidden]
   template <class ConcreteT>
   static constexpr bool SatisfiesConcept = Error<ConcreteT>;
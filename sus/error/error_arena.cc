@@ -0,0 +1,119 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/error/__private/error_arena.h"
+
+#include <stdint.h>
+
+#include <new>
+
+namespace sus::error::__private {
+
+namespace {
+
+// Blocks are 32, 64, 128 or 256 bytes.
+constexpr size_t kMinBlock = 32u;
+constexpr size_t kClassCount = 4u;
+static_assert(kMinBlock << (kClassCount - 1u) == kErrorArenaMaxBlock);
+
+// The number of free blocks of each size kept by a thread. Beyond this, freed
+// blocks are returned to the global heap.
+constexpr uint32_t kMaxCachedBlocks = 64u;
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+// The free blocks of a thread. This is trivially destructible, so it remains
+// usable while the thread's other `thread_local` objects are destroyed, which
+// may drop errors that they own.
+struct ErrorArena {
+  FreeBlock* free[kClassCount];
+  uint32_t counts[kClassCount];
+  // Whether `arena_cleanup` has been registered to run at thread exit.
+  bool registered;
+  // Set once `arena_cleanup` has run, after which blocks are no longer cached.
+  bool closed;
+};
+
+constinit thread_local ErrorArena arena = {};
+
+struct ArenaCleanup {
+  ~ArenaCleanup() noexcept {
+    for (size_t c = 0u; c < kClassCount; ++c) {
+      FreeBlock* b = arena.free[c];
+      while (b) {
+        FreeBlock* next = b->next;
+        ::operator delete(b, kMinBlock << c);
+        b = next;
+      }
+      arena.free[c] = nullptr;
+      arena.counts[c] = 0u;
+    }
+    arena.closed = true;
+  }
+};
+
+thread_local ArenaCleanup arena_cleanup;
+
+// Returns the index of the smallest block that holds `size` bytes, or
+// `kClassCount` if it is too large for the arena.
+inline size_t size_class(size_t size) noexcept {
+  if (size <= kMinBlock) return 0u;
+  if (size <= kMinBlock * 2u) return 1u;
+  if (size <= kMinBlock * 4u) return 2u;
+  if (size <= kMinBlock * 8u) return 3u;
+  return kClassCount;
+}
+
+}  // namespace
+
+void* error_alloc(size_t size) {
+  const size_t c = size_class(size);
+  if (c == kClassCount) return ::operator new(size);
+
+  ErrorArena& a = arena;
+  if (FreeBlock* b = a.free[c]; b) {
+    a.free[c] = b->next;
+    a.counts[c] -= 1u;
+    return b;
+  }
+  return ::operator new(kMinBlock << c);
+}
+
+void error_free(void* ptr, size_t size) noexcept {
+  const size_t c = size_class(size);
+  if (c == kClassCount) {
+    ::operator delete(ptr, size);
+    return;
+  }
+
+  ErrorArena& a = arena;
+  if (a.closed || a.counts[c] == kMaxCachedBlocks) {
+    ::operator delete(ptr, kMinBlock << c);
+    return;
+  }
+  if (!a.registered) {
+    // Naming the `thread_local` constructs it, which schedules its destructor
+    // for when the thread exits.
+    static_cast<void>(&arena_cleanup);
+    a.registered = true;
+  }
+  auto* b = static_cast<FreeBlock*>(ptr);
+  b->next = a.free[c];
+  a.free[c] = b;
+  a.counts[c] += 1u;
+}
+
+}  // namespace sus::error::__private
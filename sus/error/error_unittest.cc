@@ -15,6 +15,7 @@
 #include "sus/error/error.h"
 
 #include <concepts>
+#include <thread>
 
 #include "googletest/include/gtest/gtest.h"
 #include "sus/boxed/box.h"
@@ -36,6 +37,10 @@ struct SuperError {
   sus::Box<sus::error::DynError> source;
 };
 
+struct BigError {
+  char bytes[512u] = {};
+};
+
 }  // namespace test::error
 
 using namespace test::error;
@@ -85,6 +90,12 @@ struct sus::error::ErrorImpl<SuperErrorSideKick> {
   }
 };
 static_assert(sus::error::Error<SuperErrorSideKick>);
+template <>
+struct sus::error::ErrorImpl<BigError> {
+  constexpr static std::string display(const BigError&) noexcept {
+    return "BigError is here!";
+  }
+};
 
 namespace {
 using sus::error::Error;
@@ -162,4 +173,40 @@ TEST(Error, Source) {
   EXPECT_EQ(sus::error::error_display(*source), "SuperErrorSideKick is here!");
 }
 
+TEST(Error, ArenaReusesMemory) {
+  const DynError* first = nullptr;
+  {
+    sus::Box<DynError> b = sus::into(ErrorReason::SomeReason);
+    first = &*b;
+  }
+  // The memory of a dropped error is reused for the next one of the same size
+  // on the thread.
+  sus::Box<DynError> b = sus::into(ErrorReason::SomeReason);
+  EXPECT_EQ(&*b, first);
+  EXPECT_EQ(sus::error::error_display(*b), "we saw SomeReason happen");
+
+  // Sizes larger than the arena handles still work.
+  static_assert(sizeof(BigError) > sus::error::__private::kErrorArenaMaxBlock);
+  sus::Box<DynError> big = sus::into(BigError());
+  EXPECT_EQ(sus::error::error_display(*big), "BigError is here!");
+}
+
+TEST(Error, ArenaAcrossThreads) {
+  // An error made on one thread can be dropped on another, which keeps the
+  // memory in its own arena.
+  auto b = sus::Option<sus::Box<DynError>>(
+      sus::Box<DynError>::from(ErrorString("from a thread")));
+  std::thread([&]() {
+    sus::Box<DynError> made = sus::into(ErrorReason::SomeReason);
+    b.take();
+    for (usize i; i < 1000u; i += 1u) {
+      sus::Box<DynError> e = sus::into(ErrorString("in a thread"));
+      EXPECT_EQ(sus::error::error_display(*e), "in a thread");
+    }
+    b.insert(sus::move(made));
+  }).join();
+  EXPECT_EQ(sus::error::error_display(*b.as_value()),
+            "we saw SomeReason happen");
+}
+
 }  // namespace
@@ -0,0 +1,147 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+
+#include "fmt/core.h"
+#include "sus/boxed/box.h"
+#include "sus/error/error.h"
+#include "sus/macros/lifetimebound.h"
+#include "sus/macros/pure.h"
+#include "sus/mem/forward.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/option/option.h"
+
+namespace sus::error {
+
+/// An [`Error`]($sus::error::Error) holding a short message in a fixed-size
+/// buffer inside the error object.
+///
+/// This is for error messages that are built at runtime, such as one that
+/// includes the position of bad input, without allocating a `std::string` for
+/// each error. Converting it to a [`Box<DynError>`]($sus::boxed::Box) does not
+/// touch the global heap either, as the `Box` is allocated from the thread's
+/// error arena (see [`DynError`]($sus::error::DynError)).
+///
+/// Messages longer than [`kCapacity`]($sus::error::InlineError::kCapacity)
+/// bytes are truncated, at a UTF-8 character boundary.
+///
+/// The error that caused this one can be attached with
+/// [`with_source`]($sus::error::InlineError::with_source), and is returned
+/// from [`error_source`]($sus::error::error_source).
+///
+/// # Examples
+/// ```
+/// auto e = sus::error::InlineError::with_format("bad digit at {}", 7);
+/// sus_check(e.message() == "bad digit at 7");
+/// ```
+class InlineError {
+ public:
+  /// The number of bytes of message which are stored in the error.
+  static constexpr size_t kCapacity = 64u;
+
+  /// Constructs an error with a copy of `message`, truncated to `kCapacity`
+  /// bytes.
+  explicit InlineError(std::string_view message) noexcept {
+    size_t len = message.size();
+    if (len > kCapacity) len = truncated_len(message.data(), kCapacity);
+    for (size_t i = 0u; i < len; ++i) buf_[i] = message[i];
+    len_ = static_cast<uint8_t>(len);
+  }
+
+  /// Constructs an error with a message formatted by
+  /// [`fmt::format`](https://fmt.dev/latest/api.html#format), truncated to
+  /// `kCapacity` bytes.
+  template <class... Args>
+  static InlineError with_format(fmt::format_string<Args...> format,
+                                 Args&&... args) noexcept {
+    auto e = InlineError();
+    const auto out = fmt::format_to_n(e.buf_, kCapacity + 1u, format,
+                                      ::sus::forward<Args>(args)...);
+    e.len_ = static_cast<uint8_t>(
+        out.size > kCapacity ? truncated_len(e.buf_, kCapacity) : out.size);
+    return e;
+  }
+
+  /// Returns the error with `source` attached as the error that caused it.
+  InlineError with_source(::sus::boxed::Box<DynError> source) && noexcept {
+    source_ = ::sus::Option<::sus::boxed::Box<DynError>>(::sus::move(source));
+    return ::sus::move(*this);
+  }
+
+  /// The message of the error.
+  _sus_pure std::string_view message() const& noexcept sus_lifetimebound {
+    return std::string_view(buf_, len_);
+  }
+  /// The error which caused this error, if any.
+  _sus_pure ::sus::Option<const DynError&> source() const& noexcept {
+    return source_.as_ref().map(
+        [](const ::sus::boxed::Box<DynError>& b) -> const DynError& {
+          return *b;
+        });
+  }
+
+  /// Satisfies the [`Move`]($sus::mem::Move) concept.
+  InlineError(InlineError&&) noexcept = default;
+  /// Satisfies the [`Move`]($sus::mem::Move) concept.
+  InlineError& operator=(InlineError&&) noexcept = default;
+
+ private:
+  InlineError() noexcept = default;
+
+  /// Returns a length at most `max` that does not split a UTF-8 character in
+  /// `s`, which has at least `max + 1` bytes.
+  static size_t truncated_len(const char* s, size_t max) noexcept {
+    size_t len = max;
+    while (len > 0u && (static_cast<uint8_t>(s[len]) & 0xC0u) == 0x80u) --len;
+    return len;
+  }
+
+  ::sus::Option<::sus::boxed::Box<DynError>> source_;
+  uint8_t len_ = 0u;
+  // One more byte than the message holds, to find where a truncated message
+  // can end.
+  char buf_[kCapacity + 1u];
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(source_),
+                                  decltype(len_), decltype(buf_));
+};
+
+}  // namespace sus::error
+
+// Satisfies the [`Error`]($sus::error::Error) concept.
+template <>
+struct sus::error::ErrorImpl<::sus::error::InlineError> {
+  static std::string display(const ::sus::error::InlineError& e) noexcept {
+    return std::string(e.message());
+  }
+  static sus::Option<const DynError&> source(
+      const ::sus::error::InlineError& e sus_lifetimebound) noexcept {
+    return e.source();
+  }
+};
+
+static_assert(sus::error::Error<sus::error::InlineError>);
+
+// Promote `InlineError` into the `sus` namespace.
+namespace sus {
+using ::sus::error::InlineError;
+}  // namespace sus
@@ -0,0 +1,96 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/error/inline_error.h"
+
+#include <string>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/error/static_error.h"
+#include "sus/prelude.h"
+
+namespace {
+
+using sus::error::DynError;
+using sus::error::InlineError;
+
+static_assert(sus::error::Error<InlineError>);
+static_assert(sus::mem::Move<InlineError>);
+static_assert(sus::mem::TriviallyRelocatable<InlineError>);
+static_assert(sus::boxed::DynConcept<DynError, InlineError>);
+
+TEST(InlineError, Example) {
+  auto e = sus::error::InlineError::with_format("bad digit at {}", 7);
+  sus_check(e.message() == "bad digit at 7");
+}
+
+TEST(InlineError, FromString) {
+  auto e = InlineError("bad input");
+  EXPECT_EQ(e.message(), "bad input");
+  EXPECT_EQ(e.source().is_none(), true);
+  EXPECT_EQ(sus::error::error_display(e), "bad input");
+  EXPECT_EQ(fmt::format("{}", e), "bad input");
+
+  auto empty = InlineError("");
+  EXPECT_EQ(empty.message(), "");
+}
+
+TEST(InlineError, Format) {
+  auto e = InlineError::with_format("{} at {}", "bad digit", 12);
+  EXPECT_EQ(e.message(), "bad digit at 12");
+
+  sus::Box<DynError> b = sus::into(sus::move(e));
+  EXPECT_EQ(b->display(), "bad digit at 12");
+}
+
+TEST(InlineError, Truncate) {
+  const auto fits = std::string(InlineError::kCapacity, 'a');
+  EXPECT_EQ(InlineError(fits).message(), fits);
+  EXPECT_EQ(InlineError::with_format("{}", fits).message(), fits);
+
+  const auto long_str = std::string(InlineError::kCapacity + 10u, 'b');
+  EXPECT_EQ(InlineError(long_str).message(),
+            std::string(InlineError::kCapacity, 'b'));
+  EXPECT_EQ(InlineError::with_format("{}", long_str).message(),
+            std::string(InlineError::kCapacity, 'b'));
+
+  // A multi-byte character that would be split is dropped.
+  auto split = std::string(InlineError::kCapacity - 1u, 'c') + "é";
+  EXPECT_EQ(InlineError(split).message(),
+            std::string(InlineError::kCapacity - 1u, 'c'));
+  EXPECT_EQ(InlineError::with_format("{}", split).message(),
+            std::string(InlineError::kCapacity - 1u, 'c'));
+}
+
+TEST(InlineError, Source) {
+  auto e = InlineError::with_format("line {}", 3)
+               .with_source(sus::into(sus::error::StaticError("bad digit")));
+  decltype(auto) source = sus::error::error_source(e);
+  static_assert(std::same_as<decltype(source), sus::Option<const DynError&>>);
+  EXPECT_EQ(source.as_value().display(), "bad digit");
+
+  sus::Box<DynError> b = sus::into(sus::move(e));
+  EXPECT_EQ(b->display(), "line 3");
+  EXPECT_EQ(b->source().as_value().display(), "bad digit");
+}
+
+TEST(InlineError, Move) {
+  auto e = InlineError("message");
+  auto f = sus::move(e);
+  EXPECT_EQ(f.message(), "message");
+  e = InlineError("other");
+  EXPECT_EQ(e.message(), "other");
+}
+
+}  // namespace
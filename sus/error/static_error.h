@@ -0,0 +1,118 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include "sus/boxed/box.h"
+#include "sus/error/error.h"
+#include "sus/macros/lifetimebound.h"
+#include "sus/macros/pure.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/num/signed_integer.h"
+#include "sus/option/option.h"
+
+namespace sus::error {
+
+/// An [`Error`]($sus::error::Error) made of a message string with static
+/// storage duration, typically a string literal, and an integer code.
+///
+/// Constructing a `StaticError` does not allocate or copy the message, and
+/// the message is only turned into a `std::string` if the error is displayed.
+/// This makes it a good choice for errors that are produced often and are
+/// usually handled rather than reported, such as rejecting malformed input.
+/// Converting it to a [`Box<DynError>`]($sus::boxed::Box) does not touch the
+/// global heap either, as the `Box` is allocated from the thread's error
+/// arena (see [`DynError`]($sus::error::DynError)).
+///
+/// The error that caused this one can be attached with
+/// [`with_source`]($sus::error::StaticError::with_source), and is returned
+/// from [`error_source`]($sus::error::error_source).
+///
+/// # Examples
+/// ```
+/// auto parse_digit = [](char c) -> sus::Result<u8, sus::Box<DynError>> {
+///   if (c < '0' || c > '9')
+///     return sus::err(sus::into(sus::error::StaticError("not a digit", 1)));
+///   return sus::ok(u8::try_from(c - '0').unwrap());
+/// };
+/// sus_check(parse_digit('x').unwrap_err()->display() == "not a digit");
+/// ```
+class StaticError {
+ public:
+  /// Constructs an error from a `message` and a `code`.
+  ///
+  /// The `message` is not copied, and must outlive the error and anything the
+  /// error is converted into. A string literal always does.
+  explicit constexpr StaticError(
+      const char* message sus_lifetimebound,
+      ::sus::num::i32 code = ::sus::num::i32()) noexcept
+      : message_(message), code_(code) {}
+
+  /// Returns the error with `source` attached as the error that caused it.
+  constexpr StaticError with_source(
+      ::sus::boxed::Box<DynError> source) && noexcept {
+    source_ = ::sus::Option<::sus::boxed::Box<DynError>>(::sus::move(source));
+    return ::sus::move(*this);
+  }
+
+  /// The message of the error.
+  _sus_pure constexpr const char* message() const noexcept { return message_; }
+  /// The code of the error.
+  _sus_pure constexpr ::sus::num::i32 code() const noexcept { return code_; }
+  /// The error which caused this error, if any.
+  _sus_pure constexpr ::sus::Option<const DynError&> source()
+      const& noexcept {
+    return source_.as_ref().map(
+        [](const ::sus::boxed::Box<DynError>& b) -> const DynError& {
+          return *b;
+        });
+  }
+
+  /// Satisfies the [`Move`]($sus::mem::Move) concept.
+  constexpr StaticError(StaticError&&) noexcept = default;
+  /// Satisfies the [`Move`]($sus::mem::Move) concept.
+  constexpr StaticError& operator=(StaticError&&) noexcept = default;
+
+ private:
+  const char* message_;
+  ::sus::num::i32 code_;
+  ::sus::Option<::sus::boxed::Box<DynError>> source_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(message_),
+                                  decltype(code_), decltype(source_));
+};
+
+}  // namespace sus::error
+
+// Satisfies the [`Error`]($sus::error::Error) concept.
+template <>
+struct sus::error::ErrorImpl<::sus::error::StaticError> {
+  static std::string display(const ::sus::error::StaticError& e) noexcept {
+    return std::string(e.message());
+  }
+  constexpr static sus::Option<const DynError&> source(
+      const ::sus::error::StaticError& e sus_lifetimebound) noexcept {
+    return e.source();
+  }
+};
+
+static_assert(sus::error::Error<sus::error::StaticError>);
+
+// Promote `StaticError` into the `sus` namespace.
+namespace sus {
+using ::sus::error::StaticError;
+}  // namespace sus
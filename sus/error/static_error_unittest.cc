@@ -0,0 +1,86 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/error/static_error.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/prelude.h"
+#include "sus/result/result.h"
+
+namespace {
+
+using sus::error::DynError;
+using sus::error::StaticError;
+
+static_assert(sus::error::Error<StaticError>);
+static_assert(sus::mem::Move<StaticError>);
+static_assert(sus::mem::TriviallyRelocatable<StaticError>);
+static_assert(sus::boxed::DynConcept<DynError, StaticError>);
+
+TEST(StaticError, Example) {
+  auto parse_digit = [](char c) -> sus::Result<u8, sus::Box<DynError>> {
+    if (c < '0' || c > '9')
+      return sus::err(sus::into(sus::error::StaticError("not a digit", 1)));
+    return sus::ok(u8::try_from(c - '0').unwrap());
+  };
+  sus_check(parse_digit('x').unwrap_err()->display() == "not a digit");
+  sus_check(parse_digit('4').unwrap() == 4u);
+}
+
+TEST(StaticError, Construct) {
+  static constexpr const char kMessage[] = "bad input";
+  auto e = StaticError(kMessage, 3);
+  EXPECT_EQ(e.message(), kMessage);
+  EXPECT_EQ(e.code(), 3);
+  EXPECT_EQ(e.source().is_none(), true);
+
+  auto d = StaticError("no code");
+  EXPECT_EQ(d.code(), 0);
+}
+
+TEST(StaticError, Display) {
+  auto e = StaticError("bad input", 3);
+  EXPECT_EQ(sus::error::error_display(e), "bad input");
+  EXPECT_EQ(fmt::format("{}", e), "bad input");
+
+  sus::Box<DynError> b = sus::into(sus::move(e));
+  EXPECT_EQ(b->display(), "bad input");
+}
+
+TEST(StaticError, Source) {
+  auto e = StaticError("outer", 1).with_source(
+      sus::into(StaticError("middle", 2)
+                    .with_source(sus::into(StaticError("inner", 3)))));
+  EXPECT_EQ(e.code(), 1);
+  decltype(auto) source = sus::error::error_source(e);
+  static_assert(std::same_as<decltype(source), sus::Option<const DynError&>>);
+  EXPECT_EQ(source.as_value().display(), "middle");
+  EXPECT_EQ(source.as_value().source().as_value().display(), "inner");
+  EXPECT_EQ(source.as_value().source().as_value().source().is_none(), true);
+
+  // The chain is kept through type erasure.
+  sus::Box<DynError> b = sus::into(sus::move(e));
+  EXPECT_EQ(b->source().as_value().display(), "middle");
+}
+
+TEST(StaticError, Move) {
+  auto e = StaticError("outer", 1).with_source(sus::into(StaticError("in")));
+  auto f = sus::move(e);
+  EXPECT_EQ(f.message(), std::string_view("outer"));
+  EXPECT_EQ(f.source().as_value().display(), "in");
+  e = sus::move(f);
+  EXPECT_EQ(e.source().as_value().display(), "in");
+}
+
+}  // namespace
@@ -17,6 +17,8 @@
 // IWYU pragma: begin_exports
 #include "sus/fn/fn_concepts.h"
 #include "sus/fn/fn_dyn.h"
+#include "sus/fn/fn_ref.h"
+#include "sus/fn/inline_fn.h"
 // IWYU pragma: end_exports
 
 namespace sus {
@@ -87,6 +89,31 @@ namespace sus {
 ///
 /// func(sus::dyn<DynFnMut<i32(i32)>>([](i32) { return 3; }));
 /// ```
+///
+/// A [`FnMutRef`]($sus::fn::FnMutRef) or [`FnRef`]($sus::fn::FnRef) does the
+/// same without a vtable. It is a pair of pointers which can be passed by
+/// value, and constructed implicitly from the callable.
+/// ```
+/// auto func = [](FnMutRef<i32(i32)> f) {
+///   auto x = f(0);
+///   x += 3;
+/// };
+///
+/// func([](i32) { return 3; });
+/// ```
+///
+/// To own a type-erased callable without allocating for each one, such as for
+/// storing many small callbacks, use [`InlineFn`]($sus::fn::InlineFn),
+/// [`InlineFnMut`]($sus::fn::InlineFnMut) or
+/// [`InlineFnOnce`]($sus::fn::InlineFnOnce), which hold small callables inside
+/// themselves instead of in a `Box`.
+/// ```
+/// auto callbacks = sus::Vec<InlineFnMut<void(i32)>>();
+/// i32 sum;
+/// callbacks.push(sus::into([&sum](i32 i) { sum += i; }));
+/// for (auto& f : callbacks.iter_mut()) f(2);
+/// sus_check(sum == 2);
+/// ```
 namespace fn {}
 
 }  // namespace sus
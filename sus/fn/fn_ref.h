@@ -0,0 +1,184 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/fn/fn.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <type_traits>
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/macros/lifetimebound.h"
+#include "sus/mem/addressof.h"
+#include "sus/mem/forward.h"
+
+namespace sus::fn {
+
+template <class R, class... Args>
+class FnRef;
+template <class R, class... Args>
+class FnMutRef;
+
+/// A non-owning reference to a callable which satisfies the concept
+/// [`Fn<R(Args...)>`]($sus::fn::Fn), and which itself satisfies `Fn`.
+///
+/// A `FnRef` is two pointers: one to the callable, and one to a function
+/// which calls it. Calling through it is a single indirect call, without
+/// loading a vtable as calling a [`DynFn`]($sus::fn::DynFn) does. It is
+/// trivially copyable, so it can be passed by value, stored in a struct, or
+/// passed to a function that receives a [`FnMut`]($sus::fn::FnMut) such as an
+/// iterator adaptor.
+///
+/// Like a reference, the `FnRef` does not extend the lifetime of the callable
+/// it refers to. It is typically used as a function parameter, where a
+/// temporary callable lives until the function returns.
+///
+/// # Examples
+/// ```
+/// // A non-template function which receives a callable.
+/// i32 apply(sus::fn::FnRef<i32(i32)> f) { return f(2); }
+///
+/// sus_check(apply([](i32 i) { return i * 3; }) == 6);
+/// ```
+template <class R, class... Args>
+class FnRef<R(Args...)> final {
+ public:
+  /// Constructs a `FnRef` which refers to the callable `f`.
+  ///
+  /// #[doc.overloads=ctor.fn]
+  template <class F>
+    requires(!std::same_as<std::remove_cvref_t<F>, FnRef> &&
+             !std::is_function_v<std::remove_reference_t<F>> &&
+             Fn<std::remove_cvref_t<F>, R(Args...)>)
+  constexpr FnRef(F&& f sus_lifetimebound) noexcept
+      : ptr_{.object = ::sus::mem::addressof(f)},
+        call_(&call_object<std::remove_reference_t<F>>) {}
+
+  /// Constructs a `FnRef` which refers to the function `f`. The function
+  /// pointer is held in the `FnRef`, so it does not need to outlive it.
+  ///
+  /// #[doc.overloads=ctor.fnpointer]
+  FnRef(R (*f)(Args...)) noexcept
+      : ptr_{.function = reinterpret_cast<void (*)()>(f)},
+        call_(&call_function) {}
+
+  /// Calls the callable that the `FnRef` refers to.
+  R operator()(Args... args) const {
+    return call_(ptr_, ::sus::forward<Args>(args)...);
+  }
+
+ private:
+  union Ptr {
+    const void* object;
+    void (*function)();
+  };
+
+  template <class F>
+  static R call_object(Ptr ptr, Args&&... args) {
+    return ::sus::fn::call(*static_cast<const F*>(ptr.object),
+                           ::sus::forward<Args>(args)...);
+  }
+  static R call_function(Ptr ptr, Args&&... args) {
+    return reinterpret_cast<R (*)(Args...)>(ptr.function)(
+        ::sus::forward<Args>(args)...);
+  }
+
+  Ptr ptr_;
+  R (*call_)(Ptr, Args&&...);
+};
+
+/// A non-owning reference to a callable which satisfies the concept
+/// [`FnMut<R(Args...)>`]($sus::fn::FnMut), and which itself satisfies
+/// `FnMut`.
+///
+/// Calling a `FnMutRef` calls the callable it refers to as a mutable lvalue,
+/// so any state it changes is visible through other references to it. See
+/// [`FnRef`]($sus::fn::FnRef) for its representation and lifetime.
+///
+/// # Examples
+/// ```
+/// void count_to(i32 n, sus::fn::FnMutRef<void(i32)> f) {
+///   for (i32 i; i < n; i += 1) f(i);
+/// }
+///
+/// i32 sum;
+/// count_to(4, [&sum](i32 i) { sum += i; });
+/// sus_check(sum == 0 + 1 + 2 + 3);
+/// ```
+template <class R, class... Args>
+class FnMutRef<R(Args...)> final {
+ public:
+  /// Constructs a `FnMutRef` which refers to the callable `f`.
+  ///
+  /// #[doc.overloads=ctor.fnmut]
+  template <class F>
+    requires(!std::same_as<std::remove_cvref_t<F>, FnMutRef> &&
+             !std::is_function_v<std::remove_reference_t<F>> &&
+             FnMut<std::remove_cvref_t<F>, R(Args...)> &&
+             (!std::is_const_v<std::remove_reference_t<F>> ||
+              Fn<std::remove_cvref_t<F>, R(Args...)>))
+  constexpr FnMutRef(F&& f sus_lifetimebound) noexcept
+      : ptr_{.object = const_cast<void*>(static_cast<const void*>(
+                 ::sus::mem::addressof(f)))},
+        call_(&call_object<std::remove_reference_t<F>>) {}
+
+  /// Constructs a `FnMutRef` which refers to the function `f`. The function
+  /// pointer is held in the `FnMutRef`, so it does not need to outlive it.
+  ///
+  /// #[doc.overloads=ctor.fnpointer]
+  FnMutRef(R (*f)(Args...)) noexcept
+      : ptr_{.function = reinterpret_cast<void (*)()>(f)},
+        call_(&call_function) {}
+
+  /// Calls the callable that the `FnMutRef` refers to.
+  R operator()(Args... args) {
+    return call_(ptr_, ::sus::forward<Args>(args)...);
+  }
+
+ private:
+  union Ptr {
+    void* object;
+    void (*function)();
+  };
+
+  template <class F>
+  static R call_object(Ptr ptr, Args&&... args) {
+    if constexpr (std::is_const_v<F>) {
+      return ::sus::fn::call(*static_cast<F*>(ptr.object),
+                             ::sus::forward<Args>(args)...);
+    } else {
+      return ::sus::fn::call_mut(*static_cast<F*>(ptr.object),
+                                 ::sus::forward<Args>(args)...);
+    }
+  }
+  static R call_function(Ptr ptr, Args&&... args) {
+    return reinterpret_cast<R (*)(Args...)>(ptr.function)(
+        ::sus::forward<Args>(args)...);
+  }
+
+  Ptr ptr_;
+  R (*call_)(Ptr, Args&&...);
+};
+
+// `FnRef` satisfies `Fn`.
+static_assert(Fn<FnRef<int(double)>, int(double)>);
+static_assert(std::is_trivially_copyable_v<FnRef<int(double)>>);
+static_assert(sizeof(FnRef<int(double)>) == 2u * sizeof(void*));
+// `FnMutRef` satisfies `FnMut` but not `Fn`.
+static_assert(FnMut<FnMutRef<int(double)>, int(double)>);
+static_assert(!Fn<FnMutRef<int(double)>, int(double)>);
+static_assert(std::is_trivially_copyable_v<FnMutRef<int(double)>>);
+static_assert(sizeof(FnMutRef<int(double)>) == 2u * sizeof(void*));
+
+}  // namespace sus::fn
@@ -0,0 +1,110 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/fn/fn_ref.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+
+namespace {
+using namespace sus::fn;
+
+i32 add(i32 a, i32 b) { return a + b; }
+
+i32 apply(FnRef<i32(i32, i32)> f) { return f(1, 2); }
+i32 apply_mut(FnMutRef<i32(i32, i32)> f) { return f(1, 2) + f(1, 2); }
+
+TEST(FnRef, Fn) {
+  EXPECT_EQ(apply([](i32 a, i32 b) { return a + b; }), 1 + 2);
+  const auto mul = [](i32 a, i32 b) { return a * b; };
+  EXPECT_EQ(apply(mul), 1 * 2);
+  EXPECT_EQ(call(FnRef<i32(i32, i32)>(mul), 3, 4), 3 * 4);
+
+  // Captures are seen through the reference.
+  i32 c = 10;
+  auto with_c = [&c](i32 a, i32 b) { return a + b + c; };
+  auto r = FnRef<i32(i32, i32)>(with_c);
+  EXPECT_EQ(r(1, 2), 13);
+  c = 20;
+  EXPECT_EQ(r(1, 2), 23);
+}
+
+TEST(FnRef, FunctionPointer) {
+  EXPECT_EQ(apply(add), 1 + 2);
+  EXPECT_EQ(apply(&add), 1 + 2);
+  // The function pointer is held inside the FnRef.
+  auto r = FnRef<i32(i32, i32)>(&add);
+  EXPECT_EQ(r(3, 4), 3 + 4);
+}
+
+TEST(FnRef, Copy) {
+  auto f = [](i32 a, i32 b) { return a - b; };
+  auto r = FnRef<i32(i32, i32)>(f);
+  auto s = r;
+  EXPECT_EQ(s(3, 1), 2);
+  struct Holder {
+    FnRef<i32(i32, i32)> f;
+  };
+  auto h = Holder(r);
+  EXPECT_EQ(h.f(5, 1), 4);
+}
+
+TEST(FnMutRef, FnMut) {
+  i32 calls;
+  auto f = [&calls, i = 0_i32](i32 a, i32 b) mutable {
+    calls += 1;
+    i += 1;
+    return a + b + i;
+  };
+  EXPECT_EQ(apply_mut(f), (1 + 2 + 1) + (1 + 2 + 2));
+  EXPECT_EQ(calls, 2);
+  // The state of the lambda was changed through the reference.
+  EXPECT_EQ(f(0, 0), 3);
+
+  // A Fn can be called through a FnMutRef, including when it's const.
+  const auto c = [](i32 a, i32 b) { return a * b; };
+  EXPECT_EQ(apply_mut(c), 2 + 2);
+  EXPECT_EQ(apply_mut(add), 3 + 3);
+  EXPECT_EQ(call_mut(FnMutRef<i32(i32, i32)>(c), 3, 4), 12);
+}
+
+TEST(FnMutRef, Iterator) {
+  i32 calls;
+  auto double_it = [&calls](const i32& i) {
+    calls += 1;
+    return i * 2;
+  };
+  auto v = sus::Vec<i32>(1, 2, 3);
+  auto doubled = v.iter()
+                     .map(FnMutRef<i32(const i32&)>(double_it))
+                     .collect<sus::Vec<i32>>();
+  EXPECT_EQ(doubled, sus::Vec<i32>(2, 4, 6));
+  EXPECT_EQ(calls, 3);
+}
+
+TEST(FnMutRef, SortBy) {
+  auto v = sus::Vec<i32>(3, 1, 2);
+  i32 compares;
+  auto cmp = [&compares](const i32& a, const i32& b) {
+    compares += 1;
+    return b <=> a;
+  };
+  v.sort_by(FnMutRef<std::weak_ordering(const i32&, const i32&)>(cmp));
+  EXPECT_EQ(v, sus::Vec<i32>(3, 2, 1));
+  EXPECT_GT(compares, 0);
+}
+
+}  // namespace
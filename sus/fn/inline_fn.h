@@ -0,0 +1,373 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/fn/fn.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+#include <new>
+#include <type_traits>
+
+#include "sus/assertions/check.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/forward.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+
+namespace sus::fn {
+
+namespace __private {
+
+/// The operations on one type of callable held in an `InlineFn`,
+/// `InlineFnMut` or `InlineFnOnce`. There is a single static table for each
+/// type of callable.
+template <class CallPtr>
+struct InlineFnVTable {
+  CallPtr call;
+  /// Null when the callable is stored inline and is trivially destructible.
+  void (*destroy)(void* storage);
+};
+
+/// Holds a callable in a buffer of `Bytes` bytes, or on the heap if it does
+/// not fit, along with the table of operations on it.
+template <size_t Bytes, class CallPtr>
+class InlineFnStorage {
+  static_assert(Bytes >= sizeof(void*),
+                "The buffer must be able to hold a pointer to the heap");
+
+ public:
+  /// Callables are stored inline only if they can be moved with `memcpy`,
+  /// which keeps the storage trivially relocatable.
+  template <class F>
+  static constexpr bool kStoresInline = sizeof(F) <= Bytes &&
+                                        alignof(F) <= alignof(void*) &&
+                                        ::sus::mem::TriviallyRelocatable<F>;
+
+  template <class F>
+  static F& get(void* storage) noexcept {
+    if constexpr (kStoresInline<F>)
+      return *std::launder(reinterpret_cast<F*>(storage));
+    else
+      return **std::launder(reinterpret_cast<F**>(storage));
+  }
+  template <class F>
+  static const F& get(const void* storage) noexcept {
+    return get<F>(const_cast<void*>(storage));
+  }
+
+  template <class F>
+  static void destroy(void* storage) noexcept {
+    if constexpr (kStoresInline<F>)
+      get<F>(storage).~F();
+    else
+      delete &get<F>(storage);
+  }
+  template <class F>
+  static constexpr void (*destroy_fn)(void*) =
+      kStoresInline<F> && std::is_trivially_destructible_v<F> ? nullptr
+                                                              : &destroy<F>;
+
+  template <class F, class U>
+  InlineFnStorage(const InlineFnVTable<CallPtr>& vtable, std::type_identity<F>,
+                  U&& u) noexcept
+      : vtable_(&vtable) {
+    if constexpr (kStoresInline<F>)
+      new (buffer_) F(::sus::forward<U>(u));
+    else
+      new (buffer_) F*(new F(::sus::forward<U>(u)));
+  }
+
+  InlineFnStorage(InlineFnStorage&& o) noexcept : vtable_(o.vtable_) {
+    o.vtable_ = nullptr;
+    memcpy(buffer_, o.buffer_, Bytes);
+  }
+  InlineFnStorage& operator=(InlineFnStorage&& o) noexcept {
+    if (this != &o) {
+      reset();
+      vtable_ = o.vtable_;
+      o.vtable_ = nullptr;
+      memcpy(buffer_, o.buffer_, Bytes);
+    }
+    return *this;
+  }
+
+  ~InlineFnStorage() noexcept { reset(); }
+
+  /// Returns the table of operations, panicking if the storage was moved
+  /// from.
+  const InlineFnVTable<CallPtr>& vtable() const noexcept {
+    sus_check_with_message(vtable_ != nullptr, "InlineFn used after move");
+    return *vtable_;
+  }
+  /// Returns the table of operations, and leaves the storage as moved from
+  /// without destroying the callable. The caller becomes responsible for
+  /// destroying it.
+  const InlineFnVTable<CallPtr>& take_vtable() noexcept {
+    sus_check_with_message(vtable_ != nullptr, "InlineFn used after move");
+    const InlineFnVTable<CallPtr>& vtable = *vtable_;
+    vtable_ = nullptr;
+    return vtable;
+  }
+
+  void* data() noexcept { return buffer_; }
+  const void* data() const noexcept { return buffer_; }
+
+ private:
+  void reset() noexcept {
+    if (vtable_ != nullptr && vtable_->destroy != nullptr)
+      vtable_->destroy(buffer_);
+  }
+
+  const InlineFnVTable<CallPtr>* vtable_;
+  alignas(void*) unsigned char buffer_[Bytes];
+};
+
+}  // namespace __private
+
+/// The default number of bytes of inline storage in an
+/// [`InlineFn`]($sus::fn::InlineFn), [`InlineFnMut`]($sus::fn::InlineFnMut)
+/// or [`InlineFnOnce`]($sus::fn::InlineFnOnce), which makes them 4 pointers
+/// in size.
+constexpr inline size_t kInlineFnBytes = 3u * sizeof(void*);
+
+template <class Sig, size_t Bytes = kInlineFnBytes>
+class InlineFn;
+template <class Sig, size_t Bytes = kInlineFnBytes>
+class InlineFnMut;
+template <class Sig, size_t Bytes = kInlineFnBytes>
+class InlineFnOnce;
+
+/// An owned type-erased object which satisfies the concept
+/// [`Fn<R(Args...)>`]($sus::fn::Fn), and stores the callable inside itself
+/// when it fits in `Bytes` bytes.
+///
+/// Unlike `Box<DynFn<R(Args...)>>`, constructing an `InlineFn` from a small
+/// callable, such as a lambda with a few captures, does not allocate. Larger
+/// callables, those with an alignment larger than a pointer, and those which
+/// are not [`TriviallyRelocatable`]($sus::mem::TriviallyRelocatable) are
+/// stored on the heap. As such the `InlineFn` is always trivially
+/// relocatable, and moving it copies its bytes.
+///
+/// Calls are made through a pointer to a static table of functions for the
+/// callable's type, rather than through a virtual method.
+///
+/// An `InlineFn` is constructed with [`from`]($sus::fn::InlineFn::from), which
+/// allows [`sus::into`]($sus::construct::into) to convert a callable into it.
+/// Calling an `InlineFn` that has been moved from will panic.
+///
+/// # Examples
+/// ```
+/// auto f = sus::fn::InlineFn<i32(i32)>::from([y = 2_i32](i32 x) {
+///   return x * y;
+/// });
+/// sus_check(f(3) == 6);
+/// ```
+template <class R, class... Args, size_t Bytes>
+class InlineFn<R(Args...), Bytes> final {
+  using CallPtr = R (*)(const void*, Args&&...);
+  using Storage = __private::InlineFnStorage<Bytes, CallPtr>;
+
+ public:
+  /// Constructs an `InlineFn` which holds the callable `f`.
+  ///
+  /// #[doc.overloads=from.fn]
+  template <class F>
+    requires(Fn<std::decay_t<F>, R(Args...)> &&
+             !std::same_as<std::decay_t<F>, InlineFn> &&
+             std::constructible_from<std::decay_t<F>, F&&>)
+  static InlineFn from(F&& f) noexcept {
+    return InlineFn(std::type_identity<std::decay_t<F>>(),
+                    ::sus::forward<F>(f));
+  }
+
+  /// Returns whether a callable of type `F` is stored inside the `InlineFn`,
+  /// rather than on the heap.
+  template <class F>
+  static constexpr bool stores_inline() noexcept {
+    return Storage::template kStoresInline<F>;
+  }
+
+  InlineFn(InlineFn&&) noexcept = default;
+  InlineFn& operator=(InlineFn&&) noexcept = default;
+
+  /// Calls the held callable.
+  ///
+  /// # Panics
+  /// Panics if the `InlineFn` has been moved from.
+  R operator()(Args... args) const {
+    return storage_.vtable().call(storage_.data(),
+                                  ::sus::forward<Args>(args)...);
+  }
+
+ private:
+  template <class F>
+  static R call_fn(const void* storage, Args&&... args) {
+    return ::sus::fn::call(Storage::template get<F>(storage),
+                           ::sus::forward<Args>(args)...);
+  }
+  template <class F>
+  static constexpr __private::InlineFnVTable<CallPtr> kVTable = {
+      &call_fn<F>, Storage::template destroy_fn<F>};
+
+  template <class F, class U>
+  InlineFn(std::type_identity<F> type, U&& u) noexcept
+      : storage_(kVTable<F>, type, ::sus::forward<U>(u)) {}
+
+  Storage storage_;
+
+  sus_class_trivially_relocatable_unchecked(::sus::marker::unsafe_fn);
+};
+
+/// An owned type-erased object which satisfies the concept
+/// [`FnMut<R(Args...)>`]($sus::fn::FnMut), and stores the callable inside
+/// itself when it fits in `Bytes` bytes.
+///
+/// See [`InlineFn`]($sus::fn::InlineFn) for how the callable is stored.
+template <class R, class... Args, size_t Bytes>
+class InlineFnMut<R(Args...), Bytes> final {
+  using CallPtr = R (*)(void*, Args&&...);
+  using Storage = __private::InlineFnStorage<Bytes, CallPtr>;
+
+ public:
+  /// Constructs an `InlineFnMut` which holds the callable `f`.
+  ///
+  /// #[doc.overloads=from.fnmut]
+  template <class F>
+    requires(FnMut<std::decay_t<F>, R(Args...)> &&
+             !std::same_as<std::decay_t<F>, InlineFnMut> &&
+             std::constructible_from<std::decay_t<F>, F&&>)
+  static InlineFnMut from(F&& f) noexcept {
+    return InlineFnMut(std::type_identity<std::decay_t<F>>(),
+                       ::sus::forward<F>(f));
+  }
+
+  /// Returns whether a callable of type `F` is stored inside the
+  /// `InlineFnMut`, rather than on the heap.
+  template <class F>
+  static constexpr bool stores_inline() noexcept {
+    return Storage::template kStoresInline<F>;
+  }
+
+  InlineFnMut(InlineFnMut&&) noexcept = default;
+  InlineFnMut& operator=(InlineFnMut&&) noexcept = default;
+
+  /// Calls the held callable.
+  ///
+  /// # Panics
+  /// Panics if the `InlineFnMut` has been moved from.
+  R operator()(Args... args) {
+    return storage_.vtable().call(storage_.data(),
+                                  ::sus::forward<Args>(args)...);
+  }
+
+ private:
+  template <class F>
+  static R call_fn(void* storage, Args&&... args) {
+    return ::sus::fn::call_mut(Storage::template get<F>(storage),
+                               ::sus::forward<Args>(args)...);
+  }
+  template <class F>
+  static constexpr __private::InlineFnVTable<CallPtr> kVTable = {
+      &call_fn<F>, Storage::template destroy_fn<F>};
+
+  template <class F, class U>
+  InlineFnMut(std::type_identity<F> type, U&& u) noexcept
+      : storage_(kVTable<F>, type, ::sus::forward<U>(u)) {}
+
+  Storage storage_;
+
+  sus_class_trivially_relocatable_unchecked(::sus::marker::unsafe_fn);
+};
+
+/// An owned type-erased object which satisfies the concept
+/// [`FnOnce<R(Args...)>`]($sus::fn::FnOnce), and stores the callable inside
+/// itself when it fits in `Bytes` bytes.
+///
+/// The callable is destroyed when it is called, and calling the
+/// `InlineFnOnce` again will panic.
+///
+/// See [`InlineFn`]($sus::fn::InlineFn) for how the callable is stored.
+template <class R, class... Args, size_t Bytes>
+class InlineFnOnce<R(Args...), Bytes> final {
+  using CallPtr = R (*)(void*, Args&&...);
+  using Storage = __private::InlineFnStorage<Bytes, CallPtr>;
+
+ public:
+  /// Constructs an `InlineFnOnce` which holds the callable `f`.
+  ///
+  /// #[doc.overloads=from.fnonce]
+  template <class F>
+    requires(FnOnce<std::decay_t<F>, R(Args...)> &&
+             !std::same_as<std::decay_t<F>, InlineFnOnce> &&
+             std::constructible_from<std::decay_t<F>, F&&>)
+  static InlineFnOnce from(F&& f) noexcept {
+    return InlineFnOnce(std::type_identity<std::decay_t<F>>(),
+                        ::sus::forward<F>(f));
+  }
+
+  /// Returns whether a callable of type `F` is stored inside the
+  /// `InlineFnOnce`, rather than on the heap.
+  template <class F>
+  static constexpr bool stores_inline() noexcept {
+    return Storage::template kStoresInline<F>;
+  }
+
+  InlineFnOnce(InlineFnOnce&&) noexcept = default;
+  InlineFnOnce& operator=(InlineFnOnce&&) noexcept = default;
+
+  /// Calls the held callable, and destroys it.
+  ///
+  /// # Panics
+  /// Panics if the `InlineFnOnce` has already been called or moved from.
+  R operator()(Args... args) && {
+    return storage_.take_vtable().call(storage_.data(),
+                                       ::sus::forward<Args>(args)...);
+  }
+
+ private:
+  template <class F>
+  static R call_fn(void* storage, Args&&... args) {
+    struct Cleanup {
+      ~Cleanup() noexcept { Storage::template destroy<F>(storage); }
+      void* storage;
+    };
+    Cleanup cleanup(storage);
+    return ::sus::fn::call_once(::sus::move(Storage::template get<F>(storage)),
+                                ::sus::forward<Args>(args)...);
+  }
+  template <class F>
+  static constexpr __private::InlineFnVTable<CallPtr> kVTable = {
+      &call_fn<F>, Storage::template destroy_fn<F>};
+
+  template <class F, class U>
+  InlineFnOnce(std::type_identity<F> type, U&& u) noexcept
+      : storage_(kVTable<F>, type, ::sus::forward<U>(u)) {}
+
+  Storage storage_;
+
+  sus_class_trivially_relocatable_unchecked(::sus::marker::unsafe_fn);
+};
+
+// `InlineFn` satisfies `Fn`.
+static_assert(Fn<InlineFn<int(double)>, int(double)>);
+// `InlineFnMut` satisfies `FnMut`.
+static_assert(FnMut<InlineFnMut<int(double)>, int(double)>);
+// `InlineFnOnce` satisfies `FnOnce`.
+static_assert(FnOnce<InlineFnOnce<int(double)>, int(double)>);
+
+}  // namespace sus::fn
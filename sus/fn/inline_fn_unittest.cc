@@ -0,0 +1,182 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/fn/inline_fn.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/boxed/box.h"
+#include "sus/mem/relocate.h"
+#include "sus/prelude.h"
+
+namespace {
+using namespace sus::fn;
+
+// Counts the destructions of a callable. It is not trivially relocatable, so
+// is stored on the heap.
+struct Counted {
+  Counted(i32& destroyed) : destroyed(destroyed) {}
+  Counted(Counted&& o) : destroyed(o.destroyed) { o.moved = true; }
+  ~Counted() {
+    if (!moved) destroyed += 1;
+  }
+
+  i32 operator()(i32 a) const { return a + 1; }
+
+  i32& destroyed;
+  bool moved = false;
+};
+
+// The same as Counted, but trivially relocatable, so it is stored inline.
+struct CountedRelocatable {
+  CountedRelocatable(i32& destroyed) : destroyed(destroyed) {}
+  CountedRelocatable(CountedRelocatable&& o) : destroyed(o.destroyed) {
+    o.moved = true;
+  }
+  ~CountedRelocatable() {
+    if (!moved) destroyed += 1;
+  }
+
+  i32 operator()(i32 a) const { return a + 1; }
+
+  i32& destroyed;
+  bool moved = false;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(destroyed),
+                                  decltype(moved));
+};
+
+static_assert(sizeof(InlineFn<void()>) == 4u * sizeof(void*));
+static_assert(sizeof(InlineFn<void(), 48u>) == 48u + sizeof(void*));
+static_assert(sus::mem::TriviallyRelocatable<InlineFn<i32(i32)>>);
+static_assert(sus::mem::TriviallyRelocatable<InlineFnMut<i32(i32)>>);
+static_assert(sus::mem::TriviallyRelocatable<InlineFnOnce<i32(i32)>>);
+static_assert(!sus::mem::Copy<InlineFn<i32(i32)>>);
+static_assert(sus::mem::Move<InlineFn<i32(i32)>>);
+
+// Larger than the default inline storage.
+struct Big {
+  u64 a, b, c, d;
+};
+
+static_assert(InlineFn<i32(i32)>::stores_inline<CountedRelocatable>());
+static_assert(!InlineFn<i32(i32)>::stores_inline<Counted>());
+static_assert(!InlineFn<i32(i32)>::stores_inline<Big>());
+static_assert(InlineFn<i32(i32), 32u>::stores_inline<Big>());
+
+TEST(InlineFn, Fn) {
+  auto x = [](const InlineFn<i32(i32, i32)>& f) { return call(f, 1, 2); };
+  i32 c = x(InlineFn<i32(i32, i32)>::from([](i32 a, i32 b) { return a + b; }));
+  EXPECT_EQ(c, 1 + 2);
+  i32 d = x(sus::into([](i32 a, i32 b) { return a * b; }));
+  EXPECT_EQ(d, 1 * 2);
+}
+
+TEST(InlineFn, Captures) {
+  i32 y = 3;
+  auto small = InlineFn<i32(i32)>::from([y](i32 a) { return a * y; });
+  EXPECT_EQ(small(2), 6);
+
+  // Too large to store inline.
+  auto big_capture = Big(1u, 2u, 3u, u64::try_from(y).unwrap());
+  auto big = InlineFn<i32(i32)>::from([big_capture](i32 a) {
+    return a * i32::try_from(big_capture.d).unwrap();
+  });
+  EXPECT_EQ(big(3), 9);
+
+  // Function pointers.
+  auto ptr = InlineFn<i32(i32)>::from(+[](i32 a) { return a - 1; });
+  EXPECT_EQ(ptr(3), 2);
+}
+
+TEST(InlineFn, Move) {
+  auto f = InlineFn<i32(i32)>::from([y = 4_i32](i32 a) { return a + y; });
+  auto g = sus::move(f);
+  EXPECT_EQ(g(1), 5);
+  f = sus::move(g);
+  EXPECT_EQ(f(2), 6);
+
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(g(1), "used after move");
+#endif
+}
+
+TEST(InlineFn, Destroy) {
+  i32 destroyed;
+  {
+    auto f = InlineFn<i32(i32)>::from(CountedRelocatable(destroyed));
+    auto g = sus::move(f);
+    EXPECT_EQ(g(1), 2);
+    EXPECT_EQ(destroyed, 0);
+  }
+  EXPECT_EQ(destroyed, 1);
+  {
+    auto f = InlineFn<i32(i32)>::from(Counted(destroyed));
+    auto g = sus::move(f);
+    EXPECT_EQ(g(1), 2);
+    EXPECT_EQ(destroyed, 1);
+    // Assigning over destroys the previous callable.
+    g = InlineFn<i32(i32)>::from(CountedRelocatable(destroyed));
+    EXPECT_EQ(destroyed, 2);
+  }
+  EXPECT_EQ(destroyed, 3);
+}
+
+TEST(InlineFnMut, FnMut) {
+  auto f = InlineFnMut<i32()>::from([i = 0_i32]() mutable {
+    i += 1;
+    return i;
+  });
+  EXPECT_EQ(f(), 1);
+  EXPECT_EQ(call_mut(f), 2);
+  auto g = sus::move(f);
+  EXPECT_EQ(g(), 3);
+
+  i32 sum;
+  auto callbacks = sus::Vec<InlineFnMut<void(i32)>>();
+  for (i32 i; i < 4; i += 1)
+    callbacks.push(sus::into([&sum, i](i32 x) { sum += x * i; }));
+  for (auto& c : callbacks.iter_mut()) c(2);
+  EXPECT_EQ(sum, 2 * (0 + 1 + 2 + 3));
+}
+
+TEST(InlineFnOnce, FnOnce) {
+  auto f = InlineFnOnce<i32(i32)>::from(
+      [b = sus::Box<i32>(3)](i32 a) mutable { return a + *b; });
+  EXPECT_EQ(call_once(sus::move(f), 2), 5);
+
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(sus::move(f)(2), "used after move");
+#endif
+}
+
+TEST(InlineFnOnce, Destroy) {
+  i32 destroyed;
+  {
+    auto f = InlineFnOnce<i32(i32)>::from(Counted(destroyed));
+    EXPECT_EQ(sus::move(f)(1), 2);
+    // Calling destroys the callable.
+    EXPECT_EQ(destroyed, 1);
+  }
+  EXPECT_EQ(destroyed, 1);
+  {
+    auto f = InlineFnOnce<i32(i32)>::from(CountedRelocatable(destroyed));
+    EXPECT_EQ(sus::move(f)(1), 2);
+    EXPECT_EQ(destroyed, 2);
+    auto g = InlineFnOnce<i32(i32)>::from(CountedRelocatable(destroyed));
+  }
+  // A callable that is never called is destroyed with the InlineFnOnce.
+  EXPECT_EQ(destroyed, 3);
+}
+
+}  // namespace
@@ -0,0 +1,71 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <compare>
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/mem/swap.h"
+#include "sus/num/unsigned_integer.h"
+
+namespace sus::iter::__private {
+
+// Helpers for a binary max-heap (with respect to `cmp`) stored in the first
+// `len` elements at `data`. They operate on a raw pointer so that they can be
+// used from `IteratorBase` without a dependency on `Vec`, and without bounds
+// checks in the inner loops, as the indices are always within `len`.
+
+template <class T, class Cmp>
+constexpr void heap_sift_up(T* data, usize pos, Cmp& cmp) noexcept {
+  while (pos > 0u) {
+    const usize parent = (pos - 1u) / 2u;
+    if (::sus::fn::call_mut(cmp, data[size_t{parent}], data[size_t{pos}]) >= 0)
+      break;
+    ::sus::mem::swap(data[size_t{parent}], data[size_t{pos}]);
+    pos = parent;
+  }
+}
+
+template <class T, class Cmp>
+constexpr void heap_sift_down(T* data, usize len, usize pos,
+                              Cmp& cmp) noexcept {
+  while (true) {
+    const usize left = pos * 2u + 1u;
+    if (left >= len) break;
+    usize largest = left;
+    const usize right = left + 1u;
+    if (right < len &&
+        ::sus::fn::call_mut(cmp, data[size_t{right}], data[size_t{left}]) > 0)
+      largest = right;
+    if (::sus::fn::call_mut(cmp, data[size_t{largest}], data[size_t{pos}]) <= 0)
+      break;
+    ::sus::mem::swap(data[size_t{largest}], data[size_t{pos}]);
+    pos = largest;
+  }
+}
+
+/// Sorts a max-heap in place into ascending order with respect to `cmp`.
+template <class T, class Cmp>
+constexpr void heap_sort_in_place(T* data, usize len, Cmp& cmp) noexcept {
+  while (len > 1u) {
+    len -= 1u;
+    ::sus::mem::swap(data[0u], data[size_t{len}]);
+    heap_sift_down(data, len, 0u, cmp);
+  }
+}
+
+}  // namespace sus::iter::__private
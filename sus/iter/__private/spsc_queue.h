@@ -0,0 +1,143 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+
+#include <atomic>
+#include <bit>
+#include <thread>
+
+#include "sus/mem/forward.h"
+#include "sus/mem/move.h"
+#include "sus/option/option.h"
+
+namespace sus::iter::__private {
+
+/// A bounded, lock-free, single-producer single-consumer queue.
+///
+/// The producer and consumer indices live on separate cache lines, and each
+/// side keeps a cached copy of the other side's index so that it only has to
+/// touch the other cache line when the queue looks full (for the producer) or
+/// empty (for the consumer).
+///
+/// Either side can close the queue: the producer closes it once it will push
+/// no more items, and the consumer closes it when it will pop no more items.
+/// The closed state is stored in the top bit of the closing side's index so
+/// that a blocked peer, which waits for that index to change, wakes up.
+///
+/// When the queue is full or empty, the blocked side spins briefly, then
+/// sleeps in `std::atomic::wait()`, so an idle peer does not burn a core.
+template <class T>
+class SpscQueue {
+  static constexpr size_t kClosed = size_t{1} << (sizeof(size_t) * 8u - 1u);
+  static constexpr size_t kSpins = 64u;
+  // Avoid false sharing between the producer and consumer indices.
+  static constexpr size_t kCacheLine = 64u;
+
+ public:
+  /// Constructs a queue that can hold at least `capacity` items. The capacity
+  /// is rounded up to a power of two, so that indices can wrap with a mask.
+  explicit SpscQueue(size_t capacity) noexcept
+      : mask_(std::bit_ceil(capacity > 0u ? capacity : size_t{1}) - 1u),
+        slots_(new Option<T>[mask_ + 1u]) {}
+  ~SpscQueue() noexcept { delete[] slots_; }
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  /// Pushes an item into the queue, waiting for space if it is full. Returns
+  /// false without pushing if the consumer has closed the queue.
+  ///
+  /// Must only be called from the producer thread.
+  bool push(T&& item) noexcept {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ > mask_) {
+      for (size_t spins = 0u;; spins += 1u) {
+        const size_t head = head_.load(std::memory_order_acquire);
+        if ((head & kClosed) != 0u) return false;
+        cached_head_ = head;
+        if (tail - head <= mask_) break;
+        if (spins < kSpins)
+          std::this_thread::yield();
+        else
+          head_.wait(head, std::memory_order_acquire);
+      }
+    }
+    slots_[tail & mask_] = Option<T>(::sus::forward<T>(item));
+    tail_.store(tail + 1u, std::memory_order_release);
+    tail_.notify_one();
+    return true;
+  }
+
+  /// Marks that no more items will be pushed.
+  ///
+  /// Must only be called from the producer thread.
+  void close_producer() noexcept {
+    tail_.fetch_or(kClosed, std::memory_order_release);
+    tail_.notify_one();
+  }
+
+  /// Pops the next item from the queue, waiting for one if it is empty.
+  /// Returns `None` once the queue is empty and the producer has closed it.
+  ///
+  /// Must only be called from the consumer thread.
+  Option<T> pop() noexcept {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+      for (size_t spins = 0u;; spins += 1u) {
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        cached_tail_ = tail & ~kClosed;
+        if (head != cached_tail_) break;
+        if ((tail & kClosed) != 0u) return Option<T>();
+        if (spins < kSpins)
+          std::this_thread::yield();
+        else
+          tail_.wait(tail, std::memory_order_acquire);
+      }
+    }
+    Option<T> out = slots_[head & mask_].take();
+    head_.store(head + 1u, std::memory_order_release);
+    head_.notify_one();
+    return out;
+  }
+
+  /// Marks that no more items will be popped, which makes the producer stop at
+  /// its next `push()`.
+  ///
+  /// Must only be called from the consumer thread.
+  void close_consumer() noexcept {
+    head_.fetch_or(kClosed, std::memory_order_release);
+    head_.notify_one();
+  }
+
+ private:
+  const size_t mask_;
+  Option<T>* const slots_;
+
+  // Written by the consumer, read by the producer.
+  alignas(kCacheLine) std::atomic<size_t> head_ = 0u;
+  // The consumer's view of `tail_`, without the closed bit.
+  size_t cached_tail_ = 0u;
+
+  // Written by the producer, read by the consumer.
+  alignas(kCacheLine) std::atomic<size_t> tail_ = 0u;
+  // The producer's view of `head_`.
+  size_t cached_head_ = 0u;
+};
+
+}  // namespace sus::iter::__private
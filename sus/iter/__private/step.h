@@ -16,13 +16,84 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+
 #include "sus/marker/unsafe.h"
+#include "sus/mem/size_of.h"
+#include "sus/num/__private/intrinsics.h"
 #include "sus/num/integer_concepts.h"
 #include "sus/num/unsigned_integer.h"
 #include "sus/option/option.h"
 
 namespace sus::iter::__private {
 
+/// The unsigned type that steps of a primitive `T` are computed in. It is at
+/// least as wide as both `T` and `size_t`, so that the distance between any two
+/// values of `T` is found by wrapping subtraction, and is not promoted to
+/// `int`.
+#if defined(__SIZEOF_INT128__)
+template <class T>
+using StepMath =
+    std::conditional_t<(::sus::mem::size_of<T>() > sizeof(uintmax_t)),
+                       ::sus::num::__private::uint128_type, uintmax_t>;
+#else
+template <class T>
+using StepMath = uintmax_t;
+#endif
+
+template <::sus::num::PrimitiveInteger T>
+constexpr T step_max() noexcept {
+  return ::sus::num::__private::max_value<T>();
+}
+
+template <::sus::num::PrimitiveInteger T>
+constexpr T step_forward(T l) noexcept {
+  sus_check(l < ::sus::num::__private::max_value<T>());
+  // SAFETY: All `PrimitiveInteger` can hold `1`.
+  return l + T(1);
+}
+template <::sus::num::PrimitiveInteger T>
+constexpr T step_backward(T l) noexcept {
+  sus_check(l > ::sus::num::__private::min_value<T>());
+  // SAFETY: All `PrimitiveInteger` can hold `1`.
+  return l - T(1);
+}
+template <::sus::num::PrimitiveInteger T>
+constexpr ::sus::Option<::sus::num::usize> steps_between(const T& l,
+                                                         const T& r) noexcept {
+  if (r >= l) {
+    // Subtracting in an unsigned type gives the distance even when `r - l`
+    // does not fit in a signed `T`.
+    using U = StepMath<T>;
+    const U steps = static_cast<U>(r) - static_cast<U>(l);
+    if (steps > U{SIZE_MAX}) return sus::none();
+    return sus::some(::sus::num::usize(static_cast<size_t>(steps)));
+  } else {
+    return sus::none();
+  }
+}
+// The unchecked steps are used by iterators which have already compared
+// against the end of their range, so the result is known to be in range. This
+// avoids an overflow check on every step, which prevents loops from being
+// unrolled and vectorized.
+template <::sus::num::PrimitiveInteger T>
+constexpr T step_forward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                      ::sus::num::usize n) noexcept {
+  // Unsigned arithmetic wraps rather than overflowing, and the caller ensures
+  // the result is representable in `T`.
+  using U = StepMath<T>;
+  return static_cast<T>(static_cast<U>(l) + U{size_t{n}});
+}
+template <::sus::num::PrimitiveInteger T>
+constexpr T step_backward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                       ::sus::num::usize n) noexcept {
+  using U = StepMath<T>;
+  return static_cast<T>(static_cast<U>(l) - U{size_t{n}});
+}
+
 template <::sus::num::IntegerNumeric T>
 constexpr T step_max() noexcept {
   return T::MAX;
@@ -40,8 +111,20 @@ constexpr T step_backward(T l) noexcept {
 template <::sus::num::IntegerNumeric T>
 constexpr ::sus::Option<::sus::num::usize> steps_between(const T& l,
                                                          const T& r) noexcept {
-  return r.checked_sub(l).and_then(
-      [](T steps) { return ::sus::num::usize::try_from(steps).ok(); });
+  return steps_between(l.primitive_value, r.primitive_value);
+}
+
+template <::sus::num::IntegerNumeric T>
+constexpr T step_forward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                      ::sus::num::usize n) noexcept {
+  return T(step_forward_by_unchecked(::sus::marker::unsafe_fn,
+                                     l.primitive_value, n));
+}
+template <::sus::num::IntegerNumeric T>
+constexpr T step_backward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                       ::sus::num::usize n) noexcept {
+  return T(step_backward_by_unchecked(::sus::marker::unsafe_fn,
+                                      l.primitive_value, n));
 }
 
 template <::sus::num::IntegerPointer T>
@@ -64,32 +147,15 @@ constexpr ::sus::Option<::sus::num::usize> steps_between(const T& l,
   return r.checked_sub(l).and_then(
       [](T steps) { return ::sus::num::usize::try_from(steps).ok(); });
 }
-
-template <::sus::num::PrimitiveInteger T>
-constexpr T step_max() noexcept {
-  return ::sus::num::__private::max_value<T>();
-}
-
-template <::sus::num::PrimitiveInteger T>
-constexpr T step_forward(T l) noexcept {
-  sus_check(l < ::sus::num::__private::max_value<T>());
-  // SAFETY: All `PrimitiveInteger` can hold `1`.
-  return l + T(1);
-}
-template <::sus::num::PrimitiveInteger T>
-constexpr T step_backward(T l) noexcept {
-  sus_check(l > ::sus::num::__private::min_value<T>());
-  // SAFETY: All `PrimitiveInteger` can hold `1`.
-  return l - T(1);
+template <::sus::num::IntegerPointer T>
+constexpr T step_forward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                      ::sus::num::usize n) noexcept {
+  return l + n;
 }
-template <::sus::num::PrimitiveInteger T>
-constexpr ::sus::Option<::sus::num::usize> steps_between(const T& l,
-                                                         const T& r) noexcept {
-  if (r >= l) {
-    return ::sus::num::usize::try_from(r - l).ok();
-  } else {
-    return sus::none();
-  }
+template <::sus::num::IntegerPointer T>
+constexpr T step_backward_by_unchecked(::sus::marker::UnsafeFnMarker, T l,
+                                       ::sus::num::usize n) noexcept {
+  return l - n;
 }
 
 /// Objects that have a notion of successor and predecessor operations.
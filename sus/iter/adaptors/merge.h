@@ -0,0 +1,153 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private, include "sus/iter/iterator.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+
+namespace sus::iter {
+
+using ::sus::mem::TriviallyRelocatable;
+
+/// An iterator that merges two sorted iterators into a single sorted iterator.
+///
+/// This type is returned from `Iterator::merge()` and `Iterator::merge_by()`.
+template <class InnerSizedIter, class OtherSizedIter, class CmpFn>
+class [[nodiscard]] Merge final
+    : public IteratorBase<Merge<InnerSizedIter, OtherSizedIter, CmpFn>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = typename InnerSizedIter::Item;
+
+  // Type is Move and (can be) Clone.
+  Merge(Merge&&) = default;
+  Merge& operator=(Merge&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr Merge clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter> &&  //
+             ::sus::mem::Clone<OtherSizedIter> &&  //
+             ::sus::mem::Clone<CmpFn> &&           //
+             ::sus::mem::CloneOrRef<Item>)
+  {
+    return Merge(CLONE, ::sus::clone(cmp_), ::sus::clone(left_),
+                 ::sus::clone(right_), ::sus::clone(left_peek_),
+                 ::sus::clone(right_peek_));
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    if (left_peek_.is_none()) left_peek_.insert(left_.next());
+    if (right_peek_.is_none()) right_peek_.insert(right_.next());
+    Option<Item>& l = left_peek_.as_value_mut();
+    Option<Item>& r = right_peek_.as_value_mut();
+    if (l.is_none()) {
+      // Once both sides are exhausted, their slots keep holding `Some(None)`,
+      // so neither side is polled again and the merge stays fused.
+      if (r.is_none()) return Option<Item>();
+      return right_peek_.take().flatten();
+    }
+    if (r.is_none()) return left_peek_.take().flatten();
+    // Ties are resolved in favour of the left side, which makes the merge
+    // stable.
+    if (::sus::fn::call_mut(cmp_, r.as_value(), l.as_value()) < 0)
+      return right_peek_.take().flatten();
+    else
+      return left_peek_.take().flatten();
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    auto [l_lower, l_upper] = side_size_hint(left_peek_, left_);
+    auto [r_lower, r_upper] = side_size_hint(right_peek_, right_);
+    auto lower = l_lower.saturating_add(r_lower);
+    if (l_upper.is_some() && r_upper.is_some())
+      return SizeHint(lower, (*l_upper).checked_add(*r_upper));
+    else
+      return SizeHint(lower, ::sus::Option<::sus::num::usize>());
+  }
+
+  /// sus::iter::TrustedLen trait.
+  constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
+      const noexcept
+    requires(TrustedLen<InnerSizedIter> &&  //
+             TrustedLen<OtherSizedIter>)
+  {
+    return {};
+  }
+
+  // No exact_size_hint() as the size of two iterators may overflow.
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  template <class SideIter>
+  static constexpr SizeHint side_size_hint(
+      const ::sus::Option<::sus::Option<Item>>& peek,
+      const SideIter& iter) noexcept {
+    usize peek_len;
+    if (peek.is_some()) {
+      if (peek.as_value().is_some())
+        peek_len = 1u;
+      else
+        return SizeHint(0u, ::sus::some(0u));
+    }
+    auto [lo, hi] = iter.size_hint();
+    return SizeHint(
+        lo.saturating_add(peek_len),
+        hi.and_then([&](usize i) { return i.checked_add(peek_len); }));
+  }
+
+  // Regular ctor.
+  explicit constexpr Merge(CmpFn&& cmp, InnerSizedIter&& left,
+                           OtherSizedIter&& right)
+      : cmp_(::sus::move(cmp)),
+        left_(::sus::move(left)),
+        right_(::sus::move(right)) {}
+  // Clone ctor.
+  enum Clone { CLONE };
+  explicit constexpr Merge(Clone, CmpFn&& cmp, InnerSizedIter&& left,
+                           OtherSizedIter&& right,
+                           ::sus::Option<::sus::Option<Item>>&& left_peek,
+                           ::sus::Option<::sus::Option<Item>>&& right_peek)
+      : cmp_(::sus::move(cmp)),
+        left_(::sus::move(left)),
+        right_(::sus::move(right)),
+        left_peek_(::sus::move(left_peek)),
+        right_peek_(::sus::move(right_peek)) {}
+
+  CmpFn cmp_;
+  InnerSizedIter left_;
+  OtherSizedIter right_;
+  // The next item from each side, once it has been pulled. An inner `None`
+  // means that side is exhausted. Like in `Peekable` this holds at most one
+  // item from each side at a time.
+  ::sus::Option<::sus::Option<Item>> left_peek_;
+  ::sus::Option<::sus::Option<Item>> right_peek_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(cmp_), decltype(left_),
+                                           decltype(right_),
+                                           decltype(left_peek_),
+                                           decltype(right_peek_));
+};
+
+}  // namespace sus::iter
@@ -26,7 +26,8 @@ namespace sus::iter {
 /// An iterator that moves from the elements of an underlying iterator.
 ///
 /// This type is returned from [`IteratorOverRange::moved()`](
-/// $sus::iter::IteratorOverRange::moved).
+/// $sus::iter::IteratorOverRange::moved) and [`SliceIterMut::moved()`](
+/// $sus::collections::SliceIterMut::moved).
 template <class InnerSizedIter>
 class [[nodiscard]] Moved final
     : public IteratorBase<Moved<InnerSizedIter>,
@@ -90,6 +91,8 @@ class [[nodiscard]] Moved final
  private:
   template <class R, class B, class E, class I>
   friend class IteratorOverRange;
+  template <class T>
+  friend struct ::sus::collections::SliceIterMut;
 
   explicit constexpr Moved(InnerSizedIter&& next_iter)
       : next_iter_(::sus::move(next_iter)) {}
@@ -16,9 +16,12 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <type_traits>
+
 #include "sus/fn/fn_concepts.h"
 #include "sus/iter/iterator_concept.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/mem/forward.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/size_of.h"
@@ -65,6 +68,40 @@ class [[nodiscard]] Reverse final
   {
     return next_iter_.exact_size_hint();
   }
+  /// sus::iter::Iterator trait.
+  ///
+  /// Skips from the back of the inner iterator, which lets iterators like
+  /// ranges skip in constant time.
+  constexpr Option<Item> nth(usize n) noexcept {
+    return next_iter_.nth_back(n);
+  }
+  /// sus::iter::DoubleEndedIterator trait.
+  constexpr Option<Item> nth_back(usize n) noexcept {
+    return next_iter_.nth(n);
+  }
+
+  /// sus::iter::Iterator trait.
+  ///
+  /// Folds the inner iterator from the back, which lets it use its own
+  /// `rfold()` if it has one.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+    requires(std::convertible_to<std::invoke_result_t<F&, B &&, Item &&>, B> &&
+             (!std::is_reference_v<B> ||
+              std::is_reference_v<std::invoke_result_t<F&, B &&, Item &&>>))
+  constexpr B fold(B init, F f) && noexcept {
+    return ::sus::move(next_iter_).rfold(::sus::forward<B>(init),
+                                         ::sus::move(f));
+  }
+  /// sus::iter::DoubleEndedIterator trait.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, Item)> F>
+    requires(std::convertible_to<std::invoke_result_t<F&, B &&, Item &&>, B> &&
+             (!std::is_reference_v<B> ||
+              std::is_reference_v<std::invoke_result_t<F&, B &&, Item &&>>))
+  constexpr B rfold(B init, F f) && noexcept {
+    return ::sus::move(next_iter_).fold(::sus::forward<B>(init),
+                                        ::sus::move(f));
+  }
+
   /// sus::iter::TrustedLen trait.
   constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
       const noexcept
@@ -17,10 +17,12 @@
 #include <iterator>
 #include <ranges>
 
+#include "sus/collections/iterators/slice_iter.h"
 #include "sus/iter/__private/iterator_end.h"
 #include "sus/iter/__private/range_begin.h"
 #include "sus/iter/adaptors/moved.h"
 #include "sus/iter/iterator.h"
+#include "sus/iter/iterator_ref.h"
 #include "sus/macros/__private/compiler_bugs.h"
 #include "sus/macros/lifetimebound.h"
 #include "sus/mem/move.h"
@@ -33,6 +35,25 @@ namespace sus::iter {
 template <class R, class B, class E, class ItemT>
 class IteratorOverRange;
 
+namespace __private {
+
+/// A range whose values can be iterated by a `SliceIter` or `SliceIterMut`.
+template <class R>
+concept ContiguousRangeOfValues =
+    std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+    std::is_lvalue_reference_v<std::ranges::range_reference_t<R>> &&
+    std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<R>>,
+                 std::ranges::range_value_t<R>>;
+
+template <class Iter>
+struct IsSliceIter : std::false_type {};
+template <class T>
+struct IsSliceIter<::sus::collections::SliceIter<T>> : std::true_type {};
+template <class T>
+struct IsSliceIter<::sus::collections::SliceIterMut<T>> : std::true_type {};
+
+}  // namespace __private
+
 /// Constructs an [`Iterator`]($sus::iter::Iterator) from a
 /// [`std::ranges::input_range`](https://en.cppreference.com/w/cpp/ranges/input_range).
 ///
@@ -59,6 +80,14 @@ class IteratorOverRange;
 /// `std::ranges::std::sized_sentinel_for<end type, begin type>`, then the
 /// output `Iterator` will be an `ExactSizeIterator`.
 ///
+/// If the input range is a `std::ranges::contiguous_range` and a
+/// `std::ranges::sized_range` over references to its values, such as a
+/// `std::vector` or `std::string_view`, the output `Iterator` will be a
+/// [`SliceIter`]($sus::collections::SliceIter) for const values or a
+/// [`SliceIterMut`]($sus::collections::SliceIterMut) otherwise. These are
+/// double-ended and exact-size, and iterate over the range's values through a
+/// pointer.
+///
 /// # Examples
 /// Iterates over references of a vector, copying and summing:
 /// ```
@@ -76,10 +105,23 @@ class IteratorOverRange;
 template <class R>
   requires(std::ranges::input_range<R>)
 constexpr auto from_range(R&& r) noexcept {
-  using B = decltype(std::declval<R&>().begin());
-  using E = decltype(std::declval<R&>().end());
-  using Item = typename std::iterator_traits<B>::reference;
-  return IteratorOverRange<R, B, E, Item>(r);
+  if constexpr (__private::ContiguousRangeOfValues<R>) {
+    using T = std::remove_reference_t<std::ranges::range_reference_t<R>>;
+    using Iter =
+        std::conditional_t<std::is_const_v<T>,
+                           ::sus::collections::SliceIter<T&>,
+                           ::sus::collections::SliceIterMut<T&>>;
+    // The range is not a subspace collection, so there is no refcount to
+    // catch iterator invalidation.
+    return Iter(::sus::iter::IterRefCounter::empty_for_view().to_iter_from_view(),
+                std::ranges::data(r),
+                static_cast<size_t>(std::ranges::size(r)));
+  } else {
+    using B = decltype(std::declval<R&>().begin());
+    using E = decltype(std::declval<R&>().end());
+    using Item = typename std::iterator_traits<B>::reference;
+    return IteratorOverRange<R, B, E, Item>(r);
+  }
 }
 
 /// The iterator created from a [`std::range`](
@@ -220,4 +262,45 @@ class IteratorRange {
   Option<Item> item_;
 };
 
+/// Support for use of a [`SliceIter`]($sus::collections::SliceIter) or
+/// [`SliceIterMut`]($sus::collections::SliceIterMut) as a
+/// `std::ranges::contiguous_range` in the std::ranges library, so that
+/// algorithms which need random access can operate on the items being iterated
+/// in place.
+///
+/// This type is returned from `Iterator::range()`.
+template <class Iter>
+  requires(__private::IsSliceIter<Iter>::value)
+class IteratorRange<Iter> {
+  using Item = typename Iter::Item;
+  using Pointer = std::remove_reference_t<Item>*;
+
+ public:
+  constexpr Pointer begin() const noexcept { return it_.ptr_; }
+  constexpr Pointer end() const noexcept { return it_.end_; }
+  constexpr Pointer data() const noexcept { return it_.ptr_; }
+  constexpr size_t size() const noexcept {
+    return static_cast<size_t>(it_.end_ - it_.ptr_);
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  constexpr IteratorRange(Iter&& it) noexcept : it_(::sus::move(it)) {}
+
+  // Holds the iterator's reference on the collection, if any, while the range
+  // is in use.
+  Iter it_;
+};
+
 }  // namespace sus::iter
+
+// The pointers from a slice iterator's range point into the collection, not
+// the range, so they remain valid after the range is destroyed.
+template <class T>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    ::sus::iter::IteratorRange<::sus::collections::SliceIter<T>>> = true;
+template <class T>
+inline constexpr bool std::ranges::enable_borrowed_range<
+    ::sus::iter::IteratorRange<::sus::collections::SliceIterMut<T>>> = true;
@@ -15,7 +15,9 @@
 #include "sus/iter/compat_ranges.h"
 
 #include <concepts>
+#include <algorithm>
 #include <iterator>
+#include <list>
 #include <ranges>
 #include <string>
 #include <string_view>
@@ -128,17 +130,53 @@ TEST(CompatRanges, InputRangeMutRefs) {
 
 TEST(CompatRanges, FromRange) {
   {
-    auto v = std::vector<i32>({1, 2, 3});
+    auto v = std::list<i32>({1, 2, 3});
     auto it = sus::iter::from_range(v);
     static_assert(sus::iter::Iterator<decltype(it), i32&>);
     static_assert(sus::iter::DoubleEndedIterator<decltype(it), i32&>);
-    static_assert(sus::iter::ExactSizeIterator<decltype(it), i32&>);
-    static_assert(sus::iter::TrustedLen<decltype(it)>);
+    static_assert(!sus::iter::ExactSizeIterator<decltype(it), i32&>);
+    static_assert(!sus::iter::TrustedLen<decltype(it)>);
     static_assert(sus::mem::Move<decltype(it)>);
     static_assert(!sus::mem::Copy<decltype(it)>);
     static_assert(sus::mem::Clone<decltype(it)>);
     static_assert(sus::mem::TriviallyRelocatable<decltype(it)>);
   }
+  // Contiguous ranges are iterated as slices.
+  {
+    auto v = std::vector<i32>({1, 2, 3});
+    auto it = sus::iter::from_range(v);
+    static_assert(
+        std::same_as<decltype(it), sus::collections::SliceIterMut<i32&>>);
+    static_assert(sus::iter::Iterator<decltype(it), i32&>);
+    static_assert(sus::iter::DoubleEndedIterator<decltype(it), i32&>);
+    static_assert(sus::iter::ExactSizeIterator<decltype(it), i32&>);
+    static_assert(sus::iter::TrustedLen<decltype(it)>);
+    static_assert(sus::mem::Copy<decltype(it)>);
+    static_assert(sus::mem::TriviallyRelocatable<decltype(it)>);
+
+    const auto& cv = v;
+    static_assert(std::same_as<decltype(sus::iter::from_range(cv)),
+                               sus::collections::SliceIter<const i32&>>);
+    static_assert(
+        std::same_as<decltype(sus::iter::from_range(std::string_view("a"))),
+                     sus::collections::SliceIter<const char&>>);
+    i32 arr[] = {1, 2};
+    static_assert(std::same_as<decltype(sus::iter::from_range(arr)),
+                               sus::collections::SliceIterMut<i32&>>);
+    // A std::vector<bool> is not contiguous.
+    static_assert(!std::same_as<decltype(sus::iter::from_range(
+                                    std::declval<std::vector<bool>&>())),
+                                sus::collections::SliceIterMut<bool&>>);
+
+    EXPECT_EQ(sus::iter::from_range(std::vector<i32>()).next(), sus::none());
+  }
+  // Non-contiguous ranges.
+  {
+    auto l = std::list<i32>({1, 2, 3});
+    sus::iter::Iterator<i32&> auto it = sus::iter::from_range(l);
+    EXPECT_EQ(it.next_back().unwrap(), 3);
+    EXPECT_EQ(sus::move(it).copied().collect_vec(), sus::Vec<i32>(1, 2));
+  }
 
   // Mutable use of vector.
   {
@@ -322,4 +360,53 @@ TEST(CompatRanges, Moved) {
                     .sum() == 1u + 2u);
 }
 
+using SliceRange =
+    sus::iter::IteratorRange<sus::collections::SliceIter<const i32&>>;
+static_assert(std::ranges::contiguous_range<SliceRange>);
+static_assert(std::ranges::random_access_range<SliceRange>);
+static_assert(std::ranges::sized_range<SliceRange>);
+static_assert(std::ranges::common_range<SliceRange>);
+static_assert(std::ranges::borrowed_range<SliceRange>);
+static_assert(std::ranges::viewable_range<SliceRange>);
+static_assert(!std::ranges::output_range<SliceRange, i32>);
+
+using SliceRangeMut =
+    sus::iter::IteratorRange<sus::collections::SliceIterMut<i32&>>;
+static_assert(std::ranges::contiguous_range<SliceRangeMut>);
+static_assert(std::ranges::random_access_range<SliceRangeMut>);
+static_assert(std::ranges::sized_range<SliceRangeMut>);
+static_assert(std::ranges::borrowed_range<SliceRangeMut>);
+static_assert(std::ranges::output_range<SliceRangeMut, i32>);
+
+TEST(CompatRanges, RandomAccessRange) {
+  auto vec = sus::Vec<i32>(5, 3, 6, 1, 4, 2);
+
+  // sort() requires a `std::ranges::random_access_range`, and sorts the
+  // elements of the Vec in place.
+  std::ranges::sort(vec.iter_mut().range());
+  EXPECT_EQ(vec, sus::Vec<i32>(1, 2, 3, 4, 5, 6));
+
+  // The range covers only the items left in the iterator.
+  auto it = vec.iter();
+  it.next();
+  it.next_back();
+  auto r = sus::move(it).range();
+  EXPECT_EQ(r.size(), 4u);
+  EXPECT_EQ(r.data(), vec.as_ptr() + 1u);
+  EXPECT_EQ(r.begin()[0u], 2);
+  EXPECT_EQ(std::ranges::lower_bound(r, 4_i32), vec.as_ptr() + 3u);
+}
+
+TEST(CompatRanges, FromRangeMoved) {
+  auto v = std::vector<sus::Vec<i32>>();
+  v.push_back(sus::Vec<i32>(1));
+  v.push_back(sus::Vec<i32>(2, 3));
+  auto it = sus::iter::from_range(v).moved(unsafe_fn);
+  static_assert(std::same_as<decltype(it.next()), sus::Option<sus::Vec<i32>>>);
+  EXPECT_EQ(it.exact_size_hint(), 2u);
+  EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>(1));
+  EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>(2, 3));
+  EXPECT_EQ(it.next(), sus::none());
+}
+
 }  // namespace
@@ -14,17 +14,24 @@
 
 #pragma once
 
+#include <stddef.h>
+
+#include <concepts>
 #include <coroutine>
+#include <memory>
+#include <new>
 
 #include "sus/assertions/unreachable.h"
 #include "sus/iter/__private/iterator_end.h"
 #include "sus/iter/__private/is_generator.h"
+#include "sus/iter/into_iterator.h"
 #include "sus/iter/iterator_defn.h"
 #include "sus/macros/lifetimebound.h"
 #include "sus/mem/copy.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/replace.h"
+#include "sus/num/unsigned_integer.h"
 
 namespace sus::iter {
 
@@ -66,34 +73,227 @@ Iterator<typename R::Item> auto from_generator(F&& f) {
   return ::sus::fn::call_once(sus::move(f));
 }
 
+/// A type that can allocate the frames of `Generator` coroutines.
+///
+/// A generator function opts into allocating its frame from such an allocator
+/// by taking `std::allocator_arg_t` followed by a reference to the allocator as
+/// its leading parameters (after the object parameter for a member function or
+/// lambda). The allocator must be passed by reference and must outlive the
+/// `Generator`, as the frame is returned to it when the `Generator` is
+/// destroyed.
+///
+/// `allocate(size)` must return memory of at least `size` bytes, aligned to
+/// `__STDCPP_DEFAULT_NEW_ALIGNMENT__`, and `deallocate(ptr, size)` receives the
+/// same `size` back.
+///
+/// # Example
+/// ```
+/// auto count = [](std::allocator_arg_t, sus::iter::GeneratorFrameFreeList&,
+///                 i32 n) -> sus::iter::Generator<i32> {
+///   for (i32 i; i < n; i += 1) co_yield i;
+/// };
+/// auto frames = sus::iter::GeneratorFrameFreeList();
+/// sus_check(count(std::allocator_arg, frames, 3).sum() == 0 + 1 + 2);
+/// ```
+template <class A>
+concept GeneratorFrameAllocator =
+    requires(A& a, void* ptr, ::sus::num::usize size) {
+      { a.allocate(size) } -> std::same_as<void*>;
+      { a.deallocate(ptr, size) } -> std::same_as<void>;
+    };
+
+/// A `GeneratorFrameAllocator` that keeps freed frames, grouped by size, to
+/// reuse them for later generators instead of returning them to the heap.
+///
+/// This is useful for recursive generators, which create and destroy a frame
+/// for every level of recursion. It is not thread-safe, but it can be
+/// `thread_local`.
+class GeneratorFrameFreeList {
+ public:
+  GeneratorFrameFreeList() noexcept = default;
+  ~GeneratorFrameFreeList() noexcept {
+    for (Node* head : free_) {
+      while (head != nullptr) ::operator delete(
+          static_cast<void*>(::sus::mem::replace(head, head->next)));
+    }
+  }
+
+  GeneratorFrameFreeList(const GeneratorFrameFreeList&) = delete;
+  GeneratorFrameFreeList& operator=(const GeneratorFrameFreeList&) = delete;
+
+  /// sus::iter::GeneratorFrameAllocator concept.
+  void* allocate(::sus::num::usize size) noexcept {
+    const size_t bucket = bucket_for(size);
+    if (bucket >= kBuckets) return ::operator new(size);
+    if (Node* n = free_[bucket]; n != nullptr) {
+      free_[bucket] = n->next;
+      return n;
+    }
+    return ::operator new(bucket * kGranule);
+  }
+  /// sus::iter::GeneratorFrameAllocator concept.
+  void deallocate(void* ptr, ::sus::num::usize size) noexcept {
+    const size_t bucket = bucket_for(size);
+    if (bucket >= kBuckets) return ::operator delete(ptr);
+    free_[bucket] = new (ptr) Node(free_[bucket]);
+  }
+
+ private:
+  static constexpr size_t kGranule = 64u;
+  static constexpr size_t kBuckets = 32u;
+
+  static constexpr size_t bucket_for(::sus::num::usize size) noexcept {
+    return (size_t{size} + kGranule - 1u) / kGranule;
+  }
+
+  struct Node {
+    Node* next;
+  };
+  Node* free_[kBuckets] = {};
+};
+
+/// The argument to `co_yield` in a `Generator` which yields every item of
+/// another iterator in turn.
+///
+/// This type is created by `elements_of()`.
+template <class Iter>
+struct [[nodiscard]] ElementsOf {
+  Iter iter;
+};
+
+/// Yields each item from `iter` out of the `Generator` in turn, as in
+/// `co_yield sus::iter::elements_of(iter)`.
+///
+/// When `iter` is a `Generator` for the same type, the outer generator hands
+/// control to it directly, so each item passes straight to the consumer no
+/// matter how deeply generators are nested. This makes recursive generators
+/// cost `O(1)` per item, where a loop that re-yields each item of a nested
+/// generator costs `O(depth)`.
+///
+/// # Example
+/// ```
+/// struct Node {
+///   i32 value;
+///   const Node* left;
+///   const Node* right;
+/// };
+///
+/// Generator<i32> in_order(const Node& n) {
+///   if (n.left) co_yield sus::iter::elements_of(in_order(*n.left));
+///   co_yield n.value;
+///   if (n.right) co_yield sus::iter::elements_of(in_order(*n.right));
+/// }
+/// ```
+template <IntoIteratorAny I>
+constexpr ElementsOf<IntoIteratorOutputType<I>> elements_of(I&& iter) noexcept {
+  return ElementsOf<IntoIteratorOutputType<I>>{
+      ::sus::move(iter).into_iter()};
+}
+
 namespace __private {
 
+// Stored in front of each generator frame, to find how the frame is freed.
+struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) GeneratorFrameHeader {
+  void (*dealloc)(void* allocator, void* ptr, ::sus::num::usize size) noexcept;
+  void* allocator;
+};
+
+inline void* allocate_generator_frame(size_t size) {
+  void* ptr = ::operator new(sizeof(GeneratorFrameHeader) + size);
+  new (ptr) GeneratorFrameHeader(nullptr, nullptr);
+  return static_cast<char*>(ptr) + sizeof(GeneratorFrameHeader);
+}
+
+template <GeneratorFrameAllocator A>
+void* allocate_generator_frame(size_t size, A& alloc) {
+  void* ptr = alloc.allocate(sizeof(GeneratorFrameHeader) + size);
+  new (ptr) GeneratorFrameHeader(
+      [](void* allocator, void* ptr, ::sus::num::usize size) noexcept {
+        static_cast<A*>(allocator)->deallocate(ptr, size);
+      },
+      std::addressof(alloc));
+  return static_cast<char*>(ptr) + sizeof(GeneratorFrameHeader);
+}
+
+inline void deallocate_generator_frame(void* frame, size_t size) noexcept {
+  void* ptr = static_cast<char*>(frame) - sizeof(GeneratorFrameHeader);
+  auto* header = static_cast<GeneratorFrameHeader*>(ptr);
+  if (header->dealloc == nullptr)
+    ::operator delete(ptr);
+  else
+    header->dealloc(header->allocator, ptr,
+                    sizeof(GeneratorFrameHeader) + size);
+}
+
+// Yields each item of `iter`, for `elements_of()` with a non-Generator
+// iterator.
+template <class T, class Iter>
+Generator<T> yield_elements_of(Iter iter) noexcept {
+  while (true) {
+    Option<typename Iter::Item> o = iter.next();
+    if (o.is_none()) break;
+    co_yield ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn);
+  }
+}
+
 template <class Generator, class T>
 class IterPromise {
+  using Handle = std::coroutine_handle<IterPromise>;
+
  public:
-  auto get_return_object() noexcept { return Generator(*this); }
+  auto get_return_object() noexcept {
+    active_ = Handle::from_promise(*this);
+    return Generator(*this);
+  }
+
+  // Frame allocation, which uses a `GeneratorFrameAllocator` when the
+  // generator function receives one after `std::allocator_arg`.
+  static void* operator new(size_t size) {
+    return allocate_generator_frame(size);
+  }
+  template <GeneratorFrameAllocator A, class... Args>
+  static void* operator new(size_t size, std::allocator_arg_t, A& alloc,
+                            Args&...) {
+    return allocate_generator_frame(size, alloc);
+  }
+  template <class Self, GeneratorFrameAllocator A, class... Args>
+  static void* operator new(size_t size, Self&, std::allocator_arg_t, A& alloc,
+                            Args&...) {
+    return allocate_generator_frame(size, alloc);
+  }
+  static void operator delete(void* ptr, size_t size) noexcept {
+    deallocate_generator_frame(ptr, size);
+  }
 
   constexpr auto yield_value(T v) noexcept
     requires(std::is_reference_v<T>)
   {
-    yielded_.insert(::sus::forward<T>(v));
+    root_->yielded_.insert(::sus::forward<T>(v));
     return std::suspend_always();
   }
   constexpr auto yield_value(const T& v) noexcept
     requires(::sus::mem::Copy<T> && !std::is_reference_v<T>)
   {
-    yielded_.insert(v);
+    root_->yielded_.insert(v);
     return std::suspend_always();
   }
   constexpr auto yield_value(T&& v) noexcept
     requires(::sus::mem::Move<T> && !std::is_reference_v<T>)
   {
-    yielded_.insert(::sus::move(v));
+    root_->yielded_.insert(::sus::move(v));
     return std::suspend_always();
   }
+  auto yield_value(ElementsOf<Generator>&& e) noexcept {
+    return NestedAwaiter(::sus::move(e.iter));
+  }
+  template <class Iter>
+  auto yield_value(ElementsOf<Iter>&& e) noexcept {
+    return NestedAwaiter(yield_elements_of<T>(::sus::move(e.iter)));
+  }
 
   constexpr void return_void() noexcept {
-    yielded_ = Option<T>();  // Yield None at the end of the generator.
+    // Yield None at the end of the generator.
+    if (parent_ == nullptr) yielded_ = Option<T>();
   }
 
   // Awaits in an iterator generator would yield None, which is unintuitive, so
@@ -104,16 +304,62 @@ class IterPromise {
   void await_transform() = delete;
 
   constexpr auto initial_suspend() noexcept { return std::suspend_always(); }
-  constexpr auto final_suspend() noexcept { return std::suspend_always(); }
+  constexpr auto final_suspend() noexcept { return FinalAwaiter(); }
   constexpr void unhandled_exception() noexcept { ::sus::unreachable(); }
 
   constexpr Option<T> take() & noexcept { return yielded_.take(); }
 
+  /// Resumes the innermost generator that is running under this one, which is
+  /// this generator itself when nothing is nested in it.
+  void resume() noexcept { active_.resume(); }
+
  private:
+  // Suspends the outer generator at `co_yield elements_of(...)` and transfers
+  // control directly to the nested generator, which then yields its items
+  // straight into the outermost generator.
+  struct NestedAwaiter {
+    Generator nested;
+
+    bool await_ready() noexcept { return nested.co_handle_.done(); }
+    std::coroutine_handle<> await_suspend(Handle outer) noexcept {
+      IterPromise* root = outer.promise().root_;
+      IterPromise& inner = nested.co_handle_.promise();
+      inner.parent_ = outer;
+      // The nested generator may have already been iterated on its own, and
+      // be suspended inside its own nested generators, which now yield into
+      // `root` too.
+      for (Handle h = inner.active_;; h = h.promise().parent_) {
+        h.promise().root_ = root;
+        if (h == nested.co_handle_) break;
+      }
+      root->active_ = inner.active_;
+      return inner.active_;
+    }
+    void await_resume() noexcept {}
+  };
+
+  // Returns control to the generator which a nested generator was yielded
+  // from, or to the caller of `resume()` for the outermost generator.
+  struct FinalAwaiter {
+    bool await_ready() noexcept { return false; }
+    std::coroutine_handle<> await_suspend(Handle h) noexcept {
+      IterPromise& p = h.promise();
+      if (p.parent_ == nullptr) return std::noop_coroutine();
+      p.root_->active_ = p.parent_;
+      return p.parent_;
+    }
+    void await_resume() noexcept {}
+  };
+
+  // Only used in the outermost generator.
   Option<T> yielded_;
-
-  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
-                                           decltype(yielded_));
+  // The outermost generator, which holds the yielded item.
+  IterPromise* root_ = this;
+  // The generator which this one was yielded from by `elements_of()`.
+  Handle parent_;
+  // Only used in the outermost generator: the innermost nested generator which
+  // is resumed to produce the next item.
+  Handle active_;
 };
 
 template <class Generator>
@@ -125,7 +371,7 @@ class [[nodiscard]] [[_sus_trivial_abi]] GeneratorLoop {
   friend constexpr bool operator==(
       const GeneratorLoop& loop,
       const ::sus::iter::__private::IteratorEnd&) noexcept {
-    return loop.generator_.co_handle_.done();
+    return loop.is_done();
   }
   constexpr GeneratorLoop& operator++() & noexcept {
     // UB occurs if this is called after GeneratorLoop == IteratorEnd. This
@@ -133,7 +379,7 @@ class [[nodiscard]] [[_sus_trivial_abi]] GeneratorLoop {
     // held onto and used in other contexts.
     //
     // TODO: Write a clang-tidy for this.
-    generator_.co_handle_.resume();
+    generator_.co_handle_.promise().resume();
     return *this;
   }
   constexpr decltype(auto) operator*() & noexcept {
@@ -147,6 +393,12 @@ class [[nodiscard]] [[_sus_trivial_abi]] GeneratorLoop {
   }
 
  private:
+  // Friendship with Generator does not extend to the hidden friend operator==
+  // on all compilers, so it goes through a member function.
+  constexpr bool is_done() const noexcept {
+    return generator_.co_handle_.done();
+  }
+
   Generator& generator_;
 
   sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
@@ -207,13 +459,17 @@ class [[nodiscard]] [[_sus_trivial_abi]] Generator final
   }
   /// sus::mem::Move trait.
   constexpr Generator& operator=(Generator&& o) noexcept {
-    co_handle_ = ::sus::mem::replace(o.co_handle_, nullptr);
-    sus_check(co_handle_ != nullptr);
+    // Take the handle out of `o` first, so a self-move doesn't destroy it.
+    auto handle = ::sus::mem::replace(o.co_handle_, nullptr);
+    sus_check(handle != nullptr);
+    if (co_handle_ != nullptr) co_handle_.destroy();
+    co_handle_ = handle;
+    return *this;
   }
 
   /// sus::iter::Iterator trait.
   constexpr Option<T> next() noexcept {
-    if (!co_handle_.done()) co_handle_.resume();
+    if (!co_handle_.done()) co_handle_.promise().resume();
     return co_handle_.promise().take();
   }
 
@@ -231,7 +487,7 @@ class [[nodiscard]] [[_sus_trivial_abi]] Generator final
   constexpr auto begin() & noexcept {
     // Ensure the first item is yielded and ready to be returned from the
     // iterator's operator*().
-    if (!co_handle_.done()) co_handle_.resume();
+    if (!co_handle_.done()) co_handle_.promise().resume();
     return __private::GeneratorLoop(*this);
   }
 
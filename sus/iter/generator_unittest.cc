@@ -160,4 +160,183 @@ TEST(IterGenerator, ComposeIntoGenerator) {
   EXPECT_EQ(it.next(), sus::None);
 }
 
+struct Node {
+  i32 value;
+  const Node* left;
+  const Node* right;
+};
+
+Generator<i32> in_order(const Node& n) {
+  if (n.left) co_yield sus::iter::elements_of(in_order(*n.left));
+  co_yield n.value;
+  if (n.right) co_yield sus::iter::elements_of(in_order(*n.right));
+}
+
+TEST(IterGenerator, ElementsOfRecursive) {
+  //       4
+  //    2     6
+  //   1 3   5
+  auto n1 = Node(1, nullptr, nullptr);
+  auto n3 = Node(3, nullptr, nullptr);
+  auto n5 = Node(5, nullptr, nullptr);
+  auto n2 = Node(2, &n1, &n3);
+  auto n6 = Node(6, &n5, nullptr);
+  auto n4 = Node(4, &n2, &n6);
+  EXPECT_EQ(in_order(n4).collect_vec(), sus::Vec<i32>(1, 2, 3, 4, 5, 6));
+
+  i32 e = 1;
+  for (i32 i : in_order(n4)) {
+    EXPECT_EQ(e, i);
+    e += 1;
+  }
+  EXPECT_EQ(e, 7);
+}
+
+TEST(IterGenerator, ElementsOfEmpty) {
+  auto empty = []() -> Generator<i32> { co_return; };
+  auto x = [&]() -> Generator<i32> {
+    co_yield sus::iter::elements_of(empty());
+    co_yield 1;
+    co_yield sus::iter::elements_of(empty());
+  };
+  EXPECT_EQ(x().collect_vec(), sus::Vec<i32>(1));
+
+  auto only_empty = [&]() -> Generator<i32> {
+    co_yield sus::iter::elements_of(empty());
+  };
+  auto it = only_empty();
+  EXPECT_EQ(it.next(), sus::None);
+  EXPECT_EQ(it.next(), sus::None);
+}
+
+TEST(IterGenerator, ElementsOfPartiallyConsumed) {
+  auto inner = []() -> Generator<i32> {
+    co_yield 1;
+    co_yield 2;
+    co_yield 3;
+  };
+  auto middle = [&]() -> Generator<i32> {
+    co_yield 0;
+    co_yield sus::iter::elements_of(inner());
+    co_yield 4;
+  };
+  // `middle` is suspended inside `inner` when it is yielded from `outer`.
+  auto m = middle();
+  EXPECT_EQ(m.next(), sus::some(0));
+  EXPECT_EQ(m.next(), sus::some(1));
+  auto outer = [](Generator<i32> g) -> Generator<i32> {
+    co_yield sus::iter::elements_of(sus::move(g));
+    co_yield 5;
+  };
+  EXPECT_EQ(outer(sus::move(m)).collect_vec(), sus::Vec<i32>(2, 3, 4, 5));
+}
+
+TEST(IterGenerator, ElementsOfDropEarly) {
+  auto inner = []() -> Generator<sus::Vec<i32>> {
+    co_yield sus::Vec<i32>(1);
+    co_yield sus::Vec<i32>(2);
+  };
+  auto outer = [&]() -> Generator<sus::Vec<i32>> {
+    co_yield sus::iter::elements_of(inner());
+    co_yield sus::Vec<i32>(3);
+  };
+  // Destroying the outer generator while suspended in the inner one destroys
+  // both.
+  auto it = outer();
+  EXPECT_EQ(it.next().unwrap(), sus::Vec<i32>(1));
+}
+
+TEST(IterGenerator, ElementsOfIterator) {
+  auto v = sus::Vec<i32>(2, 3);
+  auto x = [&]() -> Generator<i32> {
+    co_yield 1;
+    co_yield sus::iter::elements_of(v.iter().copied());
+    co_yield sus::iter::elements_of(sus::Vec<i32>(4, 5));
+  };
+  EXPECT_EQ(x().collect_vec(), sus::Vec<i32>(1, 2, 3, 4, 5));
+
+  auto refs = [&]() -> Generator<const i32&> {
+    co_yield sus::iter::elements_of(v.iter());
+  };
+  auto it = refs();
+  EXPECT_EQ(&it.next().unwrap(), &v[0u]);
+  EXPECT_EQ(&it.next().unwrap(), &v[1u]);
+  EXPECT_EQ(it.next(), sus::None);
+}
+
+struct CountingAllocator {
+  void* allocate(usize size) noexcept {
+    allocs += 1u;
+    return ::operator new(size);
+  }
+  void deallocate(void* ptr, usize) noexcept {
+    deallocs += 1u;
+    ::operator delete(ptr);
+  }
+
+  usize allocs;
+  usize deallocs;
+};
+static_assert(sus::iter::GeneratorFrameAllocator<CountingAllocator>);
+
+Generator<i32> count_to(std::allocator_arg_t, CountingAllocator&, i32 n) {
+  for (i32 i = 1; i <= n; i += 1) co_yield i;
+}
+
+TEST(IterGenerator, FrameAllocator) {
+  auto alloc = CountingAllocator();
+  {
+    auto it = count_to(std::allocator_arg, alloc, 3);
+    EXPECT_EQ(alloc.allocs, 1u);
+    EXPECT_EQ(sus::move(it).collect_vec(), sus::Vec<i32>(1, 2, 3));
+  }
+  EXPECT_EQ(alloc.deallocs, 1u);
+
+  // With a lambda, the allocator follows the object parameter.
+  auto x = [](std::allocator_arg_t, CountingAllocator&) -> Generator<i32> {
+    co_yield 4;
+  };
+  EXPECT_EQ(x(std::allocator_arg, alloc).collect_vec(), sus::Vec<i32>(4));
+  EXPECT_EQ(alloc.allocs, 2u);
+  EXPECT_EQ(alloc.deallocs, 2u);
+}
+
+Generator<i32> in_order_with(std::allocator_arg_t,
+                             sus::iter::GeneratorFrameFreeList& frames,
+                             const Node& n) {
+  if (n.left)
+    co_yield sus::iter::elements_of(
+        in_order_with(std::allocator_arg, frames, *n.left));
+  co_yield n.value;
+  if (n.right)
+    co_yield sus::iter::elements_of(
+        in_order_with(std::allocator_arg, frames, *n.right));
+}
+
+TEST(IterGenerator, FrameFreeList) {
+  auto n1 = Node(1, nullptr, nullptr);
+  auto n3 = Node(3, nullptr, nullptr);
+  auto n2 = Node(2, &n1, &n3);
+  auto frames = sus::iter::GeneratorFrameFreeList();
+  for (usize i; i < 3u; i += 1u) {
+    EXPECT_EQ(in_order_with(std::allocator_arg, frames, n2).collect_vec(),
+              sus::Vec<i32>(1, 2, 3));
+  }
+}
+
+TEST(IterGenerator, MoveAssign) {
+  auto count = [](i32 from) -> Generator<i32> {
+    for (i32 i = from; true; i += 1) co_yield i;
+  };
+  auto g = count(1);
+  EXPECT_EQ(g.next(), sus::some(1));
+  g = count(10);
+  EXPECT_EQ(g.next(), sus::some(10));
+
+  // Assigned through a reference, as compilers warn about a direct self-move.
+  auto& alias = g;
+  g = sus::move(alias);
+  EXPECT_EQ(g.next(), sus::some(11));
+}
+
 }  // namespace
@@ -19,9 +19,11 @@
 #include <compare>
 
 #include "sus/cmp/eq.h"
+#include "sus/cmp/ord.h"
 #include "sus/construct/default.h"
 #include "sus/construct/into.h"
 #include "sus/fn/fn.h"
+#include "sus/iter/__private/bounded_heap.h"
 #include "sus/iter/__private/is_generator.h"
 #include "sus/iter/__private/iter_compare.h"
 #include "sus/iter/__private/iterator_end.h"
@@ -390,6 +392,21 @@ class IteratorBase {
     requires(__private::IsGenerator<R>::value)
   Iterator<GenR> auto generate(GenFn generator_fn) && noexcept;
 
+  /// Runs this iterator on a worker thread, ahead of the consumer, and returns
+  /// an iterator which receives its items through a queue that holds up to
+  /// `buffer_len` items.
+  ///
+  /// This lets an expensive iterator chain, such as one that parses input, run
+  /// in parallel with the work done on each item it produces. Everything in
+  /// the chain up to this call runs on the worker thread, and it must be safe
+  /// to run there. The worker is stopped and joined when the returned
+  /// iterator is destroyed.
+  ///
+  /// The `sus/iter/spawn_ahead.h` header must be included to use this method.
+  /// Threads can not be used in a constant evaluation, so this function is not
+  /// constexpr.
+  Iterator<Item> auto spawn_ahead(::sus::num::usize buffer_len) && noexcept;
+
   /// Determines if the elements of this Iterator are
   /// [lexicographically]($sus::cmp::Ord#how-can-i-implement-ord?)
   /// greater than or equal to those of another.
@@ -438,6 +455,78 @@ class IteratorBase {
           const std::remove_reference_t<Item>&,
           const std::remove_reference_t<Item>&)> auto compare) noexcept;
 
+  /// Returns the `k` largest elements of the iterator, in descending order.
+  ///
+  /// This consumes the whole iterator, but holds at most `k` elements at a
+  /// time in a bounded heap, so it uses `O(k)` memory and `O(n * log(k))`
+  /// comparisons. For small `k` this is much cheaper than collecting and
+  /// sorting all `n` elements.
+  ///
+  /// The resulting `Vec` holds `min(k, n)` elements. Elements that compare
+  /// equal may appear in any order.
+  constexpr ::sus::collections::Vec<ItemT> k_largest(usize k) && noexcept
+    requires(::sus::cmp::Ord<Item>);
+
+  /// Returns the `k` largest elements of the iterator with respect to the
+  /// specified comparison function, in descending order.
+  ///
+  /// See [`k_largest`]($sus::iter::IteratorBase::k_largest) for details.
+  constexpr ::sus::collections::Vec<ItemT> k_largest_by(
+      usize k,
+      ::sus::fn::FnMut<std::weak_ordering(
+          const std::remove_reference_t<Item>&,
+          const std::remove_reference_t<Item>&)> auto compare) && noexcept;
+
+  /// Returns the `k` elements of the iterator that give the largest values
+  /// from the specified key function, in descending order of their keys.
+  ///
+  /// See [`k_largest`]($sus::iter::IteratorBase::k_largest) for details.
+  template <::sus::fn::FnMut<
+                ::sus::fn::NonVoid(const std::remove_reference_t<ItemT>&)>
+                KeyFn,
+            int&...,
+            class Key = std::invoke_result_t<
+                KeyFn&, const std::remove_reference_t<ItemT>&>>
+    requires(::sus::cmp::Ord<Key>)
+  constexpr ::sus::collections::Vec<ItemT> k_largest_by_key(
+      usize k, KeyFn fn) && noexcept;
+
+  /// Returns the `k` smallest elements of the iterator, in ascending order.
+  ///
+  /// This consumes the whole iterator, but holds at most `k` elements at a
+  /// time in a bounded heap, so it uses `O(k)` memory and `O(n * log(k))`
+  /// comparisons. For small `k` this is much cheaper than collecting and
+  /// sorting all `n` elements.
+  ///
+  /// The resulting `Vec` holds `min(k, n)` elements. Elements that compare
+  /// equal may appear in any order.
+  constexpr ::sus::collections::Vec<ItemT> k_smallest(usize k) && noexcept
+    requires(::sus::cmp::Ord<Item>);
+
+  /// Returns the `k` smallest elements of the iterator with respect to the
+  /// specified comparison function, in ascending order.
+  ///
+  /// See [`k_smallest`]($sus::iter::IteratorBase::k_smallest) for details.
+  constexpr ::sus::collections::Vec<ItemT> k_smallest_by(
+      usize k,
+      ::sus::fn::FnMut<std::weak_ordering(
+          const std::remove_reference_t<Item>&,
+          const std::remove_reference_t<Item>&)> auto compare) && noexcept;
+
+  /// Returns the `k` elements of the iterator that give the smallest values
+  /// from the specified key function, in ascending order of their keys.
+  ///
+  /// See [`k_smallest`]($sus::iter::IteratorBase::k_smallest) for details.
+  template <::sus::fn::FnMut<
+                ::sus::fn::NonVoid(const std::remove_reference_t<ItemT>&)>
+                KeyFn,
+            int&...,
+            class Key = std::invoke_result_t<
+                KeyFn&, const std::remove_reference_t<ItemT>&>>
+    requires(::sus::cmp::Ord<Key>)
+  constexpr ::sus::collections::Vec<ItemT> k_smallest_by_key(
+      usize k, KeyFn fn) && noexcept;
+
   /// Determines if the elements of this Iterator are
   /// [lexicographically]($sus::cmp::Ord#how-can-i-implement-ord?)
   /// less than or equal to those of another.
@@ -528,6 +617,32 @@ class IteratorBase {
              !std::is_reference_v<Key>)
   constexpr Option<Item> max_by_key(KeyFn fn) && noexcept;
 
+  /// Merges this iterator with another, where both yield their items in
+  /// ascending order, into a single iterator in ascending order.
+  ///
+  /// The merge is stable: when two items compare equal, the item from this
+  /// iterator is yielded before the item from `other`.
+  ///
+  /// To merge more than two iterators, use [`sus::iter::kmerge`](
+  /// $sus::iter::kmerge) which uses a single loser tree instead of a chain of
+  /// two-way merges.
+  template <IntoIterator<ItemT> Other>
+    requires(::sus::cmp::Ord<ItemT>)
+  constexpr Iterator<Item> auto merge(Other&& other) && noexcept;
+
+  /// Merges this iterator with another, where both yield their items in
+  /// sorted order with respect to the specified comparison function, into a
+  /// single iterator in sorted order.
+  ///
+  /// See [`merge`]($sus::iter::IteratorBase::merge) for details.
+  template <IntoIterator<ItemT> Other,
+            ::sus::fn::FnMut<std::weak_ordering(
+                const std::remove_reference_t<ItemT>&,
+                const std::remove_reference_t<ItemT>&)>
+                CmpFn>
+  constexpr Iterator<Item> auto merge_by(Other&& other,
+                                         CmpFn compare) && noexcept;
+
   /// Returns the minimum element of an iterator.
   ///
   /// If several elements are equally minimum, the first element is returned. If
@@ -1369,6 +1484,12 @@ Iterator<GenR> auto IteratorBase<Iter, Item>::generate(
                               static_cast<Iter&&>(*this));
 }
 
+template <class Iter, class Item>
+Iterator<Item> auto IteratorBase<Iter, Item>::spawn_ahead(
+    ::sus::num::usize buffer_len) && noexcept {
+  return SpawnAhead<Iter>(static_cast<Iter&&>(*this), buffer_len);
+}
+
 template <class Iter, class Item>
 template <IntoIteratorAny Other, int&..., class OtherItem>
   requires(::sus::cmp::PartialOrd<Item, OtherItem>)
@@ -1429,6 +1550,107 @@ constexpr bool IteratorBase<Iter, Item>::is_sorted_by(
   }
 }
 
+template <class Iter, class Item>
+constexpr ::sus::collections::Vec<Item> IteratorBase<Iter, Item>::k_largest(
+    usize k) && noexcept
+  requires(::sus::cmp::Ord<Item>)
+{
+  return static_cast<Iter&&>(*this).k_largest_by(
+      k, [](const std::remove_reference_t<Item>& a,
+            const std::remove_reference_t<Item>& b) {
+        return std::weak_ordering(a <=> b);
+      });
+}
+
+template <class Iter, class Item>
+constexpr ::sus::collections::Vec<Item> IteratorBase<Iter, Item>::k_largest_by(
+    usize k,
+    ::sus::fn::FnMut<std::weak_ordering(
+        const std::remove_reference_t<Item>&,
+        const std::remove_reference_t<Item>&)> auto compare) && noexcept {
+  return static_cast<Iter&&>(*this).k_smallest_by(
+      k, [&compare](const std::remove_reference_t<Item>& a,
+                    const std::remove_reference_t<Item>& b) {
+        return ::sus::fn::call_mut(compare, b, a);
+      });
+}
+
+template <class Iter, class Item>
+template <
+    ::sus::fn::FnMut<::sus::fn::NonVoid(const std::remove_reference_t<Item>&)>
+        KeyFn,
+    int&..., class Key>
+  requires(::sus::cmp::Ord<Key>)
+constexpr ::sus::collections::Vec<Item>
+IteratorBase<Iter, Item>::k_largest_by_key(usize k, KeyFn fn) && noexcept {
+  return static_cast<Iter&&>(*this).k_largest_by(
+      k, [&fn](const std::remove_reference_t<Item>& a,
+               const std::remove_reference_t<Item>& b) {
+        return std::weak_ordering(::sus::fn::call_mut(fn, a) <=>
+                                  ::sus::fn::call_mut(fn, b));
+      });
+}
+
+template <class Iter, class Item>
+constexpr ::sus::collections::Vec<Item> IteratorBase<Iter, Item>::k_smallest(
+    usize k) && noexcept
+  requires(::sus::cmp::Ord<Item>)
+{
+  return static_cast<Iter&&>(*this).k_smallest_by(
+      k, [](const std::remove_reference_t<Item>& a,
+            const std::remove_reference_t<Item>& b) {
+        return std::weak_ordering(a <=> b);
+      });
+}
+
+template <class Iter, class Item>
+constexpr ::sus::collections::Vec<Item>
+IteratorBase<Iter, Item>::k_smallest_by(
+    usize k,
+    ::sus::fn::FnMut<std::weak_ordering(
+        const std::remove_reference_t<Item>&,
+        const std::remove_reference_t<Item>&)> auto compare) && noexcept {
+  using Vec = ::sus::collections::Vec<Item>;
+  if (k == 0u) return Vec();
+  // Don't reserve `k` up front, since `k` may be much larger than the number
+  // of elements actually produced.
+  auto heap = Vec::with_capacity(
+      ::sus::cmp::min(k, as_subclass().size_hint().lower));
+  // The heap is a max-heap, so the top is the largest of the `k` smallest
+  // elements seen so far, and is the one to be evicted by a smaller element.
+  while (true) {
+    Option<Item> o = as_subclass_mut().next();
+    if (o.is_none()) break;
+    if (heap.len() < k) {
+      heap.push(::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn));
+      __private::heap_sift_up(heap.as_mut_ptr(), heap.len() - 1u, compare);
+    } else if (::sus::fn::call_mut(compare, o.as_value(),
+                                   heap.as_ptr()[0u]) < 0) {
+      heap.as_mut_ptr()[0u] =
+          ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn);
+      __private::heap_sift_down(heap.as_mut_ptr(), heap.len(), 0u, compare);
+    }
+  }
+  __private::heap_sort_in_place(heap.as_mut_ptr(), heap.len(), compare);
+  return heap;
+}
+
+template <class Iter, class Item>
+template <
+    ::sus::fn::FnMut<::sus::fn::NonVoid(const std::remove_reference_t<Item>&)>
+        KeyFn,
+    int&..., class Key>
+  requires(::sus::cmp::Ord<Key>)
+constexpr ::sus::collections::Vec<Item>
+IteratorBase<Iter, Item>::k_smallest_by_key(usize k, KeyFn fn) && noexcept {
+  return static_cast<Iter&&>(*this).k_smallest_by(
+      k, [&fn](const std::remove_reference_t<Item>& a,
+               const std::remove_reference_t<Item>& b) {
+        return std::weak_ordering(::sus::fn::call_mut(fn, a) <=>
+                                  ::sus::fn::call_mut(fn, b));
+      });
+}
+
 template <class Iter, class Item>
 template <IntoIteratorAny Other, int&..., class OtherItem>
   requires(::sus::cmp::PartialOrd<Item, OtherItem>)
@@ -1520,6 +1742,31 @@ constexpr Option<Item> IteratorBase<Iter, Item>::max_by_key(
       });
 }
 
+template <class Iter, class Item>
+template <IntoIterator<Item> Other>
+  requires(::sus::cmp::Ord<Item>)
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::merge(
+    Other&& other) && noexcept {
+  return static_cast<Iter&&>(*this).merge_by(
+      ::sus::move(other), [](const std::remove_reference_t<Item>& a,
+                             const std::remove_reference_t<Item>& b) {
+        return std::weak_ordering(a <=> b);
+      });
+}
+
+template <class Iter, class Item>
+template <IntoIterator<Item> Other,
+          ::sus::fn::FnMut<std::weak_ordering(
+              const std::remove_reference_t<Item>&,
+              const std::remove_reference_t<Item>&)>
+              CmpFn>
+constexpr Iterator<Item> auto IteratorBase<Iter, Item>::merge_by(
+    Other&& other, CmpFn compare) && noexcept {
+  using Merge = Merge<Iter, IntoIteratorOutputType<Other>, CmpFn>;
+  return Merge(::sus::move(compare), static_cast<Iter&&>(*this),
+               ::sus::move(other).into_iter());
+}
+
 template <class Iter, class Item>
 constexpr Option<Item> IteratorBase<Iter, Item>::min() && noexcept
   requires(::sus::cmp::Ord<Item>)
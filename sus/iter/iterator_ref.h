@@ -14,13 +14,30 @@
 
 #pragma once
 
+#include <stddef.h>
+
+#include <atomic>
+#include <type_traits>
+
 #include "sus/marker/unsafe.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/replace.h"
 #include "sus/num/unsigned_integer.h"
 
+// SUS_ITERATOR_INVALIDATION selects how collections count their outstanding
+// iterators and views, in order to panic when they are mutated while those are
+// alive:
+// * 0 disables the counting.
+// * 1 (the default) counts with plain integers. A collection must then not be
+//   iterated from multiple threads at once, even if it is only read.
+// * 2 counts with relaxed atomic operations, so a collection can be iterated
+//   from multiple threads at once. Each new iterator or view is an atomic
+//   read-modify-write on the count in the collection, which becomes contended
+//   when many threads iterate over the same collection in a tight loop.
 #if defined(SUS_ITERATOR_INVALIDATION)
-static_assert(SUS_ITERATOR_INVALIDATION == 0 || SUS_ITERATOR_INVALIDATION == 1);
+static_assert(SUS_ITERATOR_INVALIDATION == 0 ||
+              SUS_ITERATOR_INVALIDATION == 1 ||
+              SUS_ITERATOR_INVALIDATION == 2);
 #endif
 
 namespace sus::iter {
@@ -29,6 +46,53 @@ struct IterRefCounter;
 
 #if !defined(SUS_ITERATOR_INVALIDATION) || SUS_ITERATOR_INVALIDATION
 
+namespace __private {
+
+#if defined(SUS_ITERATOR_INVALIDATION) && SUS_ITERATOR_INVALIDATION == 2
+constexpr inline bool kAtomicIterRefs = true;
+static_assert(std::atomic_ref<size_t>::required_alignment <= alignof(usize));
+#else
+constexpr inline bool kAtomicIterRefs = false;
+#endif
+
+// Only the count itself needs to be atomic. A collection is only mutated
+// through exclusive access, which the caller has to synchronize with the
+// threads that iterated it, so the count needs no ordering of its own.
+
+constexpr inline void iter_count_inc(usize& count) noexcept {
+  if constexpr (kAtomicIterRefs) {
+    if (!std::is_constant_evaluated()) {
+      std::atomic_ref<size_t>(count.primitive_value)
+          .fetch_add(1u, std::memory_order_relaxed);
+      return;
+    }
+  }
+  count += 1u;
+}
+
+constexpr inline void iter_count_dec(usize& count) noexcept {
+  if constexpr (kAtomicIterRefs) {
+    if (!std::is_constant_evaluated()) {
+      std::atomic_ref<size_t>(count.primitive_value)
+          .fetch_sub(1u, std::memory_order_relaxed);
+      return;
+    }
+  }
+  count -= 1u;
+}
+
+constexpr inline usize iter_count_load(usize& count) noexcept {
+  if constexpr (kAtomicIterRefs) {
+    if (!std::is_constant_evaluated()) {
+      return std::atomic_ref<size_t>(count.primitive_value)
+          .load(std::memory_order_relaxed);
+    }
+  }
+  return count;
+}
+
+}  // namespace __private
+
 /// An iterator's refcount on the owning collection, preventig mutation while
 /// the iterator is alive.
 struct [[_sus_trivial_abi]] IterRef final {
@@ -60,10 +124,10 @@ struct [[_sus_trivial_abi]] IterRef final {
   constexpr void inc() {
     // TODO: Remove this condition? Some slices have no collection so the
     // iterator doesn't either.
-    if (count_ptr_) *count_ptr_ += 1u;
+    if (count_ptr_) __private::iter_count_inc(*count_ptr_);
   }
   constexpr void dec() {
-    if (count_ptr_) *count_ptr_ -= 1u;
+    if (count_ptr_) __private::iter_count_dec(*count_ptr_);
   }
 
   sus_class_trivially_relocatable(::sus::marker::unsafe_fn,
@@ -104,7 +168,9 @@ struct [[_sus_trivial_abi]] IterRefCounter final {
   }
 
   /// Only valid to be called on owning collections such as Vec.
-  constexpr usize count_from_owner() const noexcept { return count; }
+  constexpr usize count_from_owner() const noexcept {
+    return __private::iter_count_load(count);
+  }
 
   /// Resets self to no ref counts, returning a new IterRefCounter containing
   /// the old ref counts.
@@ -129,9 +195,9 @@ struct [[_sus_trivial_abi]] IterRefCounter final {
   constexpr IterRefCounter(ForView, usize* ptr) noexcept : count_ptr(ptr) {}
 
   union {
-    /// The `count` member is active in owning collections like `Vec`.
-    // TODO: This needs to be atomic: a container can be iterated on multiple
-    // threads.
+    /// The `count` member is active in owning collections like `Vec`. It is
+    /// only safe to change from multiple threads at once when
+    /// `SUS_ITERATOR_INVALIDATION` is 2, which makes changes to it atomic.
     mutable usize count;
     /// The `count_ptr` member is active in view collections like `Slice`. It
     /// points to he owning collection. The presence of a `count_ptr` must also
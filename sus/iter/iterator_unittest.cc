@@ -4431,4 +4431,178 @@ TEST(Iterator, IsSortedBy) {
       false);
 }
 
+TEST(Iterator, KSmallest) {
+  // Fewer items than `k`.
+  {
+    decltype(auto) v = sus::Array<i32, 3>(3, 1, 2).into_iter().k_smallest(5u);
+    static_assert(std::same_as<decltype(v), sus::Vec<i32>>);
+    EXPECT_EQ(v, sus::Vec<i32>(1, 2, 3));
+  }
+  // No items.
+  {
+    auto v = sus::Array<i32, 0>().into_iter().k_smallest(5u);
+    EXPECT_EQ(v.len(), 0u);
+  }
+  // `k` of 0.
+  {
+    auto v = sus::Array<i32, 3>(3, 1, 2).into_iter().k_smallest(0u);
+    EXPECT_EQ(v.len(), 0u);
+  }
+  // More items than `k`.
+  {
+    auto v = sus::Array<i32, 8>(5, 8, 1, 7, 3, 2, 6, 4)
+                 .into_iter()
+                 .k_smallest(3u);
+    EXPECT_EQ(v, sus::Vec<i32>(1, 2, 3));
+  }
+  // Duplicates.
+  {
+    auto v = sus::Array<i32, 6>(2, 1, 2, 1, 3, 1).into_iter().k_smallest(4u);
+    EXPECT_EQ(v, sus::Vec<i32>(1, 1, 1, 2));
+  }
+  // Matches a full sort.
+  {
+    auto all = sus::Vec<i32>();
+    for (i32 i; i < 100; i += 1) all.push((i * 37) % 101);
+    auto sorted = sus::clone(all);
+    sorted.sort();
+    auto v = sus::move(all).into_iter().k_smallest(10u);
+    EXPECT_EQ(v.as_slice(), sorted[sus::ops::range_to(10_usize)]);
+  }
+
+  static_assert(sus::Array<i32, 5>(4, 2, 5, 1, 3)
+                    .into_iter()
+                    .k_smallest(2u) == sus::Vec<i32>(1, 2));
+}
+
+TEST(Iterator, KSmallestBy) {
+  auto v = sus::Array<i32, 5>(4, 2, 5, 1, 3)
+               .into_iter()
+               .k_smallest_by(2u, [](const i32& a, const i32& b) {
+                 return b <=> a;
+               });
+  EXPECT_EQ(v, sus::Vec<i32>(5, 4));
+}
+
+TEST(Iterator, KSmallestByKey) {
+  struct S {
+    i32 i;
+    static i32 key(const S& s) noexcept { return s.i; }
+  };
+  auto v = sus::Array<S, 5>(S(4), S(2), S(5), S(1), S(3))
+               .into_iter()
+               .k_smallest_by_key(3u, &S::key);
+  EXPECT_EQ(v.len(), 3u);
+  EXPECT_EQ(v[0u].i, 1);
+  EXPECT_EQ(v[1u].i, 2);
+  EXPECT_EQ(v[2u].i, 3);
+}
+
+TEST(Iterator, KLargest) {
+  {
+    auto v = sus::Array<i32, 8>(5, 8, 1, 7, 3, 2, 6, 4)
+                 .into_iter()
+                 .k_largest(3u);
+    EXPECT_EQ(v, sus::Vec<i32>(8, 7, 6));
+  }
+  {
+    auto v = sus::Array<i32, 2>(1, 2).into_iter().k_largest(3u);
+    EXPECT_EQ(v, sus::Vec<i32>(2, 1));
+  }
+
+  static_assert(sus::Array<i32, 5>(4, 2, 5, 1, 3)
+                    .into_iter()
+                    .k_largest(2u) == sus::Vec<i32>(5, 4));
+}
+
+TEST(Iterator, KLargestBy) {
+  auto v = sus::Array<i32, 5>(4, 2, 5, 1, 3)
+               .into_iter()
+               .k_largest_by(2u, [](const i32& a, const i32& b) {
+                 return b <=> a;
+               });
+  EXPECT_EQ(v, sus::Vec<i32>(1, 2));
+}
+
+TEST(Iterator, KLargestByKey) {
+  struct S {
+    i32 i;
+    static i32 key(const S& s) noexcept { return s.i; }
+  };
+  auto v = sus::Array<S, 5>(S(4), S(2), S(5), S(1), S(3))
+               .into_iter()
+               .k_largest_by_key(2u, &S::key);
+  EXPECT_EQ(v.len(), 2u);
+  EXPECT_EQ(v[0u].i, 5);
+  EXPECT_EQ(v[1u].i, 4);
+}
+
+TEST(Iterator, Merge) {
+  {
+    auto it = sus::Array<i32, 3>(1, 4, 6).into_iter().merge(
+        sus::Array<i32, 4>(2, 3, 5, 7));
+    EXPECT_EQ(it.size_hint().lower, 7u);
+    EXPECT_EQ(it.size_hint().upper, sus::some(7u));
+    EXPECT_EQ(sus::move(it).collect_vec(),
+              sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7));
+  }
+  // One side empty.
+  {
+    auto it = sus::Array<i32, 0>().into_iter().merge(
+        sus::Array<i32, 2>(2, 3));
+    EXPECT_EQ(sus::move(it).collect_vec(), sus::Vec<i32>(2, 3));
+  }
+  {
+    auto it = sus::Array<i32, 2>(2, 3).into_iter().merge(
+        sus::Array<i32, 0>());
+    EXPECT_EQ(sus::move(it).collect_vec(), sus::Vec<i32>(2, 3));
+  }
+  // References, and the merge is stable.
+  {
+    auto a = sus::Array<i32, 2>(1, 2);
+    auto b = sus::Array<i32, 2>(1, 2);
+    auto it = a.iter().merge(b.iter());
+    EXPECT_EQ(&it.next().unwrap(), &a[0u]);
+    EXPECT_EQ(&it.next().unwrap(), &b[0u]);
+    EXPECT_EQ(&it.next().unwrap(), &a[1u]);
+    EXPECT_EQ(&it.next().unwrap(), &b[1u]);
+    EXPECT_EQ(it.next(), sus::None);
+  }
+
+  // The right side is not fused, but is not polled again once it returns
+  // None.
+  {
+    struct Alternate final : public IteratorBase<Alternate, i32> {
+      using Item = i32;
+      constexpr Option<Item> next() noexcept {
+        state_ += 1;
+        return state_ % 2 == 1 ? Option<Item>(state_) : Option<Item>();
+      }
+      constexpr sus::iter::SizeHint size_hint() const noexcept {
+        return {0u, sus::none()};
+      }
+
+      i32 state_;
+    };
+    auto it = sus::Array<i32, 1>(2).into_iter().merge(Alternate());
+    EXPECT_EQ(it.next().unwrap(), 1);
+    EXPECT_EQ(it.next().unwrap(), 2);
+    EXPECT_EQ(it.next(), sus::None);
+    EXPECT_EQ(it.next(), sus::None);
+    EXPECT_EQ(it.size_hint(), sus::iter::SizeHint(0u, sus::some(0u)));
+  }
+
+  static_assert(sus::Array<i32, 2>(1, 3)
+                    .into_iter()
+                    .merge(sus::Array<i32, 2>(2, 4))
+                    .collect_vec() == sus::Vec<i32>(1, 2, 3, 4));
+}
+
+TEST(Iterator, MergeBy) {
+  auto it = sus::Array<i32, 3>(6, 4, 1).into_iter().merge_by(
+      sus::Array<i32, 4>(7, 5, 3, 2),
+      [](const i32& a, const i32& b) { return b <=> a; });
+  EXPECT_EQ(sus::move(it).collect_vec(), sus::Vec<i32>(7, 6, 5, 4, 3, 2, 1));
+}
+
 }  // namespace
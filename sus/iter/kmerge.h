@@ -0,0 +1,310 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "sus/collections/vec.h"
+#include "sus/cmp/ord.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/into_iterator.h"
+#include "sus/iter/iterator.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/mem/swap.h"
+
+namespace sus::iter {
+
+using ::sus::mem::TriviallyRelocatable;
+
+template <class InnerSizedIter, class CmpFn>
+class KMerge;
+
+namespace __private {
+template <class InnerIter, class CmpFn>
+constexpr KMerge<InnerIter, CmpFn> make_kmerge(
+    ::sus::collections::Vec<InnerIter>&& iters, CmpFn&& cmp) noexcept;
+}  // namespace __private
+
+/// Merges a collection of sorted iterators into a single sorted iterator,
+/// with respect to the specified comparison function.
+///
+/// The input is anything that can be converted into an iterator of
+/// iterators, such as a `Vec` of iterators. Each inner iterator must yield its
+/// items in sorted order with respect to `cmp`, and the output will then be
+/// sorted as well.
+///
+/// See [`KMerge`]($sus::iter::KMerge) for details of the algorithm.
+///
+/// # Example
+/// ```
+/// auto a = sus::Vec<i32>(1, 4, 7);
+/// auto b = sus::Vec<i32>(2, 5, 8);
+/// auto c = sus::Vec<i32>(3, 6, 9);
+/// auto it = sus::iter::kmerge_by(
+///     sus::Vec<sus::collections::VecIntoIter<i32>>(
+///         sus::move(a).into_iter(), sus::move(b).into_iter(),
+///         sus::move(c).into_iter()),
+///     [](const i32& l, const i32& r) { return l <=> r; });
+/// sus_check(sus::move(it).collect_vec() ==
+///           sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7, 8, 9));
+/// ```
+template <IntoIteratorAny Iters, int&...,
+          class IntoInner = typename IntoIteratorOutputType<Iters>::Item,
+          class InnerIter = IntoIteratorOutputType<IntoInner>,
+          class Item = typename InnerIter::Item,
+          ::sus::fn::FnMut<std::weak_ordering(
+              const std::remove_reference_t<Item>&,
+              const std::remove_reference_t<Item>&)>
+              CmpFn>
+  requires(::sus::mem::IsMoveRef<Iters &&> &&  //
+           !std::is_reference_v<IntoInner>)
+constexpr Iterator<Item> auto kmerge_by(Iters&& iters, CmpFn cmp) noexcept {
+  auto v = ::sus::move(iters)
+               .into_iter()
+               .map([](IntoInner&& ii) -> InnerIter {
+                 return ::sus::move(ii).into_iter();
+               })
+               .template collect<::sus::collections::Vec<InnerIter>>();
+  return __private::make_kmerge(::sus::move(v), ::sus::move(cmp));
+}
+
+/// Merges a collection of sorted iterators into a single sorted iterator.
+///
+/// The input is anything that can be converted into an iterator of
+/// iterators, such as a `Vec` of iterators. Each inner iterator must yield its
+/// items in ascending order, and the output will then be in ascending order as
+/// well.
+///
+/// This is equivalent to collecting all the iterators into a `Vec` and
+/// sorting it with a stable sort, but it needs memory for only one item per
+/// input iterator, and does `log2(k)` comparisons per item for `k` input
+/// iterators.
+///
+/// See [`KMerge`]($sus::iter::KMerge) for details of the algorithm.
+template <IntoIteratorAny Iters, int&...,
+          class IntoInner = typename IntoIteratorOutputType<Iters>::Item,
+          class InnerIter = IntoIteratorOutputType<IntoInner>,
+          class Item = typename InnerIter::Item>
+  requires(::sus::mem::IsMoveRef<Iters &&> &&  //
+           !std::is_reference_v<IntoInner> &&  //
+           ::sus::cmp::Ord<Item>)
+constexpr Iterator<Item> auto kmerge(Iters&& iters) noexcept {
+  return ::sus::iter::kmerge_by(
+      ::sus::move(iters), [](const std::remove_reference_t<Item>& a,
+                             const std::remove_reference_t<Item>& b) {
+        return std::weak_ordering(a <=> b);
+      });
+}
+
+/// Merges the sorted iterators given as arguments into a single sorted
+/// iterator.
+///
+/// All arguments must convert into the same type of iterator. To merge
+/// iterators of different types which have the same `Item`, use
+/// [`Iterator::merge`]($sus::iter::IteratorBase::merge).
+///
+/// # Example
+/// ```
+/// auto a = sus::Vec<i32>(1, 3, 5);
+/// auto b = sus::Vec<i32>(2, 4, 6);
+/// auto it = sus::iter::merge(a.iter(), b.iter());
+/// sus_check(sus::move(it).copied().collect_vec() ==
+///           sus::Vec<i32>(1, 2, 3, 4, 5, 6));
+/// ```
+template <IntoIteratorAny First, IntoIteratorAny... Rest, int&...,
+          class InnerIter = IntoIteratorOutputType<First>,
+          class Item = typename InnerIter::Item>
+  requires(::sus::mem::IsMoveRef<First &&> &&                   //
+           (... && ::sus::mem::IsMoveRef<Rest &&>) &&           //
+           (... && std::same_as<IntoIteratorOutputType<Rest>,  //
+                                InnerIter>) &&
+           ::sus::cmp::Ord<Item>)
+constexpr Iterator<Item> auto merge(First&& first, Rest&&... rest) noexcept {
+  return __private::make_kmerge(
+      ::sus::collections::Vec<InnerIter>(::sus::move(first).into_iter(),
+                                         ::sus::move(rest).into_iter()...),
+      [](const std::remove_reference_t<Item>& a,
+         const std::remove_reference_t<Item>& b) {
+        return std::weak_ordering(a <=> b);
+      });
+}
+
+/// An iterator that merges any number of sorted iterators into a single sorted
+/// iterator.
+///
+/// The merge is done with a tournament tree of losers (a "loser tree"). After
+/// yielding an item, only the path from the leaf of the iterator that produced
+/// it to the root is replayed, which costs exactly `ceil(log2(k))` comparisons
+/// for `k` iterators. A binary heap needs up to twice as many comparisons per
+/// item, as each level of its sift-down compares against both children.
+///
+/// The merge is stable: when items compare equal, the item from the iterator
+/// that appeared earlier in the input is yielded first.
+///
+/// This type is returned from [`kmerge`]($sus::iter::kmerge),
+/// [`kmerge_by`]($sus::iter::kmerge_by) and [`merge`]($sus::iter::merge).
+template <class InnerSizedIter, class CmpFn>
+class [[nodiscard]] KMerge final
+    : public IteratorBase<KMerge<InnerSizedIter, CmpFn>,
+                          typename InnerSizedIter::Item> {
+ public:
+  using Item = typename InnerSizedIter::Item;
+
+  // Type is Move and (can be) Clone.
+  KMerge(KMerge&&) = default;
+  KMerge& operator=(KMerge&&) = default;
+
+  // sus::mem::Clone trait.
+  constexpr KMerge clone() const noexcept
+    requires(::sus::mem::Clone<InnerSizedIter> &&  //
+             ::sus::mem::Clone<CmpFn> &&           //
+             ::sus::mem::Clone<Option<Item>>)
+  {
+    return KMerge(CLONE, ::sus::clone(cmp_), ::sus::clone(iters_),
+                  ::sus::clone(heads_), ::sus::clone(tree_));
+  }
+
+  // sus::iter::Iterator trait.
+  constexpr Option<Item> next() noexcept {
+    const usize k = iters_.len();
+    if (k == 0u) return Option<Item>();
+
+    // SAFETY: All indices into `heads_`, `iters_` and `tree_` in here are
+    // iterator indices in `0..k` or internal node indices in `1..k`, and all
+    // three have length `k`.
+    usize winner = tree_.get_unchecked(::sus::marker::unsafe_fn, 0u);
+    Option<Item>& head = heads_.get_unchecked_mut(::sus::marker::unsafe_fn,
+                                                  winner);
+    Option<Item> out = head.take();
+    // If the overall winner is exhausted, then every iterator is, as an
+    // exhausted iterator loses against every other.
+    if (out.is_none()) return out;
+
+    head = iters_.get_unchecked_mut(::sus::marker::unsafe_fn, winner).next();
+    // Replay the matches on the path from the winner's leaf to the root. Each
+    // internal node holds the loser of the match played there, so the new
+    // head only has to be compared against those.
+    for (usize node = (winner + k) / 2u; node > 0u; node /= 2u) {
+      usize& loser = tree_.get_unchecked_mut(::sus::marker::unsafe_fn, node);
+      if (beats(loser, winner)) ::sus::mem::swap(loser, winner);
+    }
+    tree_.get_unchecked_mut(::sus::marker::unsafe_fn, 0u) = winner;
+    return out;
+  }
+
+  /// sus::iter::Iterator trait.
+  constexpr SizeHint size_hint() const noexcept {
+    usize lower;
+    Option<usize> upper = ::sus::some(0u);
+    for (usize i; i < iters_.len(); i += 1u) {
+      auto [lo, hi] = iters_[i].size_hint();
+      if (heads_[i].is_some()) {
+        lo = lo.saturating_add(1u);
+        hi = hi.and_then([](usize h) { return h.checked_add(1u); });
+      }
+      lower = lower.saturating_add(lo);
+      upper = upper.and_then([&hi](usize u) {
+        return hi.and_then([u](usize h) { return u.checked_add(h); });
+      });
+    }
+    return SizeHint(lower, ::sus::move(upper));
+  }
+
+ private:
+  template <class InnerIter, class Cmp>
+  friend constexpr KMerge<InnerIter, Cmp> __private::make_kmerge(
+      ::sus::collections::Vec<InnerIter>&& iters, Cmp&& cmp) noexcept;
+
+  // Returns if the head of iterator `a` should be yielded before the head of
+  // iterator `b`. Exhausted iterators lose to everything, and ties are broken
+  // by the position of the iterator to keep the merge stable.
+  constexpr bool beats(usize a, usize b) noexcept {
+    // SAFETY: `a` and `b` are iterator indices, which are less than
+    // `heads_.len()`.
+    const Option<Item>& ha = heads_.get_unchecked(::sus::marker::unsafe_fn, a);
+    const Option<Item>& hb = heads_.get_unchecked(::sus::marker::unsafe_fn, b);
+    if (ha.is_none()) return false;
+    if (hb.is_none()) return true;
+    auto ord = ::sus::fn::call_mut(cmp_, ha.as_value(), hb.as_value());
+    return ord < 0 || (ord == 0 && a < b);
+  }
+
+  // Plays the matches for the subtree rooted at `node`, storing the loser of
+  // each match in `tree_`, and returns the winner. Leaves are at positions
+  // `k..2k`, so the children of internal node `n` are always `2n` and `2n+1`
+  // for any `k`.
+  constexpr usize build(usize node) noexcept {
+    const usize k = iters_.len();
+    if (node >= k) return node - k;
+    usize left = build(node * 2u);
+    usize right = build(node * 2u + 1u);
+    if (beats(left, right)) {
+      tree_[node] = right;
+      return left;
+    } else {
+      tree_[node] = left;
+      return right;
+    }
+  }
+
+  // Regular ctor.
+  explicit constexpr KMerge(
+      CmpFn&& cmp, ::sus::collections::Vec<InnerSizedIter>&& iters) noexcept
+      : cmp_(::sus::move(cmp)), iters_(::sus::move(iters)) {
+    const usize k = iters_.len();
+    heads_.reserve(k);
+    for (InnerSizedIter& it : iters_.iter_mut()) heads_.push(it.next());
+    if (k > 0u) {
+      tree_.reserve(k);
+      for (usize i; i < k; i += 1u) tree_.push(0u);
+      // With a single iterator there are no matches to play, and `build(1)`
+      // returns the only leaf.
+      tree_[0u] = build(1u);
+    }
+  }
+  // Clone ctor.
+  enum Clone { CLONE };
+  explicit constexpr KMerge(Clone, CmpFn&& cmp,
+                            ::sus::collections::Vec<InnerSizedIter>&& iters,
+                            ::sus::collections::Vec<Option<Item>>&& heads,
+                            ::sus::collections::Vec<usize>&& tree) noexcept
+      : cmp_(::sus::move(cmp)),
+        iters_(::sus::move(iters)),
+        heads_(::sus::move(heads)),
+        tree_(::sus::move(tree)) {}
+
+  CmpFn cmp_;
+  ::sus::collections::Vec<InnerSizedIter> iters_;
+  // The next item of each iterator in `iters_`, or `None` if it is exhausted.
+  ::sus::collections::Vec<Option<Item>> heads_;
+  // `tree_[0]` is the index of the iterator with the smallest head, and
+  // `tree_[1..k]` are the internal nodes of the loser tree, each holding the
+  // index of the iterator that lost the match at that node.
+  ::sus::collections::Vec<usize> tree_;
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(cmp_), decltype(iters_),
+                                           decltype(heads_), decltype(tree_));
+};
+
+namespace __private {
+template <class InnerIter, class CmpFn>
+constexpr KMerge<InnerIter, CmpFn> make_kmerge(
+    ::sus::collections::Vec<InnerIter>&& iters, CmpFn&& cmp) noexcept {
+  return KMerge<InnerIter, CmpFn>(::sus::move(cmp), ::sus::move(iters));
+}
+}  // namespace __private
+
+}  // namespace sus::iter
@@ -0,0 +1,121 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/iter/kmerge.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/prelude.h"
+
+using sus::collections::VecIntoIter;
+
+namespace {
+
+TEST(KMerge, Example) {
+  auto a = sus::Vec<i32>(1, 4, 7);
+  auto b = sus::Vec<i32>(2, 5, 8);
+  auto c = sus::Vec<i32>(3, 6, 9);
+  auto it = sus::iter::kmerge_by(
+      sus::Vec<VecIntoIter<i32>>(sus::move(a).into_iter(),
+                                 sus::move(b).into_iter(),
+                                 sus::move(c).into_iter()),
+      [](const i32& l, const i32& r) { return l <=> r; });
+  sus_check(sus::move(it).collect_vec() ==
+            sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7, 8, 9));
+}
+
+TEST(KMerge, Empty) {
+  auto it = sus::iter::kmerge(sus::Vec<VecIntoIter<i32>>());
+  EXPECT_EQ(it.size_hint().lower, 0u);
+  EXPECT_EQ(it.size_hint().upper, sus::some(0u));
+  EXPECT_EQ(it.next(), sus::None);
+}
+
+TEST(KMerge, One) {
+  auto it = sus::iter::kmerge(
+      sus::Vec<VecIntoIter<i32>>(sus::Vec<i32>(1, 2, 3).into_iter()));
+  EXPECT_EQ(it.size_hint().lower, 3u);
+  EXPECT_EQ(sus::move(it).collect_vec(), sus::Vec<i32>(1, 2, 3));
+}
+
+TEST(KMerge, SomeEmpty) {
+  auto it = sus::iter::kmerge(sus::Vec<VecIntoIter<i32>>(
+      sus::Vec<i32>().into_iter(), sus::Vec<i32>(2, 3).into_iter(),
+      sus::Vec<i32>().into_iter(), sus::Vec<i32>(1).into_iter(),
+      sus::Vec<i32>().into_iter()));
+  EXPECT_EQ(it.size_hint().lower, 3u);
+  EXPECT_EQ(it.size_hint().upper, sus::some(3u));
+  EXPECT_EQ(it.next(), sus::some(1));
+  EXPECT_EQ(it.size_hint().lower, 2u);
+  EXPECT_EQ(it.next(), sus::some(2));
+  EXPECT_EQ(it.next(), sus::some(3));
+  EXPECT_EQ(it.next(), sus::None);
+  EXPECT_EQ(it.next(), sus::None);
+}
+
+TEST(KMerge, MatchesSort) {
+  // A non-power-of-two number of runs of different lengths.
+  auto runs = sus::Vec<VecIntoIter<u32>>();
+  auto all = sus::Vec<u32>();
+  for (u32 r; r < 13u; r += 1u) {
+    auto run = sus::Vec<u32>();
+    for (u32 i; i < r * 3u; i += 1u) {
+      u32 v = (i * 7u + r) % 50u + i * 50u;
+      run.push(v);
+      all.push(v);
+    }
+    runs.push(sus::move(run).into_iter());
+  }
+  all.sort();
+  EXPECT_EQ(sus::iter::kmerge(sus::move(runs)).collect_vec(), all);
+}
+
+TEST(KMerge, Stable) {
+  struct S {
+    i32 key;
+    i32 id;
+  };
+  auto cmp = [](const S& a, const S& b) { return a.key <=> b.key; };
+  auto it = sus::iter::kmerge_by(
+      sus::Vec<VecIntoIter<S>>(
+          sus::Vec<S>(S(1, 0), S(2, 1)).into_iter(),
+          sus::Vec<S>(S(1, 2), S(2, 3)).into_iter(),
+          sus::Vec<S>(S(1, 4), S(2, 5)).into_iter()),
+      cmp);
+  auto ids = sus::move(it).map([](S s) { return s.id; }).collect_vec();
+  EXPECT_EQ(ids, sus::Vec<i32>(0, 2, 4, 1, 3, 5));
+}
+
+TEST(KMerge, References) {
+  auto a = sus::Vec<i32>(1, 3);
+  auto b = sus::Vec<i32>(2, 4);
+  auto it = sus::iter::kmerge(sus::Vec<sus::collections::SliceIter<const i32&>>(
+      a.iter(), b.iter()));
+  static_assert(std::same_as<decltype(it.next()), sus::Option<const i32&>>);
+  EXPECT_EQ(&it.next().unwrap(), &a[0u]);
+  EXPECT_EQ(&it.next().unwrap(), &b[0u]);
+  EXPECT_EQ(&it.next().unwrap(), &a[1u]);
+  EXPECT_EQ(&it.next().unwrap(), &b[1u]);
+  EXPECT_EQ(it.next(), sus::None);
+}
+
+TEST(KMerge, Merge) {
+  auto a = sus::Vec<i32>(1, 5, 9);
+  auto b = sus::Vec<i32>(2, 6);
+  auto c = sus::Vec<i32>(3, 4, 7, 8);
+  auto it = sus::iter::merge(a.iter(), b.iter(), c.iter());
+  EXPECT_EQ(sus::move(it).copied().collect_vec(),
+            sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7, 8, 9));
+}
+
+}  // namespace
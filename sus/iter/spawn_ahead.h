@@ -0,0 +1,171 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <thread>
+
+#include "sus/iter/__private/spsc_queue.h"
+#include "sus/iter/iterator_defn.h"
+#include "sus/iter/size_hint.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/mem/replace.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/option/option.h"
+
+namespace sus::iter {
+
+/// An iterator that runs the iterator it was constructed from on a worker
+/// thread, and hands its items to the consuming thread through a bounded
+/// queue.
+///
+/// This type is returned from `Iterator::spawn_ahead()`, which is only
+/// available when this header is included.
+///
+/// The worker thread pulls items from the inner iterator until it is exhausted
+/// or until `buffer_len` items are waiting to be consumed, so the work of the
+/// upstream iterator chain overlaps with the work done by the consumer.
+///
+/// When the `SpawnAhead` is destroyed, the worker is told to stop and is
+/// joined. It may have produced up to `buffer_len` items which are then
+/// dropped without being consumed, and which were pulled from the inner
+/// iterator.
+///
+/// # Threading
+/// The inner iterator, and every closure in its chain, is run on the worker
+/// thread. Anything it refers to must be safe to access from that thread
+/// while the consumer runs. The inner iterator is destroyed on the worker
+/// thread.
+///
+/// A panic on the worker thread terminates the process just like a panic on
+/// the consuming thread would, as panics are not recoverable. The same is
+/// true of an exception which escapes the inner iterator, as `next()` is
+/// `noexcept`.
+template <class InnerIter>
+class [[nodiscard]] SpawnAhead final
+    : public IteratorBase<SpawnAhead<InnerIter>, typename InnerIter::Item> {
+ public:
+  using Item = typename InnerIter::Item;
+
+  // Type is Move (but not Clone).
+  SpawnAhead(SpawnAhead&& o) noexcept
+      : state_(::sus::mem::replace(o.state_, nullptr)),
+        initial_hint_(o.initial_hint_),
+        consumed_(o.consumed_),
+        done_(o.done_) {}
+  SpawnAhead& operator=(SpawnAhead&& o) noexcept {
+    if (this != &o) {
+      stop();
+      state_ = ::sus::mem::replace(o.state_, nullptr);
+      initial_hint_ = o.initial_hint_;
+      consumed_ = o.consumed_;
+      done_ = o.done_;
+    }
+    return *this;
+  }
+
+  ~SpawnAhead() noexcept { stop(); }
+
+  // sus::iter::Iterator trait.
+  Option<Item> next() noexcept {
+    if (done_) [[unlikely]]
+      return Option<Item>();
+    Option<Item> out = state_->queue.pop();
+    if (out.is_some())
+      consumed_ += 1u;
+    else
+      done_ = true;
+    return out;
+  }
+
+  /// sus::iter::Iterator trait.
+  SizeHint size_hint() const noexcept {
+    if (done_) return SizeHint(0u, ::sus::some(0u));
+    // The inner iterator's size is known from before it moved to the worker,
+    // and every item it produces is consumed here in order.
+    return SizeHint(
+        initial_hint_.lower.saturating_sub(consumed_),
+        initial_hint_.upper.map([this](usize u) { return u - consumed_; }));
+  }
+
+  // sus::iter::ExactSizeIterator trait.
+  usize exact_size_hint() const noexcept
+    requires(ExactSizeIterator<InnerIter, Item>)
+  {
+    if (done_) return 0u;
+    return initial_hint_.lower - consumed_;
+  }
+
+  /// sus::iter::TrustedLen trait.
+  constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
+      const noexcept
+    requires(TrustedLen<InnerIter>)
+  {
+    return {};
+  }
+
+ private:
+  template <class U, class V>
+  friend class IteratorBase;
+
+  struct State {
+    explicit State(usize buffer_len) noexcept : queue(buffer_len) {}
+
+    __private::SpscQueue<Item> queue;
+    std::thread worker;
+  };
+
+  explicit SpawnAhead(InnerIter&& iter, usize buffer_len) noexcept
+      : state_(new State(buffer_len)),
+        initial_hint_(iter.size_hint()),
+        consumed_(0u),
+        done_(false) {
+    state_->worker = std::thread(
+        [queue = &state_->queue, iter = ::sus::move(iter)]() mutable noexcept {
+          while (true) {
+            Option<Item> o = iter.next();
+            if (o.is_none()) break;
+            // The consumer has gone away, so stop pulling from the iterator.
+            if (!queue->push(::sus::move(o).unwrap_unchecked(
+                    ::sus::marker::unsafe_fn)))
+              return;
+          }
+          queue->close_producer();
+        });
+  }
+
+  void stop() noexcept {
+    if (state_ != nullptr) {
+      state_->queue.close_consumer();
+      state_->worker.join();
+      delete state_;
+      state_ = nullptr;
+    }
+  }
+
+  // Heap allocated so that the worker thread can refer to the queue while the
+  // `SpawnAhead` itself is moved.
+  State* state_;
+  SizeHint initial_hint_;
+  usize consumed_;
+  bool done_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(state_),
+                                  decltype(initial_hint_), decltype(consumed_),
+                                  decltype(done_));
+};
+
+}  // namespace sus::iter
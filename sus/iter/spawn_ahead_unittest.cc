@@ -0,0 +1,137 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/iter/spawn_ahead.h"
+
+#include <atomic>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/boxed/box.h"
+#include "sus/iter/iterator.h"
+#include "sus/iter/repeat_with.h"
+#include "sus/prelude.h"
+
+namespace {
+
+TEST(SpawnAhead, Example) {
+  auto v = sus::Vec<i32>(1, 2, 3, 4, 5);
+  auto it = sus::move(v).into_iter().map([](i32 i) { return i * 2; });
+  auto ahead = sus::move(it).spawn_ahead(2u);
+  EXPECT_EQ(sus::move(ahead).collect_vec(), sus::Vec<i32>(2, 4, 6, 8, 10));
+}
+
+TEST(SpawnAhead, Empty) {
+  auto it = sus::Vec<i32>().into_iter().spawn_ahead(4u);
+  EXPECT_EQ(it.size_hint().lower, 0u);
+  EXPECT_EQ(it.size_hint().upper, sus::some(0u));
+  EXPECT_EQ(it.next(), sus::None);
+  EXPECT_EQ(it.next(), sus::None);
+}
+
+TEST(SpawnAhead, SizeHint) {
+  auto it = sus::Vec<i32>(1, 2, 3).into_iter().spawn_ahead(1u);
+  EXPECT_EQ(it.size_hint().lower, 3u);
+  EXPECT_EQ(it.size_hint().upper, sus::some(3u));
+  EXPECT_EQ(it.exact_size_hint(), 3u);
+  EXPECT_EQ(it.next(), sus::some(1));
+  EXPECT_EQ(it.size_hint().lower, 2u);
+  EXPECT_EQ(it.size_hint().upper, sus::some(2u));
+  EXPECT_EQ(it.exact_size_hint(), 2u);
+  EXPECT_EQ(it.next(), sus::some(2));
+  EXPECT_EQ(it.next(), sus::some(3));
+  EXPECT_EQ(it.exact_size_hint(), 0u);
+  EXPECT_EQ(it.next(), sus::None);
+  EXPECT_EQ(it.size_hint().lower, 0u);
+  EXPECT_EQ(it.size_hint().upper, sus::some(0u));
+
+  // A filter has no lower bound.
+  auto f = sus::Vec<i32>(1, 2, 3, 4)
+               .into_iter()
+               .filter([](const i32& i) { return i % 2 == 0; })
+               .spawn_ahead(1u);
+  EXPECT_EQ(f.size_hint().lower, 0u);
+  EXPECT_EQ(f.size_hint().upper, sus::some(4u));
+  EXPECT_EQ(f.next(), sus::some(2));
+  EXPECT_EQ(f.size_hint().lower, 0u);
+  EXPECT_EQ(f.size_hint().upper, sus::some(3u));
+}
+
+TEST(SpawnAhead, LongerThanBuffer) {
+  auto v = sus::Vec<usize>();
+  for (usize i; i < 10'000u; i += 1u) v.push(i);
+  auto expected = sus::clone(v);
+  EXPECT_EQ(sus::move(v).into_iter().spawn_ahead(3u).collect_vec(), expected);
+}
+
+TEST(SpawnAhead, DropEarly) {
+  // The upstream never ends, so dropping the iterator must stop the worker.
+  std::atomic<uint32_t> produced = 0u;
+  {
+    auto it = sus::iter::repeat_with<u32>([&]() {
+                return u32(produced.fetch_add(1u, std::memory_order_relaxed));
+              })
+                  .spawn_ahead(4u);
+    EXPECT_EQ(it.next(), sus::some(0u));
+    EXPECT_EQ(it.next(), sus::some(1u));
+  }
+  // The worker is joined, and only ran ahead by about the buffer length.
+  uint32_t stopped_at = produced.load();
+  EXPECT_LE(stopped_at, 2u + 4u + 1u);
+  EXPECT_EQ(produced.load(), stopped_at);
+
+  // Dropped without consuming anything.
+  { auto it = sus::iter::repeat_with<i32>([]() { return 1; }).spawn_ahead(1u); }
+}
+
+TEST(SpawnAhead, Take) {
+  auto it = sus::iter::repeat_with<i32>([]() { return 3; })
+                .spawn_ahead(8u)
+                .take(5u);
+  EXPECT_EQ(sus::move(it).collect_vec(), sus::Vec<i32>(3, 3, 3, 3, 3));
+}
+
+TEST(SpawnAhead, References) {
+  auto v = sus::Vec<i32>(1, 2, 3);
+  auto it = v.iter().spawn_ahead(2u);
+  static_assert(std::same_as<decltype(it.next()), sus::Option<const i32&>>);
+  EXPECT_EQ(&it.next().unwrap(), &v[0u]);
+  EXPECT_EQ(&it.next().unwrap(), &v[1u]);
+  EXPECT_EQ(&it.next().unwrap(), &v[2u]);
+  EXPECT_EQ(it.next(), sus::None);
+}
+
+TEST(SpawnAhead, MoveOnly) {
+  auto v = sus::Vec<sus::Box<i32>>();
+  v.push(sus::Box<i32>(1));
+  v.push(sus::Box<i32>(2));
+  auto it = sus::move(v).into_iter().spawn_ahead(1u);
+  EXPECT_EQ(*it.next().unwrap(), 1);
+  // Moving the iterator does not disturb the worker.
+  auto moved = sus::move(it);
+  EXPECT_EQ(*moved.next().unwrap(), 2);
+  EXPECT_EQ(moved.next().is_none(), true);
+}
+
+TEST(SpawnAhead, SelfMoveAssign) {
+  auto it = sus::Vec<i32>(1, 2, 3).into_iter().spawn_ahead(1u);
+  EXPECT_EQ(it.next(), sus::some(1));
+  // Assigned through a reference, as compilers warn about a direct self-move.
+  auto& alias = it;
+  it = sus::move(alias);
+  EXPECT_EQ(it.next(), sus::some(2));
+  EXPECT_EQ(it.next(), sus::some(3));
+  EXPECT_EQ(it.next(), sus::None);
+}
+
+}  // namespace
@@ -137,6 +137,8 @@ template <class ToItem, class InnerSizedIter, class MapFn>
 class Map;
 template <class ToItem, class InnerSizedIter, class MapFn>
 class MapWhile;
+template <class InnerSizedIter, class OtherSizedIter, class CmpFn>
+class Merge;
 template <class InnerSizedIter>
 class Moved;
 template <class InnerSizedIter>
@@ -147,6 +149,8 @@ template <class OutType, class State, class InnerSizedIter, class Fn>
 class Scan;
 template <class InnerIter>
 class Skip;
+template <class InnerIter>
+class SpawnAhead;
 template <class InnerIter, class Pred>
 class SkipWhile;
 template <class InnerIter>
@@ -171,16 +175,29 @@ template <class T>
 class NonNull;
 }
 
+namespace sus::num {
+template <class T, decltype(T::primitive_value) Lo,
+          decltype(T::primitive_value) Hi>
+  requires(Lo <= Hi)
+class Bounded;
+}
+
 namespace sus::num {
 struct i8;
 struct i16;
 struct i32;
 struct i64;
+#if defined(__SIZEOF_INT128__)
+struct i128;
+#endif
 struct isize;
 struct u8;
 struct u16;
 struct u32;
 struct u64;
+#if defined(__SIZEOF_INT128__)
+struct u128;
+#endif
 struct usize;
 struct uptr;
 struct f32;
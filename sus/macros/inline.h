@@ -26,3 +26,8 @@
 /// compiler from inlining the function.
 #define _sus_no_inline \
   sus_if_msvc_else(__declspec(noinline), __attribute__((noinline)))
+
+/// Add `_sus_cold` to the start of a function declaration to tell the compiler
+/// that it is rarely called, so that it is optimized for size and calls to it
+/// are placed away from the hot path.
+#define _sus_cold sus_if_msvc_else(, __attribute__((cold)))
@@ -45,6 +45,7 @@ namespace __private {
 /// set the never-value field to:
 /// * the never-value, after trivial default construction.
 /// * the destroy-value before destroying it from the never-value state.
+/// * any of its niches, when the type has more than one.
 ///
 /// A type which satisfies NeverValueField has a field which is never set to a
 /// specific value during its lifetime under normal use. The type provides a
@@ -80,6 +81,12 @@ struct NeverValueChecker {
     std::declval<T&>()._sus_Unsafe_NeverValueIsConstructed(
         ::sus::marker::unsafe_fn);
   };
+  static constexpr size_t niche_count = []() {
+    if constexpr (has_field)
+      return T::_sus_Unsafe_NeverValueNicheCount;
+    else
+      return size_t{0u};
+  }();
 };
 
 template <class T>
@@ -98,6 +105,31 @@ struct NeverValueAccess {
     return t_._sus_Unsafe_NeverValueIsConstructed(::sus::marker::unsafe_fn);
   }
 
+  /// The number of niches, or distinct never-values, in the never-value
+  /// field. The never-value is niche 0.
+  static constexpr size_t kNicheCount = NeverValueChecker<T>::niche_count;
+
+  /// Checks if the never-value field is set to the value of the niche
+  /// `niche`, which must be less than `kNicheCount`.
+  _sus_pure constexpr _sus_always_inline bool is_niche(
+      size_t niche) const noexcept
+    requires(NeverValueChecker<T>::has_field)
+  {
+    return t_._sus_Unsafe_NeverValueIsNiche(::sus::marker::unsafe_fn, niche);
+  }
+
+  /// Sets the never-value field to the value of the niche `niche`, which must
+  /// be less than `kNicheCount`.
+  ///
+  /// # Safety
+  /// The `T` must be in a niche already, not constructed.
+  constexpr _sus_always_inline void set_niche(::sus::marker::UnsafeFnMarker,
+                                              size_t niche) noexcept
+    requires(NeverValueChecker<T>::has_field)
+  {
+    t_._sus_Unsafe_NeverValueSetNiche(::sus::marker::unsafe_fn, niche);
+  }
+
   /// Sets the never-value field to the destroy-value.
   constexpr _sus_always_inline void set_destroy_value(
       ::sus::marker::UnsafeFnMarker) noexcept
@@ -134,4 +166,19 @@ struct NeverValueAccess {
 template <class T>
 concept NeverValueField = __private::NeverValueChecker<T>::has_field;
 
+/// Returns the number of niches in the never-value field of `T`, or 0 if `T`
+/// does not satisfy [`NeverValueField`]($sus::mem::NeverValueField).
+///
+/// A niche is a value of the never-value field which is not used by a
+/// constructed object, and the never-value is the first niche. A type that
+/// holds a `T` can use the niches to represent its own states without any
+/// extra storage. [`Option<T>`]($sus::option::Option) uses the first niche
+/// for `None` and gives the rest to an outer type, and
+/// [`Result<void, E>`]($sus::result::Result) uses two niches of `E` for its
+/// `Ok` and moved-from states.
+template <class T>
+consteval size_t never_value_niche_count() noexcept {
+  return __private::NeverValueChecker<T>::niche_count;
+}
+
 }  // namespace sus::mem
@@ -25,30 +25,74 @@
 /// when the type is in a never-value state, if the never-value would be read in
 /// the destructor.
 ///
+/// The `never_value` is the type's only niche. Use
+/// `sus_class_never_value_field_niches()` to provide more than one.
+///
 /// The macro includes `private:` which changes the class definition visibility
 /// to private.
 #define sus_class_never_value_field(unsafe_fn, T, field_name, never_value,     \
                                     destroy_value)                             \
+  _sus__never_value_field_impl(unsafe_fn, T, field_name, 1u, never_value,      \
+                               destroy_value)
+
+/// Mark a class field as never being any of `niche_count` specific values,
+/// called niches, after a constructor has run and before the destructor has
+/// completed.
+///
+/// This is like `sus_class_never_value_field()` but lets a type which holds
+/// the class store its own state in the extra niches. For example an
+/// `Option<Option<T>>` can be the same size as `T`.
+///
+/// The `niche_value` is the name of a static member function that receives a
+/// `size_t` niche index less than `niche_count` and returns the value of the
+/// field for that niche. Niche 0 is the never-value, and the type must be
+/// constructed in it from `NeverValueConstructor`. The niche values must all
+/// be different, and the field must not hold any of them under normal use.
+///
+/// The macro includes `private:` which changes the class definition visibility
+/// to private.
+#define sus_class_never_value_field_niches(unsafe_fn, T, field_name,           \
+                                           niche_count, niche_value,           \
+                                           destroy_value)                      \
+  _sus__never_value_field_impl(unsafe_fn, T, field_name, niche_count,          \
+                               niche_value(niche), destroy_value)
+
+/// The implementation of the never-value macros. The `niche_value` is an
+/// expression for the value of the niche with index `niche`.
+#define _sus__never_value_field_impl(unsafe_marker, T, field_name,             \
+                                     niche_count, niche_value, destroy_value)  \
  private:                                                                      \
   static_assert(                                                               \
-      std::same_as<decltype(unsafe_fn), const ::sus::marker::UnsafeFnMarker>); \
+      std::same_as<decltype(unsafe_marker),                                    \
+                   const ::sus::marker::UnsafeFnMarker>);                      \
                                                                                \
   template <class>                                                             \
   friend struct ::sus::mem::__private::NeverValueAccess;                       \
   template <class>                                                             \
   friend struct ::sus::mem::__private::NeverValueChecker;                      \
                                                                                \
+  static constexpr size_t _sus_Unsafe_NeverValueNicheCount = niche_count;      \
+                                                                               \
   _sus_pure constexpr bool _sus_Unsafe_NeverValueIsConstructed(                \
       ::sus::marker::UnsafeFnMarker) const noexcept {                          \
+    return !_sus_Unsafe_NeverValueIsNiche(::sus::marker::unsafe_fn, 0u);       \
+  }                                                                            \
+  _sus_pure constexpr bool _sus_Unsafe_NeverValueIsNiche(                      \
+      ::sus::marker::UnsafeFnMarker,                                           \
+      [[maybe_unused]] size_t niche) const noexcept {                          \
     static_assert(                                                             \
-        std::is_assignable_v<decltype(field_name)&, decltype(never_value)>,    \
+        std::is_assignable_v<decltype(field_name)&, decltype(niche_value)>,    \
         "The `never_value` must be able to be assigned to the named field.");  \
-    return !(field_name == never_value);                                       \
+    static_assert(::sus::cmp::Eq<decltype(field_name), decltype(niche_value)>, \
+                  "The `never_value` must be comparable to the named field."); \
+    return field_name == niche_value;                                          \
+  }                                                                            \
+  constexpr void _sus_Unsafe_NeverValueSetNiche(                               \
+      ::sus::marker::UnsafeFnMarker, [[maybe_unused]] size_t niche) noexcept { \
+    field_name = niche_value;                                                  \
   }                                                                            \
   constexpr void _sus_Unsafe_NeverValueSetDestroyValue(                        \
       ::sus::marker::UnsafeFnMarker) noexcept {                                \
-    static_assert(::sus::cmp::Eq<decltype(field_name), decltype(never_value)>, \
-                  "The `never_value` must be comparable to the named field."); \
     field_name = destroy_value;                                                \
   }                                                                            \
   static_assert(true)
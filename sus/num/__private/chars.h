@@ -0,0 +1,260 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <bit>
+#include <type_traits>
+
+#include "sus/assertions/unreachable.h"
+#include "sus/macros/inline.h"
+#include "sus/macros/pure.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/size_of.h"
+#include "sus/num/__private/int_log10.h"
+#include "sus/num/__private/intrinsics.h"
+
+// Conversions between integers and text, which work on any byte type that can
+// be converted to and from `uint8_t`, such as `u8`.
+namespace sus::num::__private {
+
+enum class ParseIntStatus {
+  Ok,
+  Empty,
+  InvalidDigit,
+  PosOverflow,
+  NegOverflow,
+};
+
+template <class U>
+struct ParseIntOut {
+  ParseIntStatus status;
+  U value;
+};
+
+/// Returns the value of the ASCII character `c` as a digit, where letters
+/// (of either case) are digits from 10 to 35. Returns 36 or more for anything
+/// else.
+__sus_pure_const _sus_always_inline constexpr uint32_t digit_value(
+    uint8_t c) noexcept {
+  const uint32_t d = uint32_t{c} - uint32_t{'0'};
+  if (d < 10u) return d;
+  // Setting 0x20 makes an ASCII letter lowercase.
+  const uint32_t l = (uint32_t{c} | 0x20u) - uint32_t{'a'};
+  if (l < 26u) return l + 10u;
+  return 36u;
+}
+
+/// Reads 8 bytes as an integer with the first byte in the lowest bits.
+template <class Byte>
+  requires(::sus::mem::size_of<Byte>() == 1u)
+_sus_always_inline uint64_t load_eight_bytes(const Byte* p) noexcept {
+  uint64_t v;
+  memcpy(&v, p, 8u);
+  if constexpr (std::endian::native == std::endian::big) v = swap_bytes(v);
+  return v;
+}
+
+/// Whether all 8 bytes in `v` are ASCII decimal digits.
+///
+/// A byte below '0' sets its high bit when '0' is subtracted, and a byte above
+/// '9' sets its high bit when 0x46 is added.
+__sus_pure_const _sus_always_inline constexpr bool is_eight_digits(
+    uint64_t v) noexcept {
+  return (((v + 0x4646464646464646u) | (v - 0x3030303030303030u)) &
+          0x8080808080808080u) == 0u;
+}
+
+/// Converts 8 ASCII decimal digits, with the most significant digit in the
+/// lowest byte, to their value. This combines adjacent digits into pairs, then
+/// the pairs into 4-digit groups and those into the result, with a multiply
+/// for each step instead of one per digit.
+__sus_pure_const _sus_always_inline constexpr uint32_t parse_eight_digits(
+    uint64_t v) noexcept {
+  constexpr uint64_t mask = 0x000000FF000000FFu;
+  constexpr uint64_t mul1 = 100u + (uint64_t{1000000u} << 32u);
+  constexpr uint64_t mul2 = 1u + (uint64_t{10000u} << 32u);
+  v -= 0x3030303030303030u;
+  v = (v * 10u) + (v >> 8u);
+  v = (((v & mask) * mul1) + (((v >> 16u) & mask) * mul2)) >> 32u;
+  return static_cast<uint32_t>(v);
+}
+
+/// Parses an integer from the `len` characters at `p`, with an optional
+/// leading `+` sign or, if `Signed`, a `-` sign.
+///
+/// The result is the magnitude of the integer as an unsigned value `U`. It must
+/// be at most `max` if positive or at most `max + 1` if negative and `Signed`,
+/// to fit in the target type. Errors are reported for the first character that
+/// is invalid or that makes the value overflow.
+template <bool Signed, class U, class Byte>
+  requires(is_unsigned_v<U> && ::sus::mem::size_of<Byte>() == 1u)
+_sus_pure constexpr ParseIntOut<U> parse_int(const Byte* p, size_t len,
+                                              uint32_t radix, U max) noexcept {
+  if (len == 0u) return ParseIntOut<U>(ParseIntStatus::Empty, U{0});
+
+  bool negative = false;
+  size_t i = 0u;
+  if (static_cast<uint8_t>(p[0u]) == uint8_t{'+'}) {
+    i = 1u;
+  } else if (Signed && static_cast<uint8_t>(p[0u]) == uint8_t{'-'}) {
+    i = 1u;
+    negative = true;
+    max = unchecked_add(max, U{1});
+  }
+  // A sign alone is not a number.
+  if (i == len) return ParseIntOut<U>(ParseIntStatus::InvalidDigit, U{0});
+
+  const ParseIntStatus overflow =
+      negative ? ParseIntStatus::NegOverflow : ParseIntStatus::PosOverflow;
+  U acc = U{0};
+
+  if (radix == 10u && !std::is_constant_evaluated()) {
+    while (len - i >= 8u) {
+      const uint64_t chunk = load_eight_bytes(p + i);
+      if (!is_eight_digits(chunk)) break;
+      const uint32_t digits = parse_eight_digits(chunk);
+      if constexpr (::sus::mem::size_of<U>() < 8u) {
+        // Any `acc <= max` fits in 32 bits, so this can't overflow 64 bits.
+        const uint64_t wide = uint64_t{acc} * 100'000'000u + digits;
+        if (wide > uint64_t{max}) return ParseIntOut<U>(overflow, U{0});
+        acc = static_cast<U>(wide);
+      } else {
+        const auto mul = mul_with_overflow(acc, U{100'000'000u});
+        const auto add = add_with_overflow(mul.value, U{digits});
+        if (mul.overflow || add.overflow || add.value > max)
+          return ParseIntOut<U>(overflow, U{0});
+        acc = add.value;
+      }
+      i += 8u;
+    }
+  }
+
+  for (; i < len; ++i) {
+    const uint32_t d = digit_value(static_cast<uint8_t>(p[i]));
+    if (d >= radix) return ParseIntOut<U>(ParseIntStatus::InvalidDigit, U{0});
+    const auto mul = mul_with_overflow(acc, static_cast<U>(radix));
+    const auto add = add_with_overflow(mul.value, static_cast<U>(d));
+    if (mul.overflow || add.overflow || add.value > max)
+      return ParseIntOut<U>(overflow, U{0});
+    acc = add.value;
+  }
+  if (negative) acc = unchecked_sub(U{0}, acc);
+  return ParseIntOut<U>(ParseIntStatus::Ok, acc);
+}
+
+/// Converts a failed `ParseIntStatus` to the error type `E`, which is
+/// `ParseIntError`.
+template <class E>
+__sus_pure_const constexpr E parse_int_error(ParseIntStatus status) noexcept {
+  switch (status) {
+    case ParseIntStatus::Empty: return E::with_empty();
+    case ParseIntStatus::InvalidDigit: return E::with_invalid_digit();
+    case ParseIntStatus::PosOverflow: return E::with_pos_overflow();
+    case ParseIntStatus::NegOverflow: return E::with_neg_overflow();
+    case ParseIntStatus::Ok: break;
+  }
+  ::sus::unreachable_unchecked(::sus::marker::unsafe_fn);
+}
+
+/// The number of decimal digits in `v`.
+template <class U>
+  requires(is_unsigned_v<U> && ::sus::mem::size_of<U>() <= 16u)
+__sus_pure_const constexpr uint32_t count_digits(U v) noexcept {
+  if (v == U{0}) return 1u;
+  if constexpr (::sus::mem::size_of<U>() <= 2u)
+    return int_log10::u16(v) + 1u;
+  else if constexpr (::sus::mem::size_of<U>() == 4u)
+    return int_log10::u32(v) + 1u;
+  else if constexpr (::sus::mem::size_of<U>() == 8u)
+    return int_log10::u64(v) + 1u;
+  else
+    return int_log10::u128(v) + 1u;
+}
+
+/// The decimal digits of 0 to 99, two characters each.
+constexpr inline char digit_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536"
+    "37383940414243444546474849505152535455565758596061626364656667686970717273"
+    "7475767778798081828384858687888990919293949596979899";
+
+/// Writes the decimal digits of `v` into the `count_digits(v)` characters
+/// ending before `end`, two digits at a time.
+template <class U, class Byte>
+  requires(is_unsigned_v<U> && ::sus::mem::size_of<Byte>() == 1u)
+constexpr void write_digits(U v, Byte* end) noexcept {
+  // Use at least 32 bits, to avoid promotion to `int` of smaller types.
+  using M = MathType<U>;
+  M m = M{v};
+  while (m >= M{100u}) {
+    const M pair = (m % M{100u}) * M{2u};
+    m /= M{100u};
+    *--end = static_cast<uint8_t>(digit_pairs[pair + 1u]);
+    *--end = static_cast<uint8_t>(digit_pairs[pair]);
+  }
+  if (m >= M{10u}) {
+    *--end = static_cast<uint8_t>(digit_pairs[m * 2u + 1u]);
+    *--end = static_cast<uint8_t>(digit_pairs[m * 2u]);
+  } else {
+    *--end = static_cast<uint8_t>(uint8_t{'0'} + m);
+  }
+}
+
+/// When parsing a decimal floating point number from `len` characters at `p`
+/// gives a value that is out of range, returns whether it overflowed (is too
+/// large) instead of underflowing (too small).
+///
+/// The number is too large if its first significant digit comes before the
+/// decimal point, after applying the exponent. The number is only out of
+/// range when the exponent is huge, so it does not matter exactly where the
+/// digit is.
+_sus_pure constexpr bool float_overflowed(const char* p, size_t len) noexcept {
+  const char* const end = p + len;
+  if (p != end && (*p == '-' || *p == '+')) ++p;
+  // The position of the first significant digit, relative to the decimal
+  // point.
+  int64_t magnitude = 0;
+  bool seen_point = false;
+  bool seen_nonzero = false;
+  for (; p != end && *p != 'e' && *p != 'E'; ++p) {
+    if (*p == '.') {
+      seen_point = true;
+    } else if (seen_nonzero) {
+      if (!seen_point) magnitude += 1;
+    } else if (*p != '0') {
+      seen_nonzero = true;
+      if (seen_point) magnitude -= 1;
+    } else if (seen_point) {
+      magnitude -= 1;
+    }
+  }
+  if (p != end) {
+    ++p;
+    bool negative_exp = false;
+    if (p != end && (*p == '-' || *p == '+')) negative_exp = *p++ == '-';
+    int64_t exp = 0;
+    // Exponents past what any float can represent are clamped.
+    for (; p != end; ++p) exp = exp < 100'000 ? exp * 10 + (*p - '0') : exp;
+    magnitude += negative_exp ? -exp : exp;
+  }
+  return magnitude >= 0;
+}
+
+}  // namespace sus::num::__private
@@ -0,0 +1,193 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <bit>
+
+#include "sus/macros/inline.h"
+#include "sus/macros/pure.h"
+
+// The bulk conversions use the hardware conversion instructions when the
+// target has them, as chosen by the compiler flags (such as `-mf16c`):
+// - F16C (x86) converts 8 values per instruction, and AVX-512F converts 16.
+// - NEON (AArch64) converts 4 values per instruction.
+// Otherwise the scalar conversions are used, which the compiler can still
+// vectorize for `bf16`.
+#if defined(__AVX512F__)
+#  include <immintrin.h>
+#  define SUS_HALF_FLOAT_X86_LANES 16
+#elif defined(__F16C__)
+#  include <immintrin.h>
+#  define SUS_HALF_FLOAT_X86_LANES 8
+#else
+#  define SUS_HALF_FLOAT_X86_LANES 0
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#  include <arm_neon.h>
+#  define SUS_HALF_FLOAT_NEON true
+#else
+#  define SUS_HALF_FLOAT_NEON false
+#endif
+
+namespace sus::num::__private {
+
+/// Converts the bits of an `f32` to the bits of the nearest IEEE 754 binary16
+/// value, rounding ties to even. NaNs stay NaN and become quiet, keeping the
+/// high bits of their payload, as the F16C instructions do.
+__sus_pure_const constexpr uint16_t f32_to_f16_bits(uint32_t x) noexcept {
+  const auto sign = static_cast<uint16_t>((x >> 16u) & 0x8000u);
+  const uint32_t exp = (x >> 23u) & 0xffu;
+  uint32_t man = x & 0x7fffffu;
+  if (exp == 0xffu) {
+    if (man == 0u) return sign | uint16_t{0x7c00u};
+    return sign | static_cast<uint16_t>(0x7e00u | (man >> 13u));
+  }
+  const int32_t e = static_cast<int32_t>(exp) - 127;
+  // Too large, so rounds to infinity.
+  if (e > 15) return sign | uint16_t{0x7c00u};
+  if (e >= -14) {
+    // A normal value. Rounding up can carry into the exponent, which gives the
+    // next power of two, or infinity above `f16::MAX`.
+    uint32_t h = (static_cast<uint32_t>(e + 15) << 10u) | (man >> 13u);
+    const uint32_t rem = man & 0x1fffu;
+    if (rem > 0x1000u || (rem == 0x1000u && (h & 1u) != 0u)) h += 1u;
+    return sign | static_cast<uint16_t>(h);
+  }
+  // Too small, so rounds to zero.
+  if (e < -25) return sign;
+  // A subnormal value, in units of 2^-24. Rounding up can carry into the
+  // smallest normal value.
+  man |= 0x800000u;
+  const auto shift = static_cast<uint32_t>(-(e + 1));
+  uint32_t h = man >> shift;
+  const uint32_t rem = man & ((1u << shift) - 1u);
+  const uint32_t half = 1u << (shift - 1u);
+  if (rem > half || (rem == half && (h & 1u) != 0u)) h += 1u;
+  return sign | static_cast<uint16_t>(h);
+}
+
+/// Converts the bits of an IEEE 754 binary16 value to the bits of the `f32`
+/// with the same value, which is always exact. NaNs stay NaN and become quiet,
+/// as they do in the hardware conversions.
+__sus_pure_const constexpr uint32_t f16_bits_to_f32(uint16_t h) noexcept {
+  const uint32_t sign = uint32_t{h & 0x8000u} << 16u;
+  const uint32_t exp = (h >> 10u) & 0x1fu;
+  uint32_t man = h & 0x3ffu;
+  if (exp == 0x1fu) {
+    if (man == 0u) return sign | 0x7f800000u;
+    return sign | 0x7fc00000u | (man << 13u);
+  }
+  if (exp == 0u) {
+    if (man == 0u) return sign;
+    // A subnormal value, which is normal as an `f32`.
+    uint32_t e = 127u - 14u;
+    while ((man & 0x400u) == 0u) {
+      man <<= 1u;
+      e -= 1u;
+    }
+    return sign | (e << 23u) | ((man & 0x3ffu) << 13u);
+  }
+  return sign | ((exp + (127u - 15u)) << 23u) | (man << 13u);
+}
+
+/// Converts the bits of an `f32` to the bits of the nearest bfloat16 value,
+/// rounding ties to even. NaNs stay NaN and become quiet.
+__sus_pure_const _sus_always_inline constexpr uint16_t f32_to_bf16_bits(
+    uint32_t x) noexcept {
+  // Written as a select rather than a branch, so that loops over it vectorize.
+  const uint32_t nan = (x >> 16u) | 0x40u;
+  const uint32_t rounded = (x + 0x7fffu + ((x >> 16u) & 1u)) >> 16u;
+  return static_cast<uint16_t>((x & 0x7fffffffu) > 0x7f800000u ? nan : rounded);
+}
+
+/// Converts the bits of a bfloat16 value to the bits of the `f32` with the
+/// same value, which is its high half.
+__sus_pure_const _sus_always_inline constexpr uint32_t bf16_bits_to_f32(
+    uint16_t h) noexcept {
+  return uint32_t{h} << 16u;
+}
+
+/// Converts `len` floats at `src` to binary16 bits at `dst`.
+inline void f32_to_f16_slice(const float* src, uint16_t* dst,
+                             size_t len) noexcept {
+  size_t i = 0u;
+#if SUS_HALF_FLOAT_X86_LANES == 16
+  for (; len - i >= 16u; i += 16u) {
+    const __m256i h = _mm512_cvtps_ph(_mm512_loadu_ps(src + i),
+                                      _MM_FROUND_TO_NEAREST_INT);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), h);
+  }
+#elif SUS_HALF_FLOAT_X86_LANES == 8
+  for (; len - i >= 8u; i += 8u) {
+    const __m128i h =
+        _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+  }
+#elif SUS_HALF_FLOAT_NEON
+  for (; len - i >= 4u; i += 4u) {
+    const float16x4_t h = vcvt_f16_f32(vld1q_f32(src + i));
+    vst1_u16(dst + i, vreinterpret_u16_f16(h));
+  }
+#endif
+  for (; i < len; ++i)
+    dst[i] = f32_to_f16_bits(std::bit_cast<uint32_t>(src[i]));
+}
+
+/// Converts `len` binary16 bits at `src` to floats at `dst`.
+inline void f16_to_f32_slice(const uint16_t* src, float* dst,
+                             size_t len) noexcept {
+  size_t i = 0u;
+#if SUS_HALF_FLOAT_X86_LANES == 16
+  for (; len - i >= 16u; i += 16u) {
+    const __m256i h =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(h));
+  }
+#elif SUS_HALF_FLOAT_X86_LANES == 8
+  for (; len - i >= 8u; i += 8u) {
+    const __m128i h =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+  }
+#elif SUS_HALF_FLOAT_NEON
+  for (; len - i >= 4u; i += 4u) {
+    const float16x4_t h = vreinterpret_f16_u16(vld1_u16(src + i));
+    vst1q_f32(dst + i, vcvt_f32_f16(h));
+  }
+#endif
+  for (; i < len; ++i)
+    dst[i] = std::bit_cast<float>(f16_bits_to_f32(src[i]));
+}
+
+/// Converts `len` floats at `src` to bfloat16 bits at `dst`.
+inline void f32_to_bf16_slice(const float* src, uint16_t* dst,
+                              size_t len) noexcept {
+  for (size_t i = 0u; i < len; ++i)
+    dst[i] = f32_to_bf16_bits(std::bit_cast<uint32_t>(src[i]));
+}
+
+/// Converts `len` bfloat16 bits at `src` to floats at `dst`.
+inline void bf16_to_f32_slice(const uint16_t* src, float* dst,
+                              size_t len) noexcept {
+  for (size_t i = 0u; i < len; ++i)
+    dst[i] = std::bit_cast<float>(bf16_bits_to_f32(src[i]));
+}
+
+}  // namespace sus::num::__private
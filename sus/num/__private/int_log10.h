@@ -80,6 +80,25 @@ __sus_pure_const _sus_always_inline constexpr uint32_t u64(uint64_t val) noexcep
   return log + less_than_5(static_cast<uint32_t>(val));
 }
 
+#if defined(__SIZEOF_INT128__)
+// 0 < val <= u128::MAX
+__sus_pure_const _sus_always_inline constexpr uint32_t u128(
+    unsigned __int128 val) noexcept {
+  constexpr auto e19 =
+      static_cast<unsigned __int128>(10'000'000'000'000'000'000u);
+  auto log = uint32_t{0};
+  if (val >= e19 * e19) {
+    val /= e19 * e19;
+    log += 38;
+  }
+  if (val >= e19) {
+    val /= e19;
+    log += 19;
+  }
+  return log + u64(static_cast<uint64_t>(val));
+}
+#endif
+
 __sus_pure_const _sus_always_inline constexpr uint32_t usize(
     std::same_as<uint32_t> auto val) noexcept {
   return u32(val);
@@ -116,6 +135,13 @@ __sus_pure_const _sus_always_inline constexpr uint32_t i64(int64_t val) noexcept
   return u64(static_cast<uint64_t>(val));
 }
 
+#if defined(__SIZEOF_INT128__)
+__sus_pure_const _sus_always_inline constexpr uint32_t i128(
+    __int128 val) noexcept {
+  return u128(static_cast<unsigned __int128>(val));
+}
+#endif
+
 __sus_pure_const _sus_always_inline constexpr uint32_t isize(
     int32_t val) noexcept {
   return usize(static_cast<uint32_t>(val));
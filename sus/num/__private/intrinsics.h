@@ -22,6 +22,7 @@
 
 #include <bit>
 #include <cmath>
+#include <functional>
 #include <type_traits>
 
 #if _MSC_VER
@@ -38,6 +39,42 @@
 
 namespace sus::num::__private {
 
+/// Whether `T` is a primitive integer type. Unlike `std::is_integral_v`, this
+/// includes the 128-bit integer types where the compiler provides them, which
+/// the standard library does not include when compiler extensions are
+/// disabled.
+template <class T>
+inline constexpr bool is_integral_v = std::is_integral_v<T>
+#if defined(__SIZEOF_INT128__)
+                                      || std::is_same_v<T, __int128> ||
+                                      std::is_same_v<T, unsigned __int128>
+#endif
+    ;
+
+/// Whether `T` is a signed primitive integer type, including 128-bit integers.
+template <class T>
+inline constexpr bool is_signed_v = std::is_signed_v<T>
+#if defined(__SIZEOF_INT128__)
+                                    || std::is_same_v<T, __int128>
+#endif
+    ;
+
+/// Whether `T` is an unsigned primitive integer type, including 128-bit
+/// integers.
+template <class T>
+inline constexpr bool is_unsigned_v = std::is_unsigned_v<T>
+#if defined(__SIZEOF_INT128__)
+                                      || std::is_same_v<T, unsigned __int128>
+#endif
+    ;
+
+#if defined(__SIZEOF_INT128__)
+/// Single-token names for the 128-bit primitive integers, so that they can be
+/// used in functional casts like `_primitive(x)`.
+using uint128_type = unsigned __int128;
+using int128_type = __int128;
+#endif
+
 template <class T>
 struct OverflowOut final {
   bool overflow;
@@ -48,10 +85,10 @@ struct OverflowOut final {
 // may be a larger type than `T` to avoid promotion to `int` which involves sign
 // conversion!
 template <class T>
-  requires(std::is_integral_v<T>)
+  requires(is_integral_v<T>)
 using MathType = std::conditional_t<
     ::sus::mem::size_of<T>() >= ::sus::mem::size_of<int>(), T,
-    std::conditional_t<std::is_signed_v<T>, int, unsigned int>>;
+    std::conditional_t<is_signed_v<T>, int, unsigned int>>;
 
 /// A sizeof() function that returns type uint32_t.
 template <class T>
@@ -62,81 +99,81 @@ unchecked_sizeof() noexcept {
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T>)
+  requires(is_integral_v<T> && is_signed_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_neg(T x) noexcept {
   return static_cast<T>(-MathType<T>{x});
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T>)
+  requires(is_integral_v<T> && !is_signed_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_not(T x) noexcept {
   return static_cast<T>(~MathType<T>{x});
 }
 
 template <class T>
-  requires(std::is_integral_v<T>)
+  requires(is_integral_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_add(T x,
                                                               T y) noexcept {
   return static_cast<T>(MathType<T>{x} + MathType<T>{y});
 }
 
 template <class T>
-  requires(std::is_integral_v<T>)
+  requires(is_integral_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_sub(T x,
                                                               T y) noexcept {
   return static_cast<T>(MathType<T>{x} - MathType<T>{y});
 }
 
 template <class T>
-  requires(std::is_integral_v<T>)
+  requires(is_integral_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_mul(T x,
                                                               T y) noexcept {
   return static_cast<T>(MathType<T>{x} * MathType<T>{y});
 }
 
 template <class T>
-  requires(std::is_integral_v<T>)
+  requires(is_integral_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_div(T x,
                                                               T y) noexcept {
   return static_cast<T>(MathType<T>{x} / MathType<T>{y});
 }
 
 template <class T>
-  requires(std::is_integral_v<T>)
+  requires(is_integral_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_rem(T x,
                                                               T y) noexcept {
   return static_cast<T>(MathType<T>{x} % MathType<T>{y});
 }
 
 template <class T>
-  requires(std::is_integral_v<T>)
+  requires(is_integral_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_and(T x,
                                                               T y) noexcept {
   return static_cast<T>(MathType<T>{x} & MathType<T>{y});
 }
 
 template <class T>
-  requires(std::is_integral_v<T>)
+  requires(is_integral_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_or(T x,
                                                              T y) noexcept {
   return static_cast<T>(MathType<T>{x} | MathType<T>{y});
 }
 
 template <class T>
-  requires(std::is_integral_v<T>)
+  requires(is_integral_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_xor(T x,
                                                               T y) noexcept {
   return static_cast<T>(MathType<T>{x} ^ MathType<T>{y});
 }
 
 template <class T>
-  requires(std::is_integral_v<T>)
+  requires(is_integral_v<T>)
 __sus_pure_const _sus_always_inline constexpr uint32_t num_bits() noexcept {
   return unchecked_mul(unchecked_sizeof<T>(), uint32_t{8});
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr T high_bit() noexcept {
   if constexpr (::sus::mem::size_of<T>() == 1)
     return static_cast<T>(0x80);
@@ -144,8 +181,10 @@ __sus_pure_const _sus_always_inline constexpr T high_bit() noexcept {
     return static_cast<T>(0x8000);
   else if constexpr (::sus::mem::size_of<T>() == 4)
     return static_cast<T>(0x80000000);
-  else
+  else if constexpr (::sus::mem::size_of<T>() == 8)
     return static_cast<T>(0x8000000000000000);
+  else
+    return static_cast<T>(static_cast<T>(0x8000000000000000) << 64u);
 }
 
 template <class T>
@@ -161,14 +200,14 @@ __sus_pure_const _sus_always_inline constexpr uint64_t high_bit() noexcept {
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T>)
+  requires(is_integral_v<T> && !is_signed_v<T>)
 __sus_pure_const _sus_always_inline constexpr T max_value() noexcept {
   return unchecked_not(T{0});
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr T max_value() noexcept {
   if constexpr (::sus::mem::size_of<T>() == 1)
     return T{0x7f};
@@ -176,8 +215,11 @@ __sus_pure_const _sus_always_inline constexpr T max_value() noexcept {
     return T{0x7fff};
   else if constexpr (::sus::mem::size_of<T>() == 4)
     return T{0x7fffffff};
-  else
+  else if constexpr (::sus::mem::size_of<T>() == 8)
     return T{0x7fffffffffffffff};
+  else
+    return static_cast<T>((T{0x7fffffffffffffff} << 64u) |
+                          T{0xffffffffffffffff});
 }
 
 template <class T>
@@ -371,10 +413,10 @@ __sus_pure_const _sus_always_inline constexpr T min_uint8_float() noexcept {
 }
 
 template <class I, class T>
-  requires(std::is_floating_point_v<T> && std::is_integral_v<I> &&
+  requires(std::is_floating_point_v<T> && is_integral_v<I> &&
            ::sus::mem::size_of<I>() <= 8)
 __sus_pure_const _sus_always_inline constexpr T max_int_float() noexcept {
-  if constexpr (std::is_signed_v<I>) {
+  if constexpr (is_signed_v<I>) {
     if constexpr (::sus::mem::size_of<I>() == 8)
       return max_int64_float<T>();
     else if constexpr (::sus::mem::size_of<I>() == 4)
@@ -396,10 +438,10 @@ __sus_pure_const _sus_always_inline constexpr T max_int_float() noexcept {
 }
 
 template <class I, class T>
-  requires(std::is_floating_point_v<T> && std::is_integral_v<I> &&
+  requires(std::is_floating_point_v<T> && is_integral_v<I> &&
            ::sus::mem::size_of<I>() <= 8)
 __sus_pure_const _sus_always_inline constexpr T min_int_float() noexcept {
-  if constexpr (std::is_signed_v<I>) {
+  if constexpr (is_signed_v<I>) {
     if constexpr (::sus::mem::size_of<I>() == 8)
       return min_int64_float<T>();
     else if constexpr (::sus::mem::size_of<I>() == 4)
@@ -421,14 +463,14 @@ __sus_pure_const _sus_always_inline constexpr T min_int_float() noexcept {
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T>)
+  requires(is_integral_v<T> && !is_signed_v<T>)
 __sus_pure_const _sus_always_inline constexpr T min_value() noexcept {
   return T{0};
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr T min_value() noexcept {
   return -max_value<T>() - T{1};
 }
@@ -461,28 +503,28 @@ __sus_pure_const _sus_always_inline constexpr T min_value() noexcept {
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T>)
+  requires(is_integral_v<T> && !is_signed_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_shl(
     T x, uint64_t y) noexcept {
   return static_cast<T>(MathType<T>{x} << y);
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T>)
+  requires(is_integral_v<T> && is_signed_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_shl(
     T x, uint64_t y) noexcept {
   return static_cast<T>(MathType<T>{x} << y);
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T>)
+  requires(is_integral_v<T> && !is_signed_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_shr(
     T x, uint64_t y) noexcept {
   return static_cast<T>(MathType<T>{x} >> y);
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T>)
+  requires(is_integral_v<T> && is_signed_v<T>)
 __sus_pure_const _sus_always_inline constexpr T unchecked_shr(
     T x, uint64_t y) noexcept {
   // Performs sign extension.
@@ -490,7 +532,7 @@ __sus_pure_const _sus_always_inline constexpr T unchecked_shr(
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_unsigned_v<T> &&
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
            ::sus::mem::size_of<T>() <= 8)
 __sus_pure_const _sus_always_inline constexpr uint32_t count_ones(
     T value) noexcept {
@@ -530,8 +572,19 @@ __sus_pure_const _sus_always_inline constexpr uint32_t count_ones(
 #endif
 }
 
+#if defined(__SIZEOF_INT128__)
 template <class T>
-  requires(std::is_integral_v<T> && std::is_unsigned_v<T> &&
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
+           ::sus::mem::size_of<T>() == 16)
+__sus_pure_const _sus_always_inline constexpr uint32_t count_ones(
+    T value) noexcept {
+  return count_ones(static_cast<uint64_t>(value)) +
+         count_ones(static_cast<uint64_t>(value >> 64u));
+}
+#endif
+
+template <class T>
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
            ::sus::mem::size_of<T>() <= 8)
 __sus_pure_const _sus_always_inline constexpr uint32_t leading_zeros_nonzero(
     ::sus::marker::UnsafeFnMarker, T value) noexcept {
@@ -611,9 +664,22 @@ __sus_pure_const _sus_always_inline constexpr uint32_t leading_zeros_nonzero(
 #endif
 }
 
+#if defined(__SIZEOF_INT128__)
 template <class T>
-  requires(std::is_integral_v<T> && std::is_unsigned_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
+           ::sus::mem::size_of<T>() == 16)
+__sus_pure_const _sus_always_inline constexpr uint32_t leading_zeros_nonzero(
+    ::sus::marker::UnsafeFnMarker, T value) noexcept {
+  const auto hi = static_cast<uint64_t>(value >> 64u);
+  if (hi != 0u) return leading_zeros_nonzero(::sus::marker::unsafe_fn, hi);
+  return 64u + leading_zeros_nonzero(::sus::marker::unsafe_fn,
+                                     static_cast<uint64_t>(value));
+}
+#endif
+
+template <class T>
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr uint32_t leading_zeros(
     T value) noexcept {
   if (value == 0) return unchecked_mul(unchecked_sizeof<T>(), uint32_t{8});
@@ -625,7 +691,7 @@ __sus_pure_const _sus_always_inline constexpr uint32_t leading_zeros(
 /// # Safety
 /// This function produces Undefined Behaviour if passed a zero value.
 template <class T>
-  requires(std::is_integral_v<T> && std::is_unsigned_v<T> &&
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
            ::sus::mem::size_of<T>() <= 8)
 __sus_pure_const _sus_always_inline constexpr uint32_t trailing_zeros_nonzero(
     ::sus::marker::UnsafeFnMarker, T value) noexcept {
@@ -672,10 +738,23 @@ __sus_pure_const _sus_always_inline constexpr uint32_t trailing_zeros_nonzero(
 #endif
 }
 
+#if defined(__SIZEOF_INT128__)
+template <class T>
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
+           ::sus::mem::size_of<T>() == 16)
+__sus_pure_const _sus_always_inline constexpr uint32_t trailing_zeros_nonzero(
+    ::sus::marker::UnsafeFnMarker, T value) noexcept {
+  const auto lo = static_cast<uint64_t>(value);
+  if (lo != 0u) return trailing_zeros_nonzero(::sus::marker::unsafe_fn, lo);
+  return 64u + trailing_zeros_nonzero(::sus::marker::unsafe_fn,
+                                      static_cast<uint64_t>(value >> 64u));
+}
+#endif
+
 // TODO: Any way to make it constexpr?
 template <class T>
-  requires(std::is_integral_v<T> && std::is_unsigned_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr uint32_t trailing_zeros(
     T value) noexcept {
   if (value == 0) return static_cast<uint32_t>(::sus::mem::size_of<T>() * 8u);
@@ -683,7 +762,7 @@ __sus_pure_const _sus_always_inline constexpr uint32_t trailing_zeros(
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_unsigned_v<T> &&
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
            ::sus::mem::size_of<T>() <= 8)
 __sus_pure_const _sus_always_inline constexpr T reverse_bits(T value) noexcept {
 #if __clang__
@@ -711,8 +790,18 @@ __sus_pure_const _sus_always_inline constexpr T reverse_bits(T value) noexcept {
 #endif
 }
 
+#if defined(__SIZEOF_INT128__)
+template <class T>
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
+           ::sus::mem::size_of<T>() == 16)
+__sus_pure_const _sus_always_inline constexpr T reverse_bits(T value) noexcept {
+  return (T{reverse_bits(static_cast<uint64_t>(value))} << 64u) |
+         T{reverse_bits(static_cast<uint64_t>(value >> 64u))};
+}
+#endif
+
 template <class T>
-  requires(std::is_integral_v<T> && std::is_unsigned_v<T>)
+  requires(is_integral_v<T> && is_unsigned_v<T>)
 __sus_pure_const inline constexpr T rotate_left(T value, uint64_t n) noexcept {
   const uint64_t num_bits = unchecked_mul(unchecked_sizeof<T>(), uint32_t{8});
   // Try avoid slow % operation if we can. Comparisons are much faster than %.
@@ -723,7 +812,7 @@ __sus_pure_const inline constexpr T rotate_left(T value, uint64_t n) noexcept {
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_unsigned_v<T>)
+  requires(is_integral_v<T> && is_unsigned_v<T>)
 __sus_pure_const inline constexpr T rotate_right(T value, uint64_t n) noexcept {
   const uint64_t num_bits = unchecked_mul(unchecked_sizeof<T>(), uint32_t{8});
   // Try avoid slow % operation if we can. Comparisons are much faster than %.
@@ -734,7 +823,7 @@ __sus_pure_const inline constexpr T rotate_right(T value, uint64_t n) noexcept {
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_unsigned_v<T> &&
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
            ::sus::mem::size_of<T>() <= 8)
 __sus_pure_const _sus_always_inline constexpr T swap_bytes(T value) noexcept {
   if (std::is_constant_evaluated()) {
@@ -793,8 +882,18 @@ __sus_pure_const _sus_always_inline constexpr T swap_bytes(T value) noexcept {
 #endif
 }
 
+#if defined(__SIZEOF_INT128__)
+template <class T>
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
+           ::sus::mem::size_of<T>() == 16)
+__sus_pure_const _sus_always_inline constexpr T swap_bytes(T value) noexcept {
+  return (T{swap_bytes(static_cast<uint64_t>(value))} << 64u) |
+         T{swap_bytes(static_cast<uint64_t>(value >> 64u))};
+}
+#endif
+
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
+  requires(is_integral_v<T> && is_signed_v<T> &&
            ::sus::mem::size_of<T>() <= 8)
 __sus_pure_const _sus_always_inline constexpr auto into_unsigned(T x) noexcept {
   if constexpr (::sus::mem::size_of<T>() == 1)
@@ -807,8 +906,17 @@ __sus_pure_const _sus_always_inline constexpr auto into_unsigned(T x) noexcept {
     return static_cast<uint64_t>(x);
 }
 
+#if defined(__SIZEOF_INT128__)
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() == 16)
+__sus_pure_const _sus_always_inline constexpr auto into_unsigned(T x) noexcept {
+  return static_cast<uint128_type>(x);
+}
+#endif
+
+template <class T>
+  requires(is_integral_v<T> && !is_signed_v<T> &&
            ::sus::mem::size_of<T>() <= 4)
 __sus_pure_const _sus_always_inline constexpr auto into_widened(T x) noexcept {
   if constexpr (::sus::mem::size_of<T>() == 1)
@@ -820,7 +928,7 @@ __sus_pure_const _sus_always_inline constexpr auto into_widened(T x) noexcept {
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
+  requires(is_integral_v<T> && is_signed_v<T> &&
            ::sus::mem::size_of<T>() <= 4)
 __sus_pure_const _sus_always_inline constexpr auto into_widened(T x) noexcept {
   if constexpr (::sus::mem::size_of<T>() == 1)
@@ -832,7 +940,7 @@ __sus_pure_const _sus_always_inline constexpr auto into_widened(T x) noexcept {
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_unsigned_v<T> &&
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
            ::sus::mem::size_of<T>() <= 8)
 __sus_pure_const _sus_always_inline constexpr auto into_signed(T x) noexcept {
   if constexpr (::sus::mem::size_of<T>() == 1)
@@ -845,8 +953,17 @@ __sus_pure_const _sus_always_inline constexpr auto into_signed(T x) noexcept {
     return static_cast<int64_t>(x);
 }
 
+#if defined(__SIZEOF_INT128__)
 template <class T>
-  requires(::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_unsigned_v<T> &&
+           ::sus::mem::size_of<T>() == 16)
+__sus_pure_const _sus_always_inline constexpr auto into_signed(T x) noexcept {
+  return static_cast<int128_type>(x);
+}
+#endif
+
+template <class T>
+  requires(::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr bool sign_bit(T x) noexcept {
   if constexpr (::sus::mem::size_of<T>() == 1)
     return (x & (T(1) << 7)) != 0;
@@ -854,15 +971,52 @@ __sus_pure_const _sus_always_inline constexpr bool sign_bit(T x) noexcept {
     return (x & (T(1) << 15)) != 0;
   else if constexpr (::sus::mem::size_of<T>() == 4)
     return (x & (T(1) << 31)) != 0;
-  else
+  else if constexpr (::sus::mem::size_of<T>() == 8)
     return (x & (T(1) << 63)) != 0;
+  else
+    return (x & (T(1) << 127)) != 0;
 }
 
+// The `*_with_overflow` functions use the compiler's overflow builtins for
+// 64-bit values, which read the carry or overflow flag of the instruction
+// instead of needing 128-bit math or a division. Smaller values are checked
+// with comparisons or by widening, which is as fast in scalar code, and which
+// the compiler can vectorize in a loop where it does not vectorize the
+// builtins. The `BenchIntegerOps` microbenchmarks compare them.
+
+/// Returns `MIN` if `x` is negative and `MAX` otherwise, without branching.
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
+__sus_pure_const _sus_always_inline constexpr T saturated_by_sign(
+    T x) noexcept {
+  // The arithmetic shift fills every bit with the sign bit, and flipping the
+  // bits of `MAX` with it gives `MIN`.
+  return static_cast<T>((x >> (num_bits<T>() - 1u)) ^ max_value<T>());
+}
+
+template <class T>
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr OverflowOut<T> add_with_overflow(
     T x, T y) noexcept {
+#if __has_builtin(__builtin_add_overflow)
+  if constexpr (::sus::mem::size_of<T>() >= 8u) {
+    T out;
+    const bool overflow = __builtin_add_overflow(x, y, &out);
+    return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                                .value = out};
+  }
+#elif defined(_M_X64)
+  if constexpr (::sus::mem::size_of<T>() == 8u) {
+    if (!std::is_constant_evaluated()) {
+      T out;
+      const bool overflow = _addcarry_u64(0, x, y, &out) != 0;
+      return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                                  .value = out};
+    }
+  }
+#endif
   return OverflowOut sus_clang_bug_56394(<T>){
       .overflow = x > max_value<T>() - y,
       .value = unchecked_add(x, y),
@@ -870,10 +1024,18 @@ __sus_pure_const inline constexpr OverflowOut<T> add_with_overflow(
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr OverflowOut<T> add_with_overflow(
     T x, T y) noexcept {
+#if __has_builtin(__builtin_add_overflow)
+  if constexpr (::sus::mem::size_of<T>() >= 8u) {
+    T out;
+    const bool overflow = __builtin_add_overflow(x, y, &out);
+    return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                                .value = out};
+  }
+#endif
   const auto out =
       into_signed(unchecked_add(into_unsigned(x), into_unsigned(y)));
   return OverflowOut sus_clang_bug_56394(<T>){
@@ -883,11 +1045,21 @@ __sus_pure_const inline constexpr OverflowOut<T> add_with_overflow(
 }
 
 template <class T, class U = decltype(into_signed(std::declval<T>()))>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8 &&
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16 &&
            ::sus::mem::size_of<T>() == ::sus::mem::size_of<U>())
 __sus_pure_const inline constexpr OverflowOut<T> add_with_overflow_signed(
     T x, U y) noexcept {
+#if __has_builtin(__builtin_add_overflow)
+  if constexpr (::sus::mem::size_of<T>() >= 8u) {
+    // The builtin computes the result with infinite precision before
+    // storing it in `out`, so the inputs may differ in signedness.
+    T out;
+    const bool overflow = __builtin_add_overflow(x, y, &out);
+    return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                                .value = out};
+  }
+#endif
   return OverflowOut sus_clang_bug_56394(<T>){
       .overflow = (y >= 0 && into_unsigned(y) > max_value<T>() - x) ||
                   (y < 0 && into_unsigned(-y) > x),
@@ -896,11 +1068,21 @@ __sus_pure_const inline constexpr OverflowOut<T> add_with_overflow_signed(
 }
 
 template <class T, class U = decltype(into_unsigned(std::declval<T>()))>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8 &&
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16 &&
            ::sus::mem::size_of<T>() == ::sus::mem::size_of<U>())
 __sus_pure_const inline constexpr OverflowOut<T> add_with_overflow_unsigned(
     T x, U y) noexcept {
+#if __has_builtin(__builtin_add_overflow)
+  if constexpr (::sus::mem::size_of<T>() >= 8u) {
+    // The builtin computes the result with infinite precision before
+    // storing it in `out`, so the inputs may differ in signedness.
+    T out;
+    const bool overflow = __builtin_add_overflow(x, y, &out);
+    return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                                .value = out};
+  }
+#endif
   const auto out = into_signed(unchecked_add(into_unsigned(x), y));
   return OverflowOut sus_clang_bug_56394(<T>){
       .overflow = static_cast<U>(max_value<T>()) - static_cast<U>(x) < y,
@@ -909,10 +1091,27 @@ __sus_pure_const inline constexpr OverflowOut<T> add_with_overflow_unsigned(
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr OverflowOut<T> sub_with_overflow(
     T x, T y) noexcept {
+#if __has_builtin(__builtin_sub_overflow)
+  if constexpr (::sus::mem::size_of<T>() >= 8u) {
+    T out;
+    const bool overflow = __builtin_sub_overflow(x, y, &out);
+    return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                                .value = out};
+  }
+#elif defined(_M_X64)
+  if constexpr (::sus::mem::size_of<T>() == 8u) {
+    if (!std::is_constant_evaluated()) {
+      T out;
+      const bool overflow = _subborrow_u64(0, x, y, &out) != 0;
+      return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                                  .value = out};
+    }
+  }
+#endif
   return OverflowOut sus_clang_bug_56394(<T>){
       .overflow = x < unchecked_add(min_value<T>(), y),
       .value = unchecked_sub(x, y),
@@ -920,10 +1119,18 @@ __sus_pure_const inline constexpr OverflowOut<T> sub_with_overflow(
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr OverflowOut<T> sub_with_overflow(
     T x, T y) noexcept {
+#if __has_builtin(__builtin_sub_overflow)
+  if constexpr (::sus::mem::size_of<T>() >= 8u) {
+    T out;
+    const bool overflow = __builtin_sub_overflow(x, y, &out);
+    return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                                .value = out};
+  }
+#endif
   const auto out =
       into_signed(unchecked_sub(into_unsigned(x), into_unsigned(y)));
   return OverflowOut sus_clang_bug_56394(<T>){
@@ -933,11 +1140,21 @@ __sus_pure_const inline constexpr OverflowOut<T> sub_with_overflow(
 }
 
 template <class T, class U = decltype(into_unsigned(std::declval<T>()))>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8 &&
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16 &&
            ::sus::mem::size_of<T>() == ::sus::mem::size_of<U>())
 __sus_pure_const inline constexpr OverflowOut<T> sub_with_overflow_unsigned(
     T x, U y) noexcept {
+#if __has_builtin(__builtin_sub_overflow)
+  if constexpr (::sus::mem::size_of<T>() >= 8u) {
+    // The builtin computes the result with infinite precision before
+    // storing it in `out`, so the inputs may differ in signedness.
+    T out;
+    const bool overflow = __builtin_sub_overflow(x, y, &out);
+    return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                                .value = out};
+  }
+#endif
   const auto out = into_signed(unchecked_sub(into_unsigned(x), y));
   return OverflowOut sus_clang_bug_56394(<T>){
       .overflow = static_cast<U>(x) - static_cast<U>(min_value<T>()) < y,
@@ -947,18 +1164,17 @@ __sus_pure_const inline constexpr OverflowOut<T> sub_with_overflow_unsigned(
 
 /// SAFETY: Requires that `x > y` so the result will be positive.
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T>)
-__sus_pure_const _sus_always_inline constexpr std::make_unsigned_t<T>
+  requires(is_integral_v<T> && is_signed_v<T>)
+__sus_pure_const _sus_always_inline constexpr auto
 sub_with_unsigned_positive_result(T x, T y) noexcept {
   return unchecked_sub(into_unsigned(x), into_unsigned(y));
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
+  requires(is_integral_v<T> && !is_signed_v<T> &&
            ::sus::mem::size_of<T>() <= 4)
 __sus_pure_const inline constexpr OverflowOut<T> mul_with_overflow(
     T x, T y) noexcept {
-  // TODO: Can we use compiler intrinsics?
   auto out = unchecked_mul(into_widened(x), into_widened(y));
   using Wide = decltype(out);
   return OverflowOut sus_clang_bug_56394(<T>){
@@ -966,38 +1182,36 @@ __sus_pure_const inline constexpr OverflowOut<T> mul_with_overflow(
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() == 8)
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           (::sus::mem::size_of<T>() == 8 || ::sus::mem::size_of<T>() == 16))
 __sus_pure_const inline constexpr OverflowOut<T> mul_with_overflow(
     T x, T y) noexcept {
-#if _MSC_VER
-  if (std::is_constant_evaluated()) {
-    const bool overflow =
-        x > T{1} && y > T{1} && x > unchecked_div(max_value<T>(), y);
-    return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
-                                                .value = unchecked_mul(x, y)};
-  } else {
-    // For MSVC, use _umul128, but what about constexpr?? If we can't do
-    // it then make the whole function non-constexpr?
+#if __has_builtin(__builtin_mul_overflow)
+  T out;
+  const bool overflow = __builtin_mul_overflow(x, y, &out);
+  return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                              .value = out};
+#else
+#  if defined(_M_X64)
+  if (!std::is_constant_evaluated()) {
     uint64_t highbits;
     auto out = static_cast<T>(_umul128(x, y, &highbits));
     return OverflowOut sus_clang_bug_56394(<T>){.overflow = highbits != 0,
                                                 .value = out};
   }
-#else
-  auto out = __uint128_t{x} * __uint128_t{y};
-  return OverflowOut sus_clang_bug_56394(<T>){
-      .overflow = out > __uint128_t{max_value<T>()},
-      .value = static_cast<T>(out)};
+#  endif
+  const bool overflow =
+      x > T{1} && y > T{1} && x > unchecked_div(max_value<T>(), y);
+  return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                              .value = unchecked_mul(x, y)};
 #endif
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
+  requires(is_integral_v<T> && is_signed_v<T> &&
            ::sus::mem::size_of<T>() <= 4)
 __sus_pure_const inline constexpr OverflowOut<T> mul_with_overflow(
     T x, T y) noexcept {
-  // TODO: Can we use compiler intrinsics?
   auto out = into_widened(x) * into_widened(y);
   using Wide = decltype(out);
   return OverflowOut sus_clang_bug_56394(<T>){
@@ -1006,11 +1220,26 @@ __sus_pure_const inline constexpr OverflowOut<T> mul_with_overflow(
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() == 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           (::sus::mem::size_of<T>() == 8 || ::sus::mem::size_of<T>() == 16))
 __sus_pure_const inline constexpr OverflowOut<T> mul_with_overflow(
     T x, T y) noexcept {
-#if _MSC_VER
+#if __has_builtin(__builtin_mul_overflow)
+  T out;
+  const bool overflow = __builtin_mul_overflow(x, y, &out);
+  return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
+                                              .value = out};
+#else
+#  if defined(_M_X64)
+  if (!std::is_constant_evaluated()) {
+    int64_t highbits;
+    auto out = static_cast<T>(_mul128(x, y, &highbits));
+    // The product fits in 64 bits if the high bits are only the sign extension
+    // of the low bits.
+    return OverflowOut sus_clang_bug_56394(<T>){
+        .overflow = highbits != (out >> 63), .value = out};
+  }
+#  endif
   if (x == T{0} || y == T{0})
     return OverflowOut sus_clang_bug_56394(<T>){.overflow = false,
                                                 .value = T{0}};
@@ -1033,17 +1262,162 @@ __sus_pure_const inline constexpr OverflowOut<T> mul_with_overflow(
   const auto mul_val = unchecked_mul(into_unsigned(x), into_unsigned(y));
   return OverflowOut sus_clang_bug_56394(<T>){.overflow = overflow,
                                               .value = into_signed(mul_val)};
+#endif
+}
+
+/// Returns the high half of the full product of `x` and `y`, which is
+/// `(x * y) >> N` for `N`-bit integers, computed without overflow.
+template <class T>
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() == 4)
+__sus_pure_const _sus_always_inline constexpr T mul_high(T x, T y) noexcept {
+  return static_cast<T>((uint64_t{x} * uint64_t{y}) >> 32u);
+}
+
+template <class T>
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() == 8)
+__sus_pure_const _sus_always_inline constexpr T mul_high(T x, T y) noexcept {
+#if defined(__SIZEOF_INT128__)
+  return static_cast<T>(
+      (static_cast<__uint128_t>(x) * static_cast<__uint128_t>(y)) >> 64u);
 #else
-  auto out = __int128_t{x} * __int128_t{y};
-  return OverflowOut sus_clang_bug_56394(<T>){
-      .overflow =
-          out > __int128_t{max_value<T>()} || out < __int128_t{min_value<T>()},
-      .value = static_cast<T>(out)};
+#  if defined(_M_X64) || defined(_M_ARM64)
+  if (!std::is_constant_evaluated()) return __umulh(x, y);
+#  endif
+  // Multiply 32-bit halves, and add the middle terms with their carries.
+  const uint64_t xlo = x & 0xffffffffu, xhi = x >> 32u;
+  const uint64_t ylo = y & 0xffffffffu, yhi = y >> 32u;
+  const uint64_t lolo = xlo * ylo;
+  const uint64_t hilo = xhi * ylo;
+  const uint64_t lohi = xlo * yhi;
+  const uint64_t mid = (lolo >> 32u) + (hilo & 0xffffffffu) + lohi;
+  return xhi * yhi + (hilo >> 32u) + (mid >> 32u);
+#endif
+}
+
+template <class T>
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() == 4)
+__sus_pure_const _sus_always_inline constexpr T mul_high(T x, T y) noexcept {
+  return static_cast<T>((int64_t{x} * int64_t{y}) >> 32);
+}
+
+template <class T>
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() == 8)
+__sus_pure_const _sus_always_inline constexpr T mul_high(T x, T y) noexcept {
+#if defined(__SIZEOF_INT128__)
+  return static_cast<T>(
+      (static_cast<__int128_t>(x) * static_cast<__int128_t>(y)) >> 64);
+#else
+#  if defined(_M_X64) || defined(_M_ARM64)
+  if (!std::is_constant_evaluated()) return __mulh(x, y);
+#  endif
+  // The unsigned product is too large by `y << 64` if `x` is negative, and by
+  // `x << 64` if `y` is negative.
+  uint64_t hi = mul_high(into_unsigned(x), into_unsigned(y));
+  if (x < 0) hi -= into_unsigned(y);
+  if (y < 0) hi -= into_unsigned(x);
+  return into_signed(hi);
+#endif
+}
+
+template <class T>
+struct WideningOut final {
+  T lo;
+  T hi;
+};
+
+/// Returns the full `2N`-bit product of `x` and `y` as its low and high halves,
+/// for `N`-bit unsigned integers.
+template <class T>
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
+__sus_pure_const inline constexpr WideningOut<T> widening_mul(T x,
+                                                              T y) noexcept {
+  if constexpr (::sus::mem::size_of<T>() <= 2) {
+    const auto out = unchecked_mul(into_widened(x), into_widened(y));
+    return WideningOut<T>(static_cast<T>(out),
+                          static_cast<T>(out >> num_bits<T>()));
+  } else if constexpr (::sus::mem::size_of<T>() <= 8) {
+#if defined(_M_X64) && !defined(__SIZEOF_INT128__)
+    if constexpr (::sus::mem::size_of<T>() == 8) {
+      if (!std::is_constant_evaluated()) {
+        uint64_t hi;
+        const uint64_t lo = _umul128(x, y, &hi);
+        return WideningOut<T>(lo, hi);
+      }
+    }
+#endif
+    return WideningOut<T>(unchecked_mul(x, y), mul_high(x, y));
+  } else {
+    // Multiply 64-bit halves, and add the middle terms with their carries.
+    const T mask = T{0xffffffffffffffff};
+    const T xlo = x & mask, xhi = x >> 64u;
+    const T ylo = y & mask, yhi = y >> 64u;
+    const T lolo = xlo * ylo;
+    const T hilo = xhi * ylo;
+    const T lohi = xlo * yhi;
+    const T mid = (lolo >> 64u) + (hilo & mask) + (lohi & mask);
+    return WideningOut<T>((mid << 64u) | (lolo & mask),
+                          xhi * yhi + (hilo >> 64u) + (lohi >> 64u) +
+                              (mid >> 64u));
+  }
+}
+
+template <class T>
+struct DivWideOut final {
+  T quot;
+  T rem;
+};
+
+/// Divides the `2N`-bit integer `(hi << N) | lo` by `d`, for `N`-bit unsigned
+/// integers. The quotient must fit in `N` bits, which is true when `hi < d`.
+template <class T>
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() == 4)
+__sus_pure_const inline constexpr DivWideOut<T> div_wide(T hi, T lo,
+                                                         T d) noexcept {
+  const uint64_t n = (uint64_t{hi} << 32u) | uint64_t{lo};
+  return DivWideOut<T>(static_cast<T>(n / d), static_cast<T>(n % d));
+}
+
+template <class T>
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() == 8)
+__sus_pure_const inline constexpr DivWideOut<T> div_wide(T hi, T lo,
+                                                         T d) noexcept {
+#if defined(__SIZEOF_INT128__)
+  const auto n = (static_cast<__uint128_t>(hi) << 64u) | lo;
+  return DivWideOut<T>(static_cast<T>(n / d), static_cast<T>(n % d));
+#else
+#  if defined(_M_X64) && _MSC_VER >= 1920
+  if (!std::is_constant_evaluated()) {
+    T rem;
+    const T quot = _udiv128(hi, lo, d, &rem);
+    return DivWideOut<T>(quot, rem);
+  }
+#  endif
+  // Long division, one bit at a time. This is slow, but it is only used when
+  // precomputing a divisor.
+  T quot = 0u;
+  for (uint32_t i = 0u; i < 64u; ++i) {
+    const bool carry = (hi >> 63u) != 0u;
+    hi = (hi << 1u) | (lo >> 63u);
+    lo <<= 1u;
+    quot <<= 1u;
+    if (carry || hi >= d) {
+      hi -= d;
+      quot |= 1u;
+    }
+  }
+  return DivWideOut<T>(quot, hi);
 #endif
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr OverflowOut<T> pow_with_overflow(
     T base, uint32_t exp) noexcept {
   if (exp == 0)
@@ -1072,9 +1446,10 @@ __sus_pure_const inline constexpr OverflowOut<T> pow_with_overflow(
 ///
 /// Returns the wrapped result along with whether the rhs overflowed.
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
+  requires(is_integral_v<T> && !is_signed_v<T> &&
            (::sus::mem::size_of<T>() == 1 || ::sus::mem::size_of<T>() == 2 ||
-            ::sus::mem::size_of<T>() == 4 || ::sus::mem::size_of<T>() == 8))
+            ::sus::mem::size_of<T>() == 4 || ::sus::mem::size_of<T>() == 8 ||
+            ::sus::mem::size_of<T>() == 16))
 __sus_pure_const inline constexpr OverflowOut<T> shl_with_overflow(
     T x, uint64_t shift) noexcept {
   // Using `num_bits<T>() - 1` as a mask only works if num_bits<T>() is a power
@@ -1092,9 +1467,10 @@ __sus_pure_const inline constexpr OverflowOut<T> shl_with_overflow(
 ///
 /// Returns the wrapped result along with whether the rhs overflowed.
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
+  requires(is_integral_v<T> && is_signed_v<T> &&
            (::sus::mem::size_of<T>() == 1 || ::sus::mem::size_of<T>() == 2 ||
-            ::sus::mem::size_of<T>() == 4 || ::sus::mem::size_of<T>() == 8))
+            ::sus::mem::size_of<T>() == 4 || ::sus::mem::size_of<T>() == 8 ||
+            ::sus::mem::size_of<T>() == 16))
 __sus_pure_const inline constexpr OverflowOut<T> shl_with_overflow(
     T x, uint64_t shift) noexcept {
   // Using `num_bits<T>() - 1` as a mask only works if num_bits<T>() is a power
@@ -1112,9 +1488,10 @@ __sus_pure_const inline constexpr OverflowOut<T> shl_with_overflow(
 ///
 /// Returns the wrapped result along with whether the rhs overflowed.
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
+  requires(is_integral_v<T> && !is_signed_v<T> &&
            (::sus::mem::size_of<T>() == 1 || ::sus::mem::size_of<T>() == 2 ||
-            ::sus::mem::size_of<T>() == 4 || ::sus::mem::size_of<T>() == 8))
+            ::sus::mem::size_of<T>() == 4 || ::sus::mem::size_of<T>() == 8 ||
+            ::sus::mem::size_of<T>() == 16))
 __sus_pure_const inline constexpr OverflowOut<T> shr_with_overflow(
     T x, uint64_t shift) noexcept {
   // Using `num_bits<T>() - 1` as a mask only works if num_bits<T>() is a power
@@ -1132,9 +1509,10 @@ __sus_pure_const inline constexpr OverflowOut<T> shr_with_overflow(
 ///
 /// Returns the wrapped result along with whether the rhs overflowed.
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
+  requires(is_integral_v<T> && is_signed_v<T> &&
            (::sus::mem::size_of<T>() == 1 || ::sus::mem::size_of<T>() == 2 ||
-            ::sus::mem::size_of<T>() == 4 || ::sus::mem::size_of<T>() == 8))
+            ::sus::mem::size_of<T>() == 4 || ::sus::mem::size_of<T>() == 8 ||
+            ::sus::mem::size_of<T>() == 16))
 __sus_pure_const inline constexpr OverflowOut<T> shr_with_overflow(
     T x, uint64_t shift) noexcept {
   // Using `num_bits<T>() - 1` as a mask only works if num_bits<T>() is a power
@@ -1148,145 +1526,111 @@ __sus_pure_const inline constexpr OverflowOut<T> shr_with_overflow(
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr T saturating_add(T x, T y) noexcept {
-  // TODO: Optimize this? Use intrinsics?
   const auto out = add_with_overflow(x, y);
-  if (!out.overflow) [[likely]]
-    return out.value;
-  else
-    return max_value<T>();
+  return out.overflow ? max_value<T>() : out.value;
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr T saturating_add(T x, T y) noexcept {
-  // TODO: Optimize this? Use intrinsics?
-  if (y >= 0) {
-    if (x <= max_value<T>() - y) [[likely]]
-      return x + y;
-    else
-      return max_value<T>();
-  } else {
-    if (x >= min_value<T>() - y) [[likely]]
-      return x + y;
-    else
-      return min_value<T>();
-  }
+  const auto out = add_with_overflow(x, y);
+  // Addition can only overflow when both sides have the same sign, so it
+  // saturates in the direction of the sign of `x`.
+  return out.overflow ? saturated_by_sign(x) : out.value;
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr T saturating_sub(T x, T y) noexcept {
-  // TODO: Optimize this? Use intrinsics?
   const auto out = sub_with_overflow(x, y);
-  if (!out.overflow) [[likely]]
-    return out.value;
-  else
-    return min_value<T>();
+  return out.overflow ? min_value<T>() : out.value;
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr T saturating_sub(T x, T y) noexcept {
-  // TODO: Optimize this? Use intrinsics?
-  if (y <= 0) {
-    if (x <= max_value<T>() + y) [[likely]]
-      return x - y;
-    else
-      return max_value<T>();
-  } else {
-    if (x >= min_value<T>() + y) [[likely]]
-      return x - y;
-    else
-      return min_value<T>();
-  }
+  const auto out = sub_with_overflow(x, y);
+  // Subtraction can only overflow when the sides have different signs, so it
+  // saturates in the direction of the sign of `x`.
+  return out.overflow ? saturated_by_sign(x) : out.value;
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr T saturating_mul(T x, T y) noexcept {
-  // TODO: Optimize this? Use intrinsics?
   const auto out = mul_with_overflow(x, y);
-  if (!out.overflow) [[likely]]
-    return out.value;
-  else
-    return max_value<T>();
+  return out.overflow ? max_value<T>() : out.value;
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr T saturating_mul(T x, T y) noexcept {
-  // TODO: Optimize this? Use intrinsics?
   const auto out = mul_with_overflow(x, y);
-  if (!out.overflow) [[likely]]
-    return out.value;
-  else if (x > 0 == y > 0)
-    return max_value<T>();
-  else
-    return min_value<T>();
+  // The product is negative if exactly one of the sides is negative.
+  return out.overflow ? saturated_by_sign(static_cast<T>(x ^ y)) : out.value;
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr T wrapping_add(T x,
                                                              T y) noexcept {
-  return x + y;
+  return unchecked_add(x, y);
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr T wrapping_add(T x,
                                                              T y) noexcept {
-  // TODO: Are there cheaper intrinsics?
-  return add_with_overflow(x, y).value;
+  return into_signed(unchecked_add(into_unsigned(x), into_unsigned(y)));
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr T wrapping_sub(T x,
                                                              T y) noexcept {
   return unchecked_sub(x, y);
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr T wrapping_sub(T x,
                                                              T y) noexcept {
-  // TODO: Are there cheaper intrinsics?
-  return sub_with_overflow(x, y).value;
+  return into_signed(unchecked_sub(into_unsigned(x), into_unsigned(y)));
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr T wrapping_mul(T x,
                                                              T y) noexcept {
-  return x * y;
+  // `unchecked_mul` avoids promoting `uint16_t` to `int`, where the product can
+  // overflow.
+  return unchecked_mul(x, y);
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr T wrapping_mul(T x,
                                                              T y) noexcept {
-  // TODO: Are there cheaper intrinsics?
-  return mul_with_overflow(x, y).value;
+  return into_signed(unchecked_mul(into_unsigned(x), into_unsigned(y)));
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr T wrapping_pow(
     T base, uint32_t exp) noexcept {
   // TODO: Don't need to track overflow and unsigned wraps by default, so this
@@ -1295,8 +1639,8 @@ __sus_pure_const _sus_always_inline constexpr T wrapping_pow(
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const _sus_always_inline constexpr T wrapping_pow(
     T base, uint32_t exp) noexcept {
   // TODO: Are there cheaper intrinsics?
@@ -1313,8 +1657,8 @@ __sus_pure_const _sus_always_inline constexpr T wrapping_pow(
 // overflow cases it instead ends up returning the maximum value
 // of the type, and can return 0 for 0.
 template <class T>
-  requires(std::is_integral_v<T> && !std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && !is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr T one_less_than_next_power_of_two(
     T x) noexcept {
   if (x <= 1u) {
@@ -1331,8 +1675,8 @@ __sus_pure_const inline constexpr T one_less_than_next_power_of_two(
 }
 
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr bool div_overflows(T x, T y) noexcept {
   // Using `&` helps LLVM see that it is the same check made in division.
   return y == T{0} || ((x == min_value<T>()) & (y == T{-1}));
@@ -1340,8 +1684,8 @@ __sus_pure_const inline constexpr bool div_overflows(T x, T y) noexcept {
 
 // SAFETY: Requires that `y` is non-zero, or the answer is invalid.
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr bool div_overflows_nonzero(T x,
                                                              T y) noexcept {
   // Using `&` helps LLVM see that it is the same check made in division.
@@ -1350,8 +1694,8 @@ __sus_pure_const inline constexpr bool div_overflows_nonzero(T x,
 
 // SAFETY: Requires that !div_overflows(x, y) or Undefined Behaviour results.
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr T div_euclid(::sus::marker::UnsafeFnMarker,
                                                T x, T y) noexcept {
   const auto q = unchecked_div(x, y);
@@ -1365,8 +1709,8 @@ __sus_pure_const inline constexpr T div_euclid(::sus::marker::UnsafeFnMarker,
 
 // SAFETY: Requires that !div_overflows(x, y) or Undefined Behaviour results.
 template <class T>
-  requires(std::is_integral_v<T> && std::is_signed_v<T> &&
-           ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && is_signed_v<T> &&
+           ::sus::mem::size_of<T>() <= 16)
 __sus_pure_const inline constexpr T rem_euclid(::sus::marker::UnsafeFnMarker,
                                                T x, T y) noexcept {
   const auto r = unchecked_rem(x, y);
@@ -1396,7 +1740,7 @@ __sus_pure_const _sus_always_inline constexpr auto into_unsigned_integer(
 // the NaN is exactly in the form that would be produced in a constexpr context
 // in order to avoid problems.
 template <class T>
-  requires(std::is_integral_v<T> && ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && ::sus::mem::size_of<T>() <= 8)
 __sus_pure_const _sus_always_inline constexpr auto into_float_constexpr(
     ::sus::marker::UnsafeFnMarker, T x) noexcept {
   if constexpr (::sus::mem::size_of<T>() == ::sus::mem::size_of<float>())
@@ -1415,7 +1759,7 @@ __sus_pure_const _sus_always_inline constexpr auto into_float_constexpr(
 // In this case `x` is `7fc00001` (the quiet bit became set), but `y` is
 // `0x7f800001`.
 template <class T>
-  requires(std::is_integral_v<T> && ::sus::mem::size_of<T>() <= 8)
+  requires(is_integral_v<T> && ::sus::mem::size_of<T>() <= 8)
 __sus_pure_const _sus_always_inline auto into_float(T x) noexcept {
   // SAFETY: Since this isn't a constexpr context, we're okay.
   return into_float_constexpr(::sus::marker::unsafe_fn, x);
@@ -1734,8 +2078,8 @@ _sus_pure _sus_always_inline T float_round_ties_by_mode(T x) noexcept {
 // Note: not __sus_pure_const because it depends on global state: the rounding
 // mode.
 template <class I, class T>
-  requires(std::is_floating_point_v<T> && std::is_integral_v<I> &&
-           std::is_signed_v<I> && ::sus::mem::size_of<T>() <= 8)
+  requires(std::is_floating_point_v<T> && is_integral_v<I> &&
+           is_signed_v<I> && ::sus::mem::size_of<T>() <= 8)
 _sus_pure _sus_always_inline I float_round_to(T x) noexcept {
   static_assert(::sus::mem::size_of<I>() <= ::sus::mem::size_of<long long>());
 
@@ -1826,8 +2170,8 @@ __sus_pure_const inline T next_toward(T from, T to) {
 #pragma warning(disable : 4756)
 
 template <class Out, class T>
-  requires(std::is_integral_v<T> && std::is_floating_point_v<Out> &&
-           (::sus::mem::size_of<T>() <= 8) &&
+  requires(is_integral_v<T> && std::is_floating_point_v<Out> &&
+           (::sus::mem::size_of<T>() <= 16) &&
            (::sus::mem::size_of<Out>() == 4 || ::sus::mem::size_of<Out>() == 8))
 __sus_pure_const constexpr inline Out static_cast_int_to_float(T x) noexcept {
   // C++20 Section 7.3.10: A prvalue of an integer type or of an unscoped
@@ -1883,4 +2227,19 @@ __sus_pure_const constexpr inline Out static_cast_to_smaller_float(
 
 #pragma warning(pop)
 
+/// Hashes a primitive integer. The standard library does not hash 128-bit
+/// integers when compiler extensions are disabled, so they hash a mix of their
+/// two halves.
+template <class T>
+  requires(is_integral_v<T> && ::sus::mem::size_of<T>() <= 16)
+_sus_pure _sus_always_inline size_t hash_integer(T x) noexcept {
+  if constexpr (::sus::mem::size_of<T>() <= 8) {
+    return std::hash<T>()(x);
+  } else {
+    const auto lo = static_cast<uint64_t>(x);
+    const auto hi = static_cast<uint64_t>(x >> 64u);
+    return std::hash<uint64_t>()(lo ^ (hi * uint64_t{0x9e3779b97f4a7c15}));
+  }
+}
+
 }  // namespace sus::num::__private
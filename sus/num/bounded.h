@@ -0,0 +1,433 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#include "sus/assertions/check.h"
+#include "sus/assertions/unreachable.h"
+#include "sus/lib/__private/forward_decl.h"
+#include "sus/macros/pure.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/size_of.h"
+#include "sus/num/__private/intrinsics.h"
+#include "sus/num/integer_concepts.h"
+#include "sus/num/signed_integer.h"
+#include "sus/num/try_from_int_error.h"
+#include "sus/num/types.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/result/result.h"
+
+namespace sus::num {
+
+namespace __private {
+
+enum class BoundedOp { Add, Sub, Mul, Div, Rem };
+
+/// The next wider integer type with the same signedness as `T`, which the
+/// result of an operation on `Bounded` values is widened to when its range
+/// does not fit in `T`. It is `void` if there is no wider type.
+template <class T>
+struct BoundedWider {
+  using type = void;
+};
+template <>
+struct BoundedWider<u8> {
+  using type = u16;
+};
+template <>
+struct BoundedWider<u16> {
+  using type = u32;
+};
+template <>
+struct BoundedWider<u32> {
+  using type = u64;
+};
+template <>
+struct BoundedWider<usize> {
+  using type =
+      std::conditional_t<::sus::mem::size_of<usize>() < 8u, u64, void>;
+};
+template <>
+struct BoundedWider<i8> {
+  using type = i16;
+};
+template <>
+struct BoundedWider<i16> {
+  using type = i32;
+};
+template <>
+struct BoundedWider<i32> {
+  using type = i64;
+};
+template <>
+struct BoundedWider<isize> {
+  using type =
+      std::conditional_t<::sus::mem::size_of<isize>() < 8u, i64, void>;
+};
+
+/// The range of values produced by an operation on `Bounded` values, computed
+/// in the primitive type `P`. If `fits` is false then some result in the range
+/// can not be represented in `P`, or the operation can fail, such as by
+/// dividing by zero.
+template <class P>
+struct BoundedRange {
+  bool fits;
+  P lo;
+  P hi;
+};
+
+template <class P>
+consteval BoundedRange<P> bounded_range_of(const OverflowOut<P> (&o)[4]) {
+  BoundedRange<P> r = {.fits = true, .lo = o[0].value, .hi = o[0].value};
+  for (const OverflowOut<P>& c : o) {
+    r.fits = r.fits && !c.overflow;
+    r.lo = c.value < r.lo ? c.value : r.lo;
+    r.hi = c.value > r.hi ? c.value : r.hi;
+  }
+  return r;
+}
+
+/// Computes the range of `[l1, h1] Op [l2, h2]` in the primitive type `P`.
+template <BoundedOp Op, class P>
+consteval BoundedRange<P> bounded_range(P l1, P h1, P l2, P h2) {
+  if constexpr (Op == BoundedOp::Add) {
+    const auto lo = add_with_overflow(l1, l2);
+    const auto hi = add_with_overflow(h1, h2);
+    return {!lo.overflow && !hi.overflow, lo.value, hi.value};
+  } else if constexpr (Op == BoundedOp::Sub) {
+    const auto lo = sub_with_overflow(l1, h2);
+    const auto hi = sub_with_overflow(h1, l2);
+    return {!lo.overflow && !hi.overflow, lo.value, hi.value};
+  } else if constexpr (Op == BoundedOp::Mul) {
+    const OverflowOut<P> corners[] = {
+        mul_with_overflow(l1, l2), mul_with_overflow(l1, h2),
+        mul_with_overflow(h1, l2), mul_with_overflow(h1, h2)};
+    return bounded_range_of(corners);
+  } else if constexpr (Op == BoundedOp::Div) {
+    // The divisor may be zero.
+    if (l2 <= P{0} && h2 >= P{0}) return {false, P{0}, P{0}};
+    // The quotient may be `MIN / -1`.
+    if constexpr (std::is_signed_v<P>) {
+      if (l1 == min_value<P>() && l2 <= P{-1} && h2 >= P{-1})
+        return {false, P{0}, P{0}};
+    }
+    // The quotient is monotonic in each of the operands when the divisor does
+    // not cross zero, so its bounds are found at the corners.
+    const OverflowOut<P> corners[] = {
+        {false, static_cast<P>(l1 / l2)}, {false, static_cast<P>(l1 / h2)},
+        {false, static_cast<P>(h1 / l2)}, {false, static_cast<P>(h1 / h2)}};
+    return bounded_range_of(corners);
+  } else {
+    static_assert(Op == BoundedOp::Rem);
+    // Only non-negative values are supported, where the remainder is no larger
+    // than the dividend or the divisor.
+    if (l1 < P{0} || l2 <= P{0}) return {false, P{0}, P{0}};
+    if (h1 < l2) return {true, l1, h1};
+    return {true, P{0}, h1 < h2 - P{1} ? h1 : static_cast<P>(h2 - P{1})};
+  }
+}
+
+/// Chooses the type of the result of `Bounded<T, L1, H1> Op Bounded<T, L2,
+/// H2>`. It is a `Bounded` over `W`, or a wider integer, if the range of the
+/// result fits in it. Otherwise the result is a `T` which is computed with the
+/// usual overflow checks.
+template <BoundedOp Op, class T, class W, auto L1, auto H1, auto L2, auto H2>
+consteval auto bounded_result() noexcept {
+  if constexpr (std::is_void_v<W>) {
+    return std::type_identity<T>();
+  } else {
+    using Q = decltype(W::primitive_value);
+    constexpr BoundedRange<Q> r =
+        bounded_range<Op, Q>(static_cast<Q>(L1), static_cast<Q>(H1),
+                             static_cast<Q>(L2), static_cast<Q>(H2));
+    if constexpr (r.fits) {
+      return std::type_identity<Bounded<W, r.lo, r.hi>>();
+    } else {
+      return bounded_result<Op, T, typename BoundedWider<W>::type, L1, H1, L2,
+                            H2>();
+    }
+  }
+}
+
+template <BoundedOp Op, class T, auto L1, auto H1, auto L2, auto H2>
+using BoundedResult =
+    typename decltype(bounded_result<Op, T, T, L1, H1, L2, H2>())::type;
+
+/// Performs `x Op y` without any overflow checks, for values whose result is
+/// known to fit in `P`.
+template <BoundedOp Op, class P>
+__sus_pure_const _sus_always_inline constexpr P bounded_unchecked(
+    P x, P y) noexcept {
+  using M = MathType<P>;
+  if constexpr (Op == BoundedOp::Add) {
+    return static_cast<P>(M{x} + M{y});
+  } else if constexpr (Op == BoundedOp::Sub) {
+    return static_cast<P>(M{x} - M{y});
+  } else if constexpr (Op == BoundedOp::Mul) {
+    return static_cast<P>(M{x} * M{y});
+  } else if constexpr (Op == BoundedOp::Div) {
+    return static_cast<P>(M{x} / M{y});
+  } else {
+    return static_cast<P>(M{x} % M{y});
+  }
+}
+
+}  // namespace __private
+
+/// An integer whose value is known to lie within the inclusive range
+/// `[Lo, Hi]`.
+///
+/// Arithmetic on integer types checks for overflow on every operation, and
+/// indexing checks the index against the length, which can prevent the
+/// compiler from vectorizing a loop. `Bounded` carries the range of its value
+/// in its type, so the range of the result of arithmetic between `Bounded`
+/// values is computed at compile time, and the check is omitted where it can
+/// never fail.
+///
+/// The result of `+`, `-`, `*`, `/` or `%` between two `Bounded` values is as
+/// follows, where `T` is the wider of their integer types, which must have the
+/// same signedness:
+/// * A `Bounded<T, ...>` of the result's range, if it fits in `T`, computed
+///   without any checks.
+/// * Otherwise, a `Bounded` over the next wider integer type of the same
+///   signedness, if the result fits in it, also computed without any checks.
+///   For example, adding two `Bounded<u8, 0, 255>` produces a
+///   `Bounded<u16, 0, 510>`.
+/// * Otherwise, a `T` which is computed with the same checks as `T`'s own
+///   operators, such as subtracting unsigned values that may go below zero,
+///   or dividing by a range that includes zero.
+///
+/// Indexing an [`Array`]($sus::collections::Array) with a `Bounded` whose
+/// range is within the array's length does not check the index.
+///
+/// A `Bounded` converts implicitly to `T`, and from a `Bounded` whose range
+/// lies inside its own, but constructing one from a `T` must check the value,
+/// or be done with
+/// [`from_unchecked`]($sus::num::Bounded::from_unchecked).
+///
+/// # Examples
+/// ```
+/// auto a = sus::num::Bounded<u8, 0, 255>(200_u8);
+/// auto b = sus::num::Bounded<u8, 0, 255>(100_u8);
+/// // The sum is widened to `u16` as it may be larger than `u8::MAX`.
+/// sus::num::Bounded<u16, 0, 510> sum = a + b;
+/// sus_check(sum == 300_u16);
+///
+/// auto counts = sus::Array<u32, 256>();
+/// // No bounds check, as the index can't be out of bounds.
+/// counts[a] += 1u;
+/// ```
+template <class T, decltype(T::primitive_value) Lo,
+          decltype(T::primitive_value) Hi>
+  requires(Lo <= Hi)
+class Bounded {
+  static_assert(IntegerNumeric<T>);
+  using P = decltype(T::primitive_value);
+
+ public:
+  /// The smallest value that can be represented by this type.
+  static constexpr T MIN = T(Lo);
+  /// The largest value that can be represented by this type.
+  static constexpr T MAX = T(Hi);
+
+  /// Default-constructs a `Bounded` with the value `0`, if `0` is in its
+  /// range.
+  constexpr Bounded() noexcept
+    requires(Lo <= P{0} && P{0} <= Hi)
+      : v_(P{0}) {}
+
+  /// Constructs a `Bounded` from a value of the integer type.
+  ///
+  /// # Panics
+  /// Panics if `v` is not in the range `[Lo, Hi]`.
+  explicit constexpr Bounded(T v) noexcept : v_(v) {
+    sus_check_with_message(contains(v.primitive_value),
+                           "Bounded value is out of range");
+  }
+
+  /// Converts from a `Bounded` whose range is inside the range of this type.
+  /// The integer type `U` may be different from `T`.
+  template <IntegerNumeric U, decltype(U::primitive_value) L2,
+            decltype(U::primitive_value) H2>
+    requires(std::cmp_less_equal(Lo, L2) && std::cmp_less_equal(H2, Hi))
+  constexpr Bounded(Bounded<U, L2, H2> o) noexcept
+      : v_(static_cast<P>(o.get().primitive_value)) {}
+
+  /// Constructs a `Bounded` from a value of the integer type, without checking
+  /// that it is in range.
+  ///
+  /// # Safety
+  /// The value `v` must be in the range `[Lo, Hi]`, or Undefined Behaviour
+  /// will result, as code that uses the `Bounded` may rely on its range.
+  _sus_pure static constexpr Bounded from_unchecked(
+      ::sus::marker::UnsafeFnMarker, T v) noexcept {
+    return Bounded(FROM_UNCHECKED, v);
+  }
+
+  /// Constructs a `Bounded` from a value of the integer type, returning an
+  /// error if it is not in the range `[Lo, Hi]`.
+  _sus_pure static constexpr ::sus::result::Result<Bounded, TryFromIntError>
+  try_from(T v) noexcept {
+    using R = ::sus::result::Result<Bounded, TryFromIntError>;
+    if (!contains(v.primitive_value)) [[unlikely]]
+      return R::with_err(TryFromIntError::with_out_of_bounds());
+    return R(Bounded(FROM_UNCHECKED, v));
+  }
+
+  /// Constructs a `Bounded` from a value of the integer type, clamping it to
+  /// the range `[Lo, Hi]`.
+  _sus_pure static constexpr Bounded from_clamped(T v) noexcept {
+    if (v.primitive_value < Lo) return Bounded(FROM_UNCHECKED, MIN);
+    if (v.primitive_value > Hi) return Bounded(FROM_UNCHECKED, MAX);
+    return Bounded(FROM_UNCHECKED, v);
+  }
+
+  /// Returns the value as the integer type.
+  _sus_pure constexpr T get() const noexcept {
+    if (!std::is_constant_evaluated()) {
+      // SAFETY: The value is in range by construction, which tells the
+      // compiler it can drop checks on the value in the code that uses it.
+      if (!contains(v_.primitive_value))
+        ::sus::unreachable_unchecked(::sus::marker::unsafe_fn);
+    }
+    return v_;
+  }
+
+  /// Converts to the integer type.
+  _sus_pure constexpr operator T() const noexcept { return get(); }
+
+  /// #[doc.overloads=bounded.eq]
+  template <decltype(T::primitive_value) L2, decltype(T::primitive_value) H2>
+  _sus_pure friend constexpr bool operator==(Bounded l,
+                                             Bounded<T, L2, H2> r) noexcept {
+    return l.get() == r.get();
+  }
+  /// #[doc.overloads=bounded.eq]
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr bool operator==(Bounded l, U r) noexcept {
+    return l.get() == T(r);
+  }
+  /// #[doc.overloads=bounded.ord]
+  template <decltype(T::primitive_value) L2, decltype(T::primitive_value) H2>
+  _sus_pure friend constexpr std::strong_ordering operator<=>(
+      Bounded l, Bounded<T, L2, H2> r) noexcept {
+    return l.get() <=> r.get();
+  }
+  /// #[doc.overloads=bounded.ord]
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr std::strong_ordering operator<=>(Bounded l,
+                                                              U r) noexcept {
+    return l.get() <=> T(r);
+  }
+
+ private:
+  enum FromUnchecked { FROM_UNCHECKED };
+  constexpr Bounded(FromUnchecked, T v) noexcept : v_(v) {}
+
+  /// Whether `v` is in the range `[Lo, Hi]`. The comparisons are skipped at
+  /// the ends of the range that are the limits of `P`, where they are always
+  /// true.
+  __sus_pure_const static constexpr bool contains(P v) noexcept {
+    bool above = true;
+    bool below = true;
+    if constexpr (Lo != __private::min_value<P>()) above = v >= Lo;
+    if constexpr (Hi != __private::max_value<P>()) below = v <= Hi;
+    return above && below;
+  }
+
+  T v_;
+};
+
+namespace __private {
+
+/// Whether `+`, `-`, `*`, `/` and `%` can be applied to `Bounded` values over
+/// `T1` and `T2`, which is when they have the same signedness.
+template <class T1, class T2>
+concept BoundedCompatible =
+    std::is_signed_v<decltype(T1::primitive_value)> ==
+    std::is_signed_v<decltype(T2::primitive_value)>;
+
+/// Applies `Op` to `Bounded` values. When the integer types differ, the
+/// narrower one is first converted to the wider one.
+template <BoundedOp Op, class T1, auto L1, auto H1, class T2, auto L2,
+          auto H2>
+_sus_pure constexpr auto bounded_apply(Bounded<T1, L1, H1> l,
+                                       Bounded<T2, L2, H2> r) noexcept {
+  using T = std::conditional_t<(::sus::mem::size_of<T2>() >
+                                ::sus::mem::size_of<T1>()),
+                               T2, T1>;
+  using P = decltype(T::primitive_value);
+  using R = BoundedResult<Op, T, static_cast<P>(L1), static_cast<P>(H1),
+                          static_cast<P>(L2), static_cast<P>(H2)>;
+  if constexpr (std::same_as<R, T>) {
+    const auto x = T(l.get());
+    const auto y = T(r.get());
+    if constexpr (Op == BoundedOp::Add) return x + y;
+    if constexpr (Op == BoundedOp::Sub) return x - y;
+    if constexpr (Op == BoundedOp::Mul) return x * y;
+    if constexpr (Op == BoundedOp::Div) return x / y;
+    if constexpr (Op == BoundedOp::Rem) return x % y;
+  } else {
+    using Q = decltype(R::MAX.primitive_value);
+    return R::from_unchecked(
+        ::sus::marker::unsafe_fn,
+        bounded_unchecked<Op>(static_cast<Q>(l.get().primitive_value),
+                              static_cast<Q>(r.get().primitive_value)));
+  }
+}
+
+}  // namespace __private
+
+/// #[doc.overloads=bounded.+]
+template <class T1, auto L1, auto H1, class T2, auto L2, auto H2>
+  requires(__private::BoundedCompatible<T1, T2>)
+_sus_pure constexpr auto operator+(Bounded<T1, L1, H1> l,
+                                   Bounded<T2, L2, H2> r) noexcept {
+  return __private::bounded_apply<__private::BoundedOp::Add>(l, r);
+}
+/// #[doc.overloads=bounded.-]
+template <class T1, auto L1, auto H1, class T2, auto L2, auto H2>
+  requires(__private::BoundedCompatible<T1, T2>)
+_sus_pure constexpr auto operator-(Bounded<T1, L1, H1> l,
+                                   Bounded<T2, L2, H2> r) noexcept {
+  return __private::bounded_apply<__private::BoundedOp::Sub>(l, r);
+}
+/// #[doc.overloads=bounded.*]
+template <class T1, auto L1, auto H1, class T2, auto L2, auto H2>
+  requires(__private::BoundedCompatible<T1, T2>)
+_sus_pure constexpr auto operator*(Bounded<T1, L1, H1> l,
+                                   Bounded<T2, L2, H2> r) noexcept {
+  return __private::bounded_apply<__private::BoundedOp::Mul>(l, r);
+}
+/// #[doc.overloads=bounded./]
+template <class T1, auto L1, auto H1, class T2, auto L2, auto H2>
+  requires(__private::BoundedCompatible<T1, T2>)
+_sus_pure constexpr auto operator/(Bounded<T1, L1, H1> l,
+                                   Bounded<T2, L2, H2> r) noexcept {
+  return __private::bounded_apply<__private::BoundedOp::Div>(l, r);
+}
+/// #[doc.overloads=bounded.%]
+template <class T1, auto L1, auto H1, class T2, auto L2, auto H2>
+  requires(__private::BoundedCompatible<T1, T2>)
+_sus_pure constexpr auto operator%(Bounded<T1, L1, H1> l,
+                                   Bounded<T2, L2, H2> r) noexcept {
+  return __private::bounded_apply<__private::BoundedOp::Rem>(l, r);
+}
+
+}  // namespace sus::num
@@ -0,0 +1,261 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/num/bounded.h"
+
+#include <concepts>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/array.h"
+#include "sus/num/signed_integer.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+namespace {
+
+using sus::num::Bounded;
+using sus::test::ensure_use;
+
+// Whether `Array<i32, N>` can be indexed by `I` without a bounds check.
+template <size_t N, class I>
+concept UncheckedIndex =
+    requires(sus::Array<i32, N>& a, I i) { a.template operator[]<>(i); };
+
+TEST(Bounded, Construct) {
+  static_assert(sizeof(Bounded<u8, 0, 255>) == sizeof(u8));
+  static_assert(sizeof(Bounded<i64, -5, 5>) == sizeof(i64));
+  static_assert(std::is_trivially_copyable_v<Bounded<u32, 1, 10>>);
+
+  constexpr auto a = Bounded<u32, 1, 10>(7u);
+  static_assert(a.get() == 7u);
+  static_assert(a == 7_u32);
+  static_assert(Bounded<u32, 1, 10>::MIN == 1u);
+  static_assert(Bounded<u32, 1, 10>::MAX == 10u);
+
+  // Default is only available when 0 is in range.
+  static_assert(sus::construct::Default<Bounded<i32, -3, 3>>);
+  static_assert(!sus::construct::Default<Bounded<i32, 1, 3>>);
+  EXPECT_EQ((Bounded<i32, -3, 3>()), 0_i32);
+
+  // Converts to the integer type.
+  u32 u = a;
+  EXPECT_EQ(u, 7u);
+
+  // Converts to a wider range, including of another integer type, but not to
+  // a narrower one.
+  Bounded<u32, 0, 10> wider = a;
+  EXPECT_EQ(wider, 7_u32);
+  Bounded<i64, -1, 20> other = a;
+  EXPECT_EQ(other, 7_i64);
+  static_assert(
+      !std::convertible_to<Bounded<u32, 0, 10>, Bounded<u32, 1, 10>>);
+  static_assert(!std::convertible_to<Bounded<i32, -1, 1>, Bounded<u32, 0, 1>>);
+}
+
+TEST(Bounded, TryFrom) {
+  EXPECT_EQ((Bounded<i32, -3, 3>::try_from(-3).unwrap()), -3_i32);
+  EXPECT_EQ((Bounded<i32, -3, 3>::try_from(3).unwrap()), 3_i32);
+  EXPECT_EQ((Bounded<i32, -3, 3>::try_from(4).unwrap_err().kind()),
+            sus::num::TryFromIntError::Kind::OutOfBounds);
+  EXPECT_EQ((Bounded<i32, -3, 3>::try_from(-4).unwrap_err().kind()),
+            sus::num::TryFromIntError::Kind::OutOfBounds);
+  EXPECT_EQ((Bounded<u8, 0, 255>::try_from(255_u8).unwrap()), 255_u8);
+}
+
+TEST(Bounded, FromClamped) {
+  EXPECT_EQ((Bounded<i32, -3, 3>::from_clamped(-10)), -3_i32);
+  EXPECT_EQ((Bounded<i32, -3, 3>::from_clamped(10)), 3_i32);
+  EXPECT_EQ((Bounded<i32, -3, 3>::from_clamped(2)), 2_i32);
+}
+
+TEST(Bounded, FromUnchecked) {
+  auto a = Bounded<u16, 2, 4>::from_unchecked(unsafe_fn, 3_u16);
+  EXPECT_EQ(a, 3_u16);
+}
+
+TEST(Bounded, Add) {
+  auto a = Bounded<u8, 0, 100>(60_u8);
+  auto b = Bounded<u8, 10, 20>(15_u8);
+  // Fits in u8.
+  auto c = a + b;
+  static_assert(std::same_as<decltype(c), Bounded<u8, 10, 120>>);
+  EXPECT_EQ(c, 75_u8);
+
+  // Widened to u16.
+  auto d = Bounded<u8, 0, 255>(200_u8) + Bounded<u8, 0, 255>(100_u8);
+  static_assert(std::same_as<decltype(d), Bounded<u16, 0, 510>>);
+  EXPECT_EQ(d, 300_u16);
+
+  // Widened to i64.
+  auto e = Bounded<i32, i32::MIN_PRIMITIVE, 0>(i32::MIN) +
+           Bounded<i32, -1, 0>(-1);
+  static_assert(std::same_as<decltype(e),
+                             Bounded<i64, int64_t{i32::MIN_PRIMITIVE} - 1, 0>>);
+  EXPECT_EQ(e, int64_t{i32::MIN_PRIMITIVE} - 1);
+
+  // Nothing wider than 64 bits, so it's a checked add.
+  auto f = Bounded<u64, 0, u64::MAX_PRIMITIVE>(1u) + Bounded<u64, 1, 1>(1u);
+  static_assert(std::same_as<decltype(f), u64>);
+  EXPECT_EQ(f, 2u);
+
+  // Composes with further operations.
+  auto g = (a + b) + (a + b);
+  static_assert(std::same_as<decltype(g), Bounded<u8, 20, 240>>);
+  EXPECT_EQ(g, 150_u8);
+
+  // The narrower integer type is widened to the other, keeping its range.
+  auto h = a + d;
+  static_assert(std::same_as<decltype(h), Bounded<u16, 0, 610>>);
+  EXPECT_EQ(h, 360_u16);
+  auto i = Bounded<i64, -1, 1>(-1_i64) * Bounded<i8, -128, 0>(i8::MIN);
+  static_assert(std::same_as<decltype(i), Bounded<i64, -128, 128>>);
+  EXPECT_EQ(i, 128_i64);
+}
+
+TEST(Bounded, Sub) {
+  auto a = Bounded<i8, -10, 10>(-10_i8);
+  auto b = Bounded<i8, 0, 100>(100_i8);
+  auto c = a - b;
+  static_assert(std::same_as<decltype(c), Bounded<i8, -110, 10>>);
+  EXPECT_EQ(c, -110_i8);
+
+  // Widened to i16.
+  auto d = Bounded<i8, -128, 127>(i8::MIN) - Bounded<i8, 0, 1>(1_i8);
+  static_assert(std::same_as<decltype(d), Bounded<i16, -129, 127>>);
+  EXPECT_EQ(d, -129_i16);
+
+  // Unsigned subtraction is checked unless it can't go below zero.
+  auto e = Bounded<u32, 10, 20>(15u) - Bounded<u32, 0, 10>(10u);
+  static_assert(std::same_as<decltype(e), Bounded<u32, 0, 20>>);
+  EXPECT_EQ(e, 5_u32);
+  auto f = Bounded<u32, 0, 20>(15u) - Bounded<u32, 0, 10>(10u);
+  static_assert(std::same_as<decltype(f), u32>);
+  EXPECT_EQ(f, 5_u32);
+}
+
+TEST(Bounded, Mul) {
+  auto a = Bounded<i16, -3, 5>(-3_i16);
+  auto b = Bounded<i16, -7, 2>(-7_i16);
+  auto c = a * b;
+  static_assert(std::same_as<decltype(c), Bounded<i16, -35, 21>>);
+  EXPECT_EQ(c, 21_i16);
+
+  auto d = Bounded<u16, 0, 65535>(u16::MAX) * Bounded<u16, 0, 65535>(u16::MAX);
+  static_assert(std::same_as<decltype(d), Bounded<u32, 0, 4294836225u>>);
+  EXPECT_EQ(d, 4294836225_u32);
+}
+
+TEST(Bounded, Div) {
+  auto a = Bounded<i32, -100, 50>(-100);
+  auto b = Bounded<i32, 3, 10>(3);
+  auto c = a / b;
+  static_assert(std::same_as<decltype(c), Bounded<i32, -33, 16>>);
+  EXPECT_EQ(c, -33_i32);
+
+  auto d = a / Bounded<i32, -10, -3>(-3);
+  static_assert(std::same_as<decltype(d), Bounded<i32, -16, 33>>);
+  EXPECT_EQ(d, 33_i32);
+
+  // Dividing by a range including 0 is checked.
+  auto e = a / Bounded<i32, 0, 10>(4);
+  static_assert(std::same_as<decltype(e), i32>);
+  EXPECT_EQ(e, -25_i32);
+
+  // `MIN / -1` is widened.
+  auto f = Bounded<i32, i32::MIN_PRIMITIVE, 0>(i32::MIN) /
+           Bounded<i32, -1, -1>(-1);
+  static_assert(std::same_as<decltype(f),
+                             Bounded<i64, 0, -int64_t{i32::MIN_PRIMITIVE}>>);
+  EXPECT_EQ(f, -int64_t{i32::MIN_PRIMITIVE});
+}
+
+TEST(Bounded, Rem) {
+  auto a = Bounded<u32, 0, 1000>(999u);
+  auto b = Bounded<u32, 1, 16>(16u);
+  auto c = a % b;
+  static_assert(std::same_as<decltype(c), Bounded<u32, 0, 15>>);
+  EXPECT_EQ(c, 7_u32);
+
+  // The dividend is smaller than the divisor.
+  auto d = Bounded<u32, 2, 5>(4u) % Bounded<u32, 8, 9>(8u);
+  static_assert(std::same_as<decltype(d), Bounded<u32, 2, 5>>);
+  EXPECT_EQ(d, 4_u32);
+
+  // Signed ranges that include negatives are checked.
+  auto e = Bounded<i32, -10, 10>(-7) % Bounded<i32, 1, 4>(4);
+  static_assert(std::same_as<decltype(e), i32>);
+  EXPECT_EQ(e, -3_i32);
+}
+
+TEST(Bounded, Cmp) {
+  auto a = Bounded<i32, 0, 10>(3);
+  auto b = Bounded<i32, -5, 5>(4);
+  EXPECT_LT(a, b);
+  EXPECT_GT(b, a);
+  EXPECT_NE(a, b);
+  EXPECT_EQ(a, (Bounded<i32, 3, 3>(3)));
+  EXPECT_LT(a, 4_i32);
+  EXPECT_EQ(a, 3_i32);
+}
+
+TEST(Bounded, ArrayIndex) {
+  static_assert(UncheckedIndex<16, Bounded<usize, 0, 15>>);
+  static_assert(UncheckedIndex<16, Bounded<u8, 3, 15>>);
+  static_assert(UncheckedIndex<16, Bounded<i32, 0, 15>>);
+  static_assert(!UncheckedIndex<16, Bounded<usize, 0, 16>>);
+  static_assert(!UncheckedIndex<16, Bounded<i32, -1, 15>>);
+
+  auto a = sus::Array<i32, 16>::with_initializer([i = 0]() mutable {
+    return i++;
+  });
+  EXPECT_EQ((a[Bounded<u8, 0, 15>(15_u8)]), 15);
+  a[Bounded<usize, 2, 3>(2u)] = 42;
+  EXPECT_EQ(a[2u], 42);
+  // A range larger than the array falls back to a checked index.
+  EXPECT_EQ((a[Bounded<usize, 0, 100>(4u)]), 4);
+}
+
+TEST(BoundedDeathTest, OutOfRange) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto b = (Bounded<i32, 0, 10>(11));
+        ensure_use(&b);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto b = (Bounded<i32, 0, 10>(-1));
+        ensure_use(&b);
+      },
+      "");
+  auto a = sus::Array<i32, 4>();
+  EXPECT_DEATH(
+      {
+        auto& i = a[(Bounded<usize, 0, 100>(4u))];
+        ensure_use(&i);
+      },
+      "");
+  // Unsigned subtraction below zero is checked.
+  EXPECT_DEATH(
+      {
+        auto u = (Bounded<u32, 0, 1>(0u) - Bounded<u32, 1, 1>(1u));
+        ensure_use(&u);
+      },
+      "");
+#endif
+}
+
+}  // namespace
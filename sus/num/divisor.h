@@ -0,0 +1,354 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "sus/assertions/check.h"
+#include "sus/collections/slice.h"
+#include "sus/macros/pure.h"
+#include "sus/mem/size_of.h"
+#include "sus/num/__private/intrinsics.h"
+#include "sus/num/integer_concepts.h"
+#include "sus/num/types.h"
+#include "sus/option/option.h"
+
+namespace sus::num {
+
+/// A divisor that has been prepared for fast repeated division.
+///
+/// Hardware division is one of the slowest integer instructions, taking tens
+/// of cycles. When the same divisor is used many times, such as to choose a
+/// bucket in a hash table, `Divisor` precomputes a "magic" reciprocal once, so
+/// that each division becomes a multiply of the high half and a shift. The
+/// results are exactly the same as dividing by the integer.
+///
+/// Division and remainder are provided by the `/` and `%` operators with the
+/// integer on the left, and by [`div_euclid`]($sus::num::Divisor::div_euclid)
+/// and [`rem_euclid`]($sus::num::Divisor::rem_euclid). To divide many integers
+/// at once, [`div_slice`]($sus::num::Divisor::div_slice) chooses the
+/// instructions once for the whole slice.
+///
+/// Divisors are available for 32-bit and 64-bit integers. The technique is the
+/// one described by Granlund and Montgomery in "Division by Invariant Integers
+/// using Multiplication", as implemented by libdivide.
+///
+/// # Examples
+/// ```
+/// const auto d = sus::num::Divisor<u32>(7u);
+/// sus_check(100_u32 / d == 14u);
+/// sus_check(100_u32 % d == 2u);
+/// sus_check((-100_i64).div_euclid(7) ==
+///           sus::num::Divisor<i64>(7).div_euclid(-100));
+/// ```
+template <Integer T>
+  requires(::sus::mem::size_of<T>() == 4u || ::sus::mem::size_of<T>() == 8u)
+class Divisor {
+  using P = decltype(T::primitive_value);
+  using U = std::make_unsigned_t<P>;
+  static constexpr bool kSigned = std::is_signed_v<P>;
+  static constexpr uint32_t kBits = ::sus::mem::size_of<P>() * 8u;
+
+  // Flags in `more_` above the shift amount, which fits in the low 6 bits.
+  static constexpr uint8_t kShiftMask = kBits - 1u;
+  static constexpr uint8_t kAddMarker = 0x40u;
+  static constexpr uint8_t kNegativeDivisor = 0x80u;
+
+ public:
+  /// Prepares to divide by `divisor`.
+  ///
+  /// This does a hardware division, so it is about as slow as a division
+  /// itself, but it is done only once.
+  ///
+  /// # Panics
+  /// Panics if `divisor` is zero.
+  explicit constexpr Divisor(T divisor) noexcept : divisor_(divisor) {
+    sus_check_with_message(divisor.primitive_value != P{0},
+                           "attempt to divide by zero");
+    if constexpr (kSigned) {
+      init_signed();
+    } else {
+      init_unsigned();
+    }
+  }
+
+  /// Prepares to divide by `divisor`, or returns None if `divisor` is zero.
+  _sus_pure static constexpr ::sus::option::Option<Divisor> checked(
+      T divisor) noexcept {
+    if (divisor.primitive_value == P{0})
+      return ::sus::option::Option<Divisor>();
+    return ::sus::option::Option<Divisor>(Divisor(divisor));
+  }
+
+  /// Returns the integer that this divides by.
+  _sus_pure constexpr T divisor() const& noexcept { return divisor_; }
+
+  /// Divides `n` by the divisor, rounding towards zero.
+  ///
+  /// # Panics
+  /// For signed integers, panics when dividing the minimum value by -1, which
+  /// overflows, the same as the integer division operator.
+  _sus_pure friend constexpr T operator/(T n, const Divisor& d) noexcept {
+    if constexpr (kSigned) {
+      sus_check_with_message(!d.div_overflows(n.primitive_value),
+                             "attempt to divide with overflow");
+    }
+    return T(d.div(n.primitive_value));
+  }
+
+  /// Computes the remainder of `n` divided by the divisor, which has the sign
+  /// of `n`.
+  ///
+  /// # Panics
+  /// For signed integers, panics when dividing the minimum value by -1, which
+  /// overflows, the same as the integer remainder operator.
+  _sus_pure friend constexpr T operator%(T n, const Divisor& d) noexcept {
+    if constexpr (kSigned) {
+      sus_check_with_message(
+          !d.div_overflows(n.primitive_value),
+          "attempt to calculate the remainder with overflow");
+    }
+    return T(d.rem(n.primitive_value));
+  }
+
+  /// Computes the quotient of Euclidean division of `n` by the divisor, which
+  /// is the same as [`div_euclid`]($sus::num::i32::div_euclid) on the integer.
+  ///
+  /// For unsigned integers this is the same as `n / d`.
+  ///
+  /// # Panics
+  /// For signed integers, panics when dividing the minimum value by -1.
+  _sus_pure constexpr T div_euclid(T n) const& noexcept {
+    if constexpr (kSigned) {
+      sus_check_with_message(!div_overflows(n.primitive_value),
+                             "attempt to divide with overflow");
+      const P q = div(n.primitive_value);
+      const P r = remainder_of(n.primitive_value, q);
+      if (r < P{0}) {
+        return T(divisor_.primitive_value > P{0} ? static_cast<P>(q - P{1})
+                                                 : static_cast<P>(q + P{1}));
+      }
+      return T(q);
+    } else {
+      return T(div(n.primitive_value));
+    }
+  }
+
+  /// Computes the least nonnegative remainder of `n` divided by the divisor,
+  /// which is the same as [`rem_euclid`]($sus::num::i32::rem_euclid) on the
+  /// integer.
+  ///
+  /// For unsigned integers this is the same as `n % d`.
+  ///
+  /// # Panics
+  /// For signed integers, panics when dividing the minimum value by -1.
+  _sus_pure constexpr T rem_euclid(T n) const& noexcept {
+    if constexpr (kSigned) {
+      sus_check_with_message(
+          !div_overflows(n.primitive_value),
+          "attempt to calculate the remainder with overflow");
+      const P r = rem(n.primitive_value);
+      if (r < P{0}) {
+        // The magnitude of `r` is less than the divisor's, so this can't
+        // overflow.
+        return T(divisor_.primitive_value < P{0}
+                     ? static_cast<P>(r - divisor_.primitive_value)
+                     : static_cast<P>(r + divisor_.primitive_value));
+      }
+      return T(r);
+    } else {
+      return T(rem(n.primitive_value));
+    }
+  }
+
+  /// Divides every integer in `values` by the divisor, in place.
+  ///
+  /// The instructions needed for the divisor are chosen once for the whole
+  /// slice, leaving a loop of multiplies and shifts without branches. For
+  /// 32-bit integers the compiler can vectorize the loop.
+  ///
+  /// # Panics
+  /// For signed integers, panics if the divisor is -1 and any value is the
+  /// minimum value.
+  constexpr void div_slice(::sus::collections::SliceMut<T> values) const& {
+    P* const p = &values.as_mut_ptr()->primitive_value;
+    const size_t len = size_t{values.len()};
+    // Copy the fields so the compiler knows that writing to `p` can't change
+    // them, otherwise they would be reloaded for each element.
+    const P magic = magic_;
+    const uint8_t more = more_;
+    if (magic == P{0}) {
+      // Powers of two are only a shift.
+      if constexpr (kSigned) {
+        if (divisor_.primitive_value == P{-1}) {
+          for (size_t i = 0u; i < len; ++i) {
+            sus_check_with_message(!div_overflows(p[i]),
+                                   "attempt to divide with overflow");
+            p[i] = -p[i];
+          }
+          return;
+        }
+      }
+      for (size_t i = 0u; i < len; ++i) p[i] = div_pow2(p[i], more);
+    } else if ((more & kAddMarker) != 0u) {
+      for (size_t i = 0u; i < len; ++i)
+        p[i] = div_magic<true>(p[i], magic, more);
+    } else {
+      for (size_t i = 0u; i < len; ++i)
+        p[i] = div_magic<false>(p[i], magic, more);
+    }
+  }
+
+  /// Satisfies the [`Eq`]($sus::cmp::Eq) concept.
+  _sus_pure friend constexpr bool operator==(const Divisor& l,
+                                             const Divisor& r) noexcept {
+    return l.divisor_ == r.divisor_;
+  }
+
+ private:
+  // Computes the magic number and shift for an unsigned divisor `d`. The
+  // quotient is `mul_high(n, magic) >> shift`, unless the magic number needs
+  // `N + 1` bits, in which case the `kAddMarker` flag is set and the top bit is
+  // added back in after the multiply.
+  constexpr void init_unsigned() noexcept {
+    const U d = divisor_.primitive_value;
+    const uint32_t log2 = kBits - 1u - __private::leading_zeros(d);
+    if ((d & (d - U{1})) == U{0}) {
+      magic_ = P{0};
+      more_ = static_cast<uint8_t>(log2);
+      return;
+    }
+    auto [m, rem] = __private::div_wide(U{1} << log2, U{0}, d);
+    const U e = d - rem;
+    if (e < (U{1} << log2)) {
+      // The magic number fits in N bits.
+      more_ = static_cast<uint8_t>(log2);
+    } else {
+      m += m;
+      const U twice_rem = rem + rem;
+      if (twice_rem >= d || twice_rem < rem) m += U{1};
+      more_ = static_cast<uint8_t>(log2 | kAddMarker);
+    }
+    magic_ = static_cast<P>(m + U{1});
+  }
+
+  // Computes the magic number and shift for the magnitude of a signed divisor.
+  // For negative divisors, the magic number is negated and the
+  // `kNegativeDivisor` flag is set.
+  constexpr void init_signed() noexcept {
+    const P d = divisor_.primitive_value;
+    const U ud = static_cast<U>(d);
+    const U abs_d = d < P{0} ? static_cast<U>(U{0} - ud) : ud;
+    const uint32_t log2 = kBits - 1u - __private::leading_zeros(abs_d);
+    const uint8_t negative = d < P{0} ? kNegativeDivisor : uint8_t{0u};
+    if ((abs_d & (abs_d - U{1})) == U{0}) {
+      magic_ = P{0};
+      more_ = static_cast<uint8_t>(log2 | negative);
+      return;
+    }
+    auto [m, rem] = __private::div_wide(U{1} << (log2 - 1u), U{0}, abs_d);
+    const U e = abs_d - rem;
+    if (e < (U{1} << log2)) {
+      more_ = static_cast<uint8_t>(log2 - 1u);
+    } else {
+      m += m;
+      const U twice_rem = rem + rem;
+      if (twice_rem >= abs_d || twice_rem < rem) m += U{1};
+      more_ = static_cast<uint8_t>(log2 | kAddMarker);
+    }
+    m += U{1};
+    more_ |= negative;
+    magic_ = static_cast<P>(negative ? U{0} - m : m);
+  }
+
+  _sus_pure constexpr bool div_overflows(P n) const noexcept
+    requires(kSigned)
+  {
+    return divisor_.primitive_value == P{-1} &&
+           n == __private::min_value<P>();
+  }
+
+  __sus_pure_const _sus_always_inline static constexpr P div_pow2(
+      P n, uint8_t more) noexcept {
+    const uint32_t shift = more & kShiftMask;
+    if constexpr (kSigned) {
+      // Round towards zero by adding `2^shift - 1` to negative numbers before
+      // the arithmetic shift, then negate for a negative divisor.
+      const U mask = (U{1} << shift) - U{1};
+      const U un = static_cast<U>(n);
+      const U uq = un + (static_cast<U>(n >> (kBits - 1u)) & mask);
+      const P q = static_cast<P>(uq) >> shift;
+      const U sign =
+          static_cast<U>(static_cast<P>(static_cast<int8_t>(more) >> 7));
+      return static_cast<P>((static_cast<U>(q) ^ sign) - sign);
+    } else {
+      return static_cast<P>(n >> shift);
+    }
+  }
+
+  template <bool Add>
+  __sus_pure_const _sus_always_inline static constexpr P div_magic(
+      P n, P magic, uint8_t more) noexcept {
+    const uint32_t shift = more & kShiftMask;
+    if constexpr (kSigned) {
+      U uq = static_cast<U>(__private::mul_high(magic, n));
+      if constexpr (Add) {
+        // Add `n` for a positive divisor, or subtract it for a negative one.
+        const U sign =
+            static_cast<U>(static_cast<P>(static_cast<int8_t>(more) >> 7));
+        uq += (static_cast<U>(n) ^ sign) - sign;
+      }
+      P q = static_cast<P>(uq) >> shift;
+      // Round towards zero.
+      q += P{q < P{0}};
+      return q;
+    } else {
+      const U q = __private::mul_high(static_cast<U>(magic), n);
+      if constexpr (Add) {
+        const U t = ((n - q) >> 1u) + q;
+        return static_cast<P>(t >> shift);
+      } else {
+        return static_cast<P>(q >> shift);
+      }
+    }
+  }
+
+  _sus_pure _sus_always_inline constexpr P div(P n) const noexcept {
+    if (magic_ == P{0}) return div_pow2(n, more_);
+    if ((more_ & kAddMarker) != 0u) return div_magic<true>(n, magic_, more_);
+    return div_magic<false>(n, magic_, more_);
+  }
+
+  _sus_pure _sus_always_inline constexpr P remainder_of(P n,
+                                                        P q) const noexcept {
+    // The remainder always fits in `P`, so wrapping math finds it even where
+    // `q * d` overflows.
+    return static_cast<P>(static_cast<U>(n) -
+                          static_cast<U>(q) *
+                              static_cast<U>(divisor_.primitive_value));
+  }
+
+  _sus_pure _sus_always_inline constexpr P rem(P n) const noexcept {
+    return remainder_of(n, div(n));
+  }
+
+  T divisor_;
+  P magic_ = P{0};
+  uint8_t more_ = 0u;
+};
+
+}  // namespace sus::num
@@ -0,0 +1,159 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/num/divisor.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/vec.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+namespace {
+
+using sus::num::Divisor;
+using sus::test::ensure_use;
+
+static_assert(sus::mem::Copy<Divisor<u32>>);
+static_assert(sus::mem::Copy<Divisor<i64>>);
+
+// Interesting values for every width: small numbers, powers of two and their
+// neighbours, and the extremes.
+template <class T>
+sus::Vec<T> interesting_values() {
+  using P = decltype(T::primitive_value);
+  auto v = sus::Vec<T>();
+  for (P i = 0; i <= 130; ++i) v.push(T(i));
+  for (uint32_t s = 7u; s < sizeof(P) * 8u - 1u; ++s) {
+    const P p = static_cast<P>(P{1} << s);
+    v.push(T(static_cast<P>(p - 1)));
+    v.push(T(p));
+    v.push(T(static_cast<P>(p + 1)));
+    // Some numbers that aren't near a power of two.
+    v.push(T(static_cast<P>(p / 3 * 2 + 7)));
+  }
+  v.push(T::MAX);
+  v.push(T(static_cast<P>(T::MAX_PRIMITIVE - 1)));
+  if constexpr (std::is_signed_v<P>) {
+    const usize len = v.len();
+    for (usize i; i < len; i += 1u) {
+      const T t = v[i];
+      v.push(-t);
+    }
+    v.push(T::MIN);
+    v.push(T(static_cast<P>(T::MIN_PRIMITIVE + 1)));
+  }
+  return v;
+}
+
+// Compares every operation against the integer's own for all pairs of
+// interesting values.
+template <class T>
+void check_all() {
+  using P = decltype(T::primitive_value);
+  const auto values = interesting_values<T>();
+  for (T d : values) {
+    if (d == T(P{0})) continue;
+    const auto div = Divisor<T>(d);
+    EXPECT_EQ(div.divisor(), d);
+    for (T n : values) {
+      if constexpr (std::is_signed_v<P>) {
+        if (n == T::MIN && d == T(P{-1})) continue;
+      }
+      EXPECT_EQ(n / div, n / d);
+      EXPECT_EQ(n % div, n % d);
+      EXPECT_EQ(div.div_euclid(n), n.div_euclid(d));
+      EXPECT_EQ(div.rem_euclid(n), n.rem_euclid(d));
+    }
+
+    auto quotients = sus::Vec<T>();
+    auto expected = sus::Vec<T>();
+    for (T n : values) {
+      if constexpr (std::is_signed_v<P>) {
+        if (n == T::MIN && d == T(P{-1})) continue;
+      }
+      quotients.push(n);
+      expected.push(n / d);
+    }
+    div.div_slice(quotients);
+    EXPECT_EQ(quotients, expected);
+  }
+}
+
+TEST(Divisor, U32) { check_all<u32>(); }
+TEST(Divisor, U64) { check_all<u64>(); }
+TEST(Divisor, I32) { check_all<i32>(); }
+TEST(Divisor, I64) { check_all<i64>(); }
+TEST(Divisor, Usize) { check_all<usize>(); }
+TEST(Divisor, Isize) { check_all<isize>(); }
+
+TEST(Divisor, Example) {
+  const auto d = Divisor<u32>(7u);
+  EXPECT_EQ(100_u32 / d, 14u);
+  EXPECT_EQ(100_u32 % d, 2u);
+  EXPECT_EQ(Divisor<i64>(7).div_euclid(-100), -15);
+  EXPECT_EQ(Divisor<i64>(7).rem_euclid(-100), 5);
+  EXPECT_EQ(Divisor<i64>(-7).div_euclid(-100), 15);
+  EXPECT_EQ(Divisor<i64>(-7).rem_euclid(-100), 5);
+}
+
+TEST(Divisor, Constexpr) {
+  constexpr auto d = Divisor<u64>(1000u);
+  static_assert(123456789_u64 / d == 123456u);
+  static_assert(123456789_u64 % d == 789u);
+  constexpr auto s = Divisor<i32>(-3);
+  static_assert(10_i32 / s == -3);
+  static_assert(-10_i32 % s == -1);
+}
+
+TEST(Divisor, Checked) {
+  EXPECT_EQ(Divisor<u32>::checked(0u), sus::none());
+  EXPECT_EQ(Divisor<u32>::checked(9u).unwrap().divisor(), 9u);
+}
+
+TEST(DivisorDeathTest, Zero) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto d = Divisor<u32>(0u);
+        ensure_use(&d);
+      },
+      "attempt to divide by zero");
+#endif
+}
+
+TEST(DivisorDeathTest, Overflow) {
+#if GTEST_HAS_DEATH_TEST
+  const auto d = Divisor<i32>(-1);
+  EXPECT_DEATH(
+      {
+        auto q = i32::MIN / d;
+        ensure_use(&q);
+      },
+      "attempt to divide with overflow");
+  EXPECT_DEATH(
+      {
+        auto r = i32::MIN % d;
+        ensure_use(&r);
+      },
+      "attempt to calculate the remainder with overflow");
+  EXPECT_DEATH(
+      {
+        auto v = sus::Vec<i32>(1, i32::MIN);
+        d.div_slice(v);
+      },
+      "attempt to divide with overflow");
+#endif
+}
+
+}  // namespace
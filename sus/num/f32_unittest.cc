@@ -1252,4 +1252,41 @@ static_assert([] {
   return f.as_mut_ptr() == &f.primitive_value;
 }());
 
+/// A slice over the characters of a string literal, without the terminating
+/// NUL.
+template <size_t N>
+sus::Slice<u8> chars(const char (&s)[N]) {
+  return sus::Slice<u8>::from_raw_parts(
+      sus::marker::unsafe_fn, reinterpret_cast<const u8*>(s), N - 1u);
+}
+
+TEST(f32, FromStr) {
+  using E = sus::num::ParseFloatError;
+  EXPECT_EQ(f32::from_str(chars("1.5")).unwrap(), 1.5_f32);
+  EXPECT_EQ(f32::from_str(chars("-0.1")).unwrap(), -0.1_f32);
+  EXPECT_EQ(f32::from_str(chars("3.4028235e38")).unwrap(), f32::MAX);
+  EXPECT_EQ(f32::from_str(chars("1e39")).unwrap(), f32::INF);
+  EXPECT_EQ(f32::from_str(chars("1e-50")).unwrap(), 0_f32);
+  EXPECT_EQ(f32::from_str(chars("")).unwrap_err(), E::with_empty());
+  EXPECT_EQ(f32::from_str(chars("1.0f")).unwrap_err(), E::with_invalid());
+}
+
+TEST(f32, ToChars) {
+  auto buf = sus::Array<u8, f32::MAX_CHARS>();
+  auto to_string = [&](f32 v) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    return std::string(reinterpret_cast<const char*>(buf.as_ptr()), n);
+  };
+  EXPECT_EQ(to_string(0.1_f32), "0.1");
+  EXPECT_EQ(to_string(f32::MAX), "3.4028235e+38");
+  EXPECT_EQ(to_string(-f32::MIN_POSITIVE), "-1.1754944e-38");
+
+  for (f32 v = f32::MIN_POSITIVE; v < f32::MAX / 3_f32; v *= 3.14159_f32) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    EXPECT_EQ(f32::from_str(buf.as_slice()[sus::ops::range(0_usize, n)])
+                  .unwrap(),
+              v);
+  }
+}
+
 }  // namespace
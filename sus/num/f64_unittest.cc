@@ -1229,4 +1229,81 @@ TEST(f64, NextToward) {
   EXPECT_LT((0_f64).next_toward(-1_f64), 0_f64);
 }
 
+/// A slice over the characters of a string literal, without the terminating
+/// NUL.
+template <size_t N>
+sus::Slice<u8> chars(const char (&s)[N]) {
+  return sus::Slice<u8>::from_raw_parts(
+      sus::marker::unsafe_fn, reinterpret_cast<const u8*>(s), N - 1u);
+}
+
+TEST(f64, FromStr) {
+  using E = sus::num::ParseFloatError;
+  EXPECT_EQ(f64::from_str(chars("0")).unwrap(), 0_f64);
+  EXPECT_EQ(f64::from_str(chars("1.5")).unwrap(), 1.5_f64);
+  EXPECT_EQ(f64::from_str(chars("+1.5")).unwrap(), 1.5_f64);
+  EXPECT_EQ(f64::from_str(chars("-1.5")).unwrap(), -1.5_f64);
+  EXPECT_EQ(f64::from_str(chars(".25")).unwrap(), 0.25_f64);
+  EXPECT_EQ(f64::from_str(chars("5.")).unwrap(), 5_f64);
+  EXPECT_EQ(f64::from_str(chars("1e3")).unwrap(), 1000_f64);
+  EXPECT_EQ(f64::from_str(chars("2.5E-3")).unwrap(), 0.0025_f64);
+  EXPECT_EQ(f64::from_str(chars("0.1")).unwrap(), 0.1_f64);
+  EXPECT_EQ(f64::from_str(chars("1.7976931348623157e308")).unwrap(), f64::MAX);
+  EXPECT_EQ(f64::from_str(chars("inf")).unwrap(), f64::INF);
+  EXPECT_EQ(f64::from_str(chars("-Infinity")).unwrap(), f64::NEG_INF);
+  EXPECT_TRUE(f64::from_str(chars("NaN")).unwrap().is_nan());
+
+  // Out of range values become infinity or zero, keeping the sign.
+  EXPECT_EQ(f64::from_str(chars("1e400")).unwrap(), f64::INF);
+  EXPECT_EQ(f64::from_str(chars("-1e400")).unwrap(), f64::NEG_INF);
+  EXPECT_EQ(f64::from_str(chars("1e-400")).unwrap(), 0_f64);
+  EXPECT_TRUE(f64::from_str(chars("-1e-400")).unwrap().is_sign_negative());
+  EXPECT_EQ(f64::from_str(chars("0.000001e-320")).unwrap(), 0_f64);
+  EXPECT_EQ(f64::from_str(chars("100000e304")).unwrap(), f64::INF);
+
+  EXPECT_EQ(f64::from_str(chars("")).unwrap_err(), E::with_empty());
+  EXPECT_EQ(f64::from_str(chars("+")).unwrap_err(), E::with_invalid());
+  EXPECT_EQ(f64::from_str(chars("+-1")).unwrap_err(), E::with_invalid());
+  EXPECT_EQ(f64::from_str(chars(".")).unwrap_err(), E::with_invalid());
+  EXPECT_EQ(f64::from_str(chars(" 1")).unwrap_err(), E::with_invalid());
+  EXPECT_EQ(f64::from_str(chars("1 ")).unwrap_err(), E::with_invalid());
+  EXPECT_EQ(f64::from_str(chars("1e")).unwrap_err(), E::with_invalid());
+  EXPECT_EQ(f64::from_str(chars("0x10")).unwrap_err(), E::with_invalid());
+}
+
+TEST(f64, ToChars) {
+  auto buf = sus::Array<u8, f64::MAX_CHARS>();
+  auto to_string = [&](f64 v) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    return std::string(reinterpret_cast<const char*>(buf.as_ptr()), n);
+  };
+  // The shortest representation that round trips.
+  EXPECT_EQ(to_string(0_f64), "0");
+  EXPECT_EQ(to_string(-0_f64), "-0");
+  EXPECT_EQ(to_string(0.1_f64), "0.1");
+  EXPECT_EQ(to_string(1.5_f64), "1.5");
+  EXPECT_EQ(to_string(100_f64), "100");
+  EXPECT_EQ(to_string(1e22_f64), "1e+22");
+  EXPECT_EQ(to_string(f64::MAX), "1.7976931348623157e+308");
+  EXPECT_EQ(to_string(f64::INF), "inf");
+  EXPECT_EQ(to_string(f64::NEG_INF), "-inf");
+  EXPECT_EQ(to_string(-f64::MIN_POSITIVE), "-2.2250738585072014e-308");
+  EXPECT_EQ(to_string(-f64::MIN_POSITIVE).size(), f64::MAX_CHARS);
+
+  auto small = sus::Array<u8, 3>();
+  EXPECT_EQ((0.125_f64).to_chars(small.as_mut_slice()), sus::none());
+  EXPECT_EQ((0.5_f64).to_chars(small.as_mut_slice()), sus::some(3u));
+
+  for (f64 v = f64::MIN_POSITIVE; v < f64::MAX / 3_f64; v *= 3.14159_f64) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    EXPECT_EQ(f64::from_str(buf.as_slice()[sus::ops::range(0_usize, n)])
+                  .unwrap(),
+              v);
+    n = (-v).to_chars(buf.as_mut_slice()).unwrap();
+    EXPECT_EQ(f64::from_str(buf.as_slice()[sus::ops::range(0_usize, n)])
+                  .unwrap(),
+              -v);
+  }
+}
+
 }  // namespace
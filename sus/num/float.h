@@ -33,6 +33,7 @@
 #include "sus/num/__private/literals.h"
 #include "sus/num/float_concepts.h"
 #include "sus/num/fp_category.h"
+#include "sus/num/parse_float_error.h"
 #include "sus/num/signed_integer.h"
 #include "sus/num/unsigned_integer.h"
 #include "sus/string/__private/format_to_stream.h"
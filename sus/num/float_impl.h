@@ -16,8 +16,16 @@
 // IWYU pragma: friend "sus/.*"
 #pragma once
 
+#include <charconv>
+#include <system_error>
+
 #include "sus/collections/array.h"
+#include "sus/num/__private/chars.h"
 #include "sus/num/float.h"
+#include "sus/num/parse_float_error_impl.h"
+#include "sus/num/parse_int_error_impl.h"
+#include "sus/option/option.h"
+#include "sus/result/result.h"
 
 #define _self f32
 #define _primitive float
@@ -0,0 +1,163 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <bit>
+#include <compare>
+
+#include "fmt/format.h"
+#include "sus/assertions/check.h"
+#include "sus/collections/slice.h"
+#include "sus/iter/iterator_concept.h"
+#include "sus/macros/pure.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
+#include "sus/num/__private/half_float.h"
+#include "sus/num/float.h"
+#include "sus/num/fp_category.h"
+#include "sus/num/types.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/string/__private/format_to_stream.h"
+
+namespace sus::num {
+
+/// A 16-bit floating point type, in the IEEE 754 binary16 format.
+///
+/// This type stores values with 11 bits of precision and a range of about
+/// ±65504, in half the memory of an [`f32`]($sus::num::f32). It is meant for
+/// storing large arrays of values, such as machine learning weights or
+/// graphics data, where memory bandwidth is the limit. Arithmetic is done by
+/// converting to [`f32`]($sus::num::f32) and rounding the result back.
+///
+/// Arrays of values are converted to and from [`f32`]($sus::num::f32) with
+/// [`from_f32_slice`]($sus::num::f16::from_f32_slice) and
+/// [`to_f32_slice`]($sus::num::f16::to_f32_slice), which use the F16C or NEON
+/// conversion instructions when the target has them.
+///
+/// # Examples
+/// ```
+/// auto h = sus::num::f16(1.5_f32);
+/// sus_check(h.to_f32() == 1.5_f32);
+/// sus_check(h.to_bits() == 0x3e00_u16);
+/// ```
+struct [[_sus_trivial_abi]] f16 final {
+#define _self f16
+#define _exp_mask 0x7c00u
+#define _man_mask 0x03ffu
+#define _from_f32_bits __private::f32_to_f16_bits
+#define _to_f32_bits __private::f16_bits_to_f32
+#define _from_f32_slice __private::f32_to_f16_slice
+#define _to_f32_slice __private::f16_to_f32_slice
+#include "sus/num/__private/half_float_methods.inc"
+
+ private:
+  enum FromBits { FROM_BITS };
+  constexpr f16(FromBits, uint16_t bits) noexcept : bits_(bits) {}
+
+  uint16_t bits_ = 0u;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(bits_));
+};
+
+inline constexpr f16 f16::MIN = f16::from_bits(0xfbff_u16);
+inline constexpr f16 f16::MAX = f16::from_bits(0x7bff_u16);
+inline constexpr f16 f16::EPSILON = f16::from_bits(0x1400_u16);
+inline constexpr f16 f16::MIN_POSITIVE = f16::from_bits(0x0400_u16);
+inline constexpr f16 f16::NaN = f16::from_bits(0x7e00_u16);
+inline constexpr f16 f16::INF = f16::from_bits(0x7c00_u16);
+inline constexpr f16 f16::NEG_INF = f16::from_bits(0xfc00_u16);
+
+/// A 16-bit floating point type, in the bfloat16 format.
+///
+/// This type is the high half of an [`f32`]($sus::num::f32): it has the same
+/// range, with 8 bits of precision. It is meant for storing large arrays of
+/// values, such as machine learning weights, where range matters more than
+/// precision. Arithmetic is done by converting to [`f32`]($sus::num::f32) and
+/// rounding the result back.
+///
+/// Arrays of values are converted to and from [`f32`]($sus::num::f32) with
+/// [`from_f32_slice`]($sus::num::bf16::from_f32_slice) and
+/// [`to_f32_slice`]($sus::num::bf16::to_f32_slice).
+///
+/// # Examples
+/// ```
+/// auto h = sus::num::bf16(1.5_f32);
+/// sus_check(h.to_f32() == 1.5_f32);
+/// sus_check(h.to_bits() == 0x3fc0_u16);
+/// ```
+struct [[_sus_trivial_abi]] bf16 final {
+#define _self bf16
+#define _exp_mask 0x7f80u
+#define _man_mask 0x007fu
+#define _from_f32_bits __private::f32_to_bf16_bits
+#define _to_f32_bits __private::bf16_bits_to_f32
+#define _from_f32_slice __private::f32_to_bf16_slice
+#define _to_f32_slice __private::bf16_to_f32_slice
+#include "sus/num/__private/half_float_methods.inc"
+
+ private:
+  enum FromBits { FROM_BITS };
+  constexpr bf16(FromBits, uint16_t bits) noexcept : bits_(bits) {}
+
+  uint16_t bits_ = 0u;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(bits_));
+};
+
+inline constexpr bf16 bf16::MIN = bf16::from_bits(0xff7f_u16);
+inline constexpr bf16 bf16::MAX = bf16::from_bits(0x7f7f_u16);
+inline constexpr bf16 bf16::EPSILON = bf16::from_bits(0x3c00_u16);
+inline constexpr bf16 bf16::MIN_POSITIVE = bf16::from_bits(0x0080_u16);
+inline constexpr bf16 bf16::NaN = bf16::from_bits(0x7fc0_u16);
+inline constexpr bf16 bf16::INF = bf16::from_bits(0x7f80_u16);
+inline constexpr bf16 bf16::NEG_INF = bf16::from_bits(0xff80_u16);
+
+}  // namespace sus::num
+
+// fmt support.
+template <class Char>
+struct fmt::formatter<::sus::num::f16, Char> {
+  template <class ParseContext>
+  constexpr auto parse(ParseContext& ctx) {
+    return underlying_.parse(ctx);
+  }
+
+  template <class FormatContext>
+  constexpr auto format(const ::sus::num::f16& t, FormatContext& ctx) const {
+    return underlying_.format(t.to_f32(), ctx);
+  }
+
+ private:
+  formatter<::sus::num::f32, Char> underlying_;
+};
+
+template <class Char>
+struct fmt::formatter<::sus::num::bf16, Char> {
+  template <class ParseContext>
+  constexpr auto parse(ParseContext& ctx) {
+    return underlying_.parse(ctx);
+  }
+
+  template <class FormatContext>
+  constexpr auto format(const ::sus::num::bf16& t, FormatContext& ctx) const {
+    return underlying_.format(t.to_f32(), ctx);
+  }
+
+ private:
+  formatter<::sus::num::f32, Char> underlying_;
+};
@@ -0,0 +1,273 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/num/half_float.h"
+
+#include <bit>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/vec.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+namespace {
+
+using sus::num::bf16;
+using sus::num::f16;
+using sus::num::FpCategory;
+using sus::test::ensure_use;
+
+static_assert(sizeof(f16) == 2u);
+static_assert(sizeof(bf16) == 2u);
+static_assert(std::is_trivially_copyable_v<f16>);
+static_assert(sus::mem::TriviallyRelocatable<f16>);
+static_assert(sus::mem::TriviallyRelocatable<bf16>);
+static_assert(sus::construct::Default<f16>);
+static_assert(sus::iter::Sum<f16>);
+static_assert(sus::iter::Sum<bf16>);
+
+f16 f16_of(float f) { return f16(f32(f)); }
+bf16 bf16_of(float f) { return bf16(f32(f)); }
+
+TEST(f16, Consts) {
+  static_assert(f16::MAX.to_f32() == 65504_f32);
+  static_assert(f16::MIN.to_f32() == -65504_f32);
+  static_assert(f16::EPSILON.to_f32() == 0.0009765625_f32);
+  static_assert(f16::MIN_POSITIVE.to_f32() == 0.00006103515625_f32);
+  static_assert(f16::INF.is_infinite());
+  static_assert(f16::NEG_INF.is_sign_negative());
+  static_assert(f16::NaN.is_nan());
+  static_assert(f16() == f16::from_bits(0_u16));
+}
+
+TEST(f16, FromF32) {
+  EXPECT_EQ(f16_of(1.f).to_bits(), 0x3c00_u16);
+  EXPECT_EQ(f16_of(-2.f).to_bits(), 0xc000_u16);
+  EXPECT_EQ(f16_of(65504.f).to_bits(), 0x7bff_u16);
+  // Halfway between MAX and the next step rounds to even, which is infinity.
+  EXPECT_EQ(f16_of(65519.f).to_bits(), 0x7bff_u16);
+  EXPECT_EQ(f16_of(65520.f).to_bits(), 0x7c00_u16);
+  EXPECT_EQ(f16_of(1e10f).to_bits(), 0x7c00_u16);
+  // Ties round to even: 1 + 2^-11 is halfway between 1 and 1 + 2^-10.
+  EXPECT_EQ(f16_of(1.f + 0x1p-11f).to_bits(), 0x3c00_u16);
+  EXPECT_EQ(f16_of(1.f + 0x3p-11f).to_bits(), 0x3c02_u16);
+  EXPECT_EQ(f16_of(1.f + 0x1p-11f + 0x1p-20f).to_bits(), 0x3c01_u16);
+  // Subnormals.
+  EXPECT_EQ(f16_of(0x1p-24f).to_bits(), 0x0001_u16);
+  EXPECT_EQ(f16_of(0x1p-25f).to_bits(), 0x0000_u16);
+  EXPECT_EQ(f16_of(0x1.8p-25f).to_bits(), 0x0001_u16);
+  EXPECT_EQ(f16_of(0x3p-25f).to_bits(), 0x0002_u16);
+  EXPECT_EQ(f16_of(-0x1p-30f).to_bits(), 0x8000_u16);
+  // Rounding the largest subnormal up gives the smallest normal.
+  EXPECT_EQ(f16_of(0x1.fffp-15f).to_bits(), 0x0400_u16);
+  // Special values.
+  EXPECT_EQ(f16(f32::INF).to_bits(), 0x7c00_u16);
+  EXPECT_EQ(f16(f32::NEG_INF).to_bits(), 0xfc00_u16);
+  EXPECT_TRUE(f16(f32::NaN).is_nan());
+  EXPECT_EQ(f16_of(-0.f).to_bits(), 0x8000_u16);
+}
+
+TEST(f16, RoundTrip) {
+  // Every f16 converts to f32 exactly and back to itself.
+  for (u32 i; i <= 0xffffu; i += 1u) {
+    const auto h = f16::from_bits(u16::try_from(i).unwrap());
+    const f16 back = f16(h.to_f32());
+    if (h.is_nan()) {
+      EXPECT_TRUE(back.is_nan());
+      EXPECT_EQ(back.is_sign_negative(), h.is_sign_negative());
+    } else {
+      EXPECT_EQ(back.to_bits(), h.to_bits());
+    }
+  }
+}
+
+TEST(f16, Classify) {
+  EXPECT_EQ(f16_of(1.f).classify(), FpCategory::Normal);
+  EXPECT_EQ(f16_of(0.f).classify(), FpCategory::Zero);
+  EXPECT_EQ(f16::from_bits(1_u16).classify(), FpCategory::Subnormal);
+  EXPECT_EQ(f16::INF.classify(), FpCategory::Infinite);
+  EXPECT_EQ(f16::NaN.classify(), FpCategory::Nan);
+  EXPECT_TRUE(f16::from_bits(1_u16).is_subnormal());
+  EXPECT_TRUE(f16::MIN_POSITIVE.is_normal());
+  EXPECT_TRUE(f16::MAX.is_finite());
+  EXPECT_FALSE(f16::INF.is_finite());
+  EXPECT_FALSE(f16::NaN.is_infinite());
+}
+
+TEST(f16, Arithmetic) {
+  EXPECT_EQ(f16_of(1.5f) + f16_of(2.25f), f16_of(3.75f));
+  EXPECT_EQ(f16_of(1.5f) - f16_of(2.25f), f16_of(-0.75f));
+  EXPECT_EQ(f16_of(1.5f) * f16_of(2.f), f16_of(3.f));
+  EXPECT_EQ(f16_of(3.f) / f16_of(2.f), f16_of(1.5f));
+  EXPECT_EQ(-f16_of(3.f), f16_of(-3.f));
+  // Overflows to infinity.
+  EXPECT_EQ(f16::MAX * f16_of(2.f), f16::INF);
+  auto h = f16_of(1.f);
+  h += f16_of(1.f);
+  h *= f16_of(3.f);
+  EXPECT_EQ(h, f16_of(6.f));
+}
+
+TEST(f16, Cmp) {
+  EXPECT_EQ(f16_of(0.f), f16_of(-0.f));
+  EXPECT_NE(f16::NaN, f16::NaN);
+  EXPECT_LT(f16_of(1.f), f16_of(2.f));
+  EXPECT_EQ(f16::NaN <=> f16_of(1.f), std::partial_ordering::unordered);
+
+  EXPECT_EQ(f16_of(-0.f).total_cmp(f16_of(0.f)), std::weak_ordering::less);
+  EXPECT_EQ(f16::INF.total_cmp(f16::NaN), std::weak_ordering::less);
+  EXPECT_EQ((-f16::NaN).total_cmp(f16::NEG_INF), std::weak_ordering::less);
+  EXPECT_EQ(f16_of(-2.f).total_cmp(f16_of(-1.f)), std::weak_ordering::less);
+  EXPECT_EQ(f16_of(2.f).total_cmp(f16_of(2.f)),
+            std::weak_ordering::equivalent);
+}
+
+TEST(f16, Sort) {
+  auto v = sus::Vec<f16>();
+  v.push(f16_of(3.f));
+  v.push(f16::NaN);
+  v.push(f16_of(-1.f));
+  v.push(f16::NEG_INF);
+  v.push(f16_of(0.f));
+  v.push(f16_of(-0.f));
+  v.sort_unstable_by(
+      [](const f16& a, const f16& b) { return a.total_cmp(b); });
+  EXPECT_EQ(v[0u], f16::NEG_INF);
+  EXPECT_EQ(v[1u], f16_of(-1.f));
+  EXPECT_EQ(v[2u].to_bits(), 0x8000_u16);
+  EXPECT_EQ(v[3u].to_bits(), 0x0000_u16);
+  EXPECT_EQ(v[4u], f16_of(3.f));
+  EXPECT_TRUE(v[5u].is_nan());
+}
+
+TEST(f16, Sum) {
+  // 2048 + 1 rounds back to 2048 in f16, so summing in f16 would get stuck.
+  auto v = sus::Vec<f16>();
+  v.push(f16_of(2048.f));
+  for (usize i; i < 16u; i += 1u) v.push(f16_of(1.f));
+  EXPECT_EQ(sus::move(v).into_iter().sum(), f16_of(2064.f));
+}
+
+TEST(f16, Slices) {
+  auto src = sus::Vec<f32>();
+  src.push(f32::INF);
+  src.push(f32::NaN);
+  src.push(0x1p-24_f32);
+  src.push(1e10_f32);
+  for (usize i; i < 37u; i += 1u)
+    src.push(f32(static_cast<float>(size_t{i})) * 0.3_f32 - 5_f32);
+
+  auto halves = sus::Vec<f16>::with_capacity(src.len());
+  for (usize i; i < src.len(); i += 1u) halves.push(f16());
+  f16::from_f32_slice(src.as_slice(), halves.as_mut_slice());
+  auto back = sus::Vec<f32>::with_capacity(src.len());
+  for (usize i; i < src.len(); i += 1u) back.push(0_f32);
+  f16::to_f32_slice(halves.as_slice(), back.as_mut_slice());
+
+  for (usize i; i < src.len(); i += 1u) {
+    const f16 scalar = f16(src[i]);
+    if (scalar.is_nan()) {
+      EXPECT_TRUE(halves[i].is_nan());
+      EXPECT_TRUE(back[i].is_nan());
+    } else {
+      EXPECT_EQ(halves[i].to_bits(), scalar.to_bits());
+      EXPECT_EQ(back[i], scalar.to_f32());
+    }
+  }
+}
+
+TEST(f16, SignalingNaN) {
+  // A signaling NaN becomes quiet and keeps its payload, both in the scalar
+  // conversion and in every lane of a slice conversion, which uses vector
+  // instructions for whole blocks where they are available.
+  const f16 snan = f16::from_bits(0x7d01_u16);
+  EXPECT_EQ(snan.to_f32().to_bits(), 0x7fe02000_u32);
+  EXPECT_EQ((-snan).to_f32().to_bits(), 0xffe02000_u32);
+
+  auto halves = sus::Vec<f16>();
+  for (usize i; i < 37u; i += 1u) halves.push(i % 2u == 0u ? snan : -snan);
+  auto back = sus::Vec<f32>::with_capacity(halves.len());
+  for (usize i; i < halves.len(); i += 1u) back.push(0_f32);
+  f16::to_f32_slice(halves.as_slice(), back.as_mut_slice());
+  for (usize i; i < halves.len(); i += 1u)
+    EXPECT_EQ(back[i].to_bits(), halves[i].to_f32().to_bits());
+}
+
+TEST(f16, fmt) {
+  EXPECT_EQ(fmt::format("{}", f16_of(1.5f)), "1.5");
+  EXPECT_EQ(fmt::format("{:.2f}", f16_of(-0.25f)), "-0.25");
+}
+
+TEST(f16DeathTest, SliceLengths) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto src = sus::Vec<f32>();
+        src.push(1_f32);
+        auto dst = sus::Vec<f16>();
+        f16::from_f32_slice(src.as_slice(), dst.as_mut_slice());
+        ensure_use(&dst);
+      },
+      "");
+#endif
+}
+
+TEST(bf16, Consts) {
+  EXPECT_EQ(bf16::MAX.to_f32(), f32::from_bits(0x7f7f0000_u32));
+  static_assert(bf16::MIN.to_f32() == -bf16::MAX.to_f32());
+  static_assert(bf16::EPSILON.to_f32() == 0.0078125_f32);
+  static_assert(bf16::MIN_POSITIVE.to_f32() == f32::MIN_POSITIVE);
+  static_assert(bf16::INF.is_infinite());
+  static_assert(bf16::NaN.is_nan());
+}
+
+TEST(bf16, FromF32) {
+  EXPECT_EQ(bf16_of(1.f).to_bits(), 0x3f80_u16);
+  EXPECT_EQ(bf16_of(-2.f).to_bits(), 0xc000_u16);
+  // Ties round to even.
+  EXPECT_EQ(bf16_of(1.f + 0x1p-8f).to_bits(), 0x3f80_u16);
+  EXPECT_EQ(bf16_of(1.f + 0x3p-8f).to_bits(), 0x3f82_u16);
+  EXPECT_EQ(bf16_of(1.f + 0x1p-8f + 0x1p-20f).to_bits(), 0x3f81_u16);
+  // Rounding f32::MAX up overflows to infinity.
+  EXPECT_EQ(bf16(f32::MAX).to_bits(), 0x7f80_u16);
+  EXPECT_EQ(bf16(f32::NEG_INF).to_bits(), 0xff80_u16);
+  // A NaN with only low payload bits set stays NaN.
+  EXPECT_TRUE(bf16(f32::from_bits(0x7f800001_u32)).is_nan());
+  EXPECT_EQ(bf16::from_bits(1_u16).classify(), FpCategory::Subnormal);
+}
+
+TEST(bf16, Slices) {
+  auto src = sus::Vec<f32>();
+  for (usize i; i < 21u; i += 1u)
+    src.push(f32(static_cast<float>(size_t{i})) * 1.7_f32 - 9_f32);
+  auto halves = sus::Vec<bf16>();
+  for (usize i; i < src.len(); i += 1u) halves.push(bf16());
+  bf16::from_f32_slice(src.as_slice(), halves.as_mut_slice());
+  auto back = sus::Vec<f32>();
+  for (usize i; i < src.len(); i += 1u) back.push(0_f32);
+  bf16::to_f32_slice(halves.as_slice(), back.as_mut_slice());
+  for (usize i; i < src.len(); i += 1u) {
+    EXPECT_EQ(halves[i].to_bits(), bf16(src[i]).to_bits());
+    EXPECT_EQ(back[i], bf16(src[i]).to_f32());
+  }
+}
+
+TEST(bf16, Sum) {
+  auto v = sus::Vec<bf16>();
+  v.push(bf16_of(256.f));
+  for (usize i; i < 8u; i += 1u) v.push(bf16_of(1.f));
+  EXPECT_EQ(sus::move(v).into_iter().sum(), bf16_of(264.f));
+}
+
+}  // namespace
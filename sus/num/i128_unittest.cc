@@ -0,0 +1,163 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <type_traits>
+#include <unordered_set>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/array.h"
+#include "sus/num/signed_integer.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/prelude.h"
+#include "sus/tuple/tuple.h"
+
+#if defined(__SIZEOF_INT128__)
+
+namespace {
+
+using sus::Tuple;
+
+static_assert(sizeof(i128) == 16);
+static_assert(sizeof(i128) == sizeof(decltype(i128::primitive_value)));
+
+static_assert(sus::num::Signed<i128>);
+static_assert(sus::num::IntegerNumeric<i128>);
+static_assert(sus::mem::Copy<i128>);
+static_assert(sus::mem::TrivialCopy<i128>);
+static_assert(sus::mem::Clone<i128>);
+static_assert(sus::mem::TriviallyRelocatable<i128>);
+static_assert(sus::mem::Move<i128>);
+static_assert(sus::construct::Default<i128>);
+
+TEST(i128, Constants) {
+  static_assert(i128::BITS == 128u);
+  static_assert(i128::MAX == i128::try_from(u128::MAX >> 1u).unwrap());
+  static_assert(i128::MIN == -i128::MAX - 1_i128);
+  static_assert(i128::MIN < i128::from(i64::MIN));
+  static_assert(i128::MAX_CHARS == 40u);
+}
+
+TEST(i128, Arithmetic) {
+  constexpr auto big = i128::from(i64::MAX) + 1_i128;
+  static_assert(big * big / big == big);
+  static_assert(-big * big == i128::MIN >> 1u);
+  static_assert(big * -3_i128 % big == 0_i128);
+
+  static_assert(i128::MAX.checked_add(1_i128).is_none());
+  static_assert(i128::MIN.checked_sub(1_i128).is_none());
+  static_assert(i128::MIN.checked_neg().is_none());
+  static_assert(i128::MIN.checked_abs().is_none());
+  static_assert(i128::MIN.checked_div(-1_i128).is_none());
+  static_assert(big.checked_mul(big).unwrap() == (i128::MIN >> 1u).abs());
+  static_assert(big.checked_mul(big * 2_i128).is_none());
+  static_assert((big * -2_i128).checked_mul(big).unwrap() == i128::MIN);
+  static_assert(i128::MAX.wrapping_add(1_i128) == i128::MIN);
+  static_assert(i128::MIN.wrapping_neg() == i128::MIN);
+  static_assert(i128::MAX.saturating_add(1_i128) == i128::MAX);
+  static_assert(i128::MIN.saturating_sub(1_i128) == i128::MIN);
+  static_assert(big.saturating_mul(-big * 2_i128) == i128::MIN);
+  static_assert(i128::MAX.overflowing_add(1_i128) ==
+                Tuple<i128, bool>(i128::MIN, true));
+  static_assert((-7_i128).div_euclid(2_i128) == -4_i128);
+  static_assert((-7_i128).rem_euclid(2_i128) == 1_i128);
+  static_assert((-3_i128).pow(3u) == -27_i128);
+  static_assert(std::same_as<decltype(i128::MIN.unsigned_abs()), u128>);
+  static_assert(i128::MIN.unsigned_abs() == u128::MAX / 2u + 1u);
+  static_assert((-5_i128).signum() == -1_i128);
+}
+
+TEST(i128, Bits) {
+  static_assert((-1_i128).count_ones() == 128u);
+  static_assert((1_i128).leading_zeros() == 127u);
+  static_assert(i128::MIN.trailing_zeros() == 127u);
+  static_assert((1_i128 << 100u).log2() == 100u);
+  static_assert(i128::MAX.log10() == 38u);
+  static_assert((-1_i128 >> 100u) == -1_i128);
+
+  auto r = i128::MIN;
+  EXPECT_EQ(r.trailing_zeros(), 127u);
+  EXPECT_EQ(r.count_ones(), 1u);
+  EXPECT_EQ(r.swap_bytes(), 0x80_i128);
+}
+
+TEST(i128, Bytes) {
+  const auto v = -2_i128;
+  const auto le = v.to_le_bytes();
+  static_assert(std::same_as<decltype(le), const sus::Array<u8, 16>>);
+  EXPECT_EQ(le[0u], 0xfe_u8);
+  EXPECT_EQ(le[15u], 0xff_u8);
+  EXPECT_EQ(i128::from_le_bytes(le), v);
+  EXPECT_EQ(i128::from_be_bytes(v.to_be_bytes()), v);
+}
+
+/// A slice over the characters of a string literal, without the terminating
+/// NUL.
+template <size_t N>
+sus::Slice<u8> chars(const char (&s)[N]) {
+  return sus::Slice<u8>::from_raw_parts(
+      sus::marker::unsafe_fn, reinterpret_cast<const u8*>(s), N - 1u);
+}
+
+TEST(i128, FromStrRadix) {
+  using E = sus::num::ParseIntError;
+  EXPECT_EQ(i128::from_str_radix(
+                chars("-170141183460469231731687303715884105728"), 10u)
+                .unwrap(),
+            i128::MIN);
+  EXPECT_EQ(i128::from_str_radix(
+                chars("170141183460469231731687303715884105727"), 10u)
+                .unwrap(),
+            i128::MAX);
+  EXPECT_EQ(i128::from_str_radix(
+                chars("170141183460469231731687303715884105728"), 10u)
+                .unwrap_err(),
+            E::with_pos_overflow());
+  EXPECT_EQ(i128::from_str_radix(
+                chars("-170141183460469231731687303715884105729"), 10u)
+                .unwrap_err(),
+            E::with_neg_overflow());
+  EXPECT_EQ(i128::from_str_radix(chars("-ff"), 16u).unwrap(), -255_i128);
+}
+
+TEST(i128, ToChars) {
+  auto buf = sus::Array<u8, i128::MAX_CHARS>();
+  for (i128 v = -1; v > i128::MIN / 7_i128; v = v * 7_i128 - 3_i128) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    EXPECT_EQ(
+        i128::from_str(buf.as_slice()[sus::ops::range(0_usize, n)]).unwrap(),
+        v);
+  }
+  usize n = i128::MIN.to_chars(buf.as_mut_slice()).unwrap();
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(buf.as_ptr()), n),
+            "-170141183460469231731687303715884105728");
+}
+
+TEST(i128, fmt) {
+  static_assert(fmt::is_formattable<i128, char>::value);
+  EXPECT_EQ(fmt::format("{}", i128::MIN),
+            "-170141183460469231731687303715884105728");
+  EXPECT_EQ(fmt::format("{}", -12_i128), "-12");
+}
+
+TEST(i128, Hash) {
+  auto set = std::unordered_set<i128>();
+  set.insert(-1_i128);
+  set.insert(i128::MIN);
+  set.insert(-1_i128);
+  EXPECT_EQ(set.size(), 2u);
+}
+
+}  // namespace
+
+#endif
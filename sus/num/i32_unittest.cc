@@ -2976,4 +2976,78 @@ static_assert([] {
   return v.as_mut_ptr() == &v.primitive_value;
 }());
 
+/// A slice over the characters of a string literal, without the terminating
+/// NUL.
+template <size_t N>
+sus::Slice<u8> chars(const char (&s)[N]) {
+  return sus::Slice<u8>::from_raw_parts(
+      sus::marker::unsafe_fn, reinterpret_cast<const u8*>(s), N - 1u);
+}
+
+TEST(i32, FromStrRadix) {
+  using E = sus::num::ParseIntError;
+  EXPECT_EQ(i32::from_str_radix(chars("0"), 10u).unwrap(), 0_i32);
+  EXPECT_EQ(i32::from_str_radix(chars("-0"), 10u).unwrap(), 0_i32);
+  EXPECT_EQ(i32::from_str_radix(chars("+42"), 10u).unwrap(), 42_i32);
+  EXPECT_EQ(i32::from_str_radix(chars("-42"), 10u).unwrap(), -42_i32);
+  EXPECT_EQ(i32::from_str_radix(chars("2147483647"), 10u).unwrap(), i32::MAX);
+  EXPECT_EQ(i32::from_str_radix(chars("-2147483648"), 10u).unwrap(), i32::MIN);
+  EXPECT_EQ(i32::from_str_radix(chars("-00000000012345678"), 10u).unwrap(),
+            -12345678_i32);
+  EXPECT_EQ(i32::from_str_radix(chars("-7fffffff"), 16u).unwrap(),
+            -0x7fffffff_i32);
+  EXPECT_EQ(i32::from_str_radix(chars("-80000000"), 16u).unwrap(), i32::MIN);
+
+  EXPECT_EQ(i32::from_str_radix(chars(""), 10u).unwrap_err(), E::with_empty());
+  EXPECT_EQ(i32::from_str_radix(chars("-"), 10u).unwrap_err(),
+            E::with_invalid_digit());
+  EXPECT_EQ(i32::from_str_radix(chars("+-1"), 10u).unwrap_err(),
+            E::with_invalid_digit());
+  EXPECT_EQ(i32::from_str_radix(chars("--1"), 10u).unwrap_err(),
+            E::with_invalid_digit());
+  EXPECT_EQ(i32::from_str_radix(chars("1-"), 10u).unwrap_err(),
+            E::with_invalid_digit());
+  EXPECT_EQ(i32::from_str_radix(chars("2147483648"), 10u).unwrap_err(),
+            E::with_pos_overflow());
+  EXPECT_EQ(i32::from_str_radix(chars("-2147483649"), 10u).unwrap_err(),
+            E::with_neg_overflow());
+  EXPECT_EQ(i32::from_str_radix(chars("-99999999999999999"), 10u).unwrap_err(),
+            E::with_neg_overflow());
+}
+
+TEST(i32, FromStr) {
+  EXPECT_EQ(i32::from_str(chars("-987654321")).unwrap(), -987654321_i32);
+  EXPECT_EQ(i32::from_str(chars("1e3")).unwrap_err(),
+            sus::num::ParseIntError::with_invalid_digit());
+}
+
+TEST(i32, ToChars) {
+  auto buf = sus::Array<u8, i32::MAX_CHARS>();
+  auto to_string = [&](i32 v) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    return std::string(reinterpret_cast<const char*>(buf.as_ptr()), n);
+  };
+  EXPECT_EQ(to_string(0_i32), "0");
+  EXPECT_EQ(to_string(-1_i32), "-1");
+  EXPECT_EQ(to_string(99_i32), "99");
+  EXPECT_EQ(to_string(-100_i32), "-100");
+  EXPECT_EQ(to_string(i32::MAX), "2147483647");
+  EXPECT_EQ(to_string(i32::MIN), "-2147483648");
+  static_assert(i32::MAX_CHARS == 11u);
+
+  // The sign needs space too.
+  auto small = sus::Array<u8, 3>();
+  EXPECT_EQ((-100_i32).to_chars(small.as_mut_slice()), sus::none());
+  EXPECT_EQ((-10_i32).to_chars(small.as_mut_slice()), sus::some(3u));
+  EXPECT_EQ((100_i32).to_chars(small.as_mut_slice()), sus::some(3u));
+
+  // Alternating signs and shrinking magnitudes, from MIN until 1.
+  for (i32 v = i32::MIN; v != 1_i32; v = v / 3 * -2 + 1) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    EXPECT_EQ(i32::from_str(buf.as_slice()[sus::ops::range(0_usize, n)])
+                  .unwrap(),
+              v);
+  }
+}
+
 }  // namespace
@@ -763,4 +763,43 @@ TEST(i64, fmt) {
   EXPECT_EQ(fmt::format("{:+#x}", 123456789_i64), "+0x75bcd15");
 }
 
+/// A slice over the characters of a string literal, without the terminating
+/// NUL.
+template <size_t N>
+sus::Slice<u8> chars(const char (&s)[N]) {
+  return sus::Slice<u8>::from_raw_parts(
+      sus::marker::unsafe_fn, reinterpret_cast<const u8*>(s), N - 1u);
+}
+
+TEST(i64, FromStrRadix) {
+  using E = sus::num::ParseIntError;
+  EXPECT_EQ(i64::from_str_radix(chars("9223372036854775807"), 10u).unwrap(),
+            i64::MAX);
+  EXPECT_EQ(i64::from_str_radix(chars("-9223372036854775808"), 10u).unwrap(),
+            i64::MIN);
+  EXPECT_EQ(i64::from_str_radix(chars("9223372036854775808"), 10u).unwrap_err(),
+            E::with_pos_overflow());
+  EXPECT_EQ(
+      i64::from_str_radix(chars("-9223372036854775809"), 10u).unwrap_err(),
+      E::with_neg_overflow());
+  EXPECT_EQ(
+      i64::from_str_radix(chars("-99999999999999999999999999"), 10u)
+          .unwrap_err(),
+      E::with_neg_overflow());
+  EXPECT_EQ(i64::from_str_radix(chars("-1y2p0ij32e8e8"), 36u).unwrap(),
+            i64::MIN);
+}
+
+TEST(i64, ToChars) {
+  auto buf = sus::Array<u8, i64::MAX_CHARS>();
+  static_assert(i64::MAX_CHARS == 20u);
+  auto to_string = [&](i64 v) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    return std::string(reinterpret_cast<const char*>(buf.as_ptr()), n);
+  };
+  EXPECT_EQ(to_string(i64::MAX), "9223372036854775807");
+  EXPECT_EQ(to_string(i64::MIN), "-9223372036854775808");
+  EXPECT_EQ(to_string(-1234567890123_i64), "-1234567890123");
+}
+
 }  // namespace
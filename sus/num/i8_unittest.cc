@@ -742,4 +742,38 @@ TEST(i8, fmt) {
   EXPECT_EQ(fmt::format("{:+#x}", 123_i8), "+0x7b");
 }
 
+/// A slice over the characters of a string literal, without the terminating
+/// NUL.
+template <size_t N>
+sus::Slice<u8> chars(const char (&s)[N]) {
+  return sus::Slice<u8>::from_raw_parts(
+      sus::marker::unsafe_fn, reinterpret_cast<const u8*>(s), N - 1u);
+}
+
+TEST(i8, FromStrRadix) {
+  using E = sus::num::ParseIntError;
+  EXPECT_EQ(i8::from_str_radix(chars("127"), 10u).unwrap(), i8::MAX);
+  EXPECT_EQ(i8::from_str_radix(chars("-128"), 10u).unwrap(), i8::MIN);
+  EXPECT_EQ(i8::from_str_radix(chars("-1111111"), 2u).unwrap(), -127_i8);
+  EXPECT_EQ(i8::from_str_radix(chars("128"), 10u).unwrap_err(),
+            E::with_pos_overflow());
+  EXPECT_EQ(i8::from_str_radix(chars("-129"), 10u).unwrap_err(),
+            E::with_neg_overflow());
+  // Digits past the 8-digit path overflow too.
+  EXPECT_EQ(i8::from_str_radix(chars("100000000"), 10u).unwrap_err(),
+            E::with_pos_overflow());
+}
+
+TEST(i8, ToChars) {
+  auto buf = sus::Array<u8, i8::MAX_CHARS>();
+  static_assert(i8::MAX_CHARS == 4u);
+  for (i8 v = i8::MIN;; v += 1_i8) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    EXPECT_EQ(i8::from_str(buf.as_slice()[sus::ops::range(0_usize, n)])
+                  .unwrap(),
+              v);
+    if (v == i8::MAX) break;
+  }
+}
+
 }  // namespace
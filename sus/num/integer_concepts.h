@@ -27,13 +27,20 @@ namespace sus::num {
 /// Unsigned Subspace numeric integer types. All of [`Unsigned`](
 /// $sus::num::Unsigned) but excluding [`uptr`]($sus::num::uptr).
 ///
+/// This includes [`u128`]($sus::num::u128) where the compiler provides a
+/// 128-bit integer type.
+///
 /// The [`uptr`]($sus::num::uptr) type is an integer but has a different API
 /// that restricts how its used compared to other integer types. This can be
 /// used to exclude it when it does not fit with a use case.
 template <class T>
 concept UnsignedNumeric =
     std::same_as<u8, T> || std::same_as<u16, T> || std::same_as<u32, T> ||
-    std::same_as<u64, T> || std::same_as<usize, T>;
+    std::same_as<u64, T> || std::same_as<usize, T>
+#if defined(__SIZEOF_INT128__)
+    || std::same_as<u128, T>
+#endif
+    ;
 
 /// Unsigned Subspace pointer integer types. This is the rest of [`Unsigned`](
 /// $sus::num::Unsigned) that is not included in [`UnsignedNumeric`](
@@ -53,11 +60,16 @@ concept Unsigned = UnsignedNumeric<T> || UnsignedPointer<T>;
 
 /// Signed Subspace integer types: [`i8`]($sus::num::i8),
 /// [`i16`]($sus::num::i16), [`i32`]($sus::num::i32), [`i64`]($sus::num::i64),
-/// and [`isize`]($sus::num::isize).
+/// and [`isize`]($sus::num::isize), along with [`i128`]($sus::num::i128)
+/// where the compiler provides a 128-bit integer type.
 template <class T>
 concept Signed =
     std::same_as<i8, T> || std::same_as<i16, T> || std::same_as<i32, T> ||
-    std::same_as<i64, T> || std::same_as<isize, T>;
+    std::same_as<i64, T> || std::same_as<isize, T>
+#if defined(__SIZEOF_INT128__)
+    || std::same_as<i128, T>
+#endif
+    ;
 
 /// All Subspace numeric integer types. This includes all safe integer types
 /// except [`uptr`]($sus::num::uptr) which represents pointers. See
@@ -92,14 +104,22 @@ concept UnsignedPrimitiveInteger =
 #endif
     std::same_as<unsigned char, T> || std::same_as<unsigned short, T> ||
     std::same_as<unsigned int, T> || std::same_as<unsigned long, T> ||
-    std::same_as<unsigned long long, T>;
+    std::same_as<unsigned long long, T>
+#if defined(__SIZEOF_INT128__)
+    || std::same_as<unsigned __int128, T>
+#endif
+    ;
 
 /// Signed primitive integer types (`signed char`, `int`, `long`, etc).
 template <class T>
 concept SignedPrimitiveInteger =
     (!std::is_unsigned_v<char> && std::same_as<char, T>) ||
     std::same_as<signed char, T> || std::same_as<short, T> ||
-    std::same_as<int, T> || std::same_as<long, T> || std::same_as<long long, T>;
+    std::same_as<int, T> || std::same_as<long, T> || std::same_as<long long, T>
+#if defined(__SIZEOF_INT128__)
+    || std::same_as<__int128, T>
+#endif
+    ;
 
 /// Signed or unsigned primitive integer types (`char`, `int`, `unsigned int`,
 /// `unsigned long`, etc).
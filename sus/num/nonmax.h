@@ -0,0 +1,245 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <type_traits>
+
+#include "fmt/core.h"
+#include "sus/assertions/check.h"
+#include "sus/assertions/unreachable.h"
+#include "sus/macros/pure.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/move.h"
+#include "sus/mem/never_value.h"
+#include "sus/mem/relocate.h"
+#include "sus/num/integer_concepts.h"
+#include "sus/num/signed_integer.h"
+#include "sus/num/try_from_int_error.h"
+#include "sus/num/types.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/option/option.h"
+#include "sus/result/result.h"
+#include "sus/string/__private/format_to_stream.h"
+
+namespace sus::num {
+
+/// An integer that is known not to equal `T::MAX`.
+///
+/// `NonMax` satisfies [`NeverValueField`]($sus::mem::NeverValueField), so
+/// [`Option<NonMax<T>>`]($sus::option::Option) has the same size as `T`, with
+/// `T::MAX` used to represent `None`. This suits indices and offsets where
+/// zero is a valid value, such as a sparse table of indices into another
+/// collection stored as `Vec<Option<NonMax<u32>>>`, which uses half the memory
+/// of `Vec<Option<u32>>`.
+///
+/// Arithmetic that can not produce `T::MAX` returns a `NonMax`, such as
+/// dividing, taking the remainder of, or masking an unsigned `NonMax`. Other
+/// arithmetic returns an `Option<NonMax>`, such as
+/// [`checked_add`]($sus::num::NonMax::checked_add).
+///
+/// A `NonMax` converts implicitly to `T`, but constructing one from a `T` must
+/// check the value, or be done with
+/// [`from_unchecked`]($sus::num::NonMax::from_unchecked).
+///
+/// # Examples
+/// ```
+/// static_assert(sizeof(sus::Option<sus::num::NonMax<u32>>) == sizeof(u32));
+///
+/// auto slots = sus::Vec<sus::Option<sus::num::NonMax<u32>>>();
+/// slots.push(sus::some(sus::num::NonMax<u32>(0u)));
+/// slots.push(sus::none());
+/// sus_check(slots[0u].as_value() == 0u);
+/// ```
+template <class T>
+class [[_sus_trivial_abi]] NonMax {
+  static_assert(IntegerNumeric<T>);
+
+ public:
+  /// Default-constructs a `NonMax` with the value `0`.
+  constexpr NonMax() noexcept : v_() {}
+
+  /// Constructs a `NonMax` from a value of the integer type.
+  ///
+  /// # Panics
+  /// Panics if `v` is `T::MAX`.
+  explicit constexpr NonMax(T v) noexcept : v_(v) {
+    sus_check_with_message(v != T::MAX, "NonMax value is the maximum");
+  }
+
+  /// Constructs a `NonMax` from a value of the integer type, without checking
+  /// that it is not `T::MAX`.
+  ///
+  /// # Safety
+  /// The value `v` must not be `T::MAX`, or Undefined Behaviour will result,
+  /// as code that uses the `NonMax` may rely on it, including `Option` which
+  /// would see the value as `None`.
+  _sus_pure static constexpr NonMax from_unchecked(
+      ::sus::marker::UnsafeFnMarker, T v) noexcept {
+    return NonMax(FROM_UNCHECKED, v);
+  }
+
+  /// Constructs a `NonMax` from a value of the integer type, returning an
+  /// error if it is `T::MAX`.
+  ///
+  /// Satisfies the [`TryFrom<NonMax<T>, T>`]($sus::construct::TryFrom)
+  /// concept.
+  _sus_pure static constexpr ::sus::result::Result<NonMax, TryFromIntError>
+  try_from(T v) noexcept {
+    using R = ::sus::result::Result<NonMax, TryFromIntError>;
+    if (v == T::MAX) [[unlikely]]
+      return R::with_err(TryFromIntError::with_out_of_bounds());
+    return R(NonMax(FROM_UNCHECKED, v));
+  }
+
+  /// Returns the value as the integer type.
+  _sus_pure constexpr T get() const noexcept {
+    if (!std::is_constant_evaluated()) {
+      // SAFETY: The value is not `T::MAX` by construction, which tells the
+      // compiler it can drop overflow checks when adding one to it.
+      if (v_ == T::MAX) ::sus::unreachable_unchecked(::sus::marker::unsafe_fn);
+    }
+    return v_;
+  }
+
+  /// Converts to the integer type.
+  _sus_pure constexpr operator T() const noexcept { return get(); }
+
+  /// Adds `r` to the value, returning `None` if it overflows or produces
+  /// `T::MAX`.
+  _sus_pure constexpr ::sus::option::Option<NonMax> checked_add(
+      T r) const noexcept {
+    return wrap(get().checked_add(r));
+  }
+  /// Subtracts `r` from the value, returning `None` if it overflows or
+  /// produces `T::MAX`.
+  _sus_pure constexpr ::sus::option::Option<NonMax> checked_sub(
+      T r) const noexcept {
+    return wrap(get().checked_sub(r));
+  }
+  /// Multiplies the value by `r`, returning `None` if it overflows or
+  /// produces `T::MAX`.
+  _sus_pure constexpr ::sus::option::Option<NonMax> checked_mul(
+      T r) const noexcept {
+    return wrap(get().checked_mul(r));
+  }
+  /// Subtracts an unsigned integer from the value, saturating at zero. The
+  /// result is no larger than the value so can not be `T::MAX`.
+  _sus_pure constexpr NonMax saturating_sub(T r) const noexcept
+    requires(Unsigned<T>)
+  {
+    return NonMax(FROM_UNCHECKED, get().saturating_sub(r));
+  }
+
+  /// Divides an unsigned `NonMax` by an integer. The result is no larger than
+  /// the value so can not be `T::MAX`.
+  ///
+  /// # Panics
+  /// Panics if `r` is zero.
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr NonMax operator/(NonMax l, U r) noexcept
+    requires(Unsigned<T>)
+  {
+    return NonMax(FROM_UNCHECKED, l.get() / T(r));
+  }
+  /// Computes the remainder of dividing an unsigned `NonMax` by an integer.
+  /// The result is less than `r` so can not be `T::MAX`.
+  ///
+  /// # Panics
+  /// Panics if `r` is zero.
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr NonMax operator%(NonMax l, U r) noexcept
+    requires(Unsigned<T>)
+  {
+    return NonMax(FROM_UNCHECKED, l.get() % T(r));
+  }
+  /// Bitwise and of an unsigned `NonMax` with an integer. The result is no
+  /// larger than the value so can not be `T::MAX`.
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr NonMax operator&(NonMax l, U r) noexcept
+    requires(Unsigned<T>)
+  {
+    return NonMax(FROM_UNCHECKED, l.get() & T(r));
+  }
+
+  /// #[doc.overloads=nonmax.eq]
+  _sus_pure friend constexpr bool operator==(NonMax l, NonMax r) noexcept {
+    return l.get() == r.get();
+  }
+  /// #[doc.overloads=nonmax.eq]
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr bool operator==(NonMax l, U r) noexcept {
+    return l.get() == T(r);
+  }
+  /// #[doc.overloads=nonmax.ord]
+  _sus_pure friend constexpr std::strong_ordering operator<=>(
+      NonMax l, NonMax r) noexcept {
+    return l.get() <=> r.get();
+  }
+  /// #[doc.overloads=nonmax.ord]
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr std::strong_ordering operator<=>(NonMax l,
+                                                              U r) noexcept {
+    return l.get() <=> T(r);
+  }
+
+  // Stream support.
+  _sus_format_to_stream(NonMax);
+
+ private:
+  enum FromUnchecked { FROM_UNCHECKED };
+  constexpr NonMax(FromUnchecked, T v) noexcept : v_(v) {}
+
+  __sus_pure_const static constexpr ::sus::option::Option<NonMax> wrap(
+      ::sus::option::Option<T> o) noexcept {
+    if (o.is_none() || o.as_value() == T::MAX)
+      return ::sus::option::Option<NonMax>();
+    return ::sus::option::Option<NonMax>(NonMax(
+        FROM_UNCHECKED,
+        ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn)));
+  }
+
+  T v_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(v_));
+  // Declare that the `v_` field is never set to `T::MAX` for library
+  // optimizations, which gives `Option<NonMax>` the size of `T`.
+  sus_class_never_value_field(::sus::marker::unsafe_fn, NonMax, v_, T::MAX,
+                              T::MAX);
+  // For the NeverValueField.
+  explicit constexpr NonMax(::sus::mem::NeverValueConstructor) noexcept
+      : v_(T::MAX) {}
+};
+
+}  // namespace sus::num
+
+// fmt support.
+template <class T, class Char>
+struct fmt::formatter<::sus::num::NonMax<T>, Char> {
+  template <class ParseContext>
+  constexpr auto parse(ParseContext& ctx) {
+    return underlying_.parse(ctx);
+  }
+
+  template <class FormatContext>
+  constexpr auto format(const ::sus::num::NonMax<T>& t,
+                        FormatContext& ctx) const {
+    return underlying_.format(t.get(), ctx);
+  }
+
+ private:
+  formatter<T, Char> underlying_;
+};
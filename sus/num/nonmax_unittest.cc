@@ -0,0 +1,126 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/num/nonmax.h"
+
+#include <concepts>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/vec.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+namespace {
+
+using sus::num::NonMax;
+using sus::test::ensure_use;
+
+static_assert(sus::mem::NeverValueField<NonMax<u32>>);
+static_assert(sizeof(NonMax<u8>) == sizeof(u8));
+static_assert(sizeof(sus::Option<NonMax<u8>>) == sizeof(u8));
+static_assert(sizeof(sus::Option<NonMax<u16>>) == sizeof(u16));
+static_assert(sizeof(sus::Option<NonMax<u32>>) == sizeof(u32));
+static_assert(sizeof(sus::Option<NonMax<u64>>) == sizeof(u64));
+static_assert(sizeof(sus::Option<NonMax<usize>>) == sizeof(usize));
+static_assert(sizeof(sus::Option<NonMax<i8>>) == sizeof(i8));
+static_assert(sizeof(sus::Option<NonMax<i16>>) == sizeof(i16));
+static_assert(sizeof(sus::Option<NonMax<i32>>) == sizeof(i32));
+static_assert(sizeof(sus::Option<NonMax<i64>>) == sizeof(i64));
+static_assert(sizeof(sus::Option<NonMax<isize>>) == sizeof(isize));
+static_assert(std::is_trivially_copyable_v<NonMax<u32>>);
+static_assert(sus::mem::TriviallyRelocatable<NonMax<u32>>);
+
+TEST(NonMax, Construct) {
+  static_assert(sus::construct::Default<NonMax<u32>>);
+  EXPECT_EQ(NonMax<u32>(), 0u);
+
+  constexpr auto a = NonMax<u32>(7u);
+  static_assert(a.get() == 7u);
+  static_assert(a == 7_u32);
+  u32 u = a;
+  EXPECT_EQ(u, 7u);
+
+  EXPECT_EQ(NonMax<i32>::try_from(i32::MIN).unwrap(), i32::MIN);
+  EXPECT_EQ(NonMax<i32>::try_from(i32::MAX).unwrap_err().kind(),
+            sus::num::TryFromIntError::Kind::OutOfBounds);
+  EXPECT_EQ(NonMax<u8>::from_unchecked(unsafe_fn, 0_u8), 0_u8);
+}
+
+TEST(NonMax, Option) {
+  auto o = sus::Option<NonMax<u32>>();
+  EXPECT_TRUE(o.is_none());
+  o.insert(NonMax<u32>(0u));
+  EXPECT_EQ(o.as_value(), 0u);
+  o = sus::Option<NonMax<u32>>(NonMax<u32>(u32::MAX - 1u));
+  EXPECT_EQ(o.as_value(), u32::MAX - 1u);
+  o.take();
+  EXPECT_TRUE(o.is_none());
+
+  auto v = sus::Vec<sus::Option<NonMax<u32>>>();
+  v.push(sus::Option<NonMax<u32>>(NonMax<u32>(0u)));
+  v.push(sus::Option<NonMax<u32>>());
+  EXPECT_EQ(v[0u].as_value(), 0u);
+  EXPECT_TRUE(v[1u].is_none());
+}
+
+TEST(NonMax, Arithmetic) {
+  constexpr auto a = NonMax<u8>(200_u8);
+  static_assert(a.checked_add(54_u8).unwrap() == 254_u8);
+  // Overflows `T::MAX`, or produces it.
+  static_assert(a.checked_add(56_u8).is_none());
+  static_assert(a.checked_add(55_u8).is_none());
+  static_assert(a.checked_sub(200_u8).unwrap() == 0_u8);
+  static_assert(a.checked_sub(201_u8).is_none());
+  static_assert(a.checked_mul(2_u8).is_none());
+  static_assert(NonMax<u8>(5_u8).checked_mul(50_u8).unwrap() == 250_u8);
+  static_assert(NonMax<i8>(i8::MIN).checked_add(127_i8).unwrap() == -1_i8);
+  static_assert(NonMax<i8>(0_i8).checked_add(127_i8).is_none());
+
+  static_assert(a.saturating_sub(250_u8) == 0_u8);
+  static_assert(std::same_as<decltype(a / 3_u8), NonMax<u8>>);
+  static_assert(a / 3_u8 == 66_u8);
+  static_assert(a % 7_u8 == 4_u8);
+  static_assert((a & 0xf_u8) == 8_u8);
+}
+
+TEST(NonMax, Cmp) {
+  EXPECT_LT(NonMax<i32>(-1), NonMax<i32>(1));
+  EXPECT_GT(NonMax<i32>(1), -1);
+  EXPECT_EQ(NonMax<i32>(1), 1);
+  EXPECT_NE(NonMax<i32>(1), 2);
+}
+
+TEST(NonMax, fmt) {
+  EXPECT_EQ(fmt::format("{}", NonMax<i32>(-4)), "-4");
+  EXPECT_EQ(fmt::format("{:02x}", NonMax<u8>(10_u8)), "0a");
+}
+
+TEST(NonMaxDeathTest, Max) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto n = NonMax<u32>(u32::MAX);
+        ensure_use(&n);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto n = NonMax<u32>(1u) / 0u;
+        ensure_use(&n);
+      },
+      "");
+#endif
+}
+
+}  // namespace
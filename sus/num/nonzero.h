@@ -0,0 +1,326 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <type_traits>
+
+#include "fmt/core.h"
+#include "sus/assertions/check.h"
+#include "sus/assertions/unreachable.h"
+#include "sus/macros/pure.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/move.h"
+#include "sus/mem/never_value.h"
+#include "sus/mem/relocate.h"
+#include "sus/num/integer_concepts.h"
+#include "sus/num/signed_integer.h"
+#include "sus/num/try_from_int_error.h"
+#include "sus/num/types.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/option/option.h"
+#include "sus/result/result.h"
+#include "sus/string/__private/format_to_stream.h"
+
+namespace sus::num {
+
+/// An integer that is known not to equal zero.
+///
+/// `NonZero` satisfies [`NeverValueField`]($sus::mem::NeverValueField), so
+/// [`Option<NonZero<T>>`]($sus::option::Option) has the same size as `T`, with
+/// zero used to represent `None`. For example, a table of optional ids stored
+/// as `Vec<Option<NonZero<u32>>>` uses half the memory of
+/// `Vec<Option<u32>>`.
+///
+/// Arithmetic that can not produce zero returns a `NonZero`, such as adding to
+/// an unsigned `NonZero` with [`checked_add`]($sus::num::NonZero::checked_add)
+/// or [`saturating_add`]($sus::num::NonZero::saturating_add). Dividing an
+/// unsigned integer by a `NonZero` does not need to check for division by zero.
+///
+/// A `NonZero` converts implicitly to `T`, but constructing one from a `T`
+/// must check the value, or be done with
+/// [`from_unchecked`]($sus::num::NonZero::from_unchecked).
+///
+/// # Examples
+/// ```
+/// static_assert(sizeof(sus::Option<sus::num::NonZero<u32>>) == sizeof(u32));
+///
+/// auto id = sus::num::NonZero<u32>(7u);
+/// sus_check(id.checked_add(1u).unwrap() == 8u);
+///
+/// // No check for division by zero.
+/// u32 buckets = 1024_u32 / id;
+/// ```
+template <class T>
+class [[_sus_trivial_abi]] NonZero {
+  static_assert(IntegerNumeric<T>);
+
+ public:
+  /// Constructs a `NonZero` from a value of the integer type.
+  ///
+  /// # Panics
+  /// Panics if `v` is zero.
+  explicit constexpr NonZero(T v) noexcept : v_(v) {
+    sus_check_with_message(v != T(), "NonZero value is zero");
+  }
+
+  /// Constructs a `NonZero` from a value of the integer type, without checking
+  /// that it is not zero.
+  ///
+  /// # Safety
+  /// The value `v` must not be zero, or Undefined Behaviour will result, as
+  /// code that uses the `NonZero` may rely on it, including `Option` which
+  /// would see the value as `None`.
+  _sus_pure static constexpr NonZero from_unchecked(
+      ::sus::marker::UnsafeFnMarker, T v) noexcept {
+    return NonZero(FROM_UNCHECKED, v);
+  }
+
+  /// Constructs a `NonZero` from a value of the integer type, returning an
+  /// error if it is zero.
+  ///
+  /// Satisfies the [`TryFrom<NonZero<T>, T>`]($sus::construct::TryFrom)
+  /// concept.
+  _sus_pure static constexpr ::sus::result::Result<NonZero, TryFromIntError>
+  try_from(T v) noexcept {
+    using R = ::sus::result::Result<NonZero, TryFromIntError>;
+    if (v == T()) [[unlikely]]
+      return R::with_err(TryFromIntError::with_out_of_bounds());
+    return R(NonZero(FROM_UNCHECKED, v));
+  }
+
+  /// Returns the value as the integer type.
+  _sus_pure constexpr T get() const noexcept {
+    if (!std::is_constant_evaluated()) {
+      // SAFETY: The value is not zero by construction, which tells the
+      // compiler it can drop checks for zero in the code that uses it.
+      if (v_ == T()) ::sus::unreachable_unchecked(::sus::marker::unsafe_fn);
+    }
+    return v_;
+  }
+
+  /// Converts to the integer type.
+  _sus_pure constexpr operator T() const noexcept { return get(); }
+
+  /// Returns the number of leading zeros in the binary representation of the
+  /// value.
+  ///
+  /// Unlike for `T`, this does not need to handle a value of zero.
+  _sus_pure constexpr u32 leading_zeros() const noexcept {
+    return get().leading_zeros();
+  }
+  /// Returns the number of trailing zeros in the binary representation of the
+  /// value.
+  ///
+  /// Unlike for `T`, this does not need to handle a value of zero.
+  _sus_pure constexpr u32 trailing_zeros() const noexcept {
+    return get().trailing_zeros();
+  }
+
+  /// Adds an unsigned integer to the value, returning `None` if it overflows.
+  _sus_pure constexpr ::sus::option::Option<NonZero> checked_add(
+      T r) const noexcept
+    requires(Unsigned<T>)
+  {
+    return wrap(get().checked_add(r));
+  }
+  /// Adds an unsigned integer to the value, saturating at `T::MAX`, which
+  /// can not be zero.
+  _sus_pure constexpr NonZero saturating_add(T r) const noexcept
+    requires(Unsigned<T>)
+  {
+    return NonZero(FROM_UNCHECKED, get().saturating_add(r));
+  }
+
+  /// Multiplies two `NonZero` values, returning `None` if it overflows.
+  _sus_pure constexpr ::sus::option::Option<NonZero> checked_mul(
+      NonZero r) const noexcept {
+    return wrap(get().checked_mul(r.get()));
+  }
+  /// Multiplies two `NonZero` values, saturating at the numeric bounds, which
+  /// can not be zero.
+  _sus_pure constexpr NonZero saturating_mul(NonZero r) const noexcept {
+    return NonZero(FROM_UNCHECKED, get().saturating_mul(r.get()));
+  }
+  /// Raises the value to the power of `exp`, returning `None` if it overflows.
+  _sus_pure constexpr ::sus::option::Option<NonZero> checked_pow(
+      u32 exp) const noexcept {
+    return wrap(get().checked_pow(exp));
+  }
+
+  /// Returns whether the value is a power of two.
+  _sus_pure constexpr bool is_power_of_two() const noexcept
+    requires(Unsigned<T>)
+  {
+    return (get() & (get() - T(decltype(T::primitive_value){1}))) == T();
+  }
+  /// Returns the base 2 logarithm of the value, rounded down.
+  ///
+  /// Unlike for `T`, this does not panic.
+  _sus_pure constexpr u32 log2() const noexcept
+    requires(Unsigned<T>)
+  {
+    return T::BITS - 1u - leading_zeros();
+  }
+
+  /// Returns whether the value is negative.
+  _sus_pure constexpr bool is_negative() const noexcept
+    requires(Signed<T>)
+  {
+    return get().is_negative();
+  }
+  /// Returns whether the value is positive.
+  _sus_pure constexpr bool is_positive() const noexcept
+    requires(Signed<T>)
+  {
+    return get().is_positive();
+  }
+  /// Computes the absolute value, returning `None` if the value is `T::MIN`.
+  _sus_pure constexpr ::sus::option::Option<NonZero> checked_abs()
+      const noexcept
+    requires(Signed<T>)
+  {
+    return wrap(get().checked_abs());
+  }
+  /// Computes the absolute value, returning `T::MIN` if the value is
+  /// `T::MIN`.
+  _sus_pure constexpr NonZero wrapping_abs() const noexcept
+    requires(Signed<T>)
+  {
+    return NonZero(FROM_UNCHECKED, get().wrapping_abs());
+  }
+  /// Computes the absolute value, which can not overflow in the unsigned
+  /// type.
+  _sus_pure constexpr auto unsigned_abs() const noexcept
+    requires(Signed<T>)
+  {
+    using U = decltype(std::declval<T>().unsigned_abs());
+    return NonZero<U>::from_unchecked(::sus::marker::unsafe_fn,
+                                      get().unsigned_abs());
+  }
+  /// Negates the value, returning `None` if the value is `T::MIN`.
+  _sus_pure constexpr ::sus::option::Option<NonZero> checked_neg()
+      const noexcept
+    requires(Signed<T>)
+  {
+    return wrap(get().checked_neg());
+  }
+  /// Negates the value, returning `T::MIN` if the value is `T::MIN`.
+  _sus_pure constexpr NonZero wrapping_neg() const noexcept
+    requires(Signed<T>)
+  {
+    return NonZero(FROM_UNCHECKED, get().wrapping_neg());
+  }
+
+  /// Bitwise or with an integer can not produce zero.
+  ///
+  /// #[doc.overloads=nonzero.bitor]
+  _sus_pure friend constexpr NonZero operator|(NonZero l, NonZero r) noexcept {
+    return NonZero(FROM_UNCHECKED, l.get() | r.get());
+  }
+  /// #[doc.overloads=nonzero.bitor]
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr NonZero operator|(NonZero l, U r) noexcept {
+    return NonZero(FROM_UNCHECKED, l.get() | T(r));
+  }
+  /// #[doc.overloads=nonzero.bitor]
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr NonZero operator|(U l, NonZero r) noexcept {
+    return NonZero(FROM_UNCHECKED, T(l) | r.get());
+  }
+
+  /// Divides an unsigned integer by a `NonZero`, which can not panic.
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr T operator/(U l, NonZero r) noexcept
+    requires(Unsigned<T>)
+  {
+    return T(T(l).primitive_value / r.get().primitive_value);
+  }
+  /// Computes the remainder of dividing an unsigned integer by a `NonZero`,
+  /// which can not panic.
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr T operator%(U l, NonZero r) noexcept
+    requires(Unsigned<T>)
+  {
+    return T(T(l).primitive_value % r.get().primitive_value);
+  }
+
+  /// #[doc.overloads=nonzero.eq]
+  _sus_pure friend constexpr bool operator==(NonZero l, NonZero r) noexcept {
+    return l.get() == r.get();
+  }
+  /// #[doc.overloads=nonzero.eq]
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr bool operator==(NonZero l, U r) noexcept {
+    return l.get() == T(r);
+  }
+  /// #[doc.overloads=nonzero.ord]
+  _sus_pure friend constexpr std::strong_ordering operator<=>(
+      NonZero l, NonZero r) noexcept {
+    return l.get() <=> r.get();
+  }
+  /// #[doc.overloads=nonzero.ord]
+  template <std::convertible_to<T> U>
+  _sus_pure friend constexpr std::strong_ordering operator<=>(NonZero l,
+                                                              U r) noexcept {
+    return l.get() <=> T(r);
+  }
+
+  // Stream support.
+  _sus_format_to_stream(NonZero);
+
+ private:
+  enum FromUnchecked { FROM_UNCHECKED };
+  constexpr NonZero(FromUnchecked, T v) noexcept : v_(v) {}
+
+  __sus_pure_const static constexpr ::sus::option::Option<NonZero> wrap(
+      ::sus::option::Option<T> o) noexcept {
+    if (o.is_none()) return ::sus::option::Option<NonZero>();
+    return ::sus::option::Option<NonZero>(NonZero(
+        FROM_UNCHECKED,
+        ::sus::move(o).unwrap_unchecked(::sus::marker::unsafe_fn)));
+  }
+
+  T v_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(v_));
+  // Declare that the `v_` field is never set to zero for library
+  // optimizations, which gives `Option<NonZero>` the size of `T`.
+  sus_class_never_value_field(::sus::marker::unsafe_fn, NonZero, v_, T(), T());
+  // For the NeverValueField.
+  explicit constexpr NonZero(::sus::mem::NeverValueConstructor) noexcept
+      : v_() {}
+};
+
+}  // namespace sus::num
+
+// fmt support.
+template <class T, class Char>
+struct fmt::formatter<::sus::num::NonZero<T>, Char> {
+  template <class ParseContext>
+  constexpr auto parse(ParseContext& ctx) {
+    return underlying_.parse(ctx);
+  }
+
+  template <class FormatContext>
+  constexpr auto format(const ::sus::num::NonZero<T>& t,
+                        FormatContext& ctx) const {
+    return underlying_.format(t.get(), ctx);
+  }
+
+ private:
+  formatter<T, Char> underlying_;
+};
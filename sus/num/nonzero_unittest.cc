@@ -0,0 +1,142 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/num/nonzero.h"
+
+#include <concepts>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/vec.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+namespace {
+
+using sus::num::NonZero;
+using sus::test::ensure_use;
+
+static_assert(sus::mem::NeverValueField<NonZero<u32>>);
+static_assert(sizeof(NonZero<u8>) == sizeof(u8));
+static_assert(sizeof(sus::Option<NonZero<u8>>) == sizeof(u8));
+static_assert(sizeof(sus::Option<NonZero<u16>>) == sizeof(u16));
+static_assert(sizeof(sus::Option<NonZero<u32>>) == sizeof(u32));
+static_assert(sizeof(sus::Option<NonZero<u64>>) == sizeof(u64));
+static_assert(sizeof(sus::Option<NonZero<usize>>) == sizeof(usize));
+static_assert(sizeof(sus::Option<NonZero<i8>>) == sizeof(i8));
+static_assert(sizeof(sus::Option<NonZero<i16>>) == sizeof(i16));
+static_assert(sizeof(sus::Option<NonZero<i32>>) == sizeof(i32));
+static_assert(sizeof(sus::Option<NonZero<i64>>) == sizeof(i64));
+static_assert(sizeof(sus::Option<NonZero<isize>>) == sizeof(isize));
+static_assert(std::is_trivially_copyable_v<NonZero<u32>>);
+static_assert(sus::mem::TriviallyRelocatable<NonZero<u32>>);
+static_assert(!sus::construct::Default<NonZero<u32>>);
+
+TEST(NonZero, Construct) {
+  constexpr auto a = NonZero<u32>(7u);
+  static_assert(a.get() == 7u);
+  static_assert(a == 7_u32);
+  u32 u = a;
+  EXPECT_EQ(u, 7u);
+
+  EXPECT_EQ(NonZero<i32>::try_from(-3).unwrap(), -3_i32);
+  EXPECT_EQ(NonZero<i32>::try_from(0).unwrap_err().kind(),
+            sus::num::TryFromIntError::Kind::OutOfBounds);
+  EXPECT_EQ(NonZero<u8>::from_unchecked(unsafe_fn, 2_u8), 2_u8);
+}
+
+TEST(NonZero, Option) {
+  auto o = sus::Option<NonZero<u32>>();
+  EXPECT_TRUE(o.is_none());
+  o.insert(NonZero<u32>(1u));
+  EXPECT_EQ(o.as_value(), 1u);
+  o = sus::Option<NonZero<u32>>(NonZero<u32>(u32::MAX));
+  EXPECT_EQ(o.as_value(), u32::MAX);
+  o.take();
+  EXPECT_TRUE(o.is_none());
+
+  auto v = sus::Vec<sus::Option<NonZero<i64>>>();
+  v.push(sus::Option<NonZero<i64>>(NonZero<i64>(-1_i64)));
+  v.push(sus::Option<NonZero<i64>>());
+  EXPECT_EQ(v[0u].as_value(), -1_i64);
+  EXPECT_TRUE(v[1u].is_none());
+}
+
+TEST(NonZero, Arithmetic) {
+  constexpr auto a = NonZero<u8>(200_u8);
+  static_assert(a.checked_add(55_u8).unwrap() == 255_u8);
+  static_assert(a.checked_add(56_u8).is_none());
+  static_assert(a.saturating_add(100_u8) == 255_u8);
+  static_assert(a.checked_mul(NonZero<u8>(2_u8)).is_none());
+  static_assert(a.saturating_mul(NonZero<u8>(2_u8)) == 255_u8);
+  static_assert(NonZero<u8>(3_u8).checked_pow(5u).unwrap() == 243_u8);
+  static_assert(NonZero<u8>(3_u8).checked_pow(6u).is_none());
+
+  static_assert((a | 1_u8) == 201_u8);
+  static_assert((a | NonZero<u8>(1_u8)) == 201_u8);
+  static_assert((0_u8 | a) == 200_u8);
+  static_assert((NonZero<u32>(8u) | 1u) == 9u);
+
+  static_assert(NonZero<u32>(1u).leading_zeros() == 31u);
+  static_assert(NonZero<u32>(8u).trailing_zeros() == 3u);
+  static_assert(NonZero<u32>(1u).log2() == 0u);
+  static_assert(NonZero<u32>(1000u).log2() == 9u);
+  static_assert(NonZero<u32>(64u).is_power_of_two());
+  static_assert(!NonZero<u32>(65u).is_power_of_two());
+
+  // Division by a NonZero returns the integer type without a check.
+  static_assert(std::same_as<decltype(1_u32 / NonZero<u32>(1u)), u32>);
+  EXPECT_EQ(1000_u32 / NonZero<u32>(7u), 142_u32);
+  EXPECT_EQ(1000_u32 % NonZero<u32>(7u), 6_u32);
+  EXPECT_EQ(1000u / NonZero<u32>(7u), 142_u32);
+  EXPECT_EQ(NonZero<u32>(9u) / NonZero<u32>(2u), 4_u32);
+}
+
+TEST(NonZero, Signed) {
+  constexpr auto min = NonZero<i32>(i32::MIN);
+  static_assert(min.is_negative());
+  static_assert(!min.is_positive());
+  static_assert(min.checked_abs().is_none());
+  static_assert(min.wrapping_abs() == i32::MIN);
+  static_assert(min.checked_neg().is_none());
+  static_assert(min.wrapping_neg() == i32::MIN);
+  static_assert(std::same_as<decltype(min.unsigned_abs()), NonZero<u32>>);
+  static_assert(min.unsigned_abs() == 2147483648_u32);
+  static_assert(NonZero<i32>(-5).checked_abs().unwrap() == 5_i32);
+  static_assert(NonZero<i32>(-5).checked_neg().unwrap() == 5_i32);
+}
+
+TEST(NonZero, Cmp) {
+  EXPECT_LT(NonZero<i32>(-1), NonZero<i32>(1));
+  EXPECT_GT(NonZero<i32>(1), -1);
+  EXPECT_EQ(NonZero<i32>(1), 1);
+  EXPECT_NE(NonZero<i32>(1), 2);
+}
+
+TEST(NonZero, fmt) {
+  EXPECT_EQ(fmt::format("{}", NonZero<i32>(-4)), "-4");
+  EXPECT_EQ(fmt::format("{:02x}", NonZero<u8>(10_u8)), "0a");
+}
+
+TEST(NonZeroDeathTest, Zero) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto n = NonZero<u32>(0u);
+        ensure_use(&n);
+      },
+      "");
+#endif
+}
+
+}  // namespace
@@ -0,0 +1,57 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// IWYU pragma: private, include "sus/num/types.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include "sus/macros/pure.h"
+
+namespace sus::num {
+
+/// The error type returned when parsing a floating point number from a string
+/// fails, such as from [`f64::from_str`]($sus::num::f64::from_str).
+class ParseFloatError {
+ public:
+  /// The type of error which occured.
+  enum class Kind {
+    /// The string being parsed was empty.
+    Empty,
+    /// The string is not a valid floating point number.
+    Invalid,
+  };
+
+  /// Constructs a ParseFloatError with kind `Empty`.
+  constexpr static ParseFloatError with_empty() noexcept;
+  /// Constructs a ParseFloatError with kind `Invalid`.
+  constexpr static ParseFloatError with_invalid() noexcept;
+
+  /// Gives the kind of error that occured.
+  _sus_pure constexpr Kind kind() const noexcept;
+
+  /// Satisfies the [`Eq`]($sus::cmp::Eq) concept.
+  _sus_pure friend constexpr bool operator==(ParseFloatError lhs,
+                                             ParseFloatError rhs) noexcept {
+    return lhs.kind_ == rhs.kind_;
+  }
+
+ private:
+  enum Construct { CONSTRUCT };
+  constexpr explicit ParseFloatError(Construct, Kind k) noexcept;
+
+  Kind kind_;
+};
+
+}  // namespace sus::num
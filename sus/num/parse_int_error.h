@@ -0,0 +1,66 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// IWYU pragma: private, include "sus/num/types.h"
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include "sus/macros/pure.h"
+
+namespace sus::num {
+
+/// The error type returned when parsing an integer from a string fails, such
+/// as from [`u32::from_str_radix`]($sus::num::u32::from_str_radix).
+class ParseIntError {
+ public:
+  /// The type of error which occured.
+  enum class Kind {
+    /// The string being parsed was empty.
+    Empty,
+    /// The string contains a character that is not a digit in the radix, or a
+    /// sign character somewhere other than the front.
+    InvalidDigit,
+    /// The number is too large to be stored in the target type.
+    PosOverflow,
+    /// The number is too small (negative) to be stored in the target type.
+    NegOverflow,
+  };
+
+  /// Constructs a ParseIntError with kind `Empty`.
+  constexpr static ParseIntError with_empty() noexcept;
+  /// Constructs a ParseIntError with kind `InvalidDigit`.
+  constexpr static ParseIntError with_invalid_digit() noexcept;
+  /// Constructs a ParseIntError with kind `PosOverflow`.
+  constexpr static ParseIntError with_pos_overflow() noexcept;
+  /// Constructs a ParseIntError with kind `NegOverflow`.
+  constexpr static ParseIntError with_neg_overflow() noexcept;
+
+  /// Gives the kind of error that occured.
+  _sus_pure constexpr Kind kind() const noexcept;
+
+  /// Satisfies the [`Eq`]($sus::cmp::Eq) concept.
+  _sus_pure friend constexpr bool operator==(ParseIntError lhs,
+                                             ParseIntError rhs) noexcept {
+    return lhs.kind_ == rhs.kind_;
+  }
+
+ private:
+  enum Construct { CONSTRUCT };
+  constexpr explicit ParseIntError(Construct, Kind k) noexcept;
+
+  Kind kind_;
+};
+
+}  // namespace sus::num
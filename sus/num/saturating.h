@@ -0,0 +1,285 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <type_traits>
+
+#include "fmt/core.h"
+#include "sus/collections/iterators/slice_iter.h"
+#include "sus/collections/slice.h"
+#include "sus/construct/from.h"
+#include "sus/iter/iterator_concept.h"
+#include "sus/macros/pure.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/move.h"
+#include "sus/num/integer_concepts.h"
+#include "sus/num/types.h"
+#include "sus/simd/simd.h"
+#include "sus/string/__private/format_to_stream.h"
+
+namespace sus::num {
+
+/// An integer type whose arithmetic saturates at the numeric bounds instead of
+/// overflowing.
+///
+/// The operators on `Saturating` call the `saturating_*` methods of the inner
+/// integer type, such as [`saturating_add`]($sus::num::u32::saturating_add),
+/// so that code which clamps its results, such as for pixel or audio samples,
+/// can be written with plain operators. Division still panics when dividing by
+/// zero.
+///
+/// `Saturating<T>` has the same layout as `T`, so a slice of integers can be
+/// viewed as a slice of `Saturating` integers with
+/// [`from_slice`]($sus::num::Saturating::from_slice), and back again with
+/// [`as_inner_slice`]($sus::num::Saturating::as_inner_slice), without copying.
+/// The inner slice can be used with [`Simd`]($sus::simd::Simd) kernels.
+///
+/// It satisfies the [`Sum`]($sus::iter::Sum) and
+/// [`Product`]($sus::iter::Product) concepts. The sum and product are computed
+/// in order, saturating at each step. Summing the iterator of a slice of
+/// unsigned `Saturating` values is done with [`Simd`]($sus::simd::Simd)
+/// vectors, which gives the same result as the sum is never reduced once it
+/// saturates.
+///
+/// # Examples
+/// ```
+/// auto a = sus::num::Saturating<u8>(200_u8);
+/// sus_check(a + 100_u8 == 255_u8);
+/// sus_check(a - 250_u8 == 0_u8);
+/// ```
+template <IntegerNumeric T>
+class Saturating {
+ public:
+  /// Default-constructs a `Saturating` with the value `0`.
+  constexpr Saturating() noexcept : v_() {}
+
+  /// Constructs a `Saturating` from an integer that converts to the integer
+  /// type `T` without loss.
+  template <class U>
+    requires((IntegerNumeric<U> || PrimitiveInteger<U>) &&
+             std::convertible_to<U, T>)
+  constexpr Saturating(U u) noexcept : v_(u) {}
+
+  /// Satisfies `sus::construct::From<Saturating<T>, U>` if the `Saturating` is
+  /// constructible from `U`.
+  template <class U>
+    requires(std::constructible_from<Saturating, U>)
+  _sus_pure static constexpr Saturating from(U u) noexcept {
+    return Saturating(u);
+  }
+
+  /// Returns the integer value.
+  _sus_pure constexpr T get() const noexcept { return v_; }
+
+  /// Views a slice of integers as a slice of `Saturating` integers, without
+  /// copying.
+  _sus_pure static ::sus::collections::Slice<Saturating> from_slice(
+      ::sus::collections::Slice<T> s) noexcept {
+    return ::sus::collections::Slice<Saturating>::from_raw_parts(
+        ::sus::marker::unsafe_fn,
+        reinterpret_cast<const Saturating*>(s.as_ptr()), s.len());
+  }
+  /// Views a mutable slice of integers as a mutable slice of `Saturating`
+  /// integers, without copying.
+  _sus_pure static ::sus::collections::SliceMut<Saturating> from_slice_mut(
+      ::sus::collections::SliceMut<T> s) noexcept {
+    return ::sus::collections::SliceMut<Saturating>::from_raw_parts_mut(
+        ::sus::marker::unsafe_fn, reinterpret_cast<Saturating*>(s.as_mut_ptr()),
+        s.len());
+  }
+  /// Views a slice of `Saturating` integers as a slice of the inner integers,
+  /// without copying.
+  _sus_pure static ::sus::collections::Slice<T> as_inner_slice(
+      ::sus::collections::Slice<Saturating> s) noexcept {
+    return ::sus::collections::Slice<T>::from_raw_parts(
+        ::sus::marker::unsafe_fn, reinterpret_cast<const T*>(s.as_ptr()),
+        s.len());
+  }
+  /// Views a mutable slice of `Saturating` integers as a mutable slice of the
+  /// inner integers, without copying.
+  _sus_pure static ::sus::collections::SliceMut<T> as_inner_slice_mut(
+      ::sus::collections::SliceMut<Saturating> s) noexcept {
+    return ::sus::collections::SliceMut<T>::from_raw_parts_mut(
+        ::sus::marker::unsafe_fn, reinterpret_cast<T*>(s.as_mut_ptr()),
+        s.len());
+  }
+
+  /// Constructs a `Saturating` from an `Iterator` by computing the saturating
+  /// sum of all elements in the iterator.
+  ///
+  /// This method should rarely be called directly, as it is used to satisfy the
+  /// [`Sum`]($sus::iter::Sum) concept, for iterators over `Saturating<T>` or
+  /// `const Saturating<T>&`. When iterating over a slice of unsigned integers,
+  /// the sum is computed with [`Simd`]($sus::simd::Simd) vectors.
+  static constexpr Saturating from_sum(
+      ::sus::iter::Iterator<Saturating> auto&& it) noexcept
+    requires(::sus::mem::IsMoveRef<decltype(it)>)
+  {
+    auto s = Saturating();
+    for (Saturating w : ::sus::move(it)) s += w;
+    return s;
+  }
+  static constexpr Saturating from_sum(
+      ::sus::iter::Iterator<const Saturating&> auto&& it) noexcept
+    requires(::sus::mem::IsMoveRef<decltype(it)>)
+  {
+    if constexpr (IsSliceIter<decltype(it)> && Unsigned<T>) {
+      if (!std::is_constant_evaluated())
+        return sum_slice(as_inner_slice(it.as_slice()));
+    }
+    auto s = Saturating();
+    for (const Saturating& w : ::sus::move(it)) s += w;
+    return s;
+  }
+
+  /// Constructs a `Saturating` from an `Iterator` by computing the saturating
+  /// product of all elements in the iterator.
+  ///
+  /// This method should rarely be called directly, as it is used to satisfy the
+  /// [`Product`]($sus::iter::Product) concept, for iterators over
+  /// `Saturating<T>` or `const Saturating<T>&`.
+  static constexpr Saturating from_product(
+      ::sus::iter::Iterator<Saturating> auto&& it) noexcept
+    requires(::sus::mem::IsMoveRef<decltype(it)>)
+  {
+    auto p = Saturating(T(decltype(T::primitive_value){1}));
+    for (Saturating w : ::sus::move(it)) p *= w;
+    return p;
+  }
+  static constexpr Saturating from_product(
+      ::sus::iter::Iterator<const Saturating&> auto&& it) noexcept
+    requires(::sus::mem::IsMoveRef<decltype(it)>)
+  {
+    auto p = Saturating(T(decltype(T::primitive_value){1}));
+    for (const Saturating& w : ::sus::move(it)) p *= w;
+    return p;
+  }
+
+  _sus_pure friend constexpr Saturating operator+(Saturating l,
+                                                  Saturating r) noexcept {
+    return l.v_.saturating_add(r.v_);
+  }
+  _sus_pure friend constexpr Saturating operator-(Saturating l,
+                                                  Saturating r) noexcept {
+    return l.v_.saturating_sub(r.v_);
+  }
+  _sus_pure friend constexpr Saturating operator*(Saturating l,
+                                                  Saturating r) noexcept {
+    return l.v_.saturating_mul(r.v_);
+  }
+  /// # Panics
+  /// Panics if `r` is zero.
+  _sus_pure friend constexpr Saturating operator/(Saturating l,
+                                                  Saturating r) noexcept {
+    return l.v_.saturating_div(r.v_);
+  }
+  /// The remainder can not overflow, except for `MIN % -1` whose result is
+  /// `0`.
+  ///
+  /// # Panics
+  /// Panics if `r` is zero.
+  _sus_pure friend constexpr Saturating operator%(Saturating l,
+                                                  Saturating r) noexcept {
+    return l.v_.wrapping_rem(r.v_);
+  }
+  _sus_pure friend constexpr Saturating operator-(Saturating w) noexcept
+    requires(Signed<T>)
+  {
+    return w.v_.saturating_neg();
+  }
+  _sus_pure friend constexpr Saturating operator~(Saturating w) noexcept {
+    return ~w.v_;
+  }
+  _sus_pure friend constexpr Saturating operator&(Saturating l,
+                                                  Saturating r) noexcept {
+    return l.v_ & r.v_;
+  }
+  _sus_pure friend constexpr Saturating operator|(Saturating l,
+                                                  Saturating r) noexcept {
+    return l.v_ | r.v_;
+  }
+  _sus_pure friend constexpr Saturating operator^(Saturating l,
+                                                  Saturating r) noexcept {
+    return l.v_ ^ r.v_;
+  }
+
+  constexpr void operator+=(Saturating r) & noexcept { *this = *this + r; }
+  constexpr void operator-=(Saturating r) & noexcept { *this = *this - r; }
+  constexpr void operator*=(Saturating r) & noexcept { *this = *this * r; }
+  constexpr void operator/=(Saturating r) & noexcept { *this = *this / r; }
+  constexpr void operator%=(Saturating r) & noexcept { *this = *this % r; }
+  constexpr void operator&=(Saturating r) & noexcept { *this = *this & r; }
+  constexpr void operator|=(Saturating r) & noexcept { *this = *this | r; }
+  constexpr void operator^=(Saturating r) & noexcept { *this = *this ^ r; }
+
+  _sus_pure friend constexpr bool operator==(Saturating l,
+                                             Saturating r) noexcept {
+    return l.v_ == r.v_;
+  }
+  _sus_pure friend constexpr std::strong_ordering operator<=>(
+      Saturating l, Saturating r) noexcept {
+    return l.v_ <=> r.v_;
+  }
+
+ private:
+  template <class I>
+  static constexpr bool IsSliceIter =
+      std::same_as<std::remove_cvref_t<I>,
+                   ::sus::collections::SliceIter<const Saturating&>>;
+
+  static Saturating sum_slice(::sus::collections::Slice<T> s) noexcept {
+    constexpr size_t N = ::sus::simd::native_lanes<T>();
+    using V = ::sus::simd::Simd<T, N>;
+    const T* p = s.as_ptr();
+    const size_t len = s.len();
+    auto acc = V();
+    size_t i = 0u;
+    for (; i + N <= len; i += N) {
+      acc = acc.saturating_add(V::from_slice(
+          ::sus::collections::Slice<T>::from_raw_parts(::sus::marker::unsafe_fn,
+                                                       p + i, N)));
+    }
+    T sum = acc.lane(0u);
+    for (size_t j = 1u; j < N; ++j) sum = sum.saturating_add(acc.lane(j));
+    for (; i < len; ++i) sum = sum.saturating_add(p[i]);
+    return sum;
+  }
+
+  T v_;
+
+  _sus_format_to_stream(Saturating);
+};
+
+}  // namespace sus::num
+
+// fmt support.
+template <class T, class Char>
+struct fmt::formatter<::sus::num::Saturating<T>, Char> {
+  template <class ParseContext>
+  constexpr auto parse(ParseContext& ctx) {
+    return underlying_.parse(ctx);
+  }
+
+  template <class FormatContext>
+  constexpr auto format(const ::sus::num::Saturating<T>& t,
+                        FormatContext& ctx) const {
+    return underlying_.format(t.get(), ctx);
+  }
+
+ private:
+  formatter<T, Char> underlying_;
+};
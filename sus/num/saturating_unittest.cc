@@ -0,0 +1,183 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/num/saturating.h"
+
+#include <concepts>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+namespace {
+
+using sus::num::Saturating;
+using sus::test::ensure_use;
+
+static_assert(sizeof(Saturating<u8>) == sizeof(u8));
+static_assert(alignof(Saturating<u64>) == alignof(u64));
+static_assert(std::is_standard_layout_v<Saturating<i32>>);
+static_assert(std::is_trivially_copyable_v<Saturating<i32>>);
+static_assert(sus::iter::Sum<Saturating<u32>>);
+static_assert(sus::iter::Sum<Saturating<u32>, const Saturating<u32>&>);
+static_assert(sus::iter::Product<Saturating<i64>>);
+static_assert(sus::iter::Product<Saturating<i64>, const Saturating<i64>&>);
+
+template <class T>
+concept CanNeg = requires(T t) { -t; };
+
+TEST(Saturating, Construct) {
+  static_assert(sus::construct::Default<Saturating<i32>>);
+  EXPECT_EQ(Saturating<i32>(), 0_i32);
+  EXPECT_EQ(Saturating<i32>(3_i32).get(), 3_i32);
+  EXPECT_EQ(Saturating<u32>(3_u8).get(), 3_u32);
+  EXPECT_EQ(Saturating<u32>::from(3u).get(), 3_u32);
+  // Lossy conversions are not allowed.
+  static_assert(!std::constructible_from<Saturating<u8>, u32>);
+  static_assert(!std::constructible_from<Saturating<u32>, i32>);
+}
+
+TEST(Saturating, Arithmetic) {
+  constexpr auto max = Saturating<u8>(u8::MAX);
+  static_assert(max + 1_u8 == u8::MAX);
+  static_assert(Saturating<u8>() - 1_u8 == 0_u8);
+  static_assert(max * 2_u8 == u8::MAX);
+  static_assert(Saturating<u8>(7_u8) / 2_u8 == 3_u8);
+  static_assert(Saturating<u8>(7_u8) % 2_u8 == 1_u8);
+
+  constexpr auto min = Saturating<i32>(i32::MIN);
+  static_assert(min - 1 == i32::MIN);
+  static_assert(min + -1 == i32::MIN);
+  static_assert(min * 2 == i32::MIN);
+  static_assert(min * -2 == i32::MAX);
+  static_assert(-min == i32::MAX);
+  static_assert(min / -1 == i32::MAX);
+  static_assert(min % -1 == 0);
+  static_assert(Saturating<i32>(i32::MAX) + 1 == i32::MAX);
+
+  // Negation is only for signed integers.
+  static_assert(CanNeg<Saturating<i32>>);
+  static_assert(!CanNeg<Saturating<u32>>);
+
+  static_assert((Saturating<u8>(0b1100_u8) & 0b1010_u8) == 0b1000_u8);
+  static_assert((Saturating<u8>(0b1100_u8) | 0b1010_u8) == 0b1110_u8);
+  static_assert((Saturating<u8>(0b1100_u8) ^ 0b1010_u8) == 0b0110_u8);
+  static_assert(~Saturating<u8>(0b1100_u8) == 0b11110011_u8);
+
+  auto a = Saturating<u16>(u16::MAX - 1_u16);
+  a += 2_u16;
+  EXPECT_EQ(a, u16::MAX);
+  a -= 65534_u16;
+  EXPECT_EQ(a, 1_u16);
+  a -= 2_u16;
+  EXPECT_EQ(a, 0_u16);
+  a += 300_u16;
+  a *= 300_u16;
+  EXPECT_EQ(a, u16::MAX);
+  a /= 5_u16;
+  EXPECT_EQ(a, 13107_u16);
+  a %= 100_u16;
+  EXPECT_EQ(a, 7_u16);
+  a &= 3_u16;
+  a |= 8_u16;
+  a ^= 1_u16;
+  EXPECT_EQ(a, 10_u16);
+}
+
+TEST(Saturating, Cmp) {
+  EXPECT_LT(Saturating<i32>(-1), Saturating<i32>(1));
+  EXPECT_GT(Saturating<i32>(1), -1);
+  EXPECT_EQ(Saturating<i32>(1), 1);
+  EXPECT_NE(Saturating<i32>(1), 2);
+}
+
+TEST(Saturating, Slice) {
+  auto v = sus::Vec<u8>(1_u8, 2_u8, 250_u8);
+  sus::SliceMut<Saturating<u8>> m =
+      Saturating<u8>::from_slice_mut(v.as_mut_slice());
+  for (Saturating<u8>& s : m.iter_mut()) s += 10_u8;
+  EXPECT_EQ(v, (sus::Vec<u8>(11_u8, 12_u8, 255_u8)));
+
+  sus::Slice<u8> inner = Saturating<u8>::as_inner_slice(
+      Saturating<u8>::from_slice(v.as_slice()));
+  EXPECT_EQ(inner.as_ptr(), v.as_ptr());
+}
+
+template <class T>
+void check_sum_product() {
+  using P = decltype(T::primitive_value);
+  // Long enough to use Simd vectors plus a remainder. The values are small
+  // enough that the sum saturates part way through for the narrow types.
+  auto v = sus::Vec<Saturating<T>>();
+  T sum;
+  T product = T(P{1});
+  uint64_t state = 0x853c49e6748fea9bu;
+  for (size_t i = 0u; i < 1001u; ++i) {
+    state = state * 6364136223846793005u + 1442695040888963407u;
+    auto t = T(static_cast<P>(static_cast<P>(state >> 58u) - P{16}));
+    v.push(t);
+    sum = sum.saturating_add(t);
+    product = product.saturating_mul(t);
+  }
+  EXPECT_EQ(v.iter().template sum<Saturating<T>>(), sum);
+  EXPECT_EQ(v.iter().copied().template sum<Saturating<T>>(), sum);
+  EXPECT_EQ(v.iter().template product<Saturating<T>>(), product);
+  EXPECT_EQ(v.iter().copied().template product<Saturating<T>>(), product);
+  // A slice that doesn't start on a vector boundary.
+  auto sub = v[sus::ops::range(1_usize, 4_usize)];
+  EXPECT_EQ(sub.iter().template sum<Saturating<T>>(), v[1u] + v[2u] + v[3u]);
+}
+
+TEST(Saturating, SumProduct) {
+  check_sum_product<u8>();
+  check_sum_product<u16>();
+  check_sum_product<u32>();
+  check_sum_product<u64>();
+  check_sum_product<usize>();
+  check_sum_product<i8>();
+  check_sum_product<i16>();
+  check_sum_product<i32>();
+  check_sum_product<i64>();
+  check_sum_product<isize>();
+
+  // Values are not reduced once the sum saturates.
+  auto v = sus::Vec<Saturating<u8>>();
+  for (size_t i = 0u; i < 100u; ++i) v.push(200_u8);
+  EXPECT_EQ(v.iter().sum<Saturating<u8>>(), u8::MAX);
+
+  auto empty = sus::Vec<Saturating<u8>>();
+  EXPECT_EQ(empty.iter().sum<Saturating<u8>>(), 0_u8);
+  EXPECT_EQ(empty.iter().product<Saturating<u8>>(), 1_u8);
+}
+
+TEST(SaturatingDeathTest, DivByZero) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto s = Saturating<i32>(1) / 0;
+        ensure_use(&s);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto s = Saturating<u32>(1u) % 0u;
+        ensure_use(&s);
+      },
+      "");
+#endif
+}
+
+}  // namespace
@@ -30,12 +30,14 @@
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/size_of.h"
+#include "sus/num/__private/chars.h"
 #include "sus/num/__private/check_integer_overflow.h"
 #include "sus/num/__private/int_log10.h"
 #include "sus/num/__private/intrinsics.h"
 #include "sus/num/__private/literals.h"
 #include "sus/num/__private/primitive_type.h"
 #include "sus/num/integer_concepts.h"
+#include "sus/num/parse_int_error.h"
 #include "sus/num/try_from_int_error.h"
 #include "sus/num/unsigned_integer.h"
 #include "sus/num/unsigned_integer_consts.h"
@@ -46,8 +48,6 @@
 
 namespace sus::num {
 
-// TODO: from_str_radix(). Need Result type and Errors.
-
 // TODO: div_ceil() and div_floor()? Lots of discussion still on
 // https://github.com/rust-lang/rust/issues/88581 for signed types.
 
@@ -103,6 +103,24 @@ struct [[_sus_trivial_abi]] i64 final {
 #define _primitive int64_t
 #include "sus/num/__private/signed_integer_consts.inc"
 
+#if defined(__SIZEOF_INT128__) || defined(__sus_doc__)
+/// A 128-bit signed integer.
+///
+/// This type is only available when the compiler provides a native 128-bit
+/// integer (`__int128` on GCC and Clang), which it is built on.
+///
+/// See the [namespace level documentation]($sus::num) for more.
+struct [[_sus_trivial_abi]] i128 final {
+#define _self i128
+#define _primitive ::sus::num::__private::int128_type
+#define _unsigned u128
+#include "sus/num/__private/signed_integer_methods.inc"
+};
+#define _self i128
+#define _primitive ::sus::num::__private::int128_type
+#include "sus/num/__private/signed_integer_consts.inc"
+#endif
+
 /// An address-sized signed integer.
 ///
 /// This type is capable of holding any offset or distance in a single memory
@@ -239,6 +257,19 @@ _sus__integer_literal(i32, ::sus::num::i32);
 /// sus_check(i == 118_i64);
 /// ```
 _sus__integer_literal(i64, ::sus::num::i64);
+#if defined(__SIZEOF_INT128__)
+/// For writing [`i128`]($sus::num::i128) literals.
+///
+/// The literal value is limited to the range of `unsigned long long`. Larger
+/// values can be built with shifts or multiplication.
+///
+/// # Examples
+/// ```
+/// auto i = 123_i128 - (5_i128).abs();
+/// sus_check(i == 118_i128);
+/// ```
+_sus__integer_literal(i128, ::sus::num::i128);
+#endif
 /// For writing [`isize`]($sus::num::isize) literals.
 ///
 /// Un-qualified integer literals are 32 bits large (the size of `int`), unless
@@ -260,6 +291,9 @@ namespace sus {
 using sus::num::i16;
 using sus::num::i32;
 using sus::num::i64;
+#if defined(__SIZEOF_INT128__)
+using sus::num::i128;
+#endif
 using sus::num::i8;
 using sus::num::isize;
 }  // namespace sus
@@ -17,8 +17,12 @@
 #pragma once
 
 #include "sus/collections/array.h"
+#include "sus/num/parse_float_error_impl.h"
+#include "sus/num/parse_int_error_impl.h"
 #include "sus/num/signed_integer.h"
+#include "sus/option/option.h"
 #include "sus/ptr/copy.h"
+#include "sus/result/result.h"
 
 #define _self i8
 #define _primitive int8_t
@@ -40,6 +44,13 @@
 #define _unsigned u64
 #include "sus/num/__private/signed_integer_methods_impl.inc"
 
+#if defined(__SIZEOF_INT128__)
+#define _self i128
+#define _primitive ::sus::num::__private::int128_type
+#define _unsigned u128
+#include "sus/num/__private/signed_integer_methods_impl.inc"
+#endif
+
 #define _self isize
 #define _primitive ::sus::num::__private::addr_type<>::signed_type
 #define _unsigned usize
@@ -30,6 +30,9 @@ namespace sus {
 /// * Unsigned integers: [`u8`]($sus::num::u8), [`u16`]($sus::num::u16),
 ///   [`u32`]($sus::num::u32), [`u64`]($sus::num::u64),
 ///   [`usize`]($sus::num::usize), [`uptr`]($sus::num::uptr).
+/// * 128-bit integers: [`i128`]($sus::num::i128) and
+///   [`u128`]($sus::num::u128), where the compiler provides a native 128-bit
+///   integer type (GCC and Clang, but not MSVC).
 /// * Floating point: [`f32`]($sus::num::f32), [`f64`]($sus::num::f64).
 /// * Portability helper: [`CInt`]
 ///
@@ -110,6 +113,8 @@ namespace num {}
 #include "sus/num/cast.h"
 #include "sus/num/float.h"
 #include "sus/num/float_impl.h"
+#include "sus/num/parse_float_error_impl.h"
+#include "sus/num/parse_int_error_impl.h"
 #include "sus/num/signed_integer.h"
 #include "sus/num/signed_integer_impl.h"
 #include "sus/num/try_from_int_error_impl.h"
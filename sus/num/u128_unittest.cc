@@ -0,0 +1,211 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <type_traits>
+#include <unordered_set>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/array.h"
+#include "sus/num/signed_integer.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/prelude.h"
+#include "sus/tuple/tuple.h"
+
+#if defined(__SIZEOF_INT128__)
+
+namespace {
+
+using sus::Tuple;
+
+static_assert(!std::is_signed_v<decltype(u64::primitive_value)>);
+static_assert(sizeof(u128) == 16);
+static_assert(sizeof(u128) == sizeof(decltype(u128::primitive_value)));
+
+static_assert(sus::num::Unsigned<u128>);
+static_assert(sus::num::UnsignedNumeric<u128>);
+static_assert(sus::num::IntegerNumeric<u128>);
+static_assert(sus::mem::Copy<u128>);
+static_assert(sus::mem::TrivialCopy<u128>);
+static_assert(sus::mem::Clone<u128>);
+static_assert(sus::mem::TriviallyRelocatable<u128>);
+static_assert(sus::mem::Move<u128>);
+static_assert(sus::construct::Default<u128>);
+
+/// Builds a `u128` from its high and low halves.
+constexpr u128 from_halves(u64 hi, u64 lo) {
+  return (u128::from(hi) << 64u) | u128::from(lo);
+}
+
+TEST(u128, Constants) {
+  static_assert(u128::BITS == 128u);
+  static_assert(u128::MIN == 0u);
+  static_assert(u128::MAX == from_halves(u64::MAX, u64::MAX));
+  static_assert(u128::MAX == ~0_u128);
+  static_assert(u128::MAX_CHARS == 39u);
+}
+
+TEST(u128, From) {
+  static_assert(std::same_as<decltype(u128::from(1_u64)), u128>);
+  static_assert(u128::from(u64::MAX) == 0xffffffff'ffffffff_u128);
+  static_assert(u128::from(3_u8) == 3_u128);
+  // Conversions to smaller types check the value.
+  EXPECT_EQ(u64::try_from(u128::from(u64::MAX)).unwrap(), u64::MAX);
+  EXPECT_TRUE(u64::try_from(u128::from(u64::MAX) + 1u).is_err());
+  EXPECT_EQ(u128::try_from(-1_i64).is_err(), true);
+  EXPECT_EQ(u128::try_from(i128::MAX).unwrap(), u128::MAX >> 1u);
+}
+
+TEST(u128, Arithmetic) {
+  constexpr auto big = from_halves(1_u64, 0_u64);
+  static_assert(big - 1u == 0xffffffff'ffffffff_u128);
+  static_assert((big * u128::from(u64::MAX)) ==
+                from_halves(u64::MAX, 0_u64));
+  static_assert(big / 3u == 0x55555555'55555555_u128);
+  static_assert(big % 3u == 1_u128);
+
+  static_assert(u128::MAX.checked_add(1u).is_none());
+  static_assert(u128::MAX.checked_sub(u128::MAX).unwrap() == 0u);
+  static_assert(big.checked_mul(big).is_none());
+  static_assert(big.checked_mul(big >> 1u).unwrap() == (1_u128 << 127u));
+  static_assert(u128::MAX.wrapping_add(2u) == 1u);
+  static_assert((0_u128).wrapping_sub(1u) == u128::MAX);
+  static_assert(u128::MAX.saturating_add(1u) == u128::MAX);
+  static_assert((1_u128).saturating_sub(2u) == 0u);
+  static_assert(big.saturating_mul(big) == u128::MAX);
+  static_assert(u128::MAX.overflowing_add(1u) == Tuple<u128, bool>(0u, true));
+  static_assert(big.overflowing_mul(big) == Tuple<u128, bool>(0u, true));
+  static_assert((10_u128).pow(38u) ==
+                10000000000000000000_u128 * 10000000000000000000_u128);
+  static_assert((10_u128).checked_pow(39u).is_none());
+  static_assert(u128::MAX.abs_diff(1u) == u128::MAX - 1u);
+  static_assert((7_u128).div_ceil(2u) == 4u);
+}
+
+TEST(u128, Bits) {
+  constexpr auto big = from_halves(1_u64, 0_u64);
+  static_assert(big.leading_zeros() == 63u);
+  static_assert(big.trailing_zeros() == 64u);
+  static_assert((1_u128).leading_zeros() == 127u);
+  static_assert((0_u128).leading_zeros() == 128u);
+  static_assert((0_u128).trailing_zeros() == 128u);
+  static_assert(u128::MAX.count_ones() == 128u);
+  static_assert(from_halves(u64::MAX, 1_u64).count_ones() == 65u);
+  static_assert((1_u128).reverse_bits() == (1_u128 << 127u));
+  static_assert(big.swap_bytes() == 0x01000000'00000000_u128);
+  static_assert((1_u128).rotate_right(1u) == (1_u128 << 127u));
+  static_assert(big.log2() == 64u);
+  static_assert(u128::MAX.log10() == 38u);
+  static_assert((1_u128 << 100u).is_power_of_two());
+  static_assert((big + 1u).next_power_of_two() == big << 1u);
+
+  // Runtime values, which use the compiler builtins.
+  auto r = big;
+  EXPECT_EQ(r.leading_zeros(), 63u);
+  EXPECT_EQ(r.trailing_zeros(), 64u);
+  EXPECT_EQ((r | 1u).count_ones(), 2u);
+  EXPECT_EQ(r.swap_bytes(), 0x01000000'00000000_u128);
+  EXPECT_EQ(r.reverse_bits(), 1_u128 << 63u);
+}
+
+TEST(u128, WideningMul) {
+  static_assert(u64::MAX.widening_mul(u64::MAX) ==
+                Tuple<u64, u64>(1_u64, u64::MAX - 1u));
+  static_assert(u128::MAX.widening_mul(u128::MAX) ==
+                Tuple<u128, u128>(1_u128, u128::MAX - 1u));
+  static_assert(from_halves(1_u64, 0_u64).widening_mul(u128::MAX) ==
+                Tuple<u128, u128>(from_halves(u64::MAX, 0_u64),
+                                  0xffffffff'ffffffff_u128));
+
+  // The widened product of two u64 is the same as their u128 product.
+  for (u64 x = 3u; x < u64::MAX / 5u; x = x * 5u + 1u) {
+    const auto y = x ^ 0x5555'5555'5555'5555_u64;
+    const auto [lo, hi] = x.widening_mul(y);
+    EXPECT_EQ(from_halves(hi, lo), u128::from(x) * u128::from(y));
+  }
+}
+
+TEST(u128, Bytes) {
+  const auto v = from_halves(0x01020304'05060708_u64, 0x090a0b0c'0d0e0f10_u64);
+  const auto le = v.to_le_bytes();
+  static_assert(std::same_as<decltype(le), const sus::Array<u8, 16>>);
+  EXPECT_EQ(le[0u], 0x10_u8);
+  EXPECT_EQ(le[15u], 0x01_u8);
+  const auto be = v.to_be_bytes();
+  EXPECT_EQ(be[0u], 0x01_u8);
+  EXPECT_EQ(be[15u], 0x10_u8);
+  EXPECT_EQ(u128::from_le_bytes(le), v);
+  EXPECT_EQ(u128::from_be_bytes(be), v);
+  EXPECT_EQ(u128::from_ne_bytes(v.to_ne_bytes()), v);
+}
+
+/// A slice over the characters of a string literal, without the terminating
+/// NUL.
+template <size_t N>
+sus::Slice<u8> chars(const char (&s)[N]) {
+  return sus::Slice<u8>::from_raw_parts(
+      sus::marker::unsafe_fn, reinterpret_cast<const u8*>(s), N - 1u);
+}
+
+TEST(u128, FromStrRadix) {
+  using E = sus::num::ParseIntError;
+  EXPECT_EQ(u128::from_str_radix(
+                chars("340282366920938463463374607431768211455"), 10u)
+                .unwrap(),
+            u128::MAX);
+  EXPECT_EQ(
+      u128::from_str_radix(chars("ffffffffffffffffffffffffffffffff"), 16u)
+          .unwrap(),
+      u128::MAX);
+  EXPECT_EQ(u128::from_str_radix(chars("18446744073709551616"), 10u).unwrap(),
+            from_halves(1_u64, 0_u64));
+  EXPECT_EQ(u128::from_str_radix(
+                chars("340282366920938463463374607431768211456"), 10u)
+                .unwrap_err(),
+            E::with_pos_overflow());
+  EXPECT_EQ(u128::from_str_radix(chars("12x"), 10u).unwrap_err(),
+            E::with_invalid_digit());
+}
+
+TEST(u128, ToChars) {
+  auto buf = sus::Array<u8, u128::MAX_CHARS>();
+  for (u128 v = 1u; v < u128::MAX / 7u; v = v * 7u + 3u) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    EXPECT_EQ(
+        u128::from_str(buf.as_slice()[sus::ops::range(0_usize, n)]).unwrap(),
+        v);
+  }
+  usize n = u128::MAX.to_chars(buf.as_mut_slice()).unwrap();
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(buf.as_ptr()), n),
+            "340282366920938463463374607431768211455");
+}
+
+TEST(u128, fmt) {
+  static_assert(fmt::is_formattable<u128, char>::value);
+  EXPECT_EQ(fmt::format("{}", u128::MAX),
+            "340282366920938463463374607431768211455");
+  EXPECT_EQ(fmt::format("{:x}", from_halves(1_u64, 2_u64)),
+            "10000000000000002");
+}
+
+TEST(u128, Hash) {
+  auto set = std::unordered_set<u128>();
+  set.insert(from_halves(1_u64, 0_u64));
+  set.insert(from_halves(0_u64, 1_u64));
+  set.insert(1_u128);
+  EXPECT_EQ(set.size(), 2u);
+}
+
+}  // namespace
+
+#endif
@@ -2275,4 +2275,100 @@ TEST(u32, CheckedNextMultipleOf) {
   EXPECT_EQ(u32::MAX.checked_next_multiple_of(20u), sus::none());
 }
 
+/// A slice over the characters of a string literal, without the terminating
+/// NUL.
+template <size_t N>
+sus::Slice<u8> chars(const char (&s)[N]) {
+  return sus::Slice<u8>::from_raw_parts(
+      sus::marker::unsafe_fn, reinterpret_cast<const u8*>(s), N - 1u);
+}
+
+TEST(u32, FromStrRadix) {
+  using E = sus::num::ParseIntError;
+  EXPECT_EQ(u32::from_str_radix(chars("0"), 10u).unwrap(), 0u);
+  EXPECT_EQ(u32::from_str_radix(chars("+123"), 10u).unwrap(),
+            123u);
+  EXPECT_EQ(u32::from_str_radix(chars("4294967295"), 10u).unwrap(),
+            u32::MAX);
+  // Long enough to use the 8-digit path, with leading zeros.
+  EXPECT_EQ(
+      u32::from_str_radix(chars("0000000012345678"), 10u).unwrap(),
+      12345678u);
+  EXPECT_EQ(u32::from_str_radix(chars("ffFF"), 16u).unwrap(),
+            0xffffu);
+  EXPECT_EQ(u32::from_str_radix(chars("101"), 2u).unwrap(), 5u);
+  EXPECT_EQ(u32::from_str_radix(chars("zz"), 36u).unwrap(),
+            35u * 36u + 35u);
+
+  EXPECT_EQ(u32::from_str_radix(chars(""), 10u).unwrap_err(),
+            E::with_empty());
+  EXPECT_EQ(u32::from_str_radix(chars("+"), 10u).unwrap_err(),
+            E::with_invalid_digit());
+  EXPECT_EQ(u32::from_str_radix(chars("-1"), 10u).unwrap_err(),
+            E::with_invalid_digit());
+  EXPECT_EQ(u32::from_str_radix(chars(" 1"), 10u).unwrap_err(),
+            E::with_invalid_digit());
+  EXPECT_EQ(u32::from_str_radix(chars("12a"), 10u).unwrap_err(),
+            E::with_invalid_digit());
+  EXPECT_EQ(u32::from_str_radix(chars("2"), 2u).unwrap_err(),
+            E::with_invalid_digit());
+  EXPECT_EQ(u32::from_str_radix(chars("1234567x"), 10u).unwrap_err(),
+            E::with_invalid_digit());
+  EXPECT_EQ(u32::from_str_radix(chars("4294967296"), 10u).unwrap_err(),
+            E::with_pos_overflow());
+  EXPECT_EQ(
+      u32::from_str_radix(chars("99999999999999999"), 10u)
+          .unwrap_err(),
+      E::with_pos_overflow());
+  EXPECT_EQ(u32::from_str_radix(chars("100000000"), 16u).unwrap_err(),
+            E::with_pos_overflow());
+}
+
+TEST(u32DeathTest, FromStrRadixInvalidRadix) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto r = u32::from_str_radix(chars("1"), 37u);
+        ensure_use(&r);
+      },
+      "radix must lie in the range");
+#endif
+}
+
+TEST(u32, FromStr) {
+  EXPECT_EQ(u32::from_str(chars("987654321")).unwrap(),
+            987654321u);
+  EXPECT_EQ(u32::from_str(chars("ff")).unwrap_err(),
+            sus::num::ParseIntError::with_invalid_digit());
+}
+
+TEST(u32, ToChars) {
+  auto buf = sus::Array<u8, u32::MAX_CHARS>();
+  auto to_string = [&](u32 v) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    return std::string(reinterpret_cast<const char*>(buf.as_ptr()), n);
+  };
+  EXPECT_EQ(to_string(0u), "0");
+  EXPECT_EQ(to_string(7u), "7");
+  EXPECT_EQ(to_string(10u), "10");
+  EXPECT_EQ(to_string(123u), "123");
+  EXPECT_EQ(to_string(1000000u), "1000000");
+  EXPECT_EQ(to_string(u32::MAX), "4294967295");
+  static_assert(u32::MAX_CHARS == 10u);
+
+  // Too short writes nothing.
+  auto small = sus::Array<u8, 3>::with_value(u8(uint8_t{'x'}));
+  EXPECT_EQ((1234_u32).to_chars(small.as_mut_slice()), sus::none());
+  EXPECT_EQ(small[0u], u8(uint8_t{'x'}));
+  EXPECT_EQ((123_u32).to_chars(small.as_mut_slice()), sus::some(3u));
+
+  // Every value round trips.
+  for (u32 v = 1u; v < u32::MAX / 3u; v = v * 3u + 1u) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    EXPECT_EQ(u32::from_str(buf.as_slice()[sus::ops::range(0_usize, n)])
+                  .unwrap(),
+              v);
+  }
+}
+
 }  // namespace
@@ -901,4 +901,43 @@ TEST(u64, ToNeBytes) {
   }
 }
 
+/// A slice over the characters of a string literal, without the terminating
+/// NUL.
+template <size_t N>
+sus::Slice<u8> chars(const char (&s)[N]) {
+  return sus::Slice<u8>::from_raw_parts(
+      sus::marker::unsafe_fn, reinterpret_cast<const u8*>(s), N - 1u);
+}
+
+TEST(u64, FromStrRadix) {
+  using E = sus::num::ParseIntError;
+  EXPECT_EQ(u64::from_str_radix(chars("18446744073709551615"), 10u).unwrap(),
+            u64::MAX);
+  EXPECT_EQ(u64::from_str_radix(chars("ffffffffffffffff"), 16u).unwrap(),
+            u64::MAX);
+  EXPECT_EQ(
+      u64::from_str_radix(chars("18446744073709551616"), 10u).unwrap_err(),
+      E::with_pos_overflow());
+  EXPECT_EQ(
+      u64::from_str_radix(chars("99999999999999999999"), 10u).unwrap_err(),
+      E::with_pos_overflow());
+  EXPECT_EQ(
+      u64::from_str_radix(chars("1844674407370955161x"), 10u).unwrap_err(),
+      E::with_invalid_digit());
+}
+
+TEST(u64, ToChars) {
+  auto buf = sus::Array<u8, u64::MAX_CHARS>();
+  static_assert(u64::MAX_CHARS == 20u);
+  for (u64 v = 1u; v < u64::MAX / 7u; v = v * 7u + 3u) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    EXPECT_EQ(u64::from_str(buf.as_slice()[sus::ops::range(0_usize, n)])
+                  .unwrap(),
+              v);
+  }
+  usize n = u64::MAX.to_chars(buf.as_mut_slice()).unwrap();
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(buf.as_ptr()), n),
+            "18446744073709551615");
+}
+
 }  // namespace
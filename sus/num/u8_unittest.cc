@@ -870,4 +870,35 @@ TEST(u8, ToNeBytes) {
   }
 }
 
+/// A slice over the characters of a string literal, without the terminating
+/// NUL.
+template <size_t N>
+sus::Slice<u8> chars(const char (&s)[N]) {
+  return sus::Slice<u8>::from_raw_parts(
+      sus::marker::unsafe_fn, reinterpret_cast<const u8*>(s), N - 1u);
+}
+
+TEST(u8, FromStrRadix) {
+  using E = sus::num::ParseIntError;
+  EXPECT_EQ(u8::from_str_radix(chars("255"), 10u).unwrap(), u8::MAX);
+  EXPECT_EQ(u8::from_str_radix(chars("00000000255"), 10u).unwrap(), u8::MAX);
+  EXPECT_EQ(u8::from_str_radix(chars("FF"), 16u).unwrap(), u8::MAX);
+  EXPECT_EQ(u8::from_str_radix(chars("256"), 10u).unwrap_err(),
+            E::with_pos_overflow());
+  EXPECT_EQ(u8::from_str_radix(chars("-0"), 10u).unwrap_err(),
+            E::with_invalid_digit());
+}
+
+TEST(u8, ToChars) {
+  auto buf = sus::Array<u8, u8::MAX_CHARS>();
+  static_assert(u8::MAX_CHARS == 3u);
+  for (u8 v = u8::MIN;; v += 1_u8) {
+    usize n = v.to_chars(buf.as_mut_slice()).unwrap();
+    EXPECT_EQ(u8::from_str(buf.as_slice()[sus::ops::range(0_usize, n)])
+                  .unwrap(),
+              v);
+    if (v == u8::MAX) break;
+  }
+}
+
 }  // namespace
@@ -32,6 +32,7 @@
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/size_of.h"
+#include "sus/num/__private/chars.h"
 #include "sus/num/__private/check_integer_overflow.h"
 #include "sus/num/__private/int_log10.h"
 #include "sus/num/__private/intrinsics.h"
@@ -39,13 +40,12 @@
 #include "sus/num/__private/primitive_type.h"
 #include "sus/num/float_concepts.h"
 #include "sus/num/integer_concepts.h"
+#include "sus/num/parse_int_error.h"
 #include "sus/num/try_from_int_error.h"
 #include "sus/string/__private/format_to_stream.h"
 
 namespace sus::num {
 
-// TODO: from_str_radix(). Need Result typ`e and Errors.
-
 /// A 64-bit unsigned integer.
 ///
 /// See the [namespace level documentation]($sus::num) for more.
@@ -58,6 +58,26 @@ struct [[_sus_trivial_abi]] u64 final {
 #include "sus/num/__private/unsigned_integer_methods.inc"
 };
 
+#if defined(__SIZEOF_INT128__) || defined(__sus_doc__)
+/// A 128-bit unsigned integer.
+///
+/// This type is only available when the compiler provides a native 128-bit
+/// integer (`unsigned __int128` on GCC and Clang), which it is built on. MSVC
+/// has no such type, though the 64-bit helpers that need a 128-bit
+/// intermediate, such as [`u64::widening_mul`]($sus::num::u64::widening_mul),
+/// use `_umul128` there.
+///
+/// See the [namespace level documentation]($sus::num) for more.
+struct [[_sus_trivial_abi]] u128 final {
+#define _self u128
+#define _pointer false
+#define _pointer_sized
+#define _primitive ::sus::num::__private::uint128_type
+#define _signed i128
+#include "sus/num/__private/unsigned_integer_methods.inc"
+};
+#endif
+
 /// A 32-bit unsigned integer.
 ///
 /// See the [namespace level documentation]($sus::num) for more.
@@ -257,6 +277,19 @@ _sus__integer_literal(u32, ::sus::num::u32);
 /// sus_check(i == 118_u64);
 /// ```
 _sus__integer_literal(u64, ::sus::num::u64);
+#if defined(__SIZEOF_INT128__)
+/// For writing [`u128`]($sus::num::u128) literals.
+///
+/// The literal value is limited to the range of `unsigned long long`. Larger
+/// values can be built with shifts, such as `(1_u128 << 100u)`.
+///
+/// # Examples
+/// ```
+/// auto i = (123_u128 << 100u) >> 99u;
+/// sus_check(i == 246_u128);
+/// ```
+_sus__integer_literal(u128, ::sus::num::u128);
+#endif
 /// For writing [`usize`]($sus::num::usize) literals.
 ///
 /// Un-qualified integer literals are 32 bits large (the size of `int`) and
@@ -278,6 +311,9 @@ namespace sus {
 using sus::num::u16;
 using sus::num::u32;
 using sus::num::u64;
+#if defined(__SIZEOF_INT128__)
+using sus::num::u128;
+#endif
 using sus::num::u8;
 using sus::num::uptr;
 using sus::num::usize;
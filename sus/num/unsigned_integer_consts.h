@@ -40,6 +40,13 @@ namespace sus::num {
 #define _primitive uint64_t
 #include "sus/num/__private/unsigned_integer_consts.inc"
 
+#if defined(__SIZEOF_INT128__)
+#define _self u128
+#define _pointer false
+#define _primitive ::sus::num::__private::uint128_type
+#include "sus/num/__private/unsigned_integer_consts.inc"
+#endif
+
 #define _self usize
 #define _pointer false
 #define _primitive \
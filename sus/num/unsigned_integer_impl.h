@@ -20,6 +20,8 @@
 #include <stdint.h>
 
 #include "sus/collections/array.h"
+#include "sus/num/parse_float_error_impl.h"
+#include "sus/num/parse_int_error_impl.h"
 #include "sus/num/unsigned_integer.h"
 #include "sus/option/option.h"
 #include "sus/ptr/copy.h"
@@ -50,6 +52,14 @@
 #define _signed i64
 #include "sus/num/__private/unsigned_integer_methods_impl.inc"
 
+#if defined(__SIZEOF_INT128__)
+#define _self u128
+#define _pointer 0
+#define _primitive ::sus::num::__private::uint128_type
+#define _signed i128
+#include "sus/num/__private/unsigned_integer_methods_impl.inc"
+#endif
+
 #define _self usize
 #define _pointer 0
 #define _primitive ::sus::num::__private::ptr_type<::sus::mem::size_of<size_t>()>::unsigned_type
@@ -0,0 +1,310 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <compare>
+#include <concepts>
+#include <type_traits>
+
+#include "fmt/core.h"
+#include "sus/collections/iterators/slice_iter.h"
+#include "sus/collections/slice.h"
+#include "sus/construct/from.h"
+#include "sus/iter/iterator_concept.h"
+#include "sus/macros/pure.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/move.h"
+#include "sus/num/integer_concepts.h"
+#include "sus/num/types.h"
+#include "sus/simd/simd.h"
+#include "sus/string/__private/format_to_stream.h"
+
+namespace sus::num {
+
+/// An integer type whose arithmetic wraps around on overflow.
+///
+/// The operators on `Wrapping` call the `wrapping_*` methods of the inner
+/// integer type, such as [`wrapping_add`]($sus::num::u32::wrapping_add), so
+/// hashing, checksum and random number generation code can be written with
+/// plain operators, and a checked operator can't slip into the code by
+/// mistake. Division and remainder still panic when dividing by zero.
+///
+/// `Wrapping<T>` has the same layout as `T`, so a slice of integers can be
+/// viewed as a slice of `Wrapping` integers with
+/// [`from_slice`]($sus::num::Wrapping::from_slice), and back again with
+/// [`as_inner_slice`]($sus::num::Wrapping::as_inner_slice), without copying.
+/// The inner slice can be used with [`Simd`]($sus::simd::Simd) kernels.
+///
+/// It satisfies the [`Sum`]($sus::iter::Sum) and
+/// [`Product`]($sus::iter::Product) concepts. Summing the iterator of a slice
+/// of `Wrapping` values is done with [`Simd`]($sus::simd::Simd) vectors.
+///
+/// # Examples
+/// A FNV-1a hash, which relies on wrapping multiplication.
+/// ```
+/// auto hash = sus::num::Wrapping<u64>(0xcbf29ce484222325_u64);
+/// for (u8 b : sus::Vec<u8>(1_u8, 2_u8, 3_u8)) {
+///   hash ^= u64::from(b);
+///   hash *= 0x100000001b3_u64;
+/// }
+/// sus_check(hash.get() != 0u);
+/// ```
+template <IntegerNumeric T>
+class Wrapping {
+ public:
+  /// Default-constructs a `Wrapping` with the value `0`.
+  constexpr Wrapping() noexcept : v_() {}
+
+  /// Constructs a `Wrapping` from an integer that converts to the integer type
+  /// `T` without loss.
+  template <class U>
+    requires((IntegerNumeric<U> || PrimitiveInteger<U>) &&
+             std::convertible_to<U, T>)
+  constexpr Wrapping(U u) noexcept : v_(u) {}
+
+  /// Satisfies `sus::construct::From<Wrapping<T>, U>` if the `Wrapping` is
+  /// constructible from `U`.
+  template <class U>
+    requires(std::constructible_from<Wrapping, U>)
+  _sus_pure static constexpr Wrapping from(U u) noexcept {
+    return Wrapping(u);
+  }
+
+  /// Returns the integer value.
+  _sus_pure constexpr T get() const noexcept { return v_; }
+
+  /// Views a slice of integers as a slice of `Wrapping` integers, without
+  /// copying.
+  _sus_pure static ::sus::collections::Slice<Wrapping> from_slice(
+      ::sus::collections::Slice<T> s) noexcept {
+    return ::sus::collections::Slice<Wrapping>::from_raw_parts(
+        ::sus::marker::unsafe_fn, reinterpret_cast<const Wrapping*>(s.as_ptr()),
+        s.len());
+  }
+  /// Views a mutable slice of integers as a mutable slice of `Wrapping`
+  /// integers, without copying.
+  _sus_pure static ::sus::collections::SliceMut<Wrapping> from_slice_mut(
+      ::sus::collections::SliceMut<T> s) noexcept {
+    return ::sus::collections::SliceMut<Wrapping>::from_raw_parts_mut(
+        ::sus::marker::unsafe_fn, reinterpret_cast<Wrapping*>(s.as_mut_ptr()),
+        s.len());
+  }
+  /// Views a slice of `Wrapping` integers as a slice of the inner integers,
+  /// without copying.
+  _sus_pure static ::sus::collections::Slice<T> as_inner_slice(
+      ::sus::collections::Slice<Wrapping> s) noexcept {
+    return ::sus::collections::Slice<T>::from_raw_parts(
+        ::sus::marker::unsafe_fn, reinterpret_cast<const T*>(s.as_ptr()),
+        s.len());
+  }
+  /// Views a mutable slice of `Wrapping` integers as a mutable slice of the
+  /// inner integers, without copying.
+  _sus_pure static ::sus::collections::SliceMut<T> as_inner_slice_mut(
+      ::sus::collections::SliceMut<Wrapping> s) noexcept {
+    return ::sus::collections::SliceMut<T>::from_raw_parts_mut(
+        ::sus::marker::unsafe_fn, reinterpret_cast<T*>(s.as_mut_ptr()),
+        s.len());
+  }
+
+  /// Constructs a `Wrapping` from an `Iterator` by computing the wrapping sum
+  /// of all elements in the iterator.
+  ///
+  /// This method should rarely be called directly, as it is used to satisfy the
+  /// [`Sum`]($sus::iter::Sum) concept, for iterators over `Wrapping<T>` or
+  /// `const Wrapping<T>&`. When iterating over a slice, the sum is computed
+  /// with [`Simd`]($sus::simd::Simd) vectors.
+  static constexpr Wrapping from_sum(
+      ::sus::iter::Iterator<Wrapping> auto&& it) noexcept
+    requires(::sus::mem::IsMoveRef<decltype(it)>)
+  {
+    auto s = Wrapping();
+    for (Wrapping w : ::sus::move(it)) s += w;
+    return s;
+  }
+  static constexpr Wrapping from_sum(
+      ::sus::iter::Iterator<const Wrapping&> auto&& it) noexcept
+    requires(::sus::mem::IsMoveRef<decltype(it)>)
+  {
+    if constexpr (IsSliceIter<decltype(it)>) {
+      if (!std::is_constant_evaluated())
+        return sum_slice(as_inner_slice(it.as_slice()));
+    }
+    auto s = Wrapping();
+    for (const Wrapping& w : ::sus::move(it)) s += w;
+    return s;
+  }
+
+  /// Constructs a `Wrapping` from an `Iterator` by computing the wrapping
+  /// product of all elements in the iterator.
+  ///
+  /// This method should rarely be called directly, as it is used to satisfy the
+  /// [`Product`]($sus::iter::Product) concept, for iterators over `Wrapping<T>`
+  /// or `const Wrapping<T>&`. When iterating over a slice, the product is
+  /// computed with [`Simd`]($sus::simd::Simd) vectors.
+  static constexpr Wrapping from_product(
+      ::sus::iter::Iterator<Wrapping> auto&& it) noexcept
+    requires(::sus::mem::IsMoveRef<decltype(it)>)
+  {
+    auto p = Wrapping(T(decltype(T::primitive_value){1}));
+    for (Wrapping w : ::sus::move(it)) p *= w;
+    return p;
+  }
+  static constexpr Wrapping from_product(
+      ::sus::iter::Iterator<const Wrapping&> auto&& it) noexcept
+    requires(::sus::mem::IsMoveRef<decltype(it)>)
+  {
+    if constexpr (IsSliceIter<decltype(it)>) {
+      if (!std::is_constant_evaluated())
+        return product_slice(as_inner_slice(it.as_slice()));
+    }
+    auto p = Wrapping(T(decltype(T::primitive_value){1}));
+    for (const Wrapping& w : ::sus::move(it)) p *= w;
+    return p;
+  }
+
+  _sus_pure friend constexpr Wrapping operator+(Wrapping l,
+                                                Wrapping r) noexcept {
+    return l.v_.wrapping_add(r.v_);
+  }
+  _sus_pure friend constexpr Wrapping operator-(Wrapping l,
+                                                Wrapping r) noexcept {
+    return l.v_.wrapping_sub(r.v_);
+  }
+  _sus_pure friend constexpr Wrapping operator*(Wrapping l,
+                                                Wrapping r) noexcept {
+    return l.v_.wrapping_mul(r.v_);
+  }
+  /// # Panics
+  /// Panics if `r` is zero.
+  _sus_pure friend constexpr Wrapping operator/(Wrapping l,
+                                                Wrapping r) noexcept {
+    return l.v_.wrapping_div(r.v_);
+  }
+  /// # Panics
+  /// Panics if `r` is zero.
+  _sus_pure friend constexpr Wrapping operator%(Wrapping l,
+                                                Wrapping r) noexcept {
+    return l.v_.wrapping_rem(r.v_);
+  }
+  _sus_pure friend constexpr Wrapping operator-(Wrapping w) noexcept {
+    return w.v_.wrapping_neg();
+  }
+  _sus_pure friend constexpr Wrapping operator~(Wrapping w) noexcept {
+    return ~w.v_;
+  }
+  _sus_pure friend constexpr Wrapping operator&(Wrapping l,
+                                                Wrapping r) noexcept {
+    return l.v_ & r.v_;
+  }
+  _sus_pure friend constexpr Wrapping operator|(Wrapping l,
+                                                Wrapping r) noexcept {
+    return l.v_ | r.v_;
+  }
+  _sus_pure friend constexpr Wrapping operator^(Wrapping l,
+                                                Wrapping r) noexcept {
+    return l.v_ ^ r.v_;
+  }
+  /// Shifts left by `r` modulo the number of bits in `T`.
+  _sus_pure friend constexpr Wrapping operator<<(Wrapping l, u64 r) noexcept {
+    return l.v_.wrapping_shl(r);
+  }
+  /// Shifts right by `r` modulo the number of bits in `T`.
+  _sus_pure friend constexpr Wrapping operator>>(Wrapping l, u64 r) noexcept {
+    return l.v_.wrapping_shr(r);
+  }
+
+  constexpr void operator+=(Wrapping r) & noexcept { *this = *this + r; }
+  constexpr void operator-=(Wrapping r) & noexcept { *this = *this - r; }
+  constexpr void operator*=(Wrapping r) & noexcept { *this = *this * r; }
+  constexpr void operator/=(Wrapping r) & noexcept { *this = *this / r; }
+  constexpr void operator%=(Wrapping r) & noexcept { *this = *this % r; }
+  constexpr void operator&=(Wrapping r) & noexcept { *this = *this & r; }
+  constexpr void operator|=(Wrapping r) & noexcept { *this = *this | r; }
+  constexpr void operator^=(Wrapping r) & noexcept { *this = *this ^ r; }
+  constexpr void operator<<=(u64 r) & noexcept { *this = *this << r; }
+  constexpr void operator>>=(u64 r) & noexcept { *this = *this >> r; }
+
+  _sus_pure friend constexpr bool operator==(Wrapping l, Wrapping r) noexcept {
+    return l.v_ == r.v_;
+  }
+  _sus_pure friend constexpr std::strong_ordering operator<=>(
+      Wrapping l, Wrapping r) noexcept {
+    return l.v_ <=> r.v_;
+  }
+
+ private:
+  template <class I>
+  static constexpr bool IsSliceIter = std::same_as<
+      std::remove_cvref_t<I>, ::sus::collections::SliceIter<const Wrapping&>>;
+
+  static Wrapping sum_slice(::sus::collections::Slice<T> s) noexcept {
+    constexpr size_t N = ::sus::simd::native_lanes<T>();
+    using V = ::sus::simd::Simd<T, N>;
+    const T* p = s.as_ptr();
+    const size_t len = s.len();
+    auto acc = V();
+    size_t i = 0u;
+    for (; i + N <= len; i += N) {
+      acc = acc.wrapping_add(V::from_slice(
+          ::sus::collections::Slice<T>::from_raw_parts(::sus::marker::unsafe_fn,
+                                                       p + i, N)));
+    }
+    T sum = acc.wrapping_reduce_sum();
+    for (; i < len; ++i) sum = sum.wrapping_add(p[i]);
+    return sum;
+  }
+
+  static Wrapping product_slice(::sus::collections::Slice<T> s) noexcept {
+    constexpr size_t N = ::sus::simd::native_lanes<T>();
+    using V = ::sus::simd::Simd<T, N>;
+    const T* p = s.as_ptr();
+    const size_t len = s.len();
+    auto acc = V::splat(T(decltype(T::primitive_value){1}));
+    size_t i = 0u;
+    for (; i + N <= len; i += N) {
+      acc = acc.wrapping_mul(V::from_slice(
+          ::sus::collections::Slice<T>::from_raw_parts(::sus::marker::unsafe_fn,
+                                                       p + i, N)));
+    }
+    T product = acc.lane(0u);
+    for (size_t j = 1u; j < N; ++j) product = product.wrapping_mul(acc.lane(j));
+    for (; i < len; ++i) product = product.wrapping_mul(p[i]);
+    return product;
+  }
+
+  T v_;
+
+  _sus_format_to_stream(Wrapping);
+};
+
+}  // namespace sus::num
+
+// fmt support.
+template <class T, class Char>
+struct fmt::formatter<::sus::num::Wrapping<T>, Char> {
+  template <class ParseContext>
+  constexpr auto parse(ParseContext& ctx) {
+    return underlying_.parse(ctx);
+  }
+
+  template <class FormatContext>
+  constexpr auto format(const ::sus::num::Wrapping<T>& t,
+                        FormatContext& ctx) const {
+    return underlying_.format(t.get(), ctx);
+  }
+
+ private:
+  formatter<T, Char> underlying_;
+};
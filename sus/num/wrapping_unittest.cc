@@ -0,0 +1,191 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/num/wrapping.h"
+
+#include <concepts>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/vec.h"
+#include "sus/iter/iterator.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+namespace {
+
+using sus::num::Wrapping;
+using sus::test::ensure_use;
+
+static_assert(sizeof(Wrapping<u8>) == sizeof(u8));
+static_assert(alignof(Wrapping<u64>) == alignof(u64));
+static_assert(std::is_standard_layout_v<Wrapping<i32>>);
+static_assert(std::is_trivially_copyable_v<Wrapping<i32>>);
+static_assert(sus::iter::Sum<Wrapping<u32>>);
+static_assert(sus::iter::Sum<Wrapping<u32>, const Wrapping<u32>&>);
+static_assert(sus::iter::Product<Wrapping<i64>>);
+static_assert(sus::iter::Product<Wrapping<i64>, const Wrapping<i64>&>);
+
+TEST(Wrapping, Construct) {
+  static_assert(sus::construct::Default<Wrapping<i32>>);
+  EXPECT_EQ(Wrapping<i32>(), 0_i32);
+  EXPECT_EQ(Wrapping<i32>(3_i32).get(), 3_i32);
+  EXPECT_EQ(Wrapping<u32>(3_u8).get(), 3_u32);
+  EXPECT_EQ(Wrapping<u32>(3u).get(), 3_u32);
+  Wrapping<u64> w = sus::into(5_u64);
+  EXPECT_EQ(w, 5_u64);
+  // Lossy conversions are not allowed.
+  static_assert(!std::constructible_from<Wrapping<u8>, u32>);
+  static_assert(!std::constructible_from<Wrapping<u32>, i32>);
+}
+
+TEST(Wrapping, Arithmetic) {
+  constexpr auto max = Wrapping<u8>(u8::MAX);
+  static_assert(max + 1_u8 == 0_u8);
+  static_assert(Wrapping<u8>() - 1_u8 == u8::MAX);
+  static_assert(max * 2_u8 == 254_u8);
+  static_assert(-Wrapping<u8>(1_u8) == u8::MAX);
+
+  constexpr auto min = Wrapping<i32>(i32::MIN);
+  static_assert(min - 1 == i32::MAX);
+  static_assert(min + -1 == i32::MAX);
+  static_assert(-min == i32::MIN);
+  static_assert(min / -1 == i32::MIN);
+  static_assert(min % -1 == 0);
+  static_assert(min * 2 == 0);
+  static_assert(Wrapping<i32>(7) / 2 == 3);
+  static_assert(Wrapping<i32>(7) % 2 == 1);
+
+  // Shifts are modulo the bit width.
+  static_assert((Wrapping<u32>(1u) << 33u) == 2u);
+  static_assert((Wrapping<u32>(4u) >> 33u) == 2u);
+
+  static_assert((Wrapping<u8>(0b1100_u8) & 0b1010_u8) == 0b1000_u8);
+  static_assert((Wrapping<u8>(0b1100_u8) | 0b1010_u8) == 0b1110_u8);
+  static_assert((Wrapping<u8>(0b1100_u8) ^ 0b1010_u8) == 0b0110_u8);
+  static_assert(~Wrapping<u8>(0b1100_u8) == 0b11110011_u8);
+
+  auto a = Wrapping<u16>(u16::MAX);
+  a += 2_u16;
+  EXPECT_EQ(a, 1_u16);
+  a -= 2_u16;
+  EXPECT_EQ(a, u16::MAX);
+  a *= 3_u16;
+  EXPECT_EQ(a, u16::MAX - 2_u16);
+  a /= 2_u16;
+  EXPECT_EQ(a, 32766_u16);
+  a %= 100_u16;
+  EXPECT_EQ(a, 66_u16);
+  a <<= 17u;
+  EXPECT_EQ(a, 132_u16);
+  a >>= 2u;
+  EXPECT_EQ(a, 33_u16);
+  a &= 1_u16;
+  a |= 4_u16;
+  a ^= 2_u16;
+  EXPECT_EQ(a, 7_u16);
+}
+
+TEST(Wrapping, Cmp) {
+  EXPECT_LT(Wrapping<i32>(-1), Wrapping<i32>(1));
+  EXPECT_GT(Wrapping<i32>(1), -1);
+  EXPECT_EQ(Wrapping<i32>(1), 1);
+  EXPECT_NE(Wrapping<i32>(1), 2);
+}
+
+TEST(Wrapping, Hash) {
+  // FNV-1a of "a".
+  auto hash = Wrapping<u64>(0xcbf29ce484222325_u64);
+  hash ^= u64::from(u8(uint8_t{'a'}));
+  hash *= 0x100000001b3_u64;
+  EXPECT_EQ(hash, 0xaf63dc4c8601ec8c_u64);
+}
+
+TEST(Wrapping, Slice) {
+  auto v = sus::Vec<u32>(1u, 2u, u32::MAX);
+  sus::Slice<Wrapping<u32>> s = Wrapping<u32>::from_slice(v.as_slice());
+  EXPECT_EQ(s.len(), 3u);
+  EXPECT_EQ(s.as_ptr(), static_cast<const void*>(v.as_ptr()));
+  EXPECT_EQ(s[2u] + 1u, 0u);
+
+  sus::SliceMut<Wrapping<u32>> m =
+      Wrapping<u32>::from_slice_mut(v.as_mut_slice());
+  for (Wrapping<u32>& w : m.iter_mut()) w += 1u;
+  EXPECT_EQ(v, sus::Vec<u32>(2u, 3u, 0u));
+
+  sus::Slice<u32> inner = Wrapping<u32>::as_inner_slice(s);
+  EXPECT_EQ(inner.as_ptr(), v.as_ptr());
+  sus::SliceMut<u32> inner_mut = Wrapping<u32>::as_inner_slice_mut(m);
+  inner_mut[0u] = 7u;
+  EXPECT_EQ(s[0u], 7u);
+}
+
+template <class T>
+void check_sum_product() {
+  using P = decltype(T::primitive_value);
+  // Long enough to use Simd vectors plus a remainder.
+  auto v = sus::Vec<Wrapping<T>>();
+  T sum;
+  T product = T(P{1});
+  uint64_t state = 0x853c49e6748fea9bu;
+  for (size_t i = 0u; i < 1001u; ++i) {
+    state = state * 6364136223846793005u + 1442695040888963407u;
+    auto t = T(static_cast<P>(static_cast<P>(state >> 29u) | P{1}));
+    v.push(t);
+    sum = sum.wrapping_add(t);
+    product = product.wrapping_mul(t);
+  }
+  EXPECT_EQ(v.iter().template sum<Wrapping<T>>(), sum);
+  EXPECT_EQ(v.iter().copied().template sum<Wrapping<T>>(), sum);
+  EXPECT_EQ(v.iter().template product<Wrapping<T>>(), product);
+  EXPECT_EQ(v.iter().copied().template product<Wrapping<T>>(), product);
+  // A slice that doesn't start on a vector boundary.
+  auto sub = v[sus::ops::range(1_usize, 4_usize)];
+  EXPECT_EQ(sub.iter().template sum<Wrapping<T>>(), v[1u] + v[2u] + v[3u]);
+}
+
+TEST(Wrapping, SumProduct) {
+  check_sum_product<u8>();
+  check_sum_product<u16>();
+  check_sum_product<u32>();
+  check_sum_product<u64>();
+  check_sum_product<usize>();
+  check_sum_product<i8>();
+  check_sum_product<i16>();
+  check_sum_product<i32>();
+  check_sum_product<i64>();
+  check_sum_product<isize>();
+
+  auto empty = sus::Vec<Wrapping<u8>>();
+  EXPECT_EQ(empty.iter().sum<Wrapping<u8>>(), 0_u8);
+  EXPECT_EQ(empty.iter().product<Wrapping<u8>>(), 1_u8);
+}
+
+TEST(WrappingDeathTest, DivByZero) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto w = Wrapping<i32>(1) / 0;
+        ensure_use(&w);
+      },
+      "");
+  EXPECT_DEATH(
+      {
+        auto w = Wrapping<u32>(1u) % 0u;
+        ensure_use(&w);
+      },
+      "");
+#endif
+}
+
+}  // namespace
@@ -14,11 +14,18 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "sus/cmp/ord.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/iter/__private/iterator_end.h"
 #include "sus/iter/__private/step.h"
 #include "sus/iter/iterator_defn.h"
+#include "sus/marker/unsafe.h"
+#include "sus/mem/addressof.h"
 #include "sus/mem/move.h"
 #include "sus/mem/relocate.h"
+#include "sus/mem/replace.h"
 #include "sus/option/option.h"
 #include "sus/string/__private/any_formatter.h"
 #include "sus/string/__private/format_to_stream.h"
@@ -58,24 +65,72 @@ namespace __private {
 template <class Final, class T, bool = ::sus::iter::__private::Step<T>>
 class RangeIter;
 
+/// An adaptor for range-based for loops over a range, which compares `start`
+/// and `finish` directly instead of going through an `Option` for each item.
+///
+/// Like `IteratorLoop`, each item is consumed from the range before the loop
+/// body runs with it.
+template <class Final, class T>
+class [[nodiscard]] RangeLoop final {
+ public:
+  constexpr RangeLoop(Final& range) noexcept : range_(range) {}
+
+  friend constexpr bool operator==(const RangeLoop& loop,
+                                   ::sus::iter::__private::IteratorEnd) noexcept {
+    return !(loop.range_.start < loop.range_.finish);
+  }
+  // The item is consumed in operator*(), which is called exactly once per
+  // iteration of a range-based for loop.
+  constexpr inline void operator++() & noexcept {}
+  constexpr inline T operator*() & noexcept {
+    // SAFETY: `start < finish` as operator*() is only called while the loop is
+    // not at its end, so `start + 1` is at most `finish`.
+    return ::sus::mem::replace(
+        range_.start, ::sus::iter::__private::step_forward_by_unchecked(
+                          ::sus::marker::unsafe_fn, range_.start, 1u));
+  }
+
+ private:
+  Final& range_;
+};
+
 template <class Final, class T>
 class RangeIter<Final, T, true> : public ::sus::iter::IteratorBase<Final, T> {
  public:
   using Item = T;
 
+  // The methods here step `start` and `finish` without overflow checks, as they
+  // never step past the other end of the range, which is a valid `T`. Without
+  // a check in each step, loops over a range can be unrolled and vectorized.
+
+  /// Adaptor for use in ranged for loops.
+  constexpr auto begin() & noexcept {
+    return RangeLoop<Final, T>(static_cast<Final&>(*this));
+  }
+  /// Adaptor for use in ranged for loops.
+  constexpr auto end() & noexcept {
+    return ::sus::iter::__private::IteratorEnd();
+  }
+
   // sus::iter::Iterator trait.
   constexpr Option<T> next() noexcept {
-    if (static_cast<Final*>(this)->start == static_cast<Final*>(this)->finish)
-      return Option<T>();
-    return Option<T>(
-        ::sus::mem::replace(static_cast<Final*>(this)->start,
-                            ::sus::iter::__private::step_forward(
-                                static_cast<Final*>(this)->start)));
+    Final& self = static_cast<Final&>(*this);
+    if (!(self.start < self.finish)) return Option<T>();
+    return Option<T>(step_start_unchecked(self));
   }
 
   // sus::iter::Iterator trait.
   constexpr ::sus::iter::SizeHint size_hint() const noexcept {
-    const usize rem = exact_size_hint();
+    const Final& self = static_cast<const Final&>(*this);
+    if (!(self.start < self.finish))
+      return ::sus::iter::SizeHint(0u, ::sus::Option<usize>(0u));
+    Option<usize> steps =
+        ::sus::iter::__private::steps_between(self.start, self.finish);
+    if (steps.is_none()) {
+      // There are more steps than fit in `usize`.
+      return ::sus::iter::SizeHint(usize::MAX, ::sus::Option<usize>());
+    }
+    const usize rem = *steps;
     return ::sus::iter::SizeHint(rem, ::sus::Option<usize>(rem));
   }
 
@@ -87,17 +142,130 @@ class RangeIter<Final, T, true> : public ::sus::iter::IteratorBase<Final, T> {
     return sus::move(steps).unwrap_or_default();
   }
 
+  /// sus::iter::TrustedLen trait.
+  /// #[doc.hidden]
+  constexpr ::sus::iter::__private::TrustedLenMarker trusted_len()
+      const noexcept {
+    return {};
+  }
+
   // sus::iter::DoubleEndedIterator trait.
   constexpr Option<T> next_back() noexcept {
-    if (static_cast<Final*>(this)->start == static_cast<Final*>(this)->finish)
-      return Option<T>();
-    static_cast<Final*>(this)->finish = ::sus::iter::__private::step_backward(
-        static_cast<Final*>(this)->finish);
-    return Option<T>(static_cast<Final*>(this)->finish);
+    Final& self = static_cast<Final&>(*this);
+    if (!(self.start < self.finish)) return Option<T>();
+    return Option<T>(step_finish_unchecked(self));
+  }
+
+  // Iterator::nth(), in constant time.
+  constexpr Option<T> nth(usize n) noexcept {
+    Final& self = static_cast<Final&>(*this);
+    if (self.start < self.finish) {
+      Option<usize> steps =
+          ::sus::iter::__private::steps_between(self.start, self.finish);
+      // No steps means there are more than fit in `usize`, so more than `n`.
+      if (steps.is_none() || n < *steps) {
+        // SAFETY: `n` steps from `start` is before `finish`.
+        T out = ::sus::iter::__private::step_forward_by_unchecked(
+            ::sus::marker::unsafe_fn, self.start, n);
+        self.start = ::sus::iter::__private::step_forward_by_unchecked(
+            ::sus::marker::unsafe_fn, out, 1u);
+        return Option<T>(::sus::move(out));
+      }
+    }
+    self.start = self.finish;
+    return Option<T>();
+  }
+
+  // DoubleEndedIterator::nth_back(), in constant time.
+  constexpr Option<T> nth_back(usize n) noexcept {
+    Final& self = static_cast<Final&>(*this);
+    if (self.start < self.finish) {
+      Option<usize> steps =
+          ::sus::iter::__private::steps_between(self.start, self.finish);
+      if (steps.is_none() || n < *steps) {
+        // SAFETY: `n + 1` steps back from `finish` is at or after `start`.
+        self.finish = ::sus::iter::__private::step_backward_by_unchecked(
+            ::sus::marker::unsafe_fn, self.finish, n + 1u);
+        return Option<T>(self.finish);
+      }
+    }
+    self.finish = self.start;
+    return Option<T>();
+  }
+
+  // Iterator::fold(), without constructing an `Option` for each item.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, T)> F>
+    requires(std::convertible_to<std::invoke_result_t<F&, B &&, T &&>, B> &&
+             (!std::is_reference_v<B> ||
+              std::is_reference_v<std::invoke_result_t<F&, B &&, T &&>>))
+  constexpr B fold(B init, F f) && noexcept {
+    Final& self = static_cast<Final&>(*this);
+    if constexpr (std::is_reference_v<B>) {
+      std::remove_reference_t<B>* out = ::sus::mem::addressof(init);
+      while (self.start < self.finish) {
+        out = ::sus::mem::addressof(
+            ::sus::fn::call_mut(f, *out, step_start_unchecked(self)));
+      }
+      return *out;
+    } else {
+      while (self.start < self.finish) {
+        init = ::sus::fn::call_mut(f, ::sus::move(init),
+                                   step_start_unchecked(self));
+      }
+      return init;
+    }
+  }
+
+  // DoubleEndedIterator::rfold(), without constructing an `Option` for each
+  // item.
+  template <class B, ::sus::fn::FnMut<::sus::fn::NonVoid(B, T)> F>
+    requires(std::convertible_to<std::invoke_result_t<F&, B &&, T &&>, B> &&
+             (!std::is_reference_v<B> ||
+              std::is_reference_v<std::invoke_result_t<F&, B &&, T &&>>))
+  constexpr B rfold(B init, F f) && noexcept {
+    Final& self = static_cast<Final&>(*this);
+    if constexpr (std::is_reference_v<B>) {
+      std::remove_reference_t<B>* out = ::sus::mem::addressof(init);
+      while (self.start < self.finish) {
+        out = ::sus::mem::addressof(
+            ::sus::fn::call_mut(f, *out, step_finish_unchecked(self)));
+      }
+      return *out;
+    } else {
+      while (self.start < self.finish) {
+        init = ::sus::fn::call_mut(f, ::sus::move(init),
+                                   step_finish_unchecked(self));
+      }
+      return init;
+    }
+  }
+
+  // Iterator::for_each(), without constructing an `Option` for each item.
+  template <::sus::fn::FnMut<void(T&&)> F>
+  constexpr void for_each(F f) && noexcept {
+    Final& self = static_cast<Final&>(*this);
+    while (self.start < self.finish)
+      ::sus::fn::call_mut(f, step_start_unchecked(self));
   }
 
   // TODO: Provide and test overrides of Iterator min(), max(), count(),
   // advance_by(), etc that can be done efficiently here.
+
+ private:
+  // Returns `start` and steps it forward. Requires `start < finish`.
+  static constexpr T step_start_unchecked(Final& self) noexcept {
+    // SAFETY: `start < finish` so `start + 1` is at most `finish`.
+    return ::sus::mem::replace(
+        self.start, ::sus::iter::__private::step_forward_by_unchecked(
+                        ::sus::marker::unsafe_fn, self.start, 1u));
+  }
+  // Steps `finish` back and returns it. Requires `start < finish`.
+  static constexpr T step_finish_unchecked(Final& self) noexcept {
+    // SAFETY: `start < finish` so `finish - 1` is at least `start`.
+    self.finish = ::sus::iter::__private::step_backward_by_unchecked(
+        ::sus::marker::unsafe_fn, self.finish, 1u);
+    return self.finish;
+  }
 };
 
 template <class Final, class T>
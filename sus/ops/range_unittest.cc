@@ -18,6 +18,7 @@
 
 #include "googletest/include/gtest/gtest.h"
 #include "sus/construct/default.h"
+#include "sus/iter/iterator.h"
 #include "sus/macros/compiler.h"
 #include "sus/prelude.h"
 
@@ -315,6 +316,153 @@ TEST(Range, RangeForIterator) {
   EXPECT_EQ(v.len(), 3u);
 }
 
+TEST(Range, RangeForConsumes) {
+  // Each item is consumed from the range before the loop body sees it.
+  auto r = "1..5"_r;
+  for (usize i : r) {
+    if (i == 2u) break;
+  }
+  EXPECT_EQ(r.next().unwrap(), 3u);
+}
+
+TEST(Range, IterEmptyOrReversed) {
+  auto empty = "3..3"_r;
+  EXPECT_EQ(empty.size_hint().upper, sus::some(0u));
+  EXPECT_EQ(empty.next(), sus::None);
+  EXPECT_EQ(empty.next_back(), sus::None);
+
+  // A range where the start is after the end is empty, not a range that wraps
+  // around.
+  auto reversed = sus::ops::range(5_i32, 2_i32);
+  EXPECT_EQ(reversed.exact_size_hint(), 0u);
+  EXPECT_EQ(reversed.size_hint().lower, 0u);
+  EXPECT_EQ(reversed.size_hint().upper, sus::some(0u));
+  EXPECT_EQ(reversed.next(), sus::None);
+  EXPECT_EQ(reversed.next_back(), sus::None);
+  EXPECT_EQ(reversed.nth(0u), sus::None);
+  usize count;
+  for (i32 i : sus::ops::range(5_i32, 2_i32)) {
+    (void)i;
+    count += 1u;
+  }
+  EXPECT_EQ(count, 0u);
+}
+
+TEST(Range, IterSmallSigned) {
+  // The distance does not fit in an `i8`.
+  auto it = sus::ops::range(-100_i8, 100_i8);
+  EXPECT_EQ(it.exact_size_hint(), 200u);
+  EXPECT_EQ(it.next().unwrap(), -100_i8);
+  EXPECT_EQ(it.next_back().unwrap(), 99_i8);
+  EXPECT_EQ(it.exact_size_hint(), 198u);
+
+  // The full range, which ends at `MAX` without stepping past it.
+  auto full = sus::ops::range(i8::MIN, i8::MAX);
+  EXPECT_EQ(full.exact_size_hint(), 255u);
+  EXPECT_EQ(full.nth_back(0u).unwrap(), 126_i8);
+  EXPECT_EQ(full.nth(253u).unwrap(), 125_i8);
+  EXPECT_EQ(full.next(), sus::None);
+}
+
+#if defined(__SIZEOF_INT128__)
+TEST(Range, IterWide) {
+  // Values beyond 2^64 are stepped in 128 bits.
+  const auto big = u128(1u) << 64u;
+  auto it = sus::ops::range(big, big + 10u);
+  EXPECT_EQ(it.exact_size_hint(), 10u);
+  EXPECT_EQ(it.nth(3u).unwrap(), big + 3u);
+  EXPECT_EQ(it.nth_back(1u).unwrap(), big + 8u);
+  EXPECT_EQ(it.exact_size_hint(), 4u);
+
+  usize count;
+  for (u128 i : sus::ops::range(big, big + 3u)) {
+    EXPECT_EQ(i, big + u128::from(count));
+    count += 1u;
+  }
+  EXPECT_EQ(count, 3u);
+
+  // A distance that doesn't fit in `usize` has no exact size.
+  auto far = sus::ops::range(0_u128, big + 5u);
+  EXPECT_EQ(far.size_hint().upper, sus::None);
+  EXPECT_EQ(far.nth(5u).unwrap(), 5_u128);
+
+  const auto neg = -(i128(1) << 64u);
+  auto signed_it = sus::ops::range(neg, neg + 4);
+  EXPECT_EQ(signed_it.exact_size_hint(), 4u);
+  EXPECT_EQ(signed_it.nth(2u).unwrap(), neg + 2);
+  EXPECT_EQ(signed_it.next_back().unwrap(), neg + 3);
+  EXPECT_EQ(signed_it.next(), sus::None);
+
+  const unsigned __int128 prim = big.primitive_value;
+  auto prim_it = sus::ops::range(prim, prim + 3u);
+  EXPECT_EQ(prim_it.exact_size_hint(), 3u);
+  EXPECT_TRUE(prim_it.nth(2u).unwrap() == prim + 2u);
+}
+#endif
+
+TEST(Range, IterNth) {
+  auto it = "2..10"_r;
+  EXPECT_EQ(it.nth(0u).unwrap(), 2u);
+  EXPECT_EQ(it.nth(2u).unwrap(), 5u);
+  EXPECT_EQ(it.nth_back(1u).unwrap(), 8u);
+  EXPECT_EQ(it.exact_size_hint(), 2u);
+  EXPECT_EQ(it.nth(2u), sus::None);
+  EXPECT_EQ(it.exact_size_hint(), 0u);
+  EXPECT_EQ(it.next(), sus::None);
+
+  auto back = "2..10"_r;
+  EXPECT_EQ(back.nth_back(8u), sus::None);
+  EXPECT_EQ(back.next(), sus::None);
+
+  auto big = sus::ops::range(0_u64, u64::MAX);
+  EXPECT_EQ(big.nth(usize::MAX - 1u).unwrap(), u64::MAX - 1u);
+  EXPECT_EQ(big.next(), sus::None);
+}
+
+TEST(Range, IterStepByRev) {
+  static_assert(sus::iter::TrustedLen<Range<usize>>);
+
+  EXPECT_EQ(sus::ops::range(0_i32, 10_i32).step_by(3u).collect_vec(),
+            sus::Vec<i32>(0, 3, 6, 9));
+  EXPECT_EQ(sus::ops::range(0_i32, 10_i32).step_by(3u).rev().collect_vec(),
+            sus::Vec<i32>(9, 6, 3, 0));
+  EXPECT_EQ(sus::ops::range(0_i32, 9_i32).step_by(4u).rev().collect_vec(),
+            sus::Vec<i32>(8, 4, 0));
+  EXPECT_EQ(sus::ops::range(0_i32, 5_i32).rev().collect_vec(),
+            sus::Vec<i32>(4, 3, 2, 1, 0));
+  EXPECT_EQ(sus::ops::range(0_i32, 10_i32).rev().nth(2u).unwrap(), 7_i32);
+  EXPECT_EQ(sus::ops::range(5_i32, 2_i32).step_by(2u).next(), sus::None);
+  EXPECT_EQ(sus::ops::range(5_i32, 2_i32).rev().next(), sus::None);
+}
+
+TEST(Range, IterFold) {
+  EXPECT_EQ(sus::ops::range(1_i32, 5_i32).fold(
+                0_i32, [](i32 acc, i32 i) { return acc * 10 + i; }),
+            1234_i32);
+  EXPECT_EQ(sus::ops::range(1_i32, 5_i32).rfold(
+                0_i32, [](i32 acc, i32 i) { return acc * 10 + i; }),
+            4321_i32);
+  EXPECT_EQ(sus::ops::range(1_i32, 5_i32).rev().fold(
+                0_i32, [](i32 acc, i32 i) { return acc * 10 + i; }),
+            4321_i32);
+  EXPECT_EQ(sus::ops::range(5_i32, 1_i32).fold(
+                7_i32, [](i32 acc, i32 i) { return acc + i; }),
+            7_i32);
+
+  i32 total;
+  i32& out = sus::ops::range(1_i32, 4_i32).fold<i32&>(
+      total, [](i32& acc, i32 i) -> i32& {
+        acc += i;
+        return acc;
+      });
+  EXPECT_EQ(&out, &total);
+  EXPECT_EQ(total, 1 + 2 + 3);
+
+  auto v = sus::Vec<i32>();
+  sus::ops::range(-2_i32, 2_i32).for_each([&](i32 i) { v.push(i); });
+  EXPECT_EQ(v, sus::Vec<i32>(-2, -1, 0, 1));
+}
+
 TEST(Range, StructuredBindings) {
   auto [a, b] = "1..5"_r;
   EXPECT_EQ(a, 1u);
@@ -230,6 +230,11 @@ struct Storage<T, true> final {
   }
 
   constexpr Storage() noexcept : access_() {}
+  /// Constructs the storage with the `T` in the never-value niche `niche`.
+  constexpr Storage(::sus::mem::NeverValueConstructor, size_t niche) noexcept
+      : access_() {
+    access_.set_niche(::sus::marker::unsafe_fn, niche);
+  }
   constexpr Storage(const T& t) noexcept : access_(t) {}
   constexpr Storage(T&& t) noexcept : access_(::sus::move(t)) {}
 
@@ -259,6 +264,16 @@ struct Storage<T, true> final {
     return access_.is_constructed() ? Some : None;
   }
 
+  /// Checks if the `T` is in the never-value niche `niche`. Niche 0 is `None`,
+  /// and the others are used by a type that holds the `Option`.
+  _sus_pure constexpr inline bool is_niche(size_t niche) const noexcept {
+    return access_.is_niche(niche);
+  }
+  /// Moves the `T` from one never-value niche to another.
+  constexpr inline void set_niche(size_t niche) noexcept {
+    access_.set_niche(::sus::marker::unsafe_fn, niche);
+  }
+
   constexpr inline void construct_from_none(const T& t) noexcept
     requires(::sus::mem::Copy<T>)
   {
@@ -41,6 +41,7 @@
 #include "sus/mem/copy.h"
 #include "sus/mem/forward.h"
 #include "sus/mem/move.h"
+#include "sus/mem/never_value.h"
 #include "sus/mem/relocate.h"
 #include "sus/mem/replace.h"
 #include "sus/mem/take.h"
@@ -185,6 +186,12 @@ namespace sus {
 /// ["null pointer optimization" or NPO in Rust](
 /// https://doc.rust-lang.org/stable/std/option/index.html#representation).
 ///
+/// When `T` has more than one never-value niche, as
+/// [`Box<T>`]($sus::boxed::Box) and [`Choice`]($sus::choice_type::Choice) do,
+/// the [`Option<T>`]($sus::option::Option) passes the unused niches on, so
+/// that an `Option<Option<T>>` also has the same size as `T`. See
+/// [`never_value_niche_count`]($sus::mem::never_value_niche_count).
+///
 /// # Reference parameters
 ///
 /// As mentioned above [`Option`]($sus::option::Option) type can hold a
@@ -1984,6 +1991,56 @@ class Option final {
 
   sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
                                            StorageType<T>);
+
+  // When `T` has more than one never-value niche, `None` is stored in its
+  // first niche, and the `Option` is itself a `NeverValueField` with the
+  // remaining niches. Then an `Option` that holds this `Option` also needs no
+  // extra storage. The `Option` is in its niche `n` when the `T` is in niche
+  // `n + 1`.
+  static constexpr size_t _sus_Unsafe_NeverValueNicheCount = []() {
+    if constexpr (std::is_reference_v<T>)
+      return size_t{0u};
+    else if constexpr (::sus::mem::never_value_niche_count<T>() > 1u)
+      return ::sus::mem::never_value_niche_count<T>() - 1u;
+    else
+      return size_t{0u};
+  }();
+  static constexpr bool kHasNiches = _sus_Unsafe_NeverValueNicheCount > 0u;
+
+  template <class>
+  friend struct ::sus::mem::__private::NeverValueAccess;
+  template <class>
+  friend struct ::sus::mem::__private::NeverValueChecker;
+
+  _sus_pure constexpr bool _sus_Unsafe_NeverValueIsConstructed(
+      ::sus::marker::UnsafeFnMarker) const noexcept
+    requires(kHasNiches)
+  {
+    return !t_.is_niche(1u);
+  }
+  _sus_pure constexpr bool _sus_Unsafe_NeverValueIsNiche(
+      ::sus::marker::UnsafeFnMarker, size_t niche) const noexcept
+    requires(kHasNiches)
+  {
+    return t_.is_niche(niche + 1u);
+  }
+  constexpr void _sus_Unsafe_NeverValueSetNiche(::sus::marker::UnsafeFnMarker,
+                                                size_t niche) noexcept
+    requires(kHasNiches)
+  {
+    t_.set_niche(niche + 1u);
+  }
+  // The destroy-value is `None`, which the destructor does nothing for.
+  constexpr void _sus_Unsafe_NeverValueSetDestroyValue(
+      ::sus::marker::UnsafeFnMarker) noexcept
+    requires(kHasNiches)
+  {
+    t_.set_niche(0u);
+  }
+  // For the NeverValueField.
+  constexpr explicit Option(::sus::mem::NeverValueConstructor) noexcept
+    requires(kHasNiches)
+      : t_(::sus::mem::NeverValueConstructor(), 1u) {}
 };
 
 template <class T>
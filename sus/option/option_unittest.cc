@@ -19,6 +19,8 @@
 
 #include "fmt/std.h"
 #include "googletest/include/gtest/gtest.h"
+#include "sus/boxed/box.h"
+#include "sus/choice/choice.h"
 #include "sus/collections/array.h"
 #include "sus/iter/from_iterator.h"
 #include "sus/iter/iterator.h"
@@ -3186,6 +3188,46 @@ TEST(Option, NoExtraNeverValueConstruction) {
 }
 }  // namespace no_extra_never_value_construction
 
+TEST(Option, NestedNeverValueNiches) {
+  // `None` uses the first niche of the `Box`, and the outer `None` uses the
+  // second.
+  using B = sus::Box<i32>;
+  static_assert(sus::mem::never_value_niche_count<B>() == 2u);
+  static_assert(sus::mem::never_value_niche_count<Option<B>>() == 1u);
+  static_assert(sus::mem::never_value_niche_count<Option<Option<B>>>() == 0u);
+  static_assert(sizeof(Option<Option<B>>) == sizeof(B));
+  static_assert(sizeof(Option<Option<Option<B>>>) > sizeof(B));
+
+  auto outer_none = Option<Option<B>>();
+  EXPECT_EQ(outer_none.is_none(), true);
+  auto inner_none = Option<Option<B>>(Option<B>());
+  EXPECT_EQ(inner_none.is_some(), true);
+  EXPECT_EQ(inner_none->is_none(), true);
+  auto some = Option<Option<B>>(Option<B>(B(3_i32)));
+  EXPECT_EQ(some.is_some(), true);
+  EXPECT_EQ(**some.as_value(), 3_i32);
+
+  outer_none = sus::move(some);
+  EXPECT_EQ(some.is_none(), true);
+  EXPECT_EQ(**outer_none.as_value(), 3_i32);
+  inner_none.insert(outer_none.take().unwrap());
+  EXPECT_EQ(outer_none.is_none(), true);
+  EXPECT_EQ(**inner_none.as_value(), 3_i32);
+  EXPECT_EQ(sus::move(inner_none).flatten().map([](B b) { return *b; }),
+            sus::some(3_i32));
+
+  // `Choice` has a niche for each unused index.
+  using C = sus::Choice<sus_choice_types((1, u32), (2, u64))>;
+  static_assert(sizeof(Option<Option<Option<C>>>) == sizeof(C));
+  static_assert([]() {
+    auto o = Option<Option<Option<C>>>(sus::some(Option<C>()));
+    auto p = Option<Option<Option<C>>>(sus::some(sus::some(C::with<1>(2u))));
+    return o.is_some() && o->is_some() && o->as_value().is_none() &&
+           p->as_value()->as<1>() == 2u &&
+           Option<Option<Option<C>>>().is_none();
+  }());
+}
+
 template <class To, class From>
 concept CanConvertOption = requires {
   { Option<To>(Option<From>()) };
@@ -49,11 +49,17 @@ using sus::num::f64;
 using sus::num::i16;
 using sus::num::i32;
 using sus::num::i64;
+#if defined(__SIZEOF_INT128__)
+using sus::num::i128;
+#endif
 using sus::num::i8;
 using sus::num::isize;
 using sus::num::u16;
 using sus::num::u32;
 using sus::num::u64;
+#if defined(__SIZEOF_INT128__)
+using sus::num::u128;
+#endif
 using sus::num::u8;
 using sus::num::uptr;
 using sus::num::usize;
@@ -70,11 +76,17 @@ using sus::prelude::f64;
 using sus::prelude::i16;
 using sus::prelude::i32;
 using sus::prelude::i64;
+#if defined(__SIZEOF_INT128__)
+using sus::prelude::i128;
+#endif
 using sus::prelude::i8;
 using sus::prelude::isize;
 using sus::prelude::u16;
 using sus::prelude::u32;
 using sus::prelude::u64;
+#if defined(__SIZEOF_INT128__)
+using sus::prelude::u128;
+#endif
 using sus::prelude::u8;
 using sus::prelude::uptr;
 using sus::prelude::usize;
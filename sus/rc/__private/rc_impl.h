@@ -0,0 +1,629 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <compare>
+#include <concepts>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+#include "sus/assertions/check.h"
+#include "sus/assertions/debug_check.h"
+#include "sus/boxed/dyn.h"
+#include "sus/cmp/eq.h"
+#include "sus/cmp/ord.h"
+#include "sus/collections/slice.h"
+#include "sus/collections/vec.h"
+#include "sus/fn/fn_concepts.h"
+#include "sus/fn/fn_dyn.h"
+#include "sus/macros/pure.h"
+#include "sus/mem/clone.h"
+#include "sus/mem/move.h"
+#include "sus/mem/never_value.h"
+#include "sus/mem/relocate.h"
+#include "sus/mem/replace.h"
+#include "sus/num/unsigned_integer.h"
+#include "sus/option/option.h"
+#include "sus/string/__private/any_formatter.h"
+#include "sus/string/__private/format_to_stream.h"
+
+namespace sus::rc::__private {
+
+/// A reference count which is only used from a single thread.
+struct LocalCount {
+  static constexpr const char kUsedAfterMove[] = "Rc used after move";
+
+  void increment() noexcept { n += 1u; }
+  /// Returns whether the count reached zero.
+  bool decrement() noexcept {
+    n -= 1u;
+    return n == 0u;
+  }
+  bool increment_if_nonzero() noexcept {
+    if (n == 0u) return false;
+    n += 1u;
+    return true;
+  }
+  size_t load() const noexcept { return n; }
+
+  // Nothing else can change the count while it is being checked, so it is
+  // never locked.
+  static constexpr size_t kLocked = SIZE_MAX;
+  bool try_lock_one() noexcept { return n == 1u; }
+  void unlock_one() noexcept {}
+  void increment_unlocked() noexcept { n += 1u; }
+
+  size_t n;
+};
+
+/// A reference count which may be shared between threads.
+struct AtomicCount {
+  static constexpr const char kUsedAfterMove[] = "Arc used after move";
+  /// The value held by a count of one while it is locked by `try_lock_one()`.
+  static constexpr size_t kLocked = SIZE_MAX;
+
+  // A new reference is made from an existing one, which already keeps the
+  // value alive, so the increment needs no ordering.
+  void increment() noexcept { n.fetch_add(1u, std::memory_order_relaxed); }
+  /// Returns whether the count reached zero.
+  ///
+  /// Every use of the value through a reference happens before the reference
+  /// is released, and the thread which releases the last one acquires all of
+  /// those uses before destroying the value.
+  bool decrement() noexcept {
+    if (n.fetch_sub(1u, std::memory_order_release) != 1u) return false;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return true;
+  }
+  bool increment_if_nonzero() noexcept {
+    size_t cur = n.load(std::memory_order_relaxed);
+    do {
+      if (cur == 0u) return false;
+    } while (!n.compare_exchange_weak(cur, cur + 1u, std::memory_order_acquire,
+                                      std::memory_order_relaxed));
+    return true;
+  }
+  size_t load() const noexcept { return n.load(std::memory_order_acquire); }
+
+  /// Locks the count if it is one, by replacing it with `kLocked` until
+  /// `unlock_one()`. Returns whether the count was locked.
+  ///
+  /// The weak count is locked while `RcImpl::is_unique()` checks the strong
+  /// count, so that no weak reference can be made from another strong
+  /// reference in between the two checks.
+  bool try_lock_one() noexcept {
+    size_t one = 1u;
+    return n.compare_exchange_strong(one, kLocked, std::memory_order_acquire,
+                                     std::memory_order_relaxed);
+  }
+  void unlock_one() noexcept { n.store(1u, std::memory_order_release); }
+  /// Increments the count, first waiting for it to be unlocked if it is
+  /// locked by `try_lock_one()`.
+  void increment_unlocked() noexcept {
+    size_t cur = n.load(std::memory_order_relaxed);
+    while (true) {
+      // The lock is only held for two atomic operations.
+      if (cur == kLocked) {
+        std::this_thread::yield();
+        cur = n.load(std::memory_order_relaxed);
+        continue;
+      }
+      // Acquires the release in `unlock_one()`, so the strong count checked
+      // by `is_unique()` happens before this reference exists.
+      if (n.compare_exchange_weak(cur, cur + 1u, std::memory_order_acquire,
+                                  std::memory_order_relaxed))
+        return;
+    }
+  }
+
+  std::atomic<size_t> n;
+};
+
+/// The counts at the start of the heap allocation, which is followed directly
+/// by the value. The header is aligned so that the value is aligned for any
+/// type with up to the default `operator new` alignment.
+template <class Count>
+struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) RcHeader {
+  /// The number of strong references.
+  Count strong;
+  /// The number of weak references, plus one held together by all the strong
+  /// references.
+  Count weak;
+};
+
+template <class Count, class T>
+inline RcHeader<Count>& header_of(const T* value) noexcept {
+  auto* bytes = const_cast<char*>(reinterpret_cast<const char*>(value));
+  return *std::launder(
+      reinterpret_cast<RcHeader<Count>*>(bytes - sizeof(RcHeader<Count>)));
+}
+
+/// Allocates the header and a `V` constructed from `args` in one allocation.
+template <class Count, class V, class... Args>
+V* allocate(size_t extra_bytes, Args&&... args) noexcept {
+  static_assert(alignof(V) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                "Reference-counted values can not be over-aligned");
+  auto* bytes = static_cast<char*>(
+      ::operator new(sizeof(RcHeader<Count>) + sizeof(V) + extra_bytes));
+  new (bytes) RcHeader<Count>(Count(1u), Count(1u));
+  return new (bytes + sizeof(RcHeader<Count>))
+      V(::sus::forward<Args>(args)...);
+}
+
+/// Releases the weak reference held by `header`, and frees the allocation if
+/// it was the last one.
+template <class Count>
+inline void release_weak(RcHeader<Count>& header) noexcept {
+  if (header.weak.decrement()) {
+    header.~RcHeader<Count>();
+    ::operator delete(static_cast<void*>(&header));
+  }
+}
+
+/// How the value of type `T` is placed in the allocation and destroyed.
+template <class T>
+struct RcValue {
+  static constexpr bool kIsSlice = false;
+  static void destroy(T* t) noexcept { std::destroy_at(t); }
+};
+
+/// A shared slice places its elements after the `Slice` which refers to them,
+/// in the same allocation.
+template <class U>
+struct RcValue<::sus::collections::Slice<U>> {
+  using Slice = ::sus::collections::Slice<U>;
+  using Element = U;
+
+  static_assert(alignof(U) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                "Reference-counted values can not be over-aligned");
+  static constexpr bool kIsSlice = true;
+  /// The offset of the elements from the `Slice`.
+  static constexpr size_t kElementsOffset =
+      (sizeof(Slice) + alignof(U) - 1u) / alignof(U) * alignof(U);
+
+  /// Allocates space for `len` elements after the `Slice`, and constructs
+  /// them with `init(elements)`.
+  template <class Count, class Init>
+  static Slice* allocate_with(size_t len, Init init) noexcept {
+    const size_t extra = kElementsOffset - sizeof(Slice) + len * sizeof(U);
+    auto* slice = __private::allocate<Count, Slice>(extra);
+    U* elements = elements_of(slice);
+    init(elements);
+    *slice = Slice::from_raw_parts(::sus::marker::unsafe_fn, elements,
+                                   usize(len));
+    return slice;
+  }
+
+  static U* elements_of(Slice* slice) noexcept {
+    return reinterpret_cast<U*>(reinterpret_cast<char*>(slice) +
+                                kElementsOffset);
+  }
+
+  static void destroy(Slice* slice) noexcept {
+    std::destroy_n(elements_of(slice), size_t{slice->len()});
+    std::destroy_at(slice);
+  }
+};
+
+template <class T, class Count>
+class WeakImpl;
+
+/// A shared pointer to a `T` in a single heap allocation along with its
+/// reference counts. This implements [`Rc`]($sus::rc::Rc) with `LocalCount`,
+/// and [`Arc`]($sus::sync::Arc) with `AtomicCount`.
+template <class T, class Count>
+class [[_sus_trivial_abi]] RcImpl final {
+  static_assert(!std::is_reference_v<T>, "Rc of a reference is not allowed.");
+  static_assert(!std::is_array_v<T>,
+                "Rc<T[N]> is not allowed, use Rc<Slice<T>>");
+
+  using Value = RcValue<T>;
+  using Header = RcHeader<Count>;
+
+ public:
+  /// Constructs an `Rc` which allocates space on the heap and moves `T` into
+  /// it.
+  template <std::convertible_to<T> U>
+  explicit RcImpl(U u) noexcept
+    requires(!Value::kIsSlice && ::sus::mem::Move<U>)
+      : RcImpl(FROM_POINTER,
+               __private::allocate<Count, T>(0u, ::sus::move(u))) {}
+
+  /// Releases the strong reference. The inner `T` is destroyed if this was the
+  /// last strong reference, and the allocation is freed once there are no weak
+  /// references left either.
+  ///
+  /// Does nothing if the `Rc` was moved-from.
+  ~RcImpl() noexcept {
+    if (t_) release();
+  }
+
+  /// Constructs an `Rc` by calling the constructor of `T` with `args`.
+  template <class... Args>
+    requires(!Value::kIsSlice && std::constructible_from<T, Args && ...>)
+  static RcImpl with_args(Args&&... args) noexcept {
+    return RcImpl(FROM_POINTER, __private::allocate<Count, T>(
+                                    0u, ::sus::forward<Args>(args)...));
+  }
+
+  /// Converts `U` into an `Rc<T>`, allocating on the heap and moving `u` into
+  /// it.
+  ///
+  /// Satisfies the [`From<U>`]($sus::construct::From) concept.
+  /// #[doc.overloads=convert]
+  template <std::convertible_to<T> U>
+  static RcImpl from(U u) noexcept
+    requires(!Value::kIsSlice && ::sus::mem::Move<U>)
+  {
+    return RcImpl(FROM_POINTER,
+                  __private::allocate<Count, T>(0u, ::sus::move(u)));
+  }
+
+  /// For a type-erased `DynC` of a concept `C`, `Rc<DynC>` can be constructed
+  /// from a type that satisfies `C`, as with [`Box`]($sus::boxed::Box).
+  ///
+  /// The value is never moved again once it is in the heap allocation, so `U`
+  /// only needs to be move-constructible, which allows lambdas.
+  ///
+  /// See [`DynConcept`]($sus::boxed::DynConcept) for more on type erasure of
+  /// concept-satisfying types.
+  /// #[doc.overloads=dync]
+  template <std::move_constructible U>
+  static RcImpl from(U u) noexcept
+    requires(std::same_as<U, std::remove_cvref_t<U>> &&  //
+             ::sus::boxed::DynConcept<T, U> &&           //
+             T::template SatisfiesConcept<U>)
+  {
+    using DynTyped = T::template DynTyped<U, U>;
+    DynTyped* typed = __private::allocate<Count, DynTyped>(0u, ::sus::move(u));
+    T* dync = typed;
+    // The counts are found before the `DynC`, so it must be at the start of
+    // the typed object.
+    sus_debug_check(static_cast<void*>(dync) == static_cast<void*>(typed));
+    return RcImpl(FROM_POINTER, dync);
+  }
+
+  /// Converts a [`Vec<U>`]($sus::collections::Vec) into a shared
+  /// [`Slice<U>`]($sus::collections::Slice), moving the elements into a single
+  /// allocation with the reference counts. The `Vec` is left empty.
+  /// #[doc.overloads=slice]
+  template <class U>
+    requires(std::same_as<T, ::sus::collections::Slice<U>>)
+  static RcImpl from(::sus::collections::Vec<U>&& vec) noexcept {
+    const size_t len = size_t{vec.len()};
+    auto init = [&vec, len](U* elements) {
+      for (size_t i = 0u; i < len; ++i)
+        new (elements + i) U(::sus::move(vec[i]));
+    };
+    auto rc = RcImpl(FROM_POINTER,
+                     Value::template allocate_with<Count>(len, init));
+    vec.clear();
+    return rc;
+  }
+  /// Clones the elements of a [`Slice`]($sus::collections::Slice) into a
+  /// shared `Slice`, in a single allocation with the reference counts.
+  /// #[doc.overloads=slice]
+  static RcImpl from(const T& slice) noexcept
+    requires(Value::kIsSlice && ::sus::mem::Clone<typename Value::Element>)
+  {
+    using U = typename Value::Element;
+    const size_t len = size_t{slice.len()};
+    auto init = [&slice, len](U* elements) {
+      for (size_t i = 0u; i < len; ++i)
+        new (elements + i) U(::sus::clone(slice[i]));
+    };
+    return RcImpl(FROM_POINTER,
+                  Value::template allocate_with<Count>(len, init));
+  }
+
+  /// Makes another strong reference to the same value.
+  ///
+  /// Satisfies the [`Clone`]($sus::mem::Clone) concept.
+  RcImpl clone() const noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    header().strong.increment();
+    return RcImpl(FROM_POINTER, t_);
+  }
+
+  /// Satisifes the [`Move`]($sus::mem::Move) concept.
+  /// #[doc.overloads=move]
+  RcImpl(RcImpl&& rhs) noexcept
+      : RcImpl(FROM_POINTER, ::sus::mem::replace(rhs.t_, nullptr)) {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+  }
+  /// Satisifes the [`Move`]($sus::mem::Move) concept.
+  /// #[doc.overloads=move]
+  RcImpl& operator=(RcImpl&& rhs) noexcept {
+    T* t = ::sus::mem::replace(rhs.t_, nullptr);
+    sus_check_with_message(t, Count::kUsedAfterMove);
+    if (t_) release();
+    t_ = t;
+    return *this;
+  }
+
+  /// The value is shared, so it is only reachable as const.
+  _sus_pure const T& operator*() const noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    return *t_;
+  }
+  _sus_pure const T* operator->() const noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    return t_;
+  }
+
+  /// Returns a const reference to the shared value.
+  const T& as_ref() const& noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    return *t_;
+  }
+  const T& as_ref() && noexcept = delete;
+
+  /// Returns the number of strong references to the value.
+  usize strong_count() const noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    return usize(header().strong.load());
+  }
+  /// Returns the number of weak references to the value.
+  usize weak_count() const noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    const size_t weak = header().weak.load();
+    // The weak count is only locked while it is one, which is held by the
+    // strong references.
+    if (weak == Count::kLocked) return 0u;
+    return usize(weak - 1u);
+  }
+
+  /// Returns whether both refer to the same allocation, rather than comparing
+  /// the values.
+  bool ptr_eq(const RcImpl& other) const noexcept { return t_ == other.t_; }
+
+  /// Makes a weak reference to the value, which does not keep it alive.
+  WeakImpl<T, Count> downgrade() const noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    header().weak.increment_unlocked();
+    return WeakImpl<T, Count>(WeakImpl<T, Count>::FROM_POINTER, t_);
+  }
+
+  /// Returns a mutable reference to the value if there are no other strong or
+  /// weak references to it, or `None` otherwise.
+  ::sus::Option<T&> get_mut() & noexcept
+    requires(!Value::kIsSlice)
+  {
+    if (!is_unique()) return ::sus::Option<T&>();
+    return ::sus::Option<T&>(*t_);
+  }
+
+  /// Returns a mutable reference to the value, first cloning it into a new
+  /// allocation if there are other strong or weak references to it.
+  ///
+  /// This is clone-on-write: the other references keep the old value, and this
+  /// one is left as the only reference to the new one.
+  T& make_mut() & noexcept
+    requires(!Value::kIsSlice && ::sus::mem::Clone<T>)
+  {
+    if (!is_unique()) {
+      *this = RcImpl(FROM_POINTER,
+                     __private::allocate<Count, T>(0u, ::sus::clone(**this)));
+    }
+    return *t_;
+  }
+
+  /// Consumes the `Rc`, and returns the value if this was the last strong
+  /// reference to it. Otherwise returns `None`, and the value stays alive for
+  /// the other references.
+  ::sus::Option<T> into_inner() && noexcept
+    requires(!Value::kIsSlice && ::sus::mem::Move<T>)
+  {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    T* t = ::sus::mem::replace(t_, nullptr);
+    Header& h = __private::header_of<Count>(t);
+    if (!h.strong.decrement()) return ::sus::Option<T>();
+    auto out = ::sus::Option<T>(::sus::move(*t));
+    std::destroy_at(t);
+    __private::release_weak(h);
+    return out;
+  }
+
+  /// Compares the inner values for equality. Use
+  /// [`ptr_eq`]($sus::rc::Rc::ptr_eq) to compare the pointers.
+  friend bool operator==(const RcImpl& lhs, const RcImpl& rhs) noexcept
+    requires(::sus::cmp::Eq<T>)
+  {
+    return lhs.as_ref() == rhs.as_ref();
+  }
+  /// Compares the inner values for ordering.
+  friend std::strong_ordering operator<=>(const RcImpl& lhs,
+                                          const RcImpl& rhs) noexcept
+    requires(::sus::cmp::ExclusiveStrongOrd<T>)
+  {
+    return lhs.as_ref() <=> rhs.as_ref();
+  }
+  friend std::weak_ordering operator<=>(const RcImpl& lhs,
+                                        const RcImpl& rhs) noexcept
+    requires(::sus::cmp::ExclusiveOrd<T>)
+  {
+    return lhs.as_ref() <=> rhs.as_ref();
+  }
+  friend std::partial_ordering operator<=>(const RcImpl& lhs,
+                                           const RcImpl& rhs) noexcept
+    requires(::sus::cmp::ExclusivePartialOrd<T>)
+  {
+    return lhs.as_ref() <=> rhs.as_ref();
+  }
+
+  /// A shared type-erased [`DynFn`]($sus::fn::DynFn) satisfies
+  /// [`Fn`]($sus::fn::Fn), forwarding the call through to the inner type.
+  template <class... Args>
+  ::sus::fn::Return<T, Args...> operator()(Args&&... args) const&
+    requires(T::IsDynFn &&
+             ::sus::fn::Fn<T, ::sus::fn::Return<T, Args...>(Args...)>)
+  {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    return ::sus::fn::call(*t_, ::sus::forward<Args>(args)...);
+  }
+
+  // Stream support.
+  _sus_format_to_stream(RcImpl);
+
+ private:
+  friend class WeakImpl<T, Count>;
+
+  enum FromPointer { FROM_POINTER };
+  explicit RcImpl(FromPointer, T* t) noexcept : t_(t) {}
+
+  Header& header() const noexcept { return __private::header_of<Count>(t_); }
+
+  bool is_unique() const noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    // With no weak references, no new strong reference can be made except
+    // from this one. The weak count is locked while the strong count is
+    // checked, as another strong reference could otherwise make a weak
+    // reference and then be released in between the two checks.
+    Header& h = header();
+    if (!h.weak.try_lock_one()) return false;
+    const bool unique = h.strong.load() == 1u;
+    h.weak.unlock_one();
+    return unique;
+  }
+
+  void release() noexcept {
+    Header& h = header();
+    if (h.strong.decrement()) {
+      Value::destroy(t_);
+      __private::release_weak(h);
+    }
+  }
+
+  T* t_;
+
+  // The niches are addresses of the first `T` objects in the zero page, which
+  // are never allocated.
+  static T* never_value_niche(size_t niche) {
+    return reinterpret_cast<T*>(alignof(T) * (niche + 1u));
+  }
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(t_));
+  sus_class_never_value_field_niches(::sus::marker::unsafe_fn, RcImpl, t_, 2u,
+                                     never_value_niche, nullptr);
+  explicit RcImpl(::sus::mem::NeverValueConstructor) noexcept
+      : t_(never_value_niche(0u)) {}
+};
+
+/// A weak reference to the value of an `RcImpl`, which does not keep the value
+/// alive, but keeps the allocation alive so that it can check if the value
+/// is.
+template <class T, class Count>
+class [[_sus_trivial_abi]] WeakImpl final {
+  using Header = RcHeader<Count>;
+
+ public:
+  /// Releases the weak reference, freeing the allocation if there are no
+  /// references left.
+  ~WeakImpl() noexcept {
+    if (t_) __private::release_weak(header());
+  }
+
+  /// Returns a strong reference to the value if it is still alive, or `None`
+  /// if all the strong references were released.
+  ::sus::Option<RcImpl<T, Count>> upgrade() const noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    if (!header().strong.increment_if_nonzero())
+      return ::sus::Option<RcImpl<T, Count>>();
+    return ::sus::Option<RcImpl<T, Count>>(
+        RcImpl<T, Count>(RcImpl<T, Count>::FROM_POINTER, t_));
+  }
+
+  /// Makes another weak reference to the same value.
+  ///
+  /// Satisfies the [`Clone`]($sus::mem::Clone) concept.
+  WeakImpl clone() const noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    header().weak.increment();
+    return WeakImpl(FROM_POINTER, t_);
+  }
+
+  /// Satisifes the [`Move`]($sus::mem::Move) concept.
+  /// #[doc.overloads=move]
+  WeakImpl(WeakImpl&& rhs) noexcept
+      : WeakImpl(FROM_POINTER, ::sus::mem::replace(rhs.t_, nullptr)) {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+  }
+  /// Satisifes the [`Move`]($sus::mem::Move) concept.
+  /// #[doc.overloads=move]
+  WeakImpl& operator=(WeakImpl&& rhs) noexcept {
+    T* t = ::sus::mem::replace(rhs.t_, nullptr);
+    sus_check_with_message(t, Count::kUsedAfterMove);
+    if (t_) __private::release_weak(header());
+    t_ = t;
+    return *this;
+  }
+
+  /// Returns the number of strong references to the value, which is zero once
+  /// the value has been destroyed.
+  usize strong_count() const noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    return usize(header().strong.load());
+  }
+  /// Returns the number of weak references to the value, or zero once the
+  /// value has been destroyed.
+  usize weak_count() const noexcept {
+    sus_check_with_message(t_, Count::kUsedAfterMove);
+    if (header().strong.load() == 0u) return 0u;
+    return usize(header().weak.load() - 1u);
+  }
+
+  /// Returns whether both refer to the same allocation.
+  bool ptr_eq(const WeakImpl& other) const noexcept { return t_ == other.t_; }
+
+ private:
+  friend class RcImpl<T, Count>;
+
+  enum FromPointer { FROM_POINTER };
+  explicit WeakImpl(FromPointer, T* t) noexcept : t_(t) {}
+
+  Header& header() const noexcept { return __private::header_of<Count>(t_); }
+
+  T* t_;
+
+  sus_class_trivially_relocatable(::sus::marker::unsafe_fn, decltype(t_));
+};
+
+}  // namespace sus::rc::__private
+
+// fmt support.
+template <class T, class Count, class Char>
+struct fmt::formatter<::sus::rc::__private::RcImpl<T, Count>, Char> {
+  template <class ParseContext>
+  constexpr auto parse(ParseContext& ctx) {
+    return underlying_.parse(ctx);
+  }
+
+  template <class FormatContext>
+  constexpr auto format(const ::sus::rc::__private::RcImpl<T, Count>& t,
+                        FormatContext& ctx) const {
+    return underlying_.format(*t, ctx);
+  }
+
+ private:
+  ::sus::string::__private::AnyFormatter<T, Char> underlying_;
+};
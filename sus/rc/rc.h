@@ -0,0 +1,93 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "sus/rc/__private/rc_impl.h"
+
+namespace sus {
+
+/// Single-threaded reference-counted pointers, [`Rc<T>`]($sus::rc::Rc) and
+/// [`Weak<T>`]($sus::rc::Weak).
+namespace rc {}
+
+}  // namespace sus
+
+namespace sus::rc {
+
+/// A single-threaded reference-counted pointer.
+///
+/// An `Rc<T>` holds shared ownership of a `T` on the heap. Cloning an `Rc`
+/// makes another reference to the same value, and the value is destroyed when
+/// the last `Rc` referring to it is destroyed. The value is shared, so it can
+/// only be reached through a const reference, except through
+/// [`get_mut`]($sus::rc::Rc::get_mut) and
+/// [`make_mut`]($sus::rc::Rc::make_mut) which give mutable access to a value
+/// that is not shared.
+///
+/// `Rc` is similar to [`std::shared_ptr`](
+/// https://en.cppreference.com/w/cpp/memory/shared_ptr) with some differences:
+/// * The reference counts are stored in the same heap allocation as the value,
+///   always, without needing
+///   [`std::make_shared`](
+///   https://en.cppreference.com/w/cpp/memory/shared_ptr/make_shared).
+/// * The `Rc` is a single pointer, and like [`Box`]($sus::boxed::Box) it is
+///   never null until it is moved-from, which leaves niches for
+///   [`Option`]($sus::option::Option) to use.
+/// * The counts are not atomic, so they are cheaper to change but an `Rc` must
+///   not be shared between threads. Use [`Arc`]($sus::sync::Arc) for a value
+///   shared between threads.
+/// * A shared [`Slice<T>`]($sus::collections::Slice) can be made with
+///   `Rc<Slice<T>>::from(vec)`, which moves the elements of a
+///   [`Vec<T>`]($sus::collections::Vec) into a single allocation with the
+///   counts.
+/// * Like `Box`, an `Rc<DynC>` can be constructed from any type that satisfies
+///   the concept `C` of a type-erased [`DynConcept`]($sus::boxed::DynConcept).
+///
+/// A [`Weak`]($sus::rc::Weak) reference from
+/// [`downgrade`]($sus::rc::Rc::downgrade) does not keep the value alive, and
+/// can be upgraded back to an `Rc` while the value is still alive. This can be
+/// used to break reference cycles.
+///
+/// The value must not be aligned to more than
+/// `__STDCPP_DEFAULT_NEW_ALIGNMENT__`.
+///
+/// # Examples
+/// ```
+/// auto a = sus::Rc<std::string>::from(std::string("hello"));
+/// auto b = a.clone();
+/// sus_check(a.strong_count() == 2u);
+/// sus_check(&*a == &*b);
+///
+/// auto s = sus::Rc<sus::Slice<i32>>::from(sus::Vec<i32>(1, 2, 3));
+/// sus_check(s->len() == 3u);
+/// ```
+template <class T>
+using Rc = __private::RcImpl<T, __private::LocalCount>;
+
+/// A weak reference to the value of an [`Rc`]($sus::rc::Rc).
+///
+/// A `Weak` does not keep the value alive, but it can be
+/// [upgraded]($sus::rc::Weak::upgrade) to an `Rc` while the value is still
+/// alive. The heap allocation is freed once there are no `Rc` or `Weak`
+/// references left.
+template <class T>
+using Weak = __private::WeakImpl<T, __private::LocalCount>;
+
+}  // namespace sus::rc
+
+// Promote `Rc` into the `sus` namespace.
+namespace sus {
+using ::sus::rc::Rc;
+}
@@ -0,0 +1,247 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/rc/rc.h"
+
+#include <string>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/fn/fn.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+namespace {
+using sus::rc::Rc;
+using sus::rc::Weak;
+using sus::test::ensure_use;
+
+static_assert(sus::mem::Clone<Rc<i32>>);
+static_assert(!sus::mem::Copy<Rc<i32>>);
+static_assert(sus::mem::Move<Rc<i32>>);
+static_assert(sus::mem::Clone<Weak<i32>>);
+// The counts live in the heap allocation, so `Rc` is a single pointer.
+static_assert(sizeof(Rc<i32>) == sizeof(void*));
+static_assert(sizeof(Rc<sus::Slice<i32>>) == sizeof(void*));
+static_assert(sus::mem::never_value_niche_count<Rc<i32>>() == 2u);
+static_assert(sizeof(sus::Option<sus::Option<Rc<i32>>>) == sizeof(Rc<i32>));
+static_assert(sus::mem::TriviallyRelocatable<Rc<i32>>);
+static_assert(sus::mem::TriviallyRelocatable<Weak<i32>>);
+
+struct Counted {
+  Counted(i32& destroyed) : destroyed(&destroyed) {}
+  Counted(Counted&& o) : destroyed(sus::mem::replace(o.destroyed, nullptr)) {}
+  Counted& operator=(Counted&& o) {
+    destroyed = sus::mem::replace(o.destroyed, nullptr);
+    return *this;
+  }
+  ~Counted() {
+    if (destroyed) *destroyed += 1;
+  }
+
+  i32* destroyed;
+};
+
+TEST(Rc, Construct) {
+  auto a = Rc<i32>(3);
+  EXPECT_EQ(*a, 3);
+  auto b = Rc<i32>::from(4);
+  EXPECT_EQ(*b, 4);
+  auto c = Rc<std::string>::with_args(3u, 'a');
+  EXPECT_EQ(*c, "aaa");
+  EXPECT_EQ(c->size(), 3u);
+  EXPECT_EQ(c.as_ref(), "aaa");
+}
+
+TEST(Rc, Clone) {
+  i32 destroyed;
+  {
+    auto a = Rc<Counted>(Counted(destroyed));
+    EXPECT_EQ(a.strong_count(), 1u);
+    {
+      auto b = a.clone();
+      EXPECT_EQ(a.strong_count(), 2u);
+      EXPECT_EQ(b.strong_count(), 2u);
+      EXPECT_TRUE(a.ptr_eq(b));
+      EXPECT_EQ(&*a, &*b);
+    }
+    EXPECT_EQ(a.strong_count(), 1u);
+    EXPECT_EQ(destroyed, 0);
+  }
+  EXPECT_EQ(destroyed, 1);
+}
+
+TEST(Rc, Move) {
+  i32 destroyed;
+  {
+    auto a = Rc<Counted>(Counted(destroyed));
+    auto b = sus::move(a);
+    EXPECT_EQ(b.strong_count(), 1u);
+    auto c = Rc<Counted>(Counted(destroyed));
+    c = sus::move(b);
+    // The value that `c` held was released.
+    EXPECT_EQ(destroyed, 1);
+    EXPECT_EQ(c.strong_count(), 1u);
+  }
+  EXPECT_EQ(destroyed, 2);
+}
+
+TEST(RcDeathTest, UseAfterMove) {
+  auto a = Rc<i32>(1);
+  auto b = sus::move(a);
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto i = *a;
+        ensure_use(&i);
+      },
+      "Rc used after move");
+#endif
+}
+
+TEST(Rc, Weak) {
+  i32 destroyed;
+  auto a = Rc<Counted>(Counted(destroyed));
+  Weak<Counted> w = a.downgrade();
+  EXPECT_EQ(a.weak_count(), 1u);
+  EXPECT_EQ(w.strong_count(), 1u);
+  EXPECT_EQ(w.weak_count(), 1u);
+  {
+    auto up = w.upgrade();
+    EXPECT_TRUE(up.is_some());
+    EXPECT_TRUE(up.as_value().ptr_eq(a));
+    EXPECT_EQ(a.strong_count(), 2u);
+  }
+  auto w2 = w.clone();
+  EXPECT_EQ(a.weak_count(), 2u);
+
+  // Dropping the last strong reference destroys the value, while the weak
+  // references keep the allocation.
+  { [[maybe_unused]] auto gone = sus::move(a); }
+  EXPECT_EQ(destroyed, 1);
+  EXPECT_TRUE(w.upgrade().is_none());
+  EXPECT_EQ(w.strong_count(), 0u);
+  EXPECT_EQ(w2.weak_count(), 0u);
+}
+
+TEST(Rc, GetMut) {
+  auto a = Rc<i32>(1);
+  a.get_mut().unwrap() = 2;
+  EXPECT_EQ(*a, 2);
+
+  auto b = a.clone();
+  EXPECT_TRUE(a.get_mut().is_none());
+  { [[maybe_unused]] auto gone = sus::move(b); }
+  EXPECT_TRUE(a.get_mut().is_some());
+
+  auto w = a.downgrade();
+  EXPECT_TRUE(a.get_mut().is_none());
+}
+
+TEST(Rc, MakeMut) {
+  auto a = Rc<i32>(1);
+  const i32* unique = &*a;
+  a.make_mut() = 2;
+  // Not shared, so modified in place.
+  EXPECT_EQ(&*a, unique);
+
+  auto b = a.clone();
+  a.make_mut() = 3;
+  // Shared, so `a` was cloned into a new allocation.
+  EXPECT_EQ(*a, 3);
+  EXPECT_EQ(*b, 2);
+  EXPECT_FALSE(a.ptr_eq(b));
+  EXPECT_EQ(a.strong_count(), 1u);
+  EXPECT_EQ(b.strong_count(), 1u);
+
+  // A weak reference also makes the value shared. Once the old value is
+  // released by `make_mut` the weak reference can not be upgraded.
+  auto w = b.downgrade();
+  b.make_mut() = 4;
+  EXPECT_EQ(*b, 4);
+  EXPECT_TRUE(w.upgrade().is_none());
+}
+
+TEST(Rc, IntoInner) {
+  auto a = Rc<std::string>(std::string("hello"));
+  auto b = a.clone();
+  EXPECT_TRUE(sus::move(a).into_inner().is_none());
+  EXPECT_EQ(sus::move(b).into_inner().unwrap(), "hello");
+}
+
+TEST(Rc, Slice) {
+  i32 destroyed;
+  {
+    auto v = sus::Vec<Counted>();
+    for (i32 i = 0; i < 4; i += 1) v.push(Counted(destroyed));
+    auto s = Rc<sus::Slice<Counted>>::from(sus::move(v));
+    EXPECT_EQ(s->len(), 4u);
+    EXPECT_TRUE(v.is_empty());
+    auto t = s.clone();
+    EXPECT_EQ(&(*t)[0u], &(*s)[0u]);
+    EXPECT_EQ(destroyed, 0);
+  }
+  EXPECT_EQ(destroyed, 4);
+
+  auto s = Rc<sus::Slice<i32>>::from(sus::Vec<i32>(1, 2, 3));
+  EXPECT_EQ(s->len(), 3u);
+  EXPECT_EQ((*s)[2u], 3);
+  i32 sum;
+  for (i32 i : s->iter()) sum += i;
+  EXPECT_EQ(sum, 6);
+  // The elements are stored in the same allocation, after the `Slice`.
+  EXPECT_EQ(reinterpret_cast<const char*>(s->as_ptr()),
+            reinterpret_cast<const char*>(&*s) + sizeof(sus::Slice<i32>));
+}
+
+TEST(Rc, SliceClone) {
+  auto v = sus::Vec<std::string>(std::string("a"), std::string("b"));
+  auto s = Rc<sus::Slice<std::string>>::from(v);
+  EXPECT_EQ(s->len(), 2u);
+  EXPECT_EQ((*s)[1u], "b");
+  // The elements were cloned.
+  EXPECT_EQ(v[1u], "b");
+  EXPECT_NE(s->as_ptr(), v.as_ptr());
+}
+
+TEST(Rc, Dyn) {
+  auto f = Rc<sus::fn::DynFn<i32(i32)>>::from([y = 2_i32](i32 x) {
+    return x * y;
+  });
+  auto g = f.clone();
+  EXPECT_EQ(f(3), 6);
+  EXPECT_EQ(g(4), 8);
+  EXPECT_EQ(sus::fn::call(*g, 5), 10);
+
+  // Type-erased values are destroyed through the `DynC`.
+  i32 destroyed;
+  {
+    auto h = Rc<sus::fn::DynFn<void()>>::from(
+        [c = Counted(destroyed)]() {});
+    auto w = h.downgrade();
+    EXPECT_EQ(destroyed, 0);
+  }
+  EXPECT_EQ(destroyed, 1);
+}
+
+TEST(Rc, Eq) {
+  EXPECT_EQ(Rc<i32>(1), Rc<i32>(1));
+  EXPECT_NE(Rc<i32>(1), Rc<i32>(2));
+  EXPECT_LT(Rc<i32>(1), Rc<i32>(2));
+}
+
+TEST(Rc, Fmt) {
+  EXPECT_EQ(fmt::format("{}", Rc<i32>(12345)), "12345");
+}
+
+}  // namespace
@@ -23,6 +23,7 @@
 #include "sus/macros/no_unique_address.h"
 #include "sus/mem/copy.h"
 #include "sus/mem/move.h"
+#include "sus/mem/never_value.h"
 #include "sus/mem/take.h"
 
 namespace sus::result::__private {
@@ -277,6 +278,165 @@ struct StorageVoid {
                                            decltype(inner_.v.state));
 };
 
+/// Storage for `Result<void, E>` when `E` has at least two never-value niches.
+/// The `Ok` and moved-from states are kept in niches of the `E`, so the
+/// `Result` is the same size as `E`.
+template <class E>
+struct StorageVoidNiche {
+  static constexpr size_t kOkNiche = 0u;
+  static constexpr size_t kMovedNiche = 1u;
+
+  constexpr StorageVoidNiche(WithT) noexcept : access_() {}
+  constexpr StorageVoidNiche(WithE, const E& e) noexcept
+    requires(std::is_copy_constructible_v<E>)
+      : access_(e) {}
+  constexpr StorageVoidNiche(WithE, E&& e) noexcept
+    requires(std::is_move_constructible_v<E>)
+      : access_(::sus::move(e)) {}
+
+  ~StorageVoidNiche() noexcept
+    requires(std::is_trivially_destructible_v<E>)
+  = default;
+  constexpr ~StorageVoidNiche() noexcept
+    requires(!std::is_trivially_destructible_v<E>)
+  {
+    if (is_err()) access_.~NeverValueAccess();
+  }
+
+  StorageVoidNiche(const StorageVoidNiche&)
+    requires(std::is_trivially_copy_constructible_v<E>)
+  = default;
+  constexpr StorageVoidNiche(const StorageVoidNiche& o) noexcept
+    requires(!std::is_trivially_copy_constructible_v<E> &&
+             std::is_copy_constructible_v<E>)
+  {
+    if (o.is_err()) {
+      std::construct_at(&access_, o.access_.as_inner());
+    } else {
+      sus_check_with_message(o.is_ok(), "Result used after move");
+      std::construct_at(&access_);
+    }
+  }
+
+  StorageVoidNiche& operator=(const StorageVoidNiche&)
+    requires(std::is_trivially_copy_assignable_v<E>)
+  = default;
+  constexpr StorageVoidNiche& operator=(const StorageVoidNiche& o) noexcept
+    requires(!std::is_trivially_copy_assignable_v<E> &&
+             std::is_copy_assignable_v<E>)
+  {
+    sus_check_with_message(!o.is_moved(), "Result used after move");
+    if (o.is_err()) {
+      if (is_err())
+        access_.as_inner_mut() = o.access_.as_inner();
+      else
+        construct_err_from_niche(o.access_.as_inner());
+    } else {
+      if (is_err())
+        destroy_err_into_niche(kOkNiche);
+      else
+        access_.set_niche(::sus::marker::unsafe_fn, kOkNiche);
+    }
+    return *this;
+  }
+
+  StorageVoidNiche(StorageVoidNiche&&)
+    requires(std::is_trivially_move_constructible_v<E>)
+  = default;
+  constexpr StorageVoidNiche(StorageVoidNiche&& o) noexcept
+    requires(!std::is_trivially_move_constructible_v<E> &&
+             std::is_move_constructible_v<E>)
+  {
+    if (o.is_err()) {
+      std::construct_at(&access_, ::sus::move(o.access_.as_inner_mut()));
+      o.destroy_err_into_niche(kMovedNiche);
+    } else {
+      sus_check_with_message(o.is_ok(), "Result used after move");
+      std::construct_at(&access_);
+      o.access_.set_niche(::sus::marker::unsafe_fn, kMovedNiche);
+    }
+  }
+
+  StorageVoidNiche& operator=(StorageVoidNiche&&)
+    requires(std::is_trivially_move_assignable_v<E>)
+  = default;
+  constexpr StorageVoidNiche& operator=(StorageVoidNiche&& o) noexcept
+    requires(!std::is_trivially_move_assignable_v<E> &&
+             std::is_move_assignable_v<E>)
+  {
+    sus_check_with_message(!o.is_moved(), "Result used after move");
+    if (o.is_err()) {
+      if (is_err())
+        access_.as_inner_mut() = ::sus::move(o.access_.as_inner_mut());
+      else
+        construct_err_from_niche(::sus::move(o.access_.as_inner_mut()));
+      o.destroy_err_into_niche(kMovedNiche);
+    } else {
+      if (is_err())
+        destroy_err_into_niche(kOkNiche);
+      else
+        access_.set_niche(::sus::marker::unsafe_fn, kOkNiche);
+      o.access_.set_niche(::sus::marker::unsafe_fn, kMovedNiche);
+    }
+    return *this;
+  }
+
+  constexpr bool is_moved() const noexcept {
+    return access_.is_niche(kMovedNiche);
+  }
+  constexpr bool is_ok() const noexcept { return access_.is_niche(kOkNiche); }
+  constexpr bool is_err() const noexcept { return !is_ok() && !is_moved(); }
+
+  template <class As>
+  constexpr void get_ok() const noexcept {}
+  constexpr const E& get_err() const noexcept { return access_.as_inner(); }
+
+  template <class As>
+  constexpr void get_ok_mut() & noexcept {}
+  constexpr E& get_err_mut() & noexcept { return access_.as_inner_mut(); }
+
+  template <class As>
+  constexpr void take_ok() & noexcept {
+    access_.set_niche(::sus::marker::unsafe_fn, kMovedNiche);
+  }
+  constexpr E take_err() & noexcept
+    requires(::sus::mem::Move<E>)
+  {
+    E e = ::sus::move(access_.as_inner_mut());
+    destroy_err_into_niche(kMovedNiche);
+    return e;
+  }
+
+  constexpr void drop_ok() & noexcept {
+    access_.set_niche(::sus::marker::unsafe_fn, kMovedNiche);
+  }
+  constexpr void drop_err() & noexcept {
+    destroy_err_into_niche(kMovedNiche);
+  }
+
+ private:
+  using NeverValueAccess = ::sus::mem::__private::NeverValueAccess<E>;
+
+  template <class U>
+  constexpr void construct_err_from_niche(U&& e) noexcept {
+    access_.set_destroy_value(::sus::marker::unsafe_fn);
+    access_.~NeverValueAccess();
+    std::construct_at(&access_, ::sus::forward<U>(e));
+  }
+  constexpr void destroy_err_into_niche(size_t niche) noexcept {
+    access_.~NeverValueAccess();
+    std::construct_at(&access_);
+    access_.set_niche(::sus::marker::unsafe_fn, niche);
+  }
+
+  union {
+    NeverValueAccess access_;
+  };
+
+  sus_class_trivially_relocatable_if_types(::sus::marker::unsafe_fn,
+                                           decltype(access_));
+};
+
 template <class T, class E>
 struct StorageNonVoid {
   enum State { Ok, Err, Moved };
@@ -927,9 +927,13 @@ class [[nodiscard]] Result final {
 
   using OkStorageType =
       std::conditional_t<std::is_reference_v<T>, StoragePointer<T>, T>;
-  using Storage = std::conditional_t<  //
-      std::is_void_v<T>,               //
-      __private::StorageVoid<E>,       //
+  // A `Result<void, E>` keeps its `Ok` and moved-from states in niches of the
+  // `E` when it has enough of them, so it needs no separate state field.
+  using Storage = std::conditional_t<
+      std::is_void_v<T>,
+      std::conditional_t<(::sus::mem::never_value_niche_count<E>() >= 2u),
+                         __private::StorageVoidNiche<E>,
+                         __private::StorageVoid<E>>,
       __private::StorageNonVoid<OkStorageType, E>>;
   [[no_unique_address]] Storage storage_;
 
@@ -18,6 +18,8 @@
 
 #include "fmt/std.h"
 #include "googletest/include/gtest/gtest.h"
+#include "sus/boxed/box.h"
+#include "sus/choice/choice.h"
 #include "sus/collections/array.h"
 #include "sus/iter/iterator.h"
 #include "sus/iter/once.h"
@@ -2070,4 +2072,49 @@ TEST(Result, AsValue) {
   EXPECT_EQ(y.as_value_mut(), 2);
 }
 
+TEST(Result, VoidNeverValueNiches) {
+  // The `Ok` and moved-from states are stored in niches of the error.
+  using E = sus::Box<i32>;
+  static_assert(sus::mem::never_value_niche_count<E>() >= 2u);
+  static_assert(sizeof(Result<void, E>) == sizeof(E));
+
+  auto ok = Result<void, E>(sus::ok());
+  EXPECT_EQ(ok.is_ok(), true);
+  auto err = Result<void, E>::with_err(E(3_i32));
+  EXPECT_EQ(err.is_err(), true);
+  EXPECT_EQ(*err.as_err(), 3_i32);
+
+  // Moving leaves the `Result` moved-from.
+  auto moved = sus::move(err);
+  EXPECT_EQ(moved.is_err(), true);
+  EXPECT_EQ(*moved.as_err(), 3_i32);
+  err = sus::move(ok);
+  EXPECT_EQ(err.is_ok(), true);
+  ok = sus::move(moved);
+  EXPECT_EQ(ok.is_err(), true);
+  moved = sus::move(ok);
+  EXPECT_EQ(*sus::move(moved).unwrap_err(), 3_i32);
+
+  // A `Copy` error.
+  using C = sus::Choice<sus_choice_types((1, u32), (2, u64))>;
+  static_assert(sizeof(Result<void, C>) == sizeof(C));
+  static_assert([]() {
+    auto r = Result<void, C>::with_err(C::with<1>(4u));
+    auto s = r;
+    r = Result<void, C>(sus::ok());
+    return r.is_ok() && s.as_err().as<1>() == 4u;
+  }());
+}
+
+TEST(ResultDeathTest, VoidNeverValueNichesUseAfterMove) {
+#if GTEST_HAS_DEATH_TEST
+  auto r = Result<void, sus::Box<i32>>(sus::ok());
+  auto s = sus::move(r);
+  EXPECT_DEATH(auto t = sus::move(r), "PANIC! at 'Result used after move'");
+  auto e = Result<void, sus::Box<i32>>::with_err(sus::Box<i32>(1_i32));
+  s = sus::move(e);
+  EXPECT_DEATH(s = sus::move(e), "PANIC! at 'Result used after move'");
+#endif
+}
+
 }  // namespace
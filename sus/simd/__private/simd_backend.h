@@ -0,0 +1,240 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// IWYU pragma: private
+// IWYU pragma: friend "sus/.*"
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "sus/macros/compiler.h"
+#include "sus/num/__private/intrinsics.h"
+
+// The instruction set that `Simd` is compiled for is chosen from the target
+// flags given to the compiler, such as `-mavx2` or `/arch:AVX2`.
+//
+// SUS_SIMD_NATIVE_BYTES is the width in bytes of the widest vector register
+// available to the chosen instruction set, or 0 if there is none and the
+// scalar fallback is used.
+#if defined(__AVX512F__)
+#define SUS_SIMD_NATIVE_BYTES 64  // AVX-512
+#elif defined(__AVX2__)
+#define SUS_SIMD_NATIVE_BYTES 32  // AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SUS_SIMD_NATIVE_BYTES 16  // SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define SUS_SIMD_NATIVE_BYTES 16  // NEON
+#else
+#define SUS_SIMD_NATIVE_BYTES 0  // Scalar.
+#endif
+
+// SUS_SIMD_FORCE_SCALAR can be defined to true to use the scalar fallback
+// even when the compiler supports vector types, such as for testing it.
+#if !defined(SUS_SIMD_FORCE_SCALAR)
+#define SUS_SIMD_FORCE_SCALAR false
+#endif
+static_assert(SUS_SIMD_FORCE_SCALAR == false || SUS_SIMD_FORCE_SCALAR == true);
+
+// GCC and Clang vector types are lowered to the instructions of the target
+// (SSE2, AVX2, AVX-512 or NEON) by the compiler, and split into multiple
+// registers when they are wider than the target's registers. MSVC has no
+// portable vector types, so it always uses the scalar fallback, which it can
+// still auto-vectorize.
+#if (SUS_COMPILER_IS_GCC || SUS_COMPILER_IS_CLANG) && !SUS_SIMD_FORCE_SCALAR
+#define SUS_SIMD_VECTOR_EXTENSIONS true
+#else
+#define SUS_SIMD_VECTOR_EXTENSIONS false
+#endif
+
+namespace sus::simd::__private {
+
+/// The primitive integer types used for each lane of a mask, where every bit is
+/// set in a lane that is true.
+template <size_t Bytes>
+struct MaskPrimitive;
+template <>
+struct MaskPrimitive<1> {
+  using type = int8_t;
+};
+template <>
+struct MaskPrimitive<2> {
+  using type = int16_t;
+};
+template <>
+struct MaskPrimitive<4> {
+  using type = int32_t;
+};
+template <>
+struct MaskPrimitive<8> {
+  using type = int64_t;
+};
+
+/// The scalar fallback for a vector of `N` primitive values. It provides the
+/// same operators as a GCC/Clang vector type, one lane at a time.
+template <class P, size_t N>
+struct ScalarVec {
+  using Lane = P;
+  using Mask = ScalarVec<typename MaskPrimitive<sizeof(P)>::type, N>;
+
+  alignas(sizeof(P) * N) P lanes[N];
+
+  constexpr P& operator[](size_t i) noexcept { return lanes[i]; }
+  constexpr const P& operator[](size_t i) const noexcept { return lanes[i]; }
+
+  template <class F>
+  static constexpr ScalarVec map(const ScalarVec& a, F f) noexcept {
+    ScalarVec out;
+    for (size_t i = 0u; i < N; ++i) out.lanes[i] = f(a.lanes[i]);
+    return out;
+  }
+  template <class R = P, class F>
+  static constexpr ScalarVec<R, N> zip(const ScalarVec& a, const ScalarVec& b,
+                                       F f) noexcept {
+    ScalarVec<R, N> out;
+    for (size_t i = 0u; i < N; ++i) out.lanes[i] = f(a.lanes[i], b.lanes[i]);
+    return out;
+  }
+  static constexpr Mask to_mask(const ScalarVec<bool, N>& b) noexcept {
+    Mask out;
+    for (size_t i = 0u; i < N; ++i)
+      out.lanes[i] = b.lanes[i] ? typename Mask::Lane(-1) : 0;
+    return out;
+  }
+
+  friend constexpr ScalarVec operator+(ScalarVec a, ScalarVec b) noexcept {
+    return zip(a, b, [](P x, P y) { return static_cast<P>(x + y); });
+  }
+  friend constexpr ScalarVec operator-(ScalarVec a, ScalarVec b) noexcept {
+    return zip(a, b, [](P x, P y) { return static_cast<P>(x - y); });
+  }
+  friend constexpr ScalarVec operator*(ScalarVec a, ScalarVec b) noexcept {
+    return zip(a, b, [](P x, P y) {
+      // Narrow lanes are multiplied as `unsigned int` instead of being promoted
+      // to `int`, where the product could overflow.
+      if constexpr (std::is_integral_v<P>) {
+        using M = ::sus::num::__private::MathType<P>;
+        return static_cast<P>(M{x} * M{y});
+      } else {
+        return static_cast<P>(x * y);
+      }
+    });
+  }
+  friend constexpr ScalarVec operator/(ScalarVec a, ScalarVec b) noexcept {
+    return zip(a, b, [](P x, P y) { return static_cast<P>(x / y); });
+  }
+  friend constexpr ScalarVec operator&(ScalarVec a, ScalarVec b) noexcept {
+    return zip(a, b, [](P x, P y) { return static_cast<P>(x & y); });
+  }
+  friend constexpr ScalarVec operator|(ScalarVec a, ScalarVec b) noexcept {
+    return zip(a, b, [](P x, P y) { return static_cast<P>(x | y); });
+  }
+  friend constexpr ScalarVec operator^(ScalarVec a, ScalarVec b) noexcept {
+    return zip(a, b, [](P x, P y) { return static_cast<P>(x ^ y); });
+  }
+  friend constexpr ScalarVec operator~(ScalarVec a) noexcept {
+    return map(a, [](P x) { return static_cast<P>(~x); });
+  }
+  friend constexpr ScalarVec operator-(ScalarVec a) noexcept {
+    return map(a, [](P x) { return static_cast<P>(-x); });
+  }
+  friend constexpr ScalarVec operator>>(ScalarVec a, int s) noexcept {
+    return map(a, [s](P x) { return static_cast<P>(x >> s); });
+  }
+  friend constexpr Mask operator==(ScalarVec a, ScalarVec b) noexcept {
+    return to_mask(zip<bool>(a, b, [](P x, P y) { return x == y; }));
+  }
+  friend constexpr Mask operator!=(ScalarVec a, ScalarVec b) noexcept {
+    return to_mask(zip<bool>(a, b, [](P x, P y) { return x != y; }));
+  }
+  friend constexpr Mask operator<(ScalarVec a, ScalarVec b) noexcept {
+    return to_mask(zip<bool>(a, b, [](P x, P y) { return x < y; }));
+  }
+  friend constexpr Mask operator<=(ScalarVec a, ScalarVec b) noexcept {
+    return to_mask(zip<bool>(a, b, [](P x, P y) { return x <= y; }));
+  }
+  friend constexpr Mask operator>(ScalarVec a, ScalarVec b) noexcept {
+    return to_mask(zip<bool>(a, b, [](P x, P y) { return x > y; }));
+  }
+  friend constexpr Mask operator>=(ScalarVec a, ScalarVec b) noexcept {
+    return to_mask(zip<bool>(a, b, [](P x, P y) { return x >= y; }));
+  }
+};
+
+/// Vectors that fit in a register of the target use a GCC/Clang vector type.
+/// Wider vectors use the scalar fallback, as vector types wider than a register
+/// change the calling convention depending on the target flags, and the loops
+/// over a fixed number of lanes in `ScalarVec` are still auto-vectorized.
+template <class P, size_t N>
+struct VecType {
+  using type = ScalarVec<P, N>;
+};
+#if SUS_SIMD_VECTOR_EXTENSIONS
+template <class P, size_t N>
+  requires(sizeof(P) * N <= SUS_SIMD_NATIVE_BYTES)
+struct VecType<P, N> {
+  typedef P type __attribute__((vector_size(sizeof(P) * N)));
+};
+#endif
+
+/// The vector of `N` lanes of primitive type `P`.
+template <class P, size_t N>
+using Vec = typename VecType<P, N>::type;
+
+/// The vector of masks for `N` lanes of `Bytes` each.
+template <size_t Bytes, size_t N>
+using MaskVec = Vec<typename MaskPrimitive<Bytes>::type, N>;
+
+/// Returns a bitmask with bit `i` set if lane `i` of the mask `m` is set.
+template <size_t Bytes, size_t N>
+inline uint64_t movemask(const MaskVec<Bytes, N>& m) noexcept {
+#if SUS_SIMD_VECTOR_EXTENSIONS && defined(__SSE2__)
+  if constexpr (Bytes * N == 16u) {
+    typedef char V16QI __attribute__((vector_size(16)));
+    typedef short V8HI __attribute__((vector_size(16)));
+    typedef float V4SF __attribute__((vector_size(16)));
+    typedef double V2DF __attribute__((vector_size(16)));
+    // Each set lane has all its bits set, so its sign bit is the lane's value.
+    if constexpr (Bytes == 1u) {
+      return static_cast<uint16_t>(
+          __builtin_ia32_pmovmskb128(__builtin_bit_cast(V16QI, m)));
+    } else if constexpr (Bytes == 2u) {
+      const auto v = __builtin_bit_cast(V8HI, m);
+      return static_cast<uint8_t>(
+          __builtin_ia32_pmovmskb128(__builtin_ia32_packsswb128(v, v)));
+    } else if constexpr (Bytes == 4u) {
+      return static_cast<uint64_t>(
+          __builtin_ia32_movmskps(__builtin_bit_cast(V4SF, m)));
+    } else {
+      return static_cast<uint64_t>(
+          __builtin_ia32_movmskpd(__builtin_bit_cast(V2DF, m)));
+    }
+  }
+#endif
+  uint64_t bitmask = 0u;
+  for (size_t i = 0u; i < N; ++i) bitmask |= uint64_t{m[i] != 0} << i;
+  return bitmask;
+}
+
+/// Whether `Simd` can be formed from `N` lanes of `Bytes` each. The lane count
+/// is a power of two, and the vector is at most 64 bytes, the width of an
+/// AVX-512 register.
+template <size_t Bytes, size_t N>
+constexpr inline bool valid_lanes =
+    N > 0u && (N & (N - 1u)) == 0u && Bytes * N <= 64u;
+
+}  // namespace sus::simd::__private
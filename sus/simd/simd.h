@@ -0,0 +1,878 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <bit>
+#include <type_traits>
+
+#include "sus/assertions/check.h"
+#include "sus/collections/array.h"
+#include "sus/collections/slice.h"
+#include "sus/macros/inline.h"
+#include "sus/macros/pure.h"
+#include "sus/marker/unsafe.h"
+#include "sus/num/__private/check_integer_overflow.h"
+#include "sus/num/__private/intrinsics.h"
+#include "sus/num/float_concepts.h"
+#include "sus/num/integer_concepts.h"
+#include "sus/num/types.h"
+#include "sus/option/option.h"
+#include "sus/simd/__private/simd_backend.h"
+#include "sus/tuple/tuple.h"
+
+namespace sus::simd {
+
+namespace __private {
+
+/// The signed integer type of a mask lane for elements of `Bytes` each.
+template <size_t Bytes>
+struct MaskElement;
+template <>
+struct MaskElement<1> {
+  using type = ::sus::num::i8;
+};
+template <>
+struct MaskElement<2> {
+  using type = ::sus::num::i16;
+};
+template <>
+struct MaskElement<4> {
+  using type = ::sus::num::i32;
+};
+template <>
+struct MaskElement<8> {
+  using type = ::sus::num::i64;
+};
+
+/// The primitive type inside a subspace numeric type.
+template <class T>
+using Primitive = std::remove_cvref_t<decltype(T::primitive_value)>;
+
+/// The types that can be the lanes of a `Simd`.
+template <class T>
+concept SimdElement = ::sus::num::IntegerNumeric<T> || ::sus::num::Float<T>;
+
+}  // namespace __private
+
+/// Returns the number of lanes of type `T` that fit in the widest vector
+/// register of the instruction set that the code is being compiled for.
+///
+/// When there are no vector registers, this is the number of lanes that fit
+/// in 16 bytes, which the compiler may still be able to auto-vectorize.
+template <__private::SimdElement T>
+constexpr size_t native_lanes() noexcept {
+  constexpr size_t bytes =
+      SUS_SIMD_NATIVE_BYTES > 0 ? SUS_SIMD_NATIVE_BYTES : 16u;
+  return bytes / sizeof(T);
+}
+
+template <class I, size_t N>
+  requires(::sus::num::Signed<I> && __private::valid_lanes<sizeof(I), N>)
+class Mask;
+
+/// A vector of `N` lanes of type `T`, which are operated on together with
+/// SIMD instructions.
+///
+/// `T` can be any subspace integer type, except for
+/// [`uptr`]($sus::num::uptr), or a floating point type. The number of lanes
+/// `N` must be a power of two, and the whole vector must be at most 64 bytes,
+/// which is the width of an AVX-512 register.
+///
+/// The instruction set used is chosen at compile time from the compiler's
+/// target flags: AVX-512, AVX2, SSE2 or NEON. On MSVC, or when
+/// `SUS_SIMD_FORCE_SCALAR` is defined to `true`, a scalar fallback is used,
+/// which operates on each lane in turn. A vector wider than the target's
+/// registers is split across multiple registers.
+///
+/// # Overflow
+/// Like the integer types, arithmetic operators on integer lanes panic if any
+/// lane overflows, unless `SUS_CHECK_INTEGER_OVERFLOW` is `false`. Each
+/// operation is also available with lane-wise `wrapping_*`, `saturating_*`,
+/// `overflowing_*` and `checked_*` semantics. The `overflowing_*` methods
+/// return a [`Mask`]($sus::simd::Mask) of the lanes that overflowed, and the
+/// `checked_*` methods return `None` if any lane overflowed.
+///
+/// Comparisons produce a [`Mask`]($sus::simd::Mask), which can be used to
+/// choose between lanes of two vectors with
+/// [`Mask::select`]($sus::simd::Mask::select).
+///
+/// # Examples
+/// Adding arrays together, a chunk of lanes at a time, with a scalar loop for
+/// the remainder.
+/// ```
+/// using sus::simd::Simd;
+/// auto a = sus::Vec<i32>(1, 2, 3, 4, 5);
+/// auto b = sus::Vec<i32>(10, 20, 30, 40, 50);
+/// auto out = sus::Vec<i32>(0, 0, 0, 0, 0);
+/// auto a_chunks = a.chunks_exact(4u);
+/// auto b_chunks = b.chunks_exact(4u);
+/// auto out_chunks = out.chunks_exact_mut(4u);
+/// for (auto o : out_chunks) {
+///   auto sum = Simd<i32, 4>::from_slice(a_chunks.next().unwrap()) +
+///              Simd<i32, 4>::from_slice(b_chunks.next().unwrap());
+///   sum.copy_to_slice(o);
+/// }
+/// out[4u] = a[4u] + b[4u];
+/// sus_check(out == sus::Vec<i32>(11, 22, 33, 44, 55));
+/// ```
+template <class T, size_t N>
+  requires(__private::SimdElement<T> && __private::valid_lanes<sizeof(T), N>)
+class Simd final {
+  using P = __private::Primitive<T>;
+  using Vec = __private::Vec<P, N>;
+  // Integer math is done in unsigned lanes, which wrap instead of having
+  // undefined behaviour on overflow.
+  using UP = std::make_unsigned_t<
+      typename __private::MaskPrimitive<sizeof(T)>::type>;
+  using UVec = __private::Vec<UP, N>;
+  using MVec = __private::MaskVec<sizeof(T), N>;
+
+ public:
+  /// The type of [`Mask`]($sus::simd::Mask) produced by comparing two `Simd`
+  /// of this type.
+  using MaskType = Mask<typename __private::MaskElement<sizeof(T)>::type, N>;
+
+  /// The number of lanes in the vector.
+  static constexpr ::sus::num::usize LANES = N;
+
+  /// Constructs a vector with every lane set to zero.
+  ///
+  /// #[doc.implements=sus::construct::Default]
+  explicit Simd() noexcept : v_() {}
+
+  /// Constructs a vector with every lane set to `value`.
+  _sus_pure static Simd splat(T value) noexcept {
+    return Simd(broadcast<Vec>(value.primitive_value));
+  }
+
+  /// Constructs a vector from the values in `a`.
+  _sus_pure static Simd from_array(
+      const ::sus::collections::Array<T, N>& a) noexcept {
+    Simd s;
+    memcpy(&s.v_, a.as_ptr(), sizeof(Vec));
+    return s;
+  }
+
+  /// Returns the lanes of the vector in an `Array`.
+  _sus_pure ::sus::collections::Array<T, N> to_array() const noexcept {
+    auto a = ::sus::collections::Array<T, N>();
+    memcpy(a.as_mut_ptr(), &v_, sizeof(Vec));
+    return a;
+  }
+
+  /// Constructs a vector from the first `N` values in `s`.
+  ///
+  /// This pairs with
+  /// [`Slice::chunks_exact`]($sus::collections::Slice::chunks_exact), which
+  /// produces slices of exactly `N` values.
+  ///
+  /// # Panics
+  /// Panics if the slice has fewer than `N` values.
+  _sus_pure static Simd from_slice(::sus::collections::Slice<T> s) noexcept {
+    sus_check_with_message(s.len() >= N,
+                           "slice is shorter than the number of lanes");
+    Simd out;
+    memcpy(&out.v_, s.as_ptr(), sizeof(Vec));
+    return out;
+  }
+
+  /// Constructs a vector from the first `N` values in `s`, using the lanes of
+  /// `or_value` where `s` is too short.
+  _sus_pure static Simd load_or(::sus::collections::Slice<T> s,
+                                Simd or_value) noexcept {
+    if (s.len() >= N) [[likely]] {
+      return from_slice(s);
+    }
+    memcpy(&or_value.v_, s.as_ptr(), size_t{s.len()} * sizeof(T));
+    return or_value;
+  }
+
+  /// Constructs a vector from the first `N` values in `s`, using zero where
+  /// `s` is too short.
+  _sus_pure static Simd load_or_default(
+      ::sus::collections::Slice<T> s) noexcept {
+    return load_or(s, Simd());
+  }
+
+  /// Writes the lanes of the vector into the first `N` values of `s`.
+  ///
+  /// # Panics
+  /// Panics if the slice has fewer than `N` values.
+  void copy_to_slice(::sus::collections::SliceMut<T> s) const noexcept {
+    sus_check_with_message(s.len() >= N,
+                           "slice is shorter than the number of lanes");
+    memcpy(s.as_mut_ptr(), &v_, sizeof(Vec));
+  }
+
+  /// Reads values from `s` at each index in `idxs`, using the lane of
+  /// `or_value` where the index is out of bounds.
+  template <int&..., class U = ::sus::num::usize>
+    requires(std::same_as<U, ::sus::num::usize>)
+  _sus_pure static Simd gather_or(::sus::collections::Slice<T> s,
+                                  Simd<U, N> idxs,
+                                  Simd or_value) noexcept {
+    return gather_select(s, Mask<::sus::num::isize, N>::splat(true), idxs,
+                         or_value);
+  }
+
+  /// Reads values from `s` at each index in `idxs`, using zero where the
+  /// index is out of bounds.
+  template <int&..., class U = ::sus::num::usize>
+    requires(std::same_as<U, ::sus::num::usize>)
+  _sus_pure static Simd gather_or_default(
+      ::sus::collections::Slice<T> s,
+      Simd<U, N> idxs) noexcept {
+    return gather_or(s, idxs, Simd());
+  }
+
+  /// Reads values from `s` at each index in `idxs` for lanes that are set in
+  /// `enable`, using the lane of `or_value` where the lane is not enabled or
+  /// the index is out of bounds.
+  template <int&..., class U = ::sus::num::usize, class E = ::sus::num::isize>
+    requires(std::same_as<U, ::sus::num::usize> &&
+             std::same_as<E, ::sus::num::isize>)
+  _sus_pure static Simd gather_select(::sus::collections::Slice<T> s,
+                                      Mask<E, N> enable,
+                                      Simd<U, N> idxs,
+                                      Simd or_value) noexcept {
+    const P* data = reinterpret_cast<const P*>(s.as_ptr());
+    const size_t len = size_t{s.len()};
+    for (size_t i = 0u; i < N; ++i) {
+      const size_t idx = idxs.v_[i];
+      if (enable.test_unchecked(i) && idx < len) or_value.v_[i] = data[idx];
+    }
+    return or_value;
+  }
+
+  /// Writes each lane into `s` at the index in the same lane of `idxs`.
+  /// Lanes with an index that is out of bounds are skipped.
+  ///
+  /// If more than one lane has the same index, the value from the last of
+  /// them is written.
+  template <int&..., class U = ::sus::num::usize>
+    requires(std::same_as<U, ::sus::num::usize>)
+  void scatter(::sus::collections::SliceMut<T> s,
+               Simd<U, N> idxs) const noexcept {
+    scatter_select(s, Mask<::sus::num::isize, N>::splat(true), idxs);
+  }
+
+  /// Writes each lane that is set in `enable` into `s` at the index in the
+  /// same lane of `idxs`. Lanes with an index that is out of bounds are
+  /// skipped.
+  ///
+  /// If more than one enabled lane has the same index, the value from the
+  /// last of them is written.
+  template <int&..., class U = ::sus::num::usize, class E = ::sus::num::isize>
+    requires(std::same_as<U, ::sus::num::usize> &&
+             std::same_as<E, ::sus::num::isize>)
+  void scatter_select(::sus::collections::SliceMut<T> s,
+                      Mask<E, N> enable,
+                      Simd<U, N> idxs) const noexcept {
+    P* data = reinterpret_cast<P*>(s.as_mut_ptr());
+    const size_t len = size_t{s.len()};
+    for (size_t i = 0u; i < N; ++i) {
+      const size_t idx = idxs.v_[i];
+      if (enable.test_unchecked(i) && idx < len) data[idx] = v_[i];
+    }
+  }
+
+  /// Returns the value in lane `i`.
+  ///
+  /// # Panics
+  /// Panics if `i` is not less than `N`.
+  _sus_pure T lane(::sus::num::usize i) const noexcept {
+    sus_check_with_message(i < N, "lane index out of bounds");
+    return T(v_[size_t{i}]);
+  }
+
+  /// Sets the value in lane `i`.
+  ///
+  /// # Panics
+  /// Panics if `i` is not less than `N`.
+  void set_lane(::sus::num::usize i, T value) noexcept {
+    sus_check_with_message(i < N, "lane index out of bounds");
+    v_[size_t{i}] = value.primitive_value;
+  }
+
+  /// Lane-wise wrapping addition.
+  _sus_pure Simd wrapping_add(const Simd& r) const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    return from_bits(bits(v_) + bits(r.v_));
+  }
+  /// Lane-wise wrapping subtraction.
+  _sus_pure Simd wrapping_sub(const Simd& r) const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    return from_bits(bits(v_) - bits(r.v_));
+  }
+  /// Lane-wise wrapping multiplication.
+  _sus_pure Simd wrapping_mul(const Simd& r) const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    return from_bits(bits(v_) * bits(r.v_));
+  }
+
+  /// Lane-wise addition, which returns the wrapped result along with a mask
+  /// of the lanes that overflowed.
+  _sus_pure ::sus::Tuple<Simd, MaskType> overflowing_add(
+      const Simd& r) const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    const UVec a = bits(v_), b = bits(r.v_), sum = a + b;
+    return ::sus::Tuple<Simd, MaskType>(from_bits(sum),
+                                        MaskType(add_overflow(a, b, sum)));
+  }
+  /// Lane-wise subtraction, which returns the wrapped result along with a
+  /// mask of the lanes that overflowed.
+  _sus_pure ::sus::Tuple<Simd, MaskType> overflowing_sub(
+      const Simd& r) const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    const UVec a = bits(v_), b = bits(r.v_), diff = a - b;
+    return ::sus::Tuple<Simd, MaskType>(from_bits(diff),
+                                        MaskType(sub_overflow(a, b, diff)));
+  }
+  /// Lane-wise multiplication, which returns the wrapped result along with a
+  /// mask of the lanes that overflowed.
+  _sus_pure ::sus::Tuple<Simd, MaskType> overflowing_mul(
+      const Simd& r) const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    // There is no portable vector instruction to detect overflow in a
+    // multiply, so it is done one lane at a time.
+    Vec out = v_;
+    MVec overflow = MVec();
+    for (size_t i = 0u; i < N; ++i) {
+      const auto o = ::sus::num::__private::mul_with_overflow(P{v_[i]},
+                                                              P{r.v_[i]});
+      out[i] = o.value;
+      overflow[i] = o.overflow ? MLane(-1) : MLane(0);
+    }
+    return ::sus::Tuple<Simd, MaskType>(Simd(out), MaskType(overflow));
+  }
+
+  /// Lane-wise checked addition. Returns `None` if any lane overflowed.
+  _sus_pure ::sus::Option<Simd> checked_add(const Simd& r) const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    return checked(overflowing_add(r));
+  }
+  /// Lane-wise checked subtraction. Returns `None` if any lane overflowed.
+  _sus_pure ::sus::Option<Simd> checked_sub(const Simd& r) const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    return checked(overflowing_sub(r));
+  }
+  /// Lane-wise checked multiplication. Returns `None` if any lane overflowed.
+  _sus_pure ::sus::Option<Simd> checked_mul(const Simd& r) const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    return checked(overflowing_mul(r));
+  }
+
+  /// Lane-wise saturating addition, which clamps each lane to the numeric
+  /// bounds of `T` instead of overflowing.
+  _sus_pure Simd saturating_add(const Simd& r) const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    const UVec a = bits(v_), b = bits(r.v_), sum = a + b;
+    const MVec overflow = add_overflow(a, b, sum);
+    if constexpr (::sus::num::Unsigned<T>) {
+      // Overflow can only go past the max.
+      return from_bits(sum | std::bit_cast<UVec>(overflow));
+    } else {
+      // Overflow goes past the bound in the direction of the sign of `a`.
+      return from_bits(select_bits(overflow, saturated(a), sum));
+    }
+  }
+  /// Lane-wise saturating subtraction, which clamps each lane to the numeric
+  /// bounds of `T` instead of overflowing.
+  _sus_pure Simd saturating_sub(const Simd& r) const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    const UVec a = bits(v_), b = bits(r.v_), diff = a - b;
+    const MVec overflow = sub_overflow(a, b, diff);
+    if constexpr (::sus::num::Unsigned<T>) {
+      // Overflow can only go past zero.
+      return from_bits(diff & ~std::bit_cast<UVec>(overflow));
+    } else {
+      return from_bits(select_bits(overflow, saturated(a), diff));
+    }
+  }
+
+  /// Lane-wise comparison for equality.
+  _sus_pure MaskType simd_eq(const Simd& r) const noexcept {
+    return MaskType(std::bit_cast<MVec>(v_ == r.v_));
+  }
+  /// Lane-wise comparison for inequality.
+  _sus_pure MaskType simd_ne(const Simd& r) const noexcept {
+    return MaskType(std::bit_cast<MVec>(v_ != r.v_));
+  }
+  /// Lane-wise less-than comparison.
+  _sus_pure MaskType simd_lt(const Simd& r) const noexcept {
+    return MaskType(std::bit_cast<MVec>(v_ < r.v_));
+  }
+  /// Lane-wise less-than-or-equal comparison.
+  _sus_pure MaskType simd_le(const Simd& r) const noexcept {
+    return MaskType(std::bit_cast<MVec>(v_ <= r.v_));
+  }
+  /// Lane-wise greater-than comparison.
+  _sus_pure MaskType simd_gt(const Simd& r) const noexcept {
+    return MaskType(std::bit_cast<MVec>(v_ > r.v_));
+  }
+  /// Lane-wise greater-than-or-equal comparison.
+  _sus_pure MaskType simd_ge(const Simd& r) const noexcept {
+    return MaskType(std::bit_cast<MVec>(v_ >= r.v_));
+  }
+
+  /// Lane-wise minimum. For floating point lanes, if one of the values is
+  /// NaN, the other value is returned.
+  _sus_pure Simd simd_min(const Simd& r) const noexcept {
+    MVec take_r = std::bit_cast<MVec>(r.v_ < v_);
+    if constexpr (::sus::num::Float<T>)
+      take_r = take_r | std::bit_cast<MVec>(v_ != v_);
+    return Simd(std::bit_cast<Vec>(select_bits(take_r, bits(r.v_), bits(v_))));
+  }
+  /// Lane-wise maximum. For floating point lanes, if one of the values is
+  /// NaN, the other value is returned.
+  _sus_pure Simd simd_max(const Simd& r) const noexcept {
+    MVec take_r = std::bit_cast<MVec>(r.v_ > v_);
+    if constexpr (::sus::num::Float<T>)
+      take_r = take_r | std::bit_cast<MVec>(v_ != v_);
+    return Simd(std::bit_cast<Vec>(select_bits(take_r, bits(r.v_), bits(v_))));
+  }
+
+  /// Returns the sum of the lanes, added in order from the first lane.
+  ///
+  /// # Panics
+  /// For integer lanes, panics if the sum overflows, like adding the lanes
+  /// with `+` would.
+  _sus_pure T reduce_sum() const noexcept {
+    T sum = T(v_[0u]);
+    for (size_t i = 1u; i < N; ++i) sum += T(v_[i]);
+    return sum;
+  }
+  /// Returns the sum of the lanes, wrapping around on overflow.
+  _sus_pure T wrapping_reduce_sum() const noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    UP sum = 0u;
+    for (size_t i = 0u; i < N; ++i) sum += static_cast<UP>(v_[i]);
+    return T(static_cast<P>(sum));
+  }
+  /// Returns the smallest lane. For floating point lanes, NaN lanes are
+  /// ignored unless every lane is NaN.
+  _sus_pure T reduce_min() const noexcept {
+    P out = v_[0u];
+    for (size_t i = 1u; i < N; ++i) {
+      const P p = v_[i];
+      if (p < out || out != out) out = p;
+    }
+    return T(out);
+  }
+  /// Returns the largest lane. For floating point lanes, NaN lanes are
+  /// ignored unless every lane is NaN.
+  _sus_pure T reduce_max() const noexcept {
+    P out = v_[0u];
+    for (size_t i = 1u; i < N; ++i) {
+      const P p = v_[i];
+      if (p > out || out != out) out = p;
+    }
+    return T(out);
+  }
+
+  /// Lane-wise addition.
+  ///
+  /// # Panics
+  /// For integer lanes, panics if any lane overflows, unless
+  /// `SUS_CHECK_INTEGER_OVERFLOW` is `false`.
+  _sus_pure friend Simd operator+(const Simd& l, const Simd& r) noexcept {
+    if constexpr (::sus::num::Float<T>) {
+      return Simd(l.v_ + r.v_);
+    } else if constexpr (SUS_CHECK_INTEGER_OVERFLOW) {
+      auto [out, overflow] = l.overflowing_add(r);
+      sus_check_with_message(!overflow.any(), "attempt to add with overflow");
+      return out;
+    } else {
+      return l.wrapping_add(r);
+    }
+  }
+  /// Lane-wise subtraction.
+  ///
+  /// # Panics
+  /// For integer lanes, panics if any lane overflows, unless
+  /// `SUS_CHECK_INTEGER_OVERFLOW` is `false`.
+  _sus_pure friend Simd operator-(const Simd& l, const Simd& r) noexcept {
+    if constexpr (::sus::num::Float<T>) {
+      return Simd(l.v_ - r.v_);
+    } else if constexpr (SUS_CHECK_INTEGER_OVERFLOW) {
+      auto [out, overflow] = l.overflowing_sub(r);
+      sus_check_with_message(!overflow.any(),
+                             "attempt to subtract with overflow");
+      return out;
+    } else {
+      return l.wrapping_sub(r);
+    }
+  }
+  /// Lane-wise multiplication.
+  ///
+  /// # Panics
+  /// For integer lanes, panics if any lane overflows, unless
+  /// `SUS_CHECK_INTEGER_OVERFLOW` is `false`.
+  _sus_pure friend Simd operator*(const Simd& l, const Simd& r) noexcept {
+    if constexpr (::sus::num::Float<T>) {
+      return Simd(l.v_ * r.v_);
+    } else if constexpr (SUS_CHECK_INTEGER_OVERFLOW) {
+      auto [out, overflow] = l.overflowing_mul(r);
+      sus_check_with_message(!overflow.any(),
+                             "attempt to multiply with overflow");
+      return out;
+    } else {
+      return l.wrapping_mul(r);
+    }
+  }
+  /// Lane-wise division of floating point lanes.
+  _sus_pure friend Simd operator/(const Simd& l, const Simd& r) noexcept
+    requires(::sus::num::Float<T>)
+  {
+    return Simd(l.v_ / r.v_);
+  }
+  /// Lane-wise negation of floating point lanes.
+  _sus_pure friend Simd operator-(const Simd& s) noexcept
+    requires(::sus::num::Float<T>)
+  {
+    return Simd(-s.v_);
+  }
+
+  /// Lane-wise negation of signed integer lanes.
+  ///
+  /// # Panics
+  /// Panics if any lane is `MIN`, unless `SUS_CHECK_INTEGER_OVERFLOW` is
+  /// `false`.
+  _sus_pure friend Simd operator-(const Simd& s) noexcept
+    requires(::sus::num::Signed<T>)
+  {
+    const UVec a = bits(s.v_), neg = UVec() - a;
+    if constexpr (SUS_CHECK_INTEGER_OVERFLOW) {
+      // Only `MIN` is negative both before and after negation.
+      sus_check_with_message(!any_lane(negative(a & neg)),
+                             "attempt to negate with overflow");
+    }
+    return from_bits(neg);
+  }
+
+  /// Lane-wise bitwise AND of integer lanes.
+  _sus_pure friend Simd operator&(const Simd& l, const Simd& r) noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    return from_bits(bits(l.v_) & bits(r.v_));
+  }
+  /// Lane-wise bitwise OR of integer lanes.
+  _sus_pure friend Simd operator|(const Simd& l, const Simd& r) noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    return from_bits(bits(l.v_) | bits(r.v_));
+  }
+  /// Lane-wise bitwise XOR of integer lanes.
+  _sus_pure friend Simd operator^(const Simd& l, const Simd& r) noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    return from_bits(bits(l.v_) ^ bits(r.v_));
+  }
+  /// Lane-wise bitwise NOT of integer lanes.
+  _sus_pure friend Simd operator~(const Simd& s) noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    return from_bits(~bits(s.v_));
+  }
+
+  void operator+=(const Simd& r) & noexcept { *this = *this + r; }
+  void operator-=(const Simd& r) & noexcept { *this = *this - r; }
+  void operator*=(const Simd& r) & noexcept { *this = *this * r; }
+  void operator/=(const Simd& r) & noexcept
+    requires(::sus::num::Float<T>)
+  {
+    *this = *this / r;
+  }
+  void operator&=(const Simd& r) & noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    *this = *this & r;
+  }
+  void operator|=(const Simd& r) & noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    *this = *this | r;
+  }
+  void operator^=(const Simd& r) & noexcept
+    requires(::sus::num::IntegerNumeric<T>)
+  {
+    *this = *this ^ r;
+  }
+
+  /// Returns true if every lane of `l` is equal to the same lane in `r`.
+  ///
+  /// #[doc.implements=sus::cmp::Eq]
+  _sus_pure friend bool operator==(const Simd& l, const Simd& r) noexcept {
+    return l.simd_eq(r).all();
+  }
+
+ private:
+  template <class U, size_t M>
+    requires(__private::SimdElement<U> && __private::valid_lanes<sizeof(U), M>)
+  friend class Simd;
+  template <class I, size_t M>
+    requires(::sus::num::Signed<I> && __private::valid_lanes<sizeof(I), M>)
+  friend class Mask;
+
+  using MLane = typename __private::MaskPrimitive<sizeof(T)>::type;
+
+  explicit Simd(Vec v) noexcept : v_(v) {}
+
+  template <class V, class L>
+  _sus_always_inline static V broadcast(L l) noexcept {
+    V v = V();
+    for (size_t i = 0u; i < N; ++i) v[i] = l;
+    return v;
+  }
+  _sus_always_inline static UVec bits(Vec v) noexcept {
+    return std::bit_cast<UVec>(v);
+  }
+  _sus_always_inline static Simd from_bits(UVec v) noexcept {
+    return Simd(std::bit_cast<Vec>(v));
+  }
+  // Chooses each lane from `t` where `m` is set, and from `f` otherwise.
+  _sus_always_inline static UVec select_bits(MVec m, UVec t, UVec f) noexcept {
+    const UVec um = std::bit_cast<UVec>(m);
+    return (t & um) | (f & ~um);
+  }
+  _sus_always_inline static bool any_lane(MVec m) noexcept {
+    MLane any = 0;
+    for (size_t i = 0u; i < N; ++i) any |= m[i];
+    return any != 0;
+  }
+  // Returns a mask of the lanes where a signed value in `v` is negative.
+  _sus_always_inline static MVec negative(UVec v) noexcept {
+    return std::bit_cast<MVec>(std::bit_cast<MVec>(v) < MVec());
+  }
+  _sus_always_inline static MVec add_overflow(UVec a, UVec b,
+                                              UVec sum) noexcept {
+    if constexpr (::sus::num::Unsigned<T>)
+      return std::bit_cast<MVec>(sum < a);
+    else
+      return negative((a ^ sum) & (b ^ sum));
+  }
+  _sus_always_inline static MVec sub_overflow(UVec a, UVec b,
+                                              UVec diff) noexcept {
+    if constexpr (::sus::num::Unsigned<T>)
+      return std::bit_cast<MVec>(a < b);
+    else
+      return negative((a ^ b) & (a ^ diff));
+  }
+  // The signed bound that a lane saturates to when overflowing in the
+  // direction of the sign of `a`: MIN if `a` is negative, MAX otherwise.
+  _sus_always_inline static UVec saturated(UVec a) noexcept {
+    constexpr UP max = static_cast<UP>(UP(~UP{0}) >> 1u);
+    return (a >> int{sizeof(T) * 8u - 1u}) + broadcast<UVec>(max);
+  }
+  static ::sus::Option<Simd> checked(
+      ::sus::Tuple<Simd, MaskType> result) noexcept {
+    auto [out, overflow] = ::sus::move(result);
+    if (overflow.any()) return ::sus::Option<Simd>();
+    return ::sus::Option<Simd>(out);
+  }
+
+  Vec v_;
+};
+
+/// A mask over `N` lanes of a [`Simd`]($sus::simd::Simd), where each lane is
+/// true or false.
+///
+/// Masks are produced by comparing `Simd` vectors, and the lane type `I` is
+/// a signed integer with the same width as the lanes that were compared. A
+/// `Mask` can choose between the lanes of any two `Simd` vectors with lanes
+/// of the same width with [`select`]($sus::simd::Mask::select).
+template <class I, size_t N>
+  requires(::sus::num::Signed<I> && __private::valid_lanes<sizeof(I), N>)
+class Mask final {
+  using Lane = typename __private::MaskPrimitive<sizeof(I)>::type;
+  using Vec = __private::MaskVec<sizeof(I), N>;
+
+ public:
+  /// The number of lanes in the mask.
+  static constexpr ::sus::num::usize LANES = N;
+
+  /// Constructs a mask with every lane set to false.
+  ///
+  /// #[doc.implements=sus::construct::Default]
+  explicit Mask() noexcept : v_() {}
+
+  /// Constructs a mask with every lane set to `value`.
+  _sus_pure static Mask splat(bool value) noexcept {
+    Vec v = Vec();
+    for (size_t i = 0u; i < N; ++i) v[i] = value ? Lane(-1) : Lane(0);
+    return Mask(v);
+  }
+
+  /// Constructs a mask from the values in `a`.
+  _sus_pure static Mask from_array(
+      const ::sus::collections::Array<bool, N>& a) noexcept {
+    Vec v = Vec();
+    for (size_t i = 0u; i < N; ++i)
+      v[i] = a.get_unchecked(::sus::marker::unsafe_fn, i) ? Lane(-1) : Lane(0);
+    return Mask(v);
+  }
+
+  /// Returns the lanes of the mask in an `Array`.
+  _sus_pure ::sus::collections::Array<bool, N> to_array() const noexcept {
+    auto a = ::sus::collections::Array<bool, N>();
+    for (size_t i = 0u; i < N; ++i)
+      a.get_unchecked_mut(::sus::marker::unsafe_fn, i) = v_[i] != 0;
+    return a;
+  }
+
+  /// Returns whether lane `i` is set.
+  ///
+  /// # Panics
+  /// Panics if `i` is not less than `N`.
+  _sus_pure bool test(::sus::num::usize i) const noexcept {
+    sus_check_with_message(i < N, "lane index out of bounds");
+    return test_unchecked(size_t{i});
+  }
+
+  /// Sets lane `i` to `value`.
+  ///
+  /// # Panics
+  /// Panics if `i` is not less than `N`.
+  void set(::sus::num::usize i, bool value) noexcept {
+    sus_check_with_message(i < N, "lane index out of bounds");
+    v_[size_t{i}] = value ? Lane(-1) : Lane(0);
+  }
+
+  /// Returns true if any lane is set.
+  _sus_pure bool any() const noexcept {
+    Lane acc = 0;
+    for (size_t i = 0u; i < N; ++i) acc |= v_[i];
+    return acc != 0;
+  }
+  /// Returns true if every lane is set.
+  _sus_pure bool all() const noexcept {
+    Lane acc = Lane(-1);
+    for (size_t i = 0u; i < N; ++i) acc &= v_[i];
+    return acc != 0;
+  }
+
+  /// Returns a bitmask with bit `i` set if lane `i` is set.
+  _sus_pure ::sus::num::u64 to_bitmask() const noexcept {
+    return __private::movemask<sizeof(I), N>(v_);
+  }
+
+  /// Returns the index of the first lane that is set, or `None` if no lane is
+  /// set.
+  _sus_pure ::sus::Option<::sus::num::usize> first_set() const noexcept {
+    const uint64_t bitmask = to_bitmask().primitive_value;
+    if (bitmask == 0u) return ::sus::Option<::sus::num::usize>();
+    return ::sus::Option<::sus::num::usize>(
+        ::sus::num::usize(static_cast<size_t>(std::countr_zero(bitmask))));
+  }
+
+  /// Returns a vector with the lanes of `if_true` where the mask is set, and
+  /// the lanes of `if_false` elsewhere.
+  template <class T>
+    requires(sizeof(T) == sizeof(I))
+  _sus_pure Simd<T, N> select(const Simd<T, N>& if_true,
+                              const Simd<T, N>& if_false) const noexcept {
+    using SimdT = Simd<T, N>;
+    return SimdT(std::bit_cast<typename SimdT::Vec>(SimdT::select_bits(
+        v_, SimdT::bits(if_true.v_), SimdT::bits(if_false.v_))));
+  }
+
+  /// Lane-wise AND.
+  _sus_pure friend Mask operator&(const Mask& l, const Mask& r) noexcept {
+    return Mask(l.v_ & r.v_);
+  }
+  /// Lane-wise OR.
+  _sus_pure friend Mask operator|(const Mask& l, const Mask& r) noexcept {
+    return Mask(l.v_ | r.v_);
+  }
+  /// Lane-wise XOR.
+  _sus_pure friend Mask operator^(const Mask& l, const Mask& r) noexcept {
+    return Mask(l.v_ ^ r.v_);
+  }
+  /// Lane-wise NOT.
+  _sus_pure friend Mask operator!(const Mask& m) noexcept {
+    return Mask(~m.v_);
+  }
+
+  /// Returns true if every lane of `l` is equal to the same lane in `r`.
+  ///
+  /// #[doc.implements=sus::cmp::Eq]
+  _sus_pure friend bool operator==(const Mask& l, const Mask& r) noexcept {
+    return (l ^ r).any() == false;
+  }
+
+ private:
+  template <class T, size_t M>
+    requires(__private::SimdElement<T> && __private::valid_lanes<sizeof(T), M>)
+  friend class Simd;
+
+  explicit Mask(Vec v) noexcept : v_(v) {}
+
+  _sus_always_inline bool test_unchecked(size_t i) const noexcept {
+    return v_[i] != 0;
+  }
+
+  Vec v_;
+};
+
+// Names matching the vector types of other SIMD libraries.
+
+using i8x16 = Simd<::sus::num::i8, 16>;
+using i8x32 = Simd<::sus::num::i8, 32>;
+using i8x64 = Simd<::sus::num::i8, 64>;
+using u8x16 = Simd<::sus::num::u8, 16>;
+using u8x32 = Simd<::sus::num::u8, 32>;
+using u8x64 = Simd<::sus::num::u8, 64>;
+using i16x8 = Simd<::sus::num::i16, 8>;
+using i16x16 = Simd<::sus::num::i16, 16>;
+using i16x32 = Simd<::sus::num::i16, 32>;
+using u16x8 = Simd<::sus::num::u16, 8>;
+using u16x16 = Simd<::sus::num::u16, 16>;
+using u16x32 = Simd<::sus::num::u16, 32>;
+using i32x4 = Simd<::sus::num::i32, 4>;
+using i32x8 = Simd<::sus::num::i32, 8>;
+using i32x16 = Simd<::sus::num::i32, 16>;
+using u32x4 = Simd<::sus::num::u32, 4>;
+using u32x8 = Simd<::sus::num::u32, 8>;
+using u32x16 = Simd<::sus::num::u32, 16>;
+using i64x2 = Simd<::sus::num::i64, 2>;
+using i64x4 = Simd<::sus::num::i64, 4>;
+using i64x8 = Simd<::sus::num::i64, 8>;
+using u64x2 = Simd<::sus::num::u64, 2>;
+using u64x4 = Simd<::sus::num::u64, 4>;
+using u64x8 = Simd<::sus::num::u64, 8>;
+using f32x4 = Simd<::sus::num::f32, 4>;
+using f32x8 = Simd<::sus::num::f32, 8>;
+using f32x16 = Simd<::sus::num::f32, 16>;
+using f64x2 = Simd<::sus::num::f64, 2>;
+using f64x4 = Simd<::sus::num::f64, 4>;
+using f64x8 = Simd<::sus::num::f64, 8>;
+
+}  // namespace sus::simd
@@ -0,0 +1,412 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/simd/simd.h"
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/collections/array.h"
+#include "sus/collections/vec.h"
+#include "sus/construct/default.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+namespace {
+
+using sus::Array;
+using sus::simd::Mask;
+using sus::simd::Simd;
+using sus::test::ensure_use;
+using sus::simd::f32x4;
+using sus::simd::f32x8;
+using sus::simd::f64x2;
+using sus::simd::i16x8;
+using sus::simd::i32x4;
+using sus::simd::i32x8;
+using sus::simd::i64x2;
+using sus::simd::i64x4;
+using sus::simd::i8x16;
+using maski32x4 = Mask<i32, 4>;
+using maski8x64 = Mask<i8, 64>;
+using maskisizex4 = Mask<isize, 4>;
+using sus::simd::u16x8;
+using sus::simd::u32x4;
+using sus::simd::u64x2;
+using sus::simd::u8x16;
+using usizex4 = Simd<usize, 4>;
+
+static_assert(sus::construct::Default<Simd<i32, 4>>);
+static_assert(sus::mem::Copy<Simd<i32, 4>>);
+static_assert(sus::construct::Default<Mask<i32, 4>>);
+static_assert(sus::mem::Copy<Mask<i32, 4>>);
+static_assert(std::same_as<Simd<f32, 8>::MaskType, Mask<i32, 8>>);
+static_assert(std::same_as<Simd<u8, 16>::MaskType, Mask<i8, 16>>);
+static_assert(sizeof(Simd<u8, 64>) == 64u);
+static_assert(alignof(Simd<i32, 4>) == 16u);
+
+// The lane count is a power of two, and the vector is at most 64 bytes.
+template <class T, size_t N>
+concept CanMakeSimd = requires { sizeof(Simd<T, N>); };
+static_assert(CanMakeSimd<u8, 64>);
+static_assert(!CanMakeSimd<u8, 128>);
+static_assert(!CanMakeSimd<u64, 16>);
+static_assert(!CanMakeSimd<i32, 3>);
+static_assert(!CanMakeSimd<uptr, 2>);
+static_assert(!CanMakeSimd<int, 4>);
+
+static_assert(sus::simd::native_lanes<u8>() >= 16u);
+static_assert(sus::simd::native_lanes<f64>() * 8u ==
+              sus::simd::native_lanes<u8>());
+
+TEST(Simd, Construct) {
+  EXPECT_EQ(i32x4().to_array(), (Array<i32, 4>(0, 0, 0, 0)));
+  EXPECT_EQ(i32x4::splat(7).to_array(), (Array<i32, 4>(7, 7, 7, 7)));
+  auto a =
+      Array<u16, 8>(1_u16, 2_u16, 3_u16, 4_u16, 5_u16, 6_u16, 7_u16, 8_u16);
+  EXPECT_EQ(u16x8::from_array(a).to_array(), a);
+  EXPECT_EQ(u16x8::from_array(a).lane(3u), 4u);
+}
+
+TEST(Simd, Lanes) {
+  auto s = i64x2::splat(3);
+  s.set_lane(1u, -4);
+  EXPECT_EQ(s.lane(0u), 3);
+  EXPECT_EQ(s.lane(1u), -4);
+  EXPECT_EQ(i64x2::LANES, 2u);
+}
+
+TEST(Simd, Slices) {
+  auto v = sus::Vec<i32>(1, 2, 3, 4, 5, 6);
+  auto s = i32x4::from_slice(v["1..6"_r]);
+  EXPECT_EQ(s.to_array(), (Array<i32, 4>(2, 3, 4, 5)));
+
+  // Loading past the end of a short slice.
+  auto tail = v["4..6"_r];
+  EXPECT_EQ(i32x4::load_or_default(tail).to_array(),
+            (Array<i32, 4>(5, 6, 0, 0)));
+  EXPECT_EQ(i32x4::load_or(tail, i32x4::splat(-1)).to_array(),
+            (Array<i32, 4>(5, 6, -1, -1)));
+  EXPECT_EQ(i32x4::load_or_default(v).to_array(),
+            (Array<i32, 4>(1, 2, 3, 4)));
+
+  auto out = sus::Vec<i32>(0, 0, 0, 0, 0);
+  i32x4::splat(9).copy_to_slice(out["1.."_r]);
+  EXPECT_EQ(out, sus::Vec<i32>(0, 9, 9, 9, 9));
+}
+
+TEST(Simd, ChunksExact) {
+  auto a = sus::Vec<i32>(1, 2, 3, 4, 5, 6, 7, 8, 9);
+  auto b = sus::Vec<i32>(10, 20, 30, 40, 50, 60, 70, 80, 90);
+  auto out = sus::Vec<i32>(0, 0, 0, 0, 0, 0, 0, 0, 0);
+
+  auto a_chunks = a.chunks_exact(4u);
+  auto b_chunks = b.chunks_exact(4u);
+  for (sus::SliceMut<i32> o : out.chunks_exact_mut(4u)) {
+    auto sum = i32x4::from_slice(a_chunks.next().unwrap()) +
+               i32x4::from_slice(b_chunks.next().unwrap());
+    sum.copy_to_slice(o);
+  }
+  out[8u] = a[8u] + b[8u];
+  EXPECT_EQ(out, sus::Vec<i32>(11, 22, 33, 44, 55, 66, 77, 88, 99));
+}
+
+TEST(Simd, GatherScatter) {
+  auto v = sus::Vec<f32>(0.f, 1.f, 2.f, 3.f, 4.f);
+  auto idxs = usizex4::from_array(Array<usize, 4>(4u, 0u, 9u, 2u));
+  EXPECT_EQ(f32x4::gather_or_default(v, idxs).to_array(),
+            (Array<f32, 4>(4.f, 0.f, 0.f, 2.f)));
+  EXPECT_EQ(
+      f32x4::gather_or(v, idxs, f32x4::splat(-1.f)).to_array(),
+      (Array<f32, 4>(4.f, 0.f, -1.f, 2.f)));
+
+  auto enable =
+      maskisizex4::from_array(Array<bool, 4>(true, false, true, true));
+  EXPECT_EQ(f32x4::gather_select(v, enable, idxs,
+                                        f32x4::splat(-1.f))
+                .to_array(),
+            (Array<f32, 4>(4.f, -1.f, -1.f, 2.f)));
+
+  auto out = sus::Vec<i32>(0, 0, 0, 0, 0);
+  auto vals = i32x4::from_array(Array<i32, 4>(10, 11, 12, 13));
+  // The out-of-bounds index is skipped, and the last lane with a repeated
+  // index wins.
+  vals.scatter(out, usizex4::from_array(Array<usize, 4>(1u, 7u, 3u, 1u)));
+  EXPECT_EQ(out, sus::Vec<i32>(0, 13, 0, 12, 0));
+
+  vals.scatter_select(out, enable,
+                      usizex4::from_array(Array<usize, 4>(0u, 2u, 4u, 9u)));
+  EXPECT_EQ(out, sus::Vec<i32>(10, 13, 0, 12, 12));
+}
+
+TEST(Simd, Wrapping) {
+  auto a = u8x16::splat(250_u8);
+  auto b = u8x16::splat(10_u8);
+  EXPECT_EQ(a.wrapping_add(b), u8x16::splat(4_u8));
+  EXPECT_EQ(b.wrapping_sub(a), u8x16::splat(16_u8));
+  EXPECT_EQ(a.wrapping_mul(b), u8x16::splat(u8(uint8_t{2500u % 256u})));
+  // The product of the largest `u16` values doesn't fit in an `int`.
+  EXPECT_EQ(u16x8::splat(u16::MAX).wrapping_mul(u16x8::splat(u16::MAX)),
+            u16x8::splat(1_u16));
+
+  auto c = i32x4::splat(i32::MAX);
+  EXPECT_EQ(c.wrapping_add(i32x4::splat(1)), i32x4::splat(i32::MIN));
+  EXPECT_EQ(i32x4::splat(i32::MIN).wrapping_sub(i32x4::splat(1)),
+            c);
+}
+
+TEST(Simd, Overflowing) {
+  auto a = i16x8::from_array(Array<i16, 8>(i16::MAX, i16::MIN, 1_i16, -1_i16,
+                                            100_i16, -100_i16, 0_i16,
+                                            i16::MAX));
+  auto b = i16x8::from_array(Array<i16, 8>(1_i16, -1_i16, 2_i16, -2_i16,
+                                            i16::MAX, i16::MIN, i16::MIN,
+                                            -1_i16));
+
+  auto [sum, add_o] = a.overflowing_add(b);
+  EXPECT_EQ(add_o.to_array(), (Array<bool, 8>(true, true, false, false, true,
+                                              true, false, false)));
+  EXPECT_EQ(sum, a.wrapping_add(b));
+
+  auto [diff, sub_o] = a.overflowing_sub(b);
+  EXPECT_EQ(sub_o.to_array(), (Array<bool, 8>(false, false, false, false,
+                                              false, false, true, true)));
+  EXPECT_EQ(diff, a.wrapping_sub(b));
+
+  auto [prod, mul_o] = a.overflowing_mul(b);
+  EXPECT_EQ(mul_o.to_array(), (Array<bool, 8>(false, true, false, false, true,
+                                              true, false, false)));
+  EXPECT_EQ(prod, a.wrapping_mul(b));
+
+  auto u = u32x4::from_array(Array<u32, 4>(u32::MAX, 0u, 5u, 1u << 16u));
+  auto v = u32x4::from_array(Array<u32, 4>(1u, 1u, 5u, 1u << 16u));
+  auto add_u = u.overflowing_add(v);
+  EXPECT_EQ(add_u.at<1>().to_bitmask(), 0b0001u);
+  auto sub_u = u.overflowing_sub(v);
+  EXPECT_EQ(sub_u.at<1>().to_bitmask(), 0b0010u);
+  auto mul_u = u.overflowing_mul(v);
+  EXPECT_EQ(mul_u.at<1>().to_bitmask(), 0b1000u);
+}
+
+TEST(Simd, Checked) {
+  auto a = i32x4::from_array(Array<i32, 4>(1, 2, 3, 4));
+  EXPECT_EQ(a.checked_add(a).unwrap(),
+            i32x4::from_array(Array<i32, 4>(2, 4, 6, 8)));
+  EXPECT_EQ(a.checked_sub(a).unwrap(), i32x4());
+  EXPECT_EQ(a.checked_mul(a).unwrap(),
+            i32x4::from_array(Array<i32, 4>(1, 4, 9, 16)));
+
+  a.set_lane(2u, i32::MAX);
+  EXPECT_EQ(a.checked_add(a).is_none(), true);
+  EXPECT_EQ(a.checked_mul(a).is_none(), true);
+  EXPECT_EQ(u64x2().checked_sub(u64x2::splat(1u)).is_none(),
+            true);
+}
+
+TEST(Simd, Saturating) {
+  auto a = u8x16::splat(250_u8);
+  EXPECT_EQ(a.saturating_add(u8x16::splat(10_u8)),
+            u8x16::splat(u8::MAX));
+  EXPECT_EQ(a.saturating_add(u8x16::splat(5_u8)),
+            u8x16::splat(255_u8));
+  EXPECT_EQ(a.saturating_add(u8x16::splat(1_u8)),
+            u8x16::splat(251_u8));
+  EXPECT_EQ(u8x16::splat(3_u8).saturating_sub(u8x16::splat(5_u8)),
+            u8x16());
+
+  auto s = i8x16::splat(100_i8);
+  EXPECT_EQ(s.saturating_add(s), i8x16::splat(i8::MAX));
+  EXPECT_EQ((-s).saturating_add(-s), i8x16::splat(i8::MIN));
+  EXPECT_EQ((-s).saturating_sub(s), i8x16::splat(i8::MIN));
+  EXPECT_EQ(s.saturating_sub(-s), i8x16::splat(i8::MAX));
+  EXPECT_EQ(s.saturating_sub(s), i8x16());
+
+  auto l = i64x4::from_array(Array<i64, 4>(i64::MAX, i64::MIN, 5, -5));
+  auto r = i64x4::from_array(Array<i64, 4>(1, -1, 1, -1));
+  EXPECT_EQ(l.saturating_add(r).to_array(),
+            (Array<i64, 4>(i64::MAX, i64::MIN, 6, -6)));
+}
+
+TEST(Simd, Float) {
+  auto a = f32x8::splat(1.5f);
+  auto b = f32x8::splat(0.5f);
+  EXPECT_EQ(a + b, f32x8::splat(2.f));
+  EXPECT_EQ(a - b, f32x8::splat(1.f));
+  EXPECT_EQ(a * b, f32x8::splat(0.75f));
+  EXPECT_EQ(a / b, f32x8::splat(3.f));
+  EXPECT_EQ(-a, f32x8::splat(-1.5f));
+
+  auto c = a;
+  c += b;
+  c *= b;
+  EXPECT_EQ(c, f32x8::splat(1.f));
+
+  // NaN is not equal to itself.
+  auto nan = f64x2::splat(f64::NaN);
+  EXPECT_NE(nan, nan);
+  EXPECT_EQ(nan.simd_eq(nan).any(), false);
+}
+
+TEST(Simd, Bitwise) {
+  auto a = u32x4::splat(0b1100u);
+  auto b = u32x4::splat(0b1010u);
+  EXPECT_EQ(a & b, u32x4::splat(0b1000u));
+  EXPECT_EQ(a | b, u32x4::splat(0b1110u));
+  EXPECT_EQ(a ^ b, u32x4::splat(0b0110u));
+  EXPECT_EQ(~a, u32x4::splat(~0b1100u));
+  a ^= b;
+  EXPECT_EQ(a, u32x4::splat(0b0110u));
+}
+
+TEST(Simd, Compare) {
+  auto a = i32x4::from_array(Array<i32, 4>(1, 5, -3, 4));
+  auto b = i32x4::from_array(Array<i32, 4>(2, 5, -4, 4));
+  EXPECT_EQ(a.simd_eq(b).to_bitmask(), 0b1010u);
+  EXPECT_EQ(a.simd_ne(b).to_bitmask(), 0b0101u);
+  EXPECT_EQ(a.simd_lt(b).to_bitmask(), 0b0001u);
+  EXPECT_EQ(a.simd_le(b).to_bitmask(), 0b1011u);
+  EXPECT_EQ(a.simd_gt(b).to_bitmask(), 0b0100u);
+  EXPECT_EQ(a.simd_ge(b).to_bitmask(), 0b1110u);
+
+  // Unsigned lanes compare as unsigned.
+  auto u = u8x16::splat(200_u8);
+  EXPECT_EQ(u.simd_gt(u8x16::splat(100_u8)).all(), true);
+
+  auto f = f32x4::from_array(Array<f32, 4>(1.f, f32::NaN, 3.f, -0.f));
+  auto g = f32x4::from_array(Array<f32, 4>(2.f, 1.f, 3.f, 0.f));
+  EXPECT_EQ(f.simd_lt(g).to_bitmask(), 0b0001u);
+  EXPECT_EQ(f.simd_eq(g).to_bitmask(), 0b1100u);
+  EXPECT_EQ(f.simd_ne(g).to_bitmask(), 0b0011u);
+}
+
+TEST(Simd, MinMax) {
+  auto a = i8x16::splat(-3_i8);
+  auto b = i8x16::splat(2_i8);
+  EXPECT_EQ(a.simd_min(b), a);
+  EXPECT_EQ(a.simd_max(b), b);
+
+  auto f = f32x4::from_array(Array<f32, 4>(1.f, f32::NaN, 3.f, 5.f));
+  auto g = f32x4::from_array(Array<f32, 4>(2.f, 1.f, f32::NaN, 4.f));
+  EXPECT_EQ(f.simd_min(g).to_array(), (Array<f32, 4>(1.f, 1.f, 3.f, 4.f)));
+  EXPECT_EQ(f.simd_max(g).to_array(), (Array<f32, 4>(2.f, 1.f, 3.f, 5.f)));
+}
+
+TEST(Simd, Reduce) {
+  auto a = i32x8::from_array(Array<i32, 8>(3, -1, 4, 1, -5, 9, 2, 6));
+  EXPECT_EQ(a.reduce_sum(), 19);
+  EXPECT_EQ(a.reduce_min(), -5);
+  EXPECT_EQ(a.reduce_max(), 9);
+
+  auto u = u8x16::splat(200_u8);
+  EXPECT_EQ(u.wrapping_reduce_sum(), u8(static_cast<uint8_t>(200u * 16u)));
+
+  auto f = f32x4::from_array(Array<f32, 4>(f32::NaN, 2.f, -1.f, 8.f));
+  EXPECT_EQ(f.reduce_min(), -1.f);
+  EXPECT_EQ(f.reduce_max(), 8.f);
+  EXPECT_EQ(f32x4::splat(0.25f).reduce_sum(), 1.f);
+  EXPECT_TRUE(f32x4::splat(f32::NaN).reduce_min().is_nan());
+}
+
+TEST(Simd, Mask) {
+  auto m = maski32x4::from_array(Array<bool, 4>(false, true, false, true));
+  EXPECT_EQ(m.any(), true);
+  EXPECT_EQ(m.all(), false);
+  EXPECT_EQ(m.test(1u), true);
+  EXPECT_EQ(m.test(2u), false);
+  EXPECT_EQ(m.to_bitmask(), 0b1010u);
+  EXPECT_EQ(m.first_set(), sus::some(1u));
+  EXPECT_EQ(maski32x4().first_set(), sus::None);
+  EXPECT_EQ(maski32x4().any(), false);
+  EXPECT_EQ(maski32x4::splat(true).all(), true);
+
+  EXPECT_EQ((!m).to_bitmask(), 0b0101u);
+  EXPECT_EQ((m & maski32x4::splat(true)), m);
+  EXPECT_EQ((m | !m), maski32x4::splat(true));
+  EXPECT_EQ((m ^ m), maski32x4());
+
+  m.set(0u, true);
+  EXPECT_EQ(m.to_array(), (Array<bool, 4>(true, true, false, true)));
+
+  // A mask selects lanes of any type with the same width.
+  auto t = f32x4::splat(1.f);
+  auto f = f32x4::splat(2.f);
+  EXPECT_EQ(m.select(t, f).to_array(), (Array<f32, 4>(1.f, 1.f, 2.f, 1.f)));
+  auto ti = u32x4::splat(7u);
+  auto fi = u32x4::splat(8u);
+  EXPECT_EQ(m.select(ti, fi).to_array(), (Array<u32, 4>(7u, 7u, 8u, 7u)));
+
+  auto wide = maski8x64::splat(false);
+  wide.set(63u, true);
+  EXPECT_EQ(wide.to_bitmask(), u64(1u) << 63u);
+  EXPECT_EQ(wide.first_set(), sus::some(63u));
+
+  // Bitmasks for each lane width.
+  auto bytes = u8x16::splat(1_u8);
+  bytes.set_lane(3u, 0_u8);
+  bytes.set_lane(15u, 0_u8);
+  EXPECT_EQ(bytes.simd_eq(u8x16()).to_bitmask(), 0b1000'0000'0000'1000u);
+  auto shorts = i16x8::splat(1_i16);
+  shorts.set_lane(6u, -1_i16);
+  EXPECT_EQ(shorts.simd_lt(i16x8()).to_bitmask(), 0b0100'0000u);
+  auto longs = i64x2::splat(1_i64);
+  longs.set_lane(1u, -1_i64);
+  EXPECT_EQ(longs.simd_lt(i64x2()).to_bitmask(), 0b10u);
+}
+
+TEST(SimdDeathTest, OperatorsPanicOnOverflow) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto x = i32x4::splat(i32::MAX) + i32x4::splat(1);
+        ensure_use(&x);
+      },
+      "attempt to add with overflow");
+  EXPECT_DEATH(
+      {
+        auto x = u8x16() - u8x16::splat(1_u8);
+        ensure_use(&x);
+      },
+      "attempt to subtract with overflow");
+  EXPECT_DEATH(
+      {
+        auto x = i64x2::splat(i64::MAX) * i64x2::splat(2);
+        ensure_use(&x);
+      },
+      "attempt to multiply with overflow");
+  EXPECT_DEATH(
+      {
+        auto x = i32x4::splat(i32::MAX).reduce_sum();
+        ensure_use(&x);
+      },
+      "attempt to add with overflow");
+#endif
+}
+
+TEST(SimdDeathTest, OutOfBounds) {
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto v = sus::Vec<i32>(1, 2, 3);
+        auto x = i32x4::from_slice(v);
+        ensure_use(&x);
+      },
+      "slice is shorter than the number of lanes");
+  EXPECT_DEATH(
+      {
+        auto x = i32x4().lane(4u);
+        ensure_use(&x);
+      },
+      "lane index out of bounds");
+#endif
+}
+
+}  // namespace
@@ -71,11 +71,16 @@ S& format_to_stream(S& os, const std::basic_string<Char>& s) {
 /// dependent type `U` defers instantiation until `operator<<` is first used.
 /// We need to constrain `U` to be the same type as `Type`, otherwise it will
 /// be ambiguous as to which overload we want.
+///
+/// `U` is declared before the stream type so that its constraint is checked
+/// first. When the left side of `<<` is a type which shifts by a `Type`, such
+/// as a wrapper around an integer, the stream constraint would otherwise
+/// recursively depend on itself.
 // clang-format off
 #define _sus_format_to_stream(Type)                                                   \
   template<                                                                           \
-      sus::string::__private::StreamCanReceiveString<char, Type> Sus_StreamType,      \
-      std::same_as<Type> U = Type                                                     \
+      std::same_as<Type> U = Type,                                                    \
+      sus::string::__private::StreamCanReceiveString<char, Type> Sus_StreamType       \
   >                                                                                   \
   /** Adaptor from fmt to streams.                                                    \
    * #[doc.hidden] */                                                                 \
@@ -0,0 +1,70 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "sus/rc/__private/rc_impl.h"
+
+namespace sus {
+
+/// Thread-safe shared ownership, with [`Arc<T>`]($sus::sync::Arc) and
+/// [`Weak<T>`]($sus::sync::Weak).
+namespace sync {}
+
+}  // namespace sus
+
+namespace sus::sync {
+
+/// A thread-safe reference-counted pointer. "Arc" stands for "Atomically
+/// Reference Counted".
+///
+/// `Arc<T>` is the same as [`Rc<T>`]($sus::rc::Rc), and has the same methods,
+/// except that its reference counts are changed with atomic operations, so
+/// references to the same value can be cloned and destroyed from different
+/// threads. The counts are stored in the same heap allocation as the value,
+/// and `Arc<Slice<T>>` shares a [`Slice`]($sus::collections::Slice) in a
+/// single allocation.
+///
+/// The value is shared between the threads, and only reachable through a
+/// const reference, so it must be safe to use through const references
+/// from multiple threads at once.
+///
+/// Atomic operations are more expensive than the plain ones in `Rc`, so
+/// prefer `Rc` for values that are only used on a single thread.
+///
+/// # Examples
+/// ```
+/// auto a = sus::Arc<sus::Vec<i32>>::from(sus::Vec<i32>(1, 2, 3));
+/// auto t = std::thread([b = a.clone()] { sus_check(b->len() == 3u); });
+/// t.join();
+/// sus_check(a.strong_count() == 1u);
+/// ```
+template <class T>
+using Arc = ::sus::rc::__private::RcImpl<T, ::sus::rc::__private::AtomicCount>;
+
+/// A weak reference to the value of an [`Arc`]($sus::sync::Arc).
+///
+/// A `Weak` does not keep the value alive, but it can be
+/// [upgraded]($sus::sync::Weak::upgrade) to an `Arc` while the value is still
+/// alive, from any thread.
+template <class T>
+using Weak =
+    ::sus::rc::__private::WeakImpl<T, ::sus::rc::__private::AtomicCount>;
+
+}  // namespace sus::sync
+
+// Promote `Arc` into the `sus` namespace.
+namespace sus {
+using ::sus::sync::Arc;
+}
@@ -0,0 +1,156 @@
+// Copyright 2023 Google LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sus/sync/arc.h"
+
+#include <atomic>
+#include <thread>
+
+#include "googletest/include/gtest/gtest.h"
+#include "sus/prelude.h"
+#include "sus/test/ensure_use.h"
+
+namespace {
+using sus::sync::Arc;
+using sus::sync::Weak;
+using sus::test::ensure_use;
+
+static_assert(sus::mem::Clone<Arc<i32>>);
+static_assert(sus::mem::Move<Arc<i32>>);
+static_assert(sizeof(Arc<i32>) == sizeof(void*));
+static_assert(sizeof(sus::Option<Arc<i32>>) == sizeof(Arc<i32>));
+static_assert(sus::mem::TriviallyRelocatable<Arc<i32>>);
+
+struct Counted {
+  Counted(std::atomic<int>& destroyed) : destroyed(&destroyed) {}
+  Counted(Counted&& o) : destroyed(sus::mem::replace(o.destroyed, nullptr)) {}
+  Counted& operator=(Counted&& o) {
+    destroyed = sus::mem::replace(o.destroyed, nullptr);
+    return *this;
+  }
+  ~Counted() {
+    if (destroyed) destroyed->fetch_add(1);
+  }
+
+  std::atomic<int>* destroyed;
+};
+
+TEST(Arc, CloneAcrossThreads) {
+  std::atomic<int> destroyed(0);
+  {
+    auto a = Arc<Counted>(Counted(destroyed));
+    auto threads = sus::Vec<std::thread>();
+    for (usize i; i < 4u; i += 1u) {
+      threads.push(std::thread([b = a.clone()] {
+        for (usize j; j < 10000u; j += 1u) {
+          auto c = b.clone();
+          EXPECT_GE(c.strong_count(), 2u);
+        }
+      }));
+    }
+    for (std::thread& t : threads.iter_mut()) t.join();
+    EXPECT_EQ(a.strong_count(), 1u);
+    EXPECT_EQ(destroyed.load(), 0);
+  }
+  EXPECT_EQ(destroyed.load(), 1);
+}
+
+TEST(Arc, LastReleaseOnAnotherThread) {
+  std::atomic<int> destroyed(0);
+  auto a = Arc<Counted>(Counted(destroyed));
+  Weak<Counted> w = a.downgrade();
+  std::thread([b = sus::move(a)] {}).join();
+  EXPECT_EQ(destroyed.load(), 1);
+  EXPECT_TRUE(w.upgrade().is_none());
+}
+
+TEST(Arc, UpgradeAcrossThreads) {
+  auto a = Arc<i32>(7);
+  auto threads = sus::Vec<std::thread>();
+  for (usize i; i < 4u; i += 1u) {
+    threads.push(std::thread([w = a.downgrade()] {
+      for (usize j; j < 10000u; j += 1u) EXPECT_EQ(*w.upgrade().unwrap(), 7);
+    }));
+  }
+  for (std::thread& t : threads.iter_mut()) t.join();
+  EXPECT_EQ(a.strong_count(), 1u);
+  EXPECT_EQ(a.weak_count(), 0u);
+}
+
+TEST(Arc, MakeMut) {
+  auto a = Arc<i32>(1);
+  auto b = a.clone();
+  a.make_mut() = 2;
+  EXPECT_EQ(*a, 2);
+  EXPECT_EQ(*b, 1);
+  EXPECT_TRUE(a.get_mut().is_some());
+}
+
+TEST(Arc, MakeMutWithWeak) {
+  auto a = Arc<i32>(1);
+  auto w = a.downgrade();
+  EXPECT_TRUE(a.get_mut().is_none());
+  a.make_mut() = 2;
+  EXPECT_EQ(*a, 2);
+  EXPECT_TRUE(a.get_mut().is_some());
+  // The old value was released by the only strong reference to it.
+  EXPECT_TRUE(w.upgrade().is_none());
+}
+
+TEST(Arc, GetMutRacesDowngrade) {
+  // Another thread makes a weak reference from its strong reference, and then
+  // releases the strong one. The strong count then drops to one, but the value
+  // is still reachable through the weak reference, so it is never unique.
+  for (usize i; i < 100u; i += 1u) {
+    auto a = Arc<i32>(1);
+    std::atomic<bool> released = false;
+    std::atomic<bool> done = false;
+    auto t = std::thread([b = a.clone(), &released, &done]() mutable {
+      auto w = b.downgrade();
+      { [[maybe_unused]] auto drop = sus::move(b); }
+      released.store(true, std::memory_order_release);
+      while (!done.load(std::memory_order_acquire)) std::this_thread::yield();
+    });
+    while (!released.load(std::memory_order_acquire)) {
+      EXPECT_TRUE(a.get_mut().is_none());
+      std::this_thread::yield();
+    }
+    EXPECT_TRUE(a.get_mut().is_none());
+    done.store(true, std::memory_order_release);
+    t.join();
+  }
+}
+
+TEST(Arc, Slice) {
+  auto s = Arc<sus::Slice<i32>>::from(sus::Vec<i32>(1, 2, 3));
+  auto t = std::thread([s = s.clone()] { EXPECT_EQ((*s)[1u], 2); });
+  t.join();
+  EXPECT_EQ(s->len(), 3u);
+  EXPECT_EQ(s.strong_count(), 1u);
+}
+
+TEST(ArcDeathTest, UseAfterMove) {
+  auto a = Arc<i32>(1);
+  auto b = sus::move(a);
+#if GTEST_HAS_DEATH_TEST
+  EXPECT_DEATH(
+      {
+        auto i = *a;
+        ensure_use(&i);
+      },
+      "Arc used after move");
+#endif
+}
+
+}  // namespace
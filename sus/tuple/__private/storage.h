@@ -27,22 +27,19 @@
 
 namespace sus::tuple_type::__private {
 
-// TODO: Consider having TupleStorage inherit from each type (if it's final then
-// it has to compose it), or just inherit from N things that each hold a T, as
-// libc++ does for std::tuple, using `:public Holds<Index..., T...>`. Then to
-// get from the Storage to the base class you can static_cast the Storage
-// pointer to it.
-template <class... T>
-struct TupleStorage;
-
-template <class T>
-struct TupleStorage<T> {
-  TupleStorage()
+/// Holds the element at index `I` of a Tuple, which has type `T`.
+///
+/// The TupleStorage inherits from one TupleLeaf for each element, so that the
+/// leaf for an index can be found from the storage in a single step through
+/// template argument deduction, instead of walking a chain of base classes.
+template <size_t I, class T>
+struct TupleLeaf {
+  TupleLeaf()
     requires(std::is_trivially_default_constructible_v<T>)
   = default;
 
   template <class U>
-  constexpr inline explicit TupleStorage(U&& value)
+  constexpr inline explicit TupleLeaf(U&& value)
       : value(::sus::forward<U>(value)) {}
 
   inline constexpr const T& at() const& noexcept { return value; }
@@ -53,9 +50,9 @@ struct TupleStorage<T> {
   [[_sus_no_unique_address]] T value;
 };
 
-template <class T>
-struct TupleStorage<T&> {
-  constexpr inline explicit TupleStorage(T& value)
+template <size_t I, class T>
+struct TupleLeaf<I, T&> {
+  constexpr inline explicit TupleLeaf(T& value)
       : value(::sus::mem::addressof(value)) {}
 
   inline constexpr const T& at() const& noexcept { return *value; }
@@ -66,78 +63,127 @@ struct TupleStorage<T&> {
   T* _sus_nonnull_var value;
 };
 
-template <class T, class... Ts>
-  requires(sizeof...(Ts) > 0)
-struct TupleStorage<T, Ts...> : TupleStorage<Ts...> {
-  using Super = TupleStorage<Ts...>;
+/// Looks up the type at index `I` in a pack without recursing through the
+/// pack.
+template <size_t I, class T>
+struct TypeLeaf {};
 
-  TupleStorage()
-    requires(std::is_trivially_default_constructible_v<T>)
-  = default;
+template <class Is, class... Ts>
+struct TypeLeaves;
 
-  template <class U, class... Us>
-  constexpr inline TupleStorage(U&& value, Us&&... more) noexcept
-      : Super(::sus::forward<Us>(more)...), value(::sus::forward<U>(value)) {}
+template <size_t... Is, class... Ts>
+struct TypeLeaves<std::index_sequence<Is...>, Ts...> : TypeLeaf<Is, Ts>... {};
 
-  inline constexpr const T& at() const& noexcept { return value; }
-  inline constexpr T& at_mut() & noexcept { return value; }
-  inline constexpr T&& into_inner() && noexcept { return ::sus::move(value); }
+template <size_t I, class T>
+std::type_identity<T> type_at(const TypeLeaf<I, T>&);
 
- private:
-  [[_sus_no_unique_address]] T value;
+template <size_t I, class... Ts>
+using TypeAt = typename decltype(type_at<I>(
+    std::declval<TypeLeaves<std::index_sequence_for<Ts...>, Ts...>>()))::type;
+
+template <size_t N>
+struct LayoutOrder {
+  size_t index[N];
 };
 
-template <class T, class... Ts>
-  requires(sizeof...(Ts) > 0)
-struct TupleStorage<T&, Ts...> : TupleStorage<Ts...> {
-  using Super = TupleStorage<Ts...>;
+/// Returns the order in which elements with the given alignments are laid out
+/// in memory, as indices into the declaration order.
+///
+/// Elements are sorted by decreasing alignment, so that padding is only needed
+/// at the end of the Tuple, where it can be reused as tail padding. Elements
+/// with the same alignment are stored in reverse of their declaration order.
+template <size_t... Aligns>
+consteval LayoutOrder<sizeof...(Aligns)> layout_order() noexcept {
+  constexpr size_t N = sizeof...(Aligns);
+  const size_t aligns[] = {Aligns...};
+  LayoutOrder<N> order = {};
+  for (size_t i = 0u; i < N; ++i) order.index[i] = N - 1u - i;
+  // A stable insertion sort, as `std::stable_sort` is not constexpr.
+  for (size_t i = 1u; i < N; ++i) {
+    const size_t x = order.index[i];
+    size_t j = i;
+    for (; j > 0u && aligns[order.index[j - 1u]] < aligns[x]; --j)
+      order.index[j] = order.index[j - 1u];
+    order.index[j] = x;
+  }
+  return order;
+}
 
-  template <class... Us>
-  constexpr inline TupleStorage(T& value, Us&&... more) noexcept
-      : Super(::sus::forward<Us>(more)...),
-        value(::sus::mem::addressof(value)) {}
+template <class Is, class... Ts>
+struct LayoutSequenceHelper;
 
-  inline constexpr const T& at() const& noexcept { return *value; }
-  inline constexpr T& at_mut() & noexcept { return *value; }
-  inline constexpr T& into_inner() && noexcept { return *value; }
+template <size_t... Is, class... Ts>
+struct LayoutSequenceHelper<std::index_sequence<Is...>, Ts...> {
+  static constexpr auto order = layout_order<alignof(TupleLeaf<Is, Ts>)...>();
+  using type = std::index_sequence<order.index[Is]...>;
+};
 
- private:
-  T* value;
+/// The indices of the elements `Ts` in the order they are laid out in memory.
+template <class... Ts>
+using LayoutSequence =
+    LayoutSequenceHelper<std::index_sequence_for<Ts...>, Ts...>::type;
+
+/// References to the arguments of a TupleStorage constructor, which can be
+/// looked up by index.
+template <size_t I, class U>
+struct TupleArg {
+  U&& value;
 };
 
-template <size_t I, class S>
-static constexpr const auto& find_tuple_storage(const S& storage) {
-  return find_tuple_storage(storage, std::integral_constant<size_t, I>());
-}
+template <class Is, class... Us>
+struct TupleArgs;
 
-template <size_t I, class S>
-static constexpr const auto& find_tuple_storage(
-    const S& storage, std::integral_constant<size_t, I>) {
-  return find_tuple_storage(static_cast<const S::Super&>(storage),
-                            std::integral_constant<size_t, I - 1>());
-}
+template <size_t... Is, class... Us>
+struct TupleArgs<std::index_sequence<Is...>, Us...> : TupleArg<Is, Us>... {};
 
-template <class S>
-static constexpr const S& find_tuple_storage(
-    const S& storage, std::integral_constant<size_t, 0>) {
-  return storage;
+template <size_t I, class U>
+constexpr inline U&& tuple_arg(const TupleArg<I, U>& arg) noexcept {
+  return ::sus::forward<U>(arg.value);
 }
 
-template <size_t I, class S>
-static constexpr auto& find_tuple_storage_mut(S& storage) {
-  return find_tuple_storage_mut(storage, std::integral_constant<size_t, I>());
-}
+template <class Is, class Ls, class... Ts>
+struct TupleStorageImpl;
+
+/// The storage for the elements `Ts` of a Tuple. The elements are laid out in
+/// memory in the order given by `Ls`, while `Is` is their declaration order.
+template <size_t... Is, size_t... Ls, class... Ts>
+struct TupleStorageImpl<std::index_sequence<Is...>, std::index_sequence<Ls...>,
+                        Ts...> : TupleLeaf<Ls, TypeAt<Ls, Ts...>>... {
+  TupleStorageImpl()
+    requires((... && std::is_trivially_default_constructible_v<Ts>))
+  = default;
 
-template <size_t I, class S>
-static constexpr auto& find_tuple_storage_mut(
-    S& storage, std::integral_constant<size_t, I>) {
-  return find_tuple_storage_mut(static_cast<S::Super&>(storage),
-                                std::integral_constant<size_t, I - 1>());
+  template <class... Us>
+    requires(sizeof...(Us) == sizeof...(Ts))
+  constexpr inline explicit TupleStorageImpl(Us&&... values) noexcept
+      : TupleStorageImpl(
+            ARGS, TupleArgs<std::index_sequence<Is...>, Us...>{
+                      {::sus::forward<Us>(values)}...}) {}
+
+ private:
+  enum ArgsConstructor { ARGS };
+  // Base classes are constructed in the order they are laid out, so each
+  // leaf looks up its own argument.
+  template <class... Us>
+  constexpr inline TupleStorageImpl(
+      ArgsConstructor,
+      TupleArgs<std::index_sequence<Is...>, Us...>&& args) noexcept
+      : TupleLeaf<Ls, TypeAt<Ls, Ts...>>(tuple_arg<Ls>(args))... {}
+};
+
+template <class... Ts>
+using TupleStorage = TupleStorageImpl<std::index_sequence_for<Ts...>,
+                                      LayoutSequence<Ts...>, Ts...>;
+
+template <size_t I, class T>
+static constexpr const TupleLeaf<I, T>& find_tuple_storage(
+    const TupleLeaf<I, T>& storage) {
+  return storage;
 }
 
-template <class S>
-static constexpr S& find_tuple_storage_mut(S& storage,
-                                           std::integral_constant<size_t, 0>) {
+template <size_t I, class T>
+static constexpr TupleLeaf<I, T>& find_tuple_storage_mut(
+    TupleLeaf<I, T>& storage) {
   return storage;
 }
 
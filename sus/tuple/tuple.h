@@ -20,7 +20,6 @@
 
 #include "fmt/core.h"
 #include "sus/assertions/check.h"
-#include "sus/choice/__private/pack_index.h"
 #include "sus/cmp/eq.h"
 #include "sus/cmp/ord.h"
 #include "sus/construct/default.h"
@@ -68,12 +67,21 @@ namespace sus::tuple_type {
 /// work generically over tuple-like objects including `sus::Tuple` and
 /// `std::tuple`.
 ///
+/// # Layout
+/// Elements in a Tuple are laid out in memory sorted by decreasing alignment,
+/// which removes the padding between them that a struct with the same members
+/// in declaration order can have. For example `Tuple<u8, u64, u8, u32>` is 16
+/// bytes, where a struct with those members in that order is 24 bytes. The
+/// order of access through `at<I>()` and `get<I>()` is not affected.
+/// Elements with the same alignment are stored in reverse of the order they are
+/// specified.
+///
 /// # Tail padding
 /// The Tuple's tail padding may be reused when the Tuple is marked as
-/// `[[no_unique_address]]`. The Tuple will have tail padding if the first
-/// type has a size that is not a multiple of the Tuple's alignment. For
-/// example if it's smaller than the alignment, such as `Tuple<u8, u64>` which
-/// has `(alignof(u64) == sizeof(u64)) - sizeof(u8)` or 7 bytes of tail padding.
+/// `[[no_unique_address]]`. The Tuple will have tail padding if the elements
+/// with the smallest alignment do not fill out the Tuple's alignment. For
+/// example `Tuple<u8, u64>` has `(alignof(u64) == sizeof(u64)) - sizeof(u8)`
+/// or 7 bytes of tail padding.
 ///
 /// ```
 /// struct S {
@@ -91,15 +99,9 @@ namespace sus::tuple_type {
 /// your types.
 ///
 /// Additionally types within the tuple may be placed inside the tail padding of
-/// other types in the tuple, should such padding exist.
-///
-/// Generally, but not always, use of tail padding in Tuple is optimized by
-/// ordering types (left-to-right in the template variables) from smallest-to-
-/// largest for simple types such as integers (which have no tail padding
-/// themselves), or in least-to-most tail-padding for more complex types.
-/// Elements in a Tuple are stored internally in reverse of the order they are
-/// specified, which is why the size of the *first* element matters for the
-/// Tuple's externally usable tail padding.
+/// other types in the tuple, should such padding exist. Since elements with the
+/// same alignment are stored in reverse order, use of tail padding is generally
+/// improved by ordering them from least-to-most tail padding.
 template <class T, class... Ts>
 class Tuple final {
  public:
@@ -399,7 +401,7 @@ class Tuple final {
   using Storage = __private::TupleStorage<T, Ts...>;
 
   template <size_t I>
-  using IthType = ::sus::choice_type::__private::PackIth<I, T, Ts...>;
+  using IthType = __private::TypeAt<I, T, Ts...>;
 
   // The use of `[[no_unique_address]]` allows the tail padding of of the
   // `storage_` to be used in structs that request to do so by putting
@@ -24,6 +24,7 @@
 #include "sus/mem/clone.h"
 #include "sus/mem/copy.h"
 #include "sus/mem/move.h"
+#include "sus/mem/relocate.h"
 #include "sus/num/types.h"
 #include "sus/prelude.h"
 #include "sus/test/no_copy_move.h"
@@ -119,6 +120,54 @@ TEST(Tuple, TailPadding) {
   static_assert(sizeof(ExampleFromDocs) == (16 + sus_if_msvc_else(8, 0)));
 }
 
+TEST(Tuple, SortedLayout) {
+  // Elements are laid out by decreasing alignment, so there's no padding
+  // between them, unlike a struct with members in the same order.
+  using Mixed = Tuple<u8, u64, u8, u32>;
+  struct MixedStruct {
+    u8 a;
+    u64 b;
+    u8 c;
+    u32 d;
+  };
+  static_assert(sizeof(Mixed) == 16u);
+  static_assert(sizeof(MixedStruct) == 24u);
+  static_assert(sizeof(Tuple<u8, u64, u8, u64, u8>) == 24u);
+  static_assert(sizeof(Tuple<u16, u8, u32, u8, u16>) == 12u);
+  static_assert(sus::mem::TriviallyRelocatable<Mixed>);
+
+  // The order of the elements is not visible outside the Tuple.
+  static_assert(std::tuple_size_v<Mixed> == 4u);
+  static_assert(std::same_as<std::tuple_element_t<0, Mixed>, u8>);
+  static_assert(std::same_as<std::tuple_element_t<1, Mixed>, u64>);
+  static_assert(std::same_as<std::tuple_element_t<2, Mixed>, u8>);
+  static_assert(std::same_as<std::tuple_element_t<3, Mixed>, u32>);
+  static_assert(Mixed(1_u8, 2_u64, 3_u8, 4_u32).into_inner<3>() == 4_u32);
+
+  auto t = Mixed(1_u8, 2_u64, 3_u8, 4_u32);
+  EXPECT_EQ(t.at<0>(), 1_u8);
+  EXPECT_EQ(t.at<1>(), 2_u64);
+  EXPECT_EQ(t.at<2>(), 3_u8);
+  EXPECT_EQ(t.at<3>(), 4_u32);
+  t.at_mut<2>() = 5_u8;
+  auto [a, b, c, d] = sus::move(t);
+  EXPECT_EQ(a, 1_u8);
+  EXPECT_EQ(b, 2_u64);
+  EXPECT_EQ(c, 5_u8);
+  EXPECT_EQ(d, 4_u32);
+  EXPECT_EQ(Mixed(1_u8, 2_u64, 3_u8, 4_u32),
+            Mixed(1_u8, 2_u64, 3_u8, 4_u32));
+  EXPECT_LT(Mixed(1_u8, 9_u64, 3_u8, 4_u32),
+            Mixed(2_u8, 2_u64, 3_u8, 4_u32));
+
+  // References are stored as pointers, and sorted by their alignment.
+  i32 i = 3;
+  auto r = Tuple<u8, i32&, u16>(1_u8, i, 2_u16);
+  static_assert(sizeof(r) == sizeof(i32*) * 2u);
+  EXPECT_EQ(&r.at<1>(), &i);
+  EXPECT_EQ(r.at<2>(), 2_u16);
+}
+
 static_assert(std::constructible_from<Tuple<i32>, i32>);
 static_assert(std::constructible_from<Tuple<i32>, const i32>);
 static_assert(std::constructible_from<Tuple<i32>, i32&>);